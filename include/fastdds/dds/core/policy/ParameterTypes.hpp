@@ -160,6 +160,7 @@ enum ParameterId_t : uint16_t
     PID_DISABLE_POSITIVE_ACKS               = 0x8005,
     PID_DATASHARING                         = 0x8006,
     PID_NETWORK_CONFIGURATION_SET           = 0x8007,
+    PID_SHM_PAYLOAD_DESCRIPTOR              = 0x8008,
 };
 
 /*!
@@ -1129,6 +1130,49 @@ const char* const parameter_policy_physical_data_process = "fastdds.physical_dat
  */
 const char* const parameter_enable_monitor_service = "fastdds.enable_monitor_service";
 
+/**
+ * Parameter property value for the period, in milliseconds, on which the statistics events of the endpoints are
+ * aggregated and published. When not set, every event is published as soon as it happens.
+ *
+ * @ingroup PARAMETER_MODULE
+ */
+const char* const parameter_statistics_aggregation_period = "fastdds.statistics.aggregation_period";
+
+/**
+ * Parameter property value for the maximum time, in milliseconds, the changes recorded on a BINARY discovery server
+ * backup may wait before being flushed to disk.
+ *
+ * @ingroup PARAMETER_MODULE
+ */
+const char* const parameter_discovery_backup_flush_period = "fastdds.discovery.backup_flush_period";
+
+/**
+ * Parameter property value for the number of threads a discovery server uses to match the endpoints of its
+ * discovery database. Topics are sharded across the threads by the hash of their name.
+ * When not set, or set to 1, the matching is performed on the discovery server thread.
+ *
+ * @ingroup PARAMETER_MODULE
+ */
+const char* const parameter_discovery_processing_threads = "fastdds.discovery.processing_threads";
+
+/**
+ * Parameter property value for the size, in octets, of the shared memory segment where a DataWriter allocates its
+ * payloads. When set, DATA submessages sent only to shared memory locators carry a reference to the payload
+ * instead of a copy of it.
+ *
+ * @ingroup PARAMETER_MODULE
+ */
+const char* const parameter_shm_payload_segment_size = "fastdds.shm.payload_segment_size";
+
+/**
+ * Parameter property value announcing whether a DataReader can map payloads from the shared memory segments of the
+ * DataWriters. Readers announce it on discovery unless it is set to "false" on their properties, and writers only
+ * send payload descriptors to readers announcing it.
+ *
+ * @ingroup PARAMETER_MODULE
+ */
+const char* const parameter_shm_payload_descriptors = "fastdds.shm.payload_descriptors";
+
 /**
  * @ingroup PARAMETER_MODULE
  */
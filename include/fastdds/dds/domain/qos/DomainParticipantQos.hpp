@@ -25,6 +25,7 @@
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 #include <fastdds/rtps/attributes/BuiltinTransports.hpp>
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/attributes/ThreadTopologyPolicy.hpp>
 #include <fastdds/rtps/flowcontrol/FlowControllerDescriptor.hpp>
 #include <fastrtps/fastrtps_dll.h>
 
@@ -89,6 +90,7 @@ public:
 #if HAVE_SECURITY
                (this->security_log_thread_ == b.security_log_thread()) &&
 #endif // if HAVE_SECURITY
+               (this->thread_topology_ == b.thread_topology()) &&
                (this->flow_controllers_ == b.flow_controllers());
     }
 
@@ -464,6 +466,37 @@ public:
 
 #endif // if HAVE_SECURITY
 
+    /**
+     * Getter for the ThreadTopologyPolicy
+     *
+     * @return rtps::ThreadTopologyPolicy reference
+     */
+    rtps::ThreadTopologyPolicy& thread_topology()
+    {
+        return thread_topology_;
+    }
+
+    /**
+     * Getter for the ThreadTopologyPolicy
+     *
+     * @return rtps::ThreadTopologyPolicy reference
+     */
+    const rtps::ThreadTopologyPolicy& thread_topology() const
+    {
+        return thread_topology_;
+    }
+
+    /**
+     * Setter for the ThreadTopologyPolicy
+     *
+     * @param value New ThreadTopologyPolicy to be set
+     */
+    void thread_topology(
+            const rtps::ThreadTopologyPolicy& value)
+    {
+        thread_topology_ = value;
+    }
+
 private:
 
     //!UserData Qos, implemented in the library.
@@ -507,6 +540,9 @@ private:
     rtps::ThreadSettings security_log_thread_;
 #endif // if HAVE_SECURITY
 
+    //! Placement of the threads of the participant on the CPUs of the system
+    rtps::ThreadTopologyPolicy thread_topology_;
+
 };
 
 RTPS_DllAPI extern const DomainParticipantQos PARTICIPANT_QOS_DEFAULT;
@@ -19,6 +19,8 @@
 #ifndef _FASTDDS_DDS_PUBLISHER_DATAWRITER_HPP_
 #define _FASTDDS_DDS_PUBLISHER_DATAWRITER_HPP_
 
+#include <vector>
+
 #include <fastdds/dds/builtin/topic/SubscriptionBuiltinTopicData.hpp>
 #include <fastdds/dds/core/Entity.hpp>
 #include <fastdds/dds/core/status/BaseStatus.hpp>
@@ -166,6 +168,20 @@ public:
             void* data,
             const InstanceHandle_t& handle);
 
+    /**
+     * Write several samples at once.
+     *
+     * The samples are added to the history holding the writer mutex once, and on synchronous DataWriters they are
+     * sent together, so their DATA submessages are grouped on as few RTPS messages as possible.
+     * The instance of each sample is deduced from its key, as when writing it with @c HANDLE_NIL.
+     *
+     * @param samples Pointers to the data of the samples, in the order they should be written.
+     * @return RETCODE_OK if all the samples are written. Otherwise, the code returned when writing the first one
+     * that failed, as the samples after it are not written.
+     */
+    RTPS_DllAPI ReturnCode_t write_batch(
+            const std::vector<void*>& samples);
+
     /**
      * @brief This operation performs the same function as write except that it also provides the value for the
      * @ref eprosima::fastdds::dds::SampleInfo::source_timestamp "source_timestamp" that is made available to DataReader
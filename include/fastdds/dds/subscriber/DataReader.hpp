@@ -35,6 +35,7 @@
 #include <fastdds/dds/core/status/SubscriptionMatchedStatus.hpp>
 #include <fastdds/dds/subscriber/ReadCondition.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleInfoBatch.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 
 #include <fastrtps/fastrtps_dll.h>
@@ -711,6 +712,117 @@ public:
             void* data,
             SampleInfo* info);
 
+    /**
+     * @brief This operation copies a batch of samples of a plain type into a contiguous array provided by the caller,
+     * along with their sample information in a structure of arrays.
+     *
+     * Samples are accessed with the same semantics as the @ref read operation, but they are copied straight from the
+     * received payloads in a single pass, without calling the type support for each sample and without loans.
+     * Only samples serialized with a byte order different from the local one are deserialized by the type support.
+     * Samples without valid data leave their slot in @c data_values untouched.
+     *
+     * This operation is only available for plain types, and fails with RETCODE_ILLEGAL_OPERATION otherwise.
+     *
+     * @param [out] data_values     Contiguous array with room for at least @c max_samples samples.
+     * @param [in]  sample_size     Size in bytes of each element of @c data_values (i.e. sizeof the data type).
+     * @param [in]  max_samples     The maximum number of samples to be returned. Should be positive.
+     * @param [out] sample_infos    Arrays where the information of the returned samples is stored.
+     * @param [out] num_samples     Number of samples returned.
+     * @param [in]  sample_states   Only data samples with @c sample_state matching one of these will be returned.
+     * @param [in]  view_states     Only data samples with @c view_state matching one of these will be returned.
+     * @param [in]  instance_states Only data samples with @c instance_state matching one of these will be returned.
+     *
+     * @return Any of the standard return codes.
+     */
+    RTPS_DllAPI ReturnCode_t read_batch(
+            void* data_values,
+            size_t sample_size,
+            int32_t max_samples,
+            SampleInfoBatch& sample_infos,
+            int32_t& num_samples,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
+    /**
+     * @brief Typed version of @ref read_batch.
+     *
+     * @param [out] data_values     Contiguous array with room for at least @c max_samples samples.
+     * @param [in]  max_samples     The maximum number of samples to be returned. Should be positive.
+     * @param [out] sample_infos    Arrays where the information of the returned samples is stored.
+     * @param [out] num_samples     Number of samples returned.
+     * @param [in]  sample_states   Only data samples with @c sample_state matching one of these will be returned.
+     * @param [in]  view_states     Only data samples with @c view_state matching one of these will be returned.
+     * @param [in]  instance_states Only data samples with @c instance_state matching one of these will be returned.
+     *
+     * @return Any of the standard return codes.
+     */
+    template<typename T>
+    ReturnCode_t read_batch(
+            T* data_values,
+            int32_t max_samples,
+            SampleInfoBatch& sample_infos,
+            int32_t& num_samples,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE)
+    {
+        return read_batch(static_cast<void*>(data_values), sizeof(T), max_samples, sample_infos, num_samples,
+                       sample_states, view_states, instance_states);
+    }
+
+    /**
+     * @brief This operation is analogous to @ref read_batch except for the fact that the samples are ‘removed’ from
+     * the DataReader, with the same semantics as the @ref take operation.
+     *
+     * @param [out] data_values     Contiguous array with room for at least @c max_samples samples.
+     * @param [in]  sample_size     Size in bytes of each element of @c data_values (i.e. sizeof the data type).
+     * @param [in]  max_samples     The maximum number of samples to be returned. Should be positive.
+     * @param [out] sample_infos    Arrays where the information of the returned samples is stored.
+     * @param [out] num_samples     Number of samples returned.
+     * @param [in]  sample_states   Only data samples with @c sample_state matching one of these will be returned.
+     * @param [in]  view_states     Only data samples with @c view_state matching one of these will be returned.
+     * @param [in]  instance_states Only data samples with @c instance_state matching one of these will be returned.
+     *
+     * @return Any of the standard return codes.
+     */
+    RTPS_DllAPI ReturnCode_t take_batch(
+            void* data_values,
+            size_t sample_size,
+            int32_t max_samples,
+            SampleInfoBatch& sample_infos,
+            int32_t& num_samples,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
+    /**
+     * @brief Typed version of @ref take_batch.
+     *
+     * @param [out] data_values     Contiguous array with room for at least @c max_samples samples.
+     * @param [in]  max_samples     The maximum number of samples to be returned. Should be positive.
+     * @param [out] sample_infos    Arrays where the information of the returned samples is stored.
+     * @param [out] num_samples     Number of samples returned.
+     * @param [in]  sample_states   Only data samples with @c sample_state matching one of these will be returned.
+     * @param [in]  view_states     Only data samples with @c view_state matching one of these will be returned.
+     * @param [in]  instance_states Only data samples with @c instance_state matching one of these will be returned.
+     *
+     * @return Any of the standard return codes.
+     */
+    template<typename T>
+    ReturnCode_t take_batch(
+            T* data_values,
+            int32_t max_samples,
+            SampleInfoBatch& sample_infos,
+            int32_t& num_samples,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE)
+    {
+        return take_batch(static_cast<void*>(data_values), sizeof(T), max_samples, sample_infos, num_samples,
+                       sample_states, view_states, instance_states);
+    }
+
     ///@}
 
     /**
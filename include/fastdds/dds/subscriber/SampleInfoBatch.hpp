@@ -0,0 +1,83 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SampleInfoBatch.hpp
+ *
+ */
+
+#ifndef _FASTDDS_DDS_SUBSCRIBER_SAMPLEINFOBATCH_HPP_
+#define _FASTDDS_DDS_SUBSCRIBER_SAMPLEINFOBATCH_HPP_
+
+#include <cstdint>
+
+#include <fastdds/dds/common/InstanceHandle.hpp>
+#include <fastdds/dds/subscriber/InstanceState.hpp>
+#include <fastdds/dds/subscriber/SampleState.hpp>
+#include <fastdds/dds/subscriber/ViewState.hpp>
+
+#include <fastdds/rtps/common/SequenceNumber.h>
+#include <fastdds/rtps/common/Time_t.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+
+/*!
+ * @brief SampleInfoBatch holds the information of the samples returned by a batched read or take operation,
+ * with one caller-provided array per field of @ref SampleInfo (structure of arrays).
+ *
+ * Every non-null array must have room for, at least, the @c max_samples passed to the operation.
+ * Fields whose array is left as nullptr are not filled, and their computation is skipped.
+ * Entry @c i of every array corresponds to the @c i -th sample returned.
+ */
+struct SampleInfoBatch
+{
+    //! whether or not the corresponding data sample has already been read
+    SampleStateKind* sample_states = nullptr;
+
+    //! view state of the instance of the corresponding data sample
+    ViewStateKind* view_states = nullptr;
+
+    //! instance state of the instance of the corresponding data sample
+    InstanceStateKind* instance_states = nullptr;
+
+    //! number of samples related to the same instance that follow in the batch
+    int32_t* sample_ranks = nullptr;
+
+    //! time provided by the DataWriter when the sample was written
+    fastrtps::rtps::Time_t* source_timestamps = nullptr;
+
+    //! time provided by the DataReader when the sample was added to its history
+    fastrtps::rtps::Time_t* reception_timestamps = nullptr;
+
+    //! local handle of the corresponding instance
+    InstanceHandle_t* instance_handles = nullptr;
+
+    //! local handle of the DataWriter that modified the instance
+    InstanceHandle_t* publication_handles = nullptr;
+
+    //! sequence number of the sample on the DataWriter that modified the instance
+    fastrtps::rtps::SequenceNumber_t* sequence_numbers = nullptr;
+
+    //! whether the data sample contains data or is only used to communicate a change in the instance
+    bool* valid_data = nullptr;
+
+};
+
+}  // namespace dds
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif /* _FASTDDS_DDS_SUBSCRIBER_SAMPLEINFOBATCH_HPP_*/
@@ -19,6 +19,8 @@
 #ifndef _FASTDDS_RTPS_RTPSPARTICIPANTALLOCATIONATTRIBUTES_HPP_
 #define _FASTDDS_RTPS_RTPSPARTICIPANTALLOCATIONATTRIBUTES_HPP_
 
+#include <cstdint>
+
 #include <fastdds/rtps/builtin/data/ContentFilterProperty.hpp>
 
 #include <fastrtps/utils/collections/ResourceLimitedContainerConfig.hpp>
@@ -112,6 +114,45 @@ struct VariableLengthDataLimits
     size_t max_datasharing_domains = 0;
 };
 
+/**
+ * @brief Holds the placement of the memory backing preallocated payload pools.
+ *
+ * It applies to the payload pools of DataWriters and DataReaders with PREALLOCATED or PREALLOCATED_WITH_REALLOC
+ * memory policies. With PREALLOCATED_WITH_REALLOC, payloads that grow over their initial size are moved to regular
+ * heap memory. Pools with DYNAMIC memory policies ignore it, logging a warning.
+ */
+struct PayloadPoolsAllocationAttributes
+{
+    bool operator ==(
+            const PayloadPoolsAllocationAttributes& b) const
+    {
+        return (this->use_huge_pages == b.use_huge_pages) &&
+               (this->prefault == b.prefault) &&
+               (this->numa_node == b.numa_node);
+    }
+
+    /** Whether to back preallocated payload pools with huge pages.
+     *
+     * When true, the memory of PREALLOCATED payload pools (including data-sharing segments) is requested
+     * as explicit huge pages (MAP_HUGETLB), falling back to transparent huge pages when the system has no
+     * huge pages reserved. Only supported on Linux; ignored on other platforms.
+     */
+    bool use_huge_pages = false;
+
+    /** Whether to touch every page of preallocated payload pools when they are created.
+     *
+     * This moves the cost of the page faults to the creation of the entities, instead of the first
+     * samples being written or received.
+     */
+    bool prefault = false;
+
+    /** NUMA node where the memory of preallocated payload pools is bound.
+     *
+     * A negative value means no binding. Only supported on Linux; ignored on other platforms.
+     */
+    int32_t numa_node = -1;
+};
+
 /**
  * @brief Holds allocation limits affecting collections managed by a participant.
  */
@@ -131,6 +172,8 @@ struct RTPSParticipantAllocationAttributes
     VariableLengthDataLimits data_limits;
     //! Defines the allocation behavior of content filter discovery information
     fastdds::rtps::ContentFilterProperty::AllocationConfiguration content_filter;
+    //! Defines the placement of the memory backing preallocated payload pools
+    PayloadPoolsAllocationAttributes payload_pools;
 
     //! @return the allocation config for the total of readers in the system (participants * readers)
     ResourceLimitedContainerConfig total_readers() const
@@ -152,7 +195,8 @@ struct RTPSParticipantAllocationAttributes
                (this->readers == b.readers) &&
                (this->writers == b.writers) &&
                (this->send_buffers == b.send_buffers) &&
-               (this->data_limits == b.data_limits);
+               (this->data_limits == b.data_limits) &&
+               (this->payload_pools == b.payload_pools);
     }
 
 private:
@@ -28,6 +28,7 @@
 #include <fastdds/rtps/attributes/RTPSParticipantAllocationAttributes.hpp>
 #include <fastdds/rtps/attributes/ServerAttributes.h>
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/attributes/ThreadTopologyPolicy.hpp>
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/PortParameters.h>
 #include <fastdds/rtps/common/Time_t.h>
@@ -137,6 +138,15 @@ typedef enum ParticipantFilteringFlags : uint32_t
     FILTER_SAME_PROCESS = 0x4
 } ParticipantFilteringFlags_t;
 
+//! Format of the files where a BACKUP discovery server persists its discovery database
+enum class DiscoveryBackupFormat : uint8_t
+{
+    //! Binary records, synced to disk in batches from a dedicated thread and restored through a memory map
+    BINARY,
+    //! Json documents, as written by previous versions
+    JSON
+};
+
 #define BUILTIN_DATA_MAX_SIZE 512
 
 //! PDP factory for EXTERNAL type
@@ -281,6 +291,12 @@ public:
     //! Filtering participants out depending on location
     ParticipantFilteringFlags_t ignoreParticipantFlags = ParticipantFilteringFlags::NO_FILTER;
 
+    /**
+     * Format of the discovery database backup, only used if discoveryProtocol=BACKUP.
+     * A BINARY server with no binary backup restores the JSON one, so servers can be upgraded keeping their backups.
+     */
+    DiscoveryBackupFormat backup_format = DiscoveryBackupFormat::BINARY;
+
     DiscoverySettings() = default;
 
     bool operator ==(
@@ -297,7 +313,8 @@ public:
                (this->m_simpleEDP == b.m_simpleEDP) &&
                (this->static_edp_xml_config_ == b.static_edp_xml_config_) &&
                (this->m_DiscoveryServers == b.m_DiscoveryServers) &&
-               (this->ignoreParticipantFlags == b.ignoreParticipantFlags);
+               (this->ignoreParticipantFlags == b.ignoreParticipantFlags) &&
+               (this->backup_format == b.backup_format);
     }
 
     /**
@@ -482,7 +499,8 @@ public:
                (this->security_log_thread == b.security_log_thread) &&
 #endif // if HAVE_SECURITY
                (this->discovery_server_thread == b.discovery_server_thread) &&
-               (this->builtin_transports_reception_threads == b.builtin_transports_reception_threads);
+               (this->builtin_transports_reception_threads == b.builtin_transports_reception_threads) &&
+               (this->thread_topology == b.thread_topology);
 
     }
 
@@ -595,6 +613,9 @@ public:
     //! Thread settings for the builtin transports reception threads
     fastdds::rtps::ThreadSettings builtin_transports_reception_threads;
 
+    //! Placement of the threads of the participant on the CPUs of the system
+    fastdds::rtps::ThreadTopologyPolicy thread_topology;
+
 #if HAVE_SECURITY
     //! Thread settings for the security log thread
     fastdds::rtps::ThreadSettings security_log_thread;
@@ -0,0 +1,91 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadTopologyPolicy.hpp
+ */
+
+#ifndef _FASTDDS_THREADTOPOLOGYPOLICY_HPP_
+#define _FASTDDS_THREADTOPOLOGYPOLICY_HPP_
+
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Struct ThreadTopologyPolicy to place all the internal threads of a participant on the CPUs of the system.
+ *
+ * The affinity of every thread of the participant (timed events, reception, flow controllers, discovery server,
+ * security log, data-sharing listeners and TCP accept and keep alive threads) whose ThreadSettings do not
+ * specify one is computed from this policy. Affinities explicitly configured are always kept.
+ * Only CPUs with index below 64 can be used, as affinities are bit masks.
+ * @ingroup RTPS_ATTRIBUTES_MODULE
+ */
+struct ThreadTopologyPolicy
+{
+    /**
+     * @brief NUMA node where the threads of the participant run.
+     *
+     * When set, threads are restricted to the CPUs of the node, and the preallocated payload pools of the participant
+     * are bound to it unless the payload pools allocation attributes select another node.
+     * A negative value means all the CPUs of the system are used. Only supported on Linux.
+     */
+    int32_t numa_node = -1;
+
+    /**
+     * @brief Reserve some CPUs to the reception threads.
+     *
+     * When true, the CPUs used by the participant are split in two halves. Reception threads (transport reception
+     * threads and data-sharing listeners) run on the second one, and the rest of threads on the first one.
+     */
+    bool isolate_receive_cores = false;
+
+    /**
+     * @brief Pin each reception thread to a single CPU.
+     *
+     * When true, each port listened by the participant, and each data-sharing listener, is assigned a different CPU
+     * of the ones used for reception, in a round robin fashion, instead of letting all of them run on any of those
+     * CPUs.
+     */
+    bool auto_spread = false;
+
+    //! @return whether the policy leaves the placement of the threads to the system.
+    bool is_default() const
+    {
+        return numa_node < 0 && !isolate_receive_cores && !auto_spread;
+    }
+
+    bool operator ==(
+            const ThreadTopologyPolicy& rhs) const
+    {
+        return (numa_node == rhs.numa_node &&
+               isolate_receive_cores == rhs.isolate_receive_cores &&
+               auto_spread == rhs.auto_spread);
+    }
+
+    bool operator !=(
+            const ThreadTopologyPolicy& rhs) const
+    {
+        return !(*this == rhs);
+    }
+
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif /* _FASTDDS_THREADTOPOLOGYPOLICY_HPP_ */
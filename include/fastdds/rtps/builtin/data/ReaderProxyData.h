@@ -408,6 +408,19 @@ public:
         return fastdds::dds::get_proxy_property<SampleIdentity>("PID_CLIENT_SERVER_KEY", m_properties);
     }
 
+    /**
+     * Set whether the reader accepts descriptors of payloads allocated on shared memory segments.
+     * @param accepted Whether the descriptors are accepted.
+     */
+    RTPS_DllAPI void shm_payload_descriptors(
+            bool accepted);
+
+    /**
+     * Check whether the reader accepts descriptors of payloads allocated on shared memory segments.
+     * @return true when the reader announced it accepts them.
+     */
+    RTPS_DllAPI bool shm_payload_descriptors() const;
+
     /**
      * Get the size in bytes of the CDR serialization of this object.
      * @param include_encapsulation Whether to include the size of the encapsulation info.
@@ -26,6 +26,7 @@
 #include <fastrtps/utils/IPLocator.h>
 
 #include <algorithm>
+#include <vector>
 
 namespace eprosima {
 namespace fastrtps {
@@ -49,6 +50,10 @@ namespace rtps {
  *           - transport handles the selection state of each entry
  *           - select may be called
  *       - Submessage is added to the message group
+ *
+ * The selection computed for each enabling state is cached, so selecting again for the same enabled entries does
+ * not involve the transports. Cached selections are discarded when entries are added or removed, and should be
+ * discarded with clear_cached_selections when the locators of the entries change.
  */
 class LocatorSelector
 {
@@ -75,6 +80,7 @@ public:
         entries_.clear();
         selections_.clear();
         last_state_.clear();
+        clear_cached_selections();
     }
 
     /**
@@ -85,6 +91,7 @@ public:
     bool add_entry(
             LocatorSelectorEntry* entry)
     {
+        clear_cached_selections();
         return entries_.push_back(entry) != nullptr;
     }
 
@@ -95,6 +102,7 @@ public:
     bool remove_entry(
             const GUID_t& guid)
     {
+        clear_cached_selections();
         return entries_.remove_if(
             [&guid](LocatorSelectorEntry* entry)
             {
@@ -171,6 +179,90 @@ public:
         }
     }
 
+    /**
+     * Restore the selection cached for the current enabling state.
+     *
+     * When this returns false, the selection should be computed as usual and then cached with store_selection.
+     *
+     * @return true if the selection was restored, false if there is no cached selection for the current state.
+     */
+    bool restore_selection()
+    {
+        for (const CachedSelection& cached : cached_selections_)
+        {
+            if (cached.enabled.size() != entries_.size() ||
+                    !std::equal(cached.enabled.begin(), cached.enabled.end(), entries_.begin(),
+                    [](bool enabled, const LocatorSelectorEntry* entry)
+                    {
+                        return enabled == entry->enabled;
+                    }))
+            {
+                continue;
+            }
+
+            selection_start();
+            auto locator_index = cached.locators.begin();
+            for (size_t index : cached.selections)
+            {
+                LocatorSelectorEntry* entry = entries_.at(index);
+                for (size_t n = *locator_index++; n > 0; --n)
+                {
+                    entry->state.multicast.push_back(*locator_index++);
+                }
+                for (size_t n = *locator_index++; n > 0; --n)
+                {
+                    entry->state.unicast.push_back(*locator_index++);
+                }
+                selections_.push_back(index);
+            }
+            return true;
+        }
+
+        return false;
+    }
+
+    /**
+     * Cache the current selection, so it can be restored when the same entries are enabled again.
+     */
+    void store_selection()
+    {
+        if (cached_selections_.size() < max_cached_selections)
+        {
+            cached_selections_.emplace_back();
+            next_cached_selection_ = cached_selections_.size() - 1;
+        }
+        CachedSelection& cached = cached_selections_[next_cached_selection_];
+        next_cached_selection_ = (next_cached_selection_ + 1) % max_cached_selections;
+
+        cached.enabled.clear();
+        for (const LocatorSelectorEntry* entry : entries_)
+        {
+            cached.enabled.push_back(entry->enabled);
+        }
+        cached.selections.assign(selections_.begin(), selections_.end());
+        cached.locators.clear();
+        for (size_t index : selections_)
+        {
+            const LocatorSelectorEntry* entry = entries_.at(index);
+            cached.locators.push_back(entry->state.multicast.size());
+            cached.locators.insert(cached.locators.end(), entry->state.multicast.begin(),
+                    entry->state.multicast.end());
+            cached.locators.push_back(entry->state.unicast.size());
+            cached.locators.insert(cached.locators.end(), entry->state.unicast.begin(), entry->state.unicast.end());
+        }
+    }
+
+    /**
+     * Discard the cached selections.
+     *
+     * Should be called whenever the locators of the entries change.
+     */
+    void clear_cached_selections()
+    {
+        cached_selections_.clear();
+        next_cached_selection_ = 0;
+    }
+
     /**
      * Called when the selection algorithm starts for a specific transport.
      *
@@ -263,6 +355,28 @@ public:
         return false;
     }
 
+    /**
+     * Check a condition on each entry with selected locators.
+     *
+     * @param pred   Unary predicate that accepts a const LocatorSelectorEntry& as argument.
+     *               This can either be a function pointer or a function object.
+     *
+     * @return true when pred returns true for all the selected entries, false otherwise.
+     */
+    template<class UnaryPredicate>
+    bool all_selected_entries(
+            UnaryPredicate pred) const
+    {
+        for (size_t index : selections_)
+        {
+            if (!pred(*entries_.at(index)))
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /**
      * Performs an action on each selected locator.
      *
@@ -469,6 +583,24 @@ private:
     ResourceLimitedVector<size_t> selections_;
     //! Enabling state when reset was called.
     ResourceLimitedVector<int> last_state_;
+
+    //! Selection computed for an enabling state.
+    struct CachedSelection
+    {
+        //! Enabling state of each entry.
+        std::vector<bool> enabled;
+        //! List of selected indexes.
+        std::vector<size_t> selections;
+        //! For each selected entry, number and indexes of its selected multicast and then unicast locators.
+        std::vector<size_t> locators;
+    };
+
+    //! Maximum number of enabling states whose selection is cached.
+    static constexpr size_t max_cached_selections = 4;
+    //! Cached selections.
+    std::vector<CachedSelection> cached_selections_;
+    //! Position of the cached selection to be replaced next.
+    size_t next_cached_selection_ = 0;
 };
 
 } /* namespace rtps */
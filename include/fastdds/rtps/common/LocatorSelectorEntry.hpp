@@ -77,6 +77,7 @@ struct LocatorSelectorEntry
         , state(max_unicast_locators, max_multicast_locators)
         , enabled(false)
         , transport_should_process(false)
+        , shm_payload_descriptors(false)
     {
     }
 
@@ -112,6 +113,8 @@ struct LocatorSelectorEntry
     bool enabled;
     //! A temporary value for each transport to help optimizing some use cases.
     bool transport_should_process;
+    //! Whether the remote entity accepts descriptors of payloads allocated on shared memory segments.
+    bool shm_payload_descriptors;
 };
 
 } /* namespace rtps */
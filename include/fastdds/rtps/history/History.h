@@ -131,7 +131,7 @@ public:
      * @param ch Pointer to the CacheChange_t to search for.
      * @return an iterator if a suitable change is found
      */
-    RTPS_DllAPI const_iterator find_change_nts(
+    RTPS_DllAPI virtual const_iterator find_change_nts(
             CacheChange_t* ch);
 
     /**
@@ -322,6 +322,19 @@ protected:
     RTPS_DllAPI virtual void do_release_cache(
             CacheChange_t* ch) = 0;
 
+    /**
+     * Look for the change with the given sequence number and writer GUID.
+     * No Thread Safe
+     * The default implementation traverses the whole history. Derived classes that keep the changes sorted or indexed
+     * should override it.
+     * @param seq Sequence number of the change.
+     * @param guid GUID of the writer of the change.
+     * @return Pointer to the change, or nullptr if it is not on the history.
+     */
+    virtual CacheChange_t* lookup_change_nts(
+            const SequenceNumber_t& seq,
+            const GUID_t& guid) const;
+
     /**
      * @brief Removes the constness of a const_iterator to obtain a regular iterator.
      *
@@ -24,6 +24,8 @@
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/dds/core/status/SampleRejectedStatus.hpp>
 
+#include <vector>
+
 namespace eprosima {
 namespace fastrtps {
 namespace rtps {
@@ -240,6 +242,10 @@ protected:
     RTPS_DllAPI void do_release_cache(
             CacheChange_t* ch) override;
 
+    CacheChange_t* lookup_change_nts(
+            const SequenceNumber_t& seq,
+            const GUID_t& guid) const override;
+
     template<typename Pred>
     inline void remove_changes_with_pred(
             Pred pred)
@@ -265,6 +271,14 @@ protected:
     //!Pointer to the reader
     RTPSReader* mp_reader;
 
+    /**
+     * Changes on the history that were not fully assembled when added.
+     * A change being reassembled is looked for on every received fragment, and this avoids traversing the whole
+     * history for it. Entries are pruned once their change is complete, so the capacity reached by the vector is
+     * reused and receiving a sample does not allocate.
+     */
+    std::vector<CacheChange_t*> fragmented_changes_;
+
 };
 
 }  // namespace rtps
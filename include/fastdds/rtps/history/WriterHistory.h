@@ -106,6 +106,16 @@ public:
             const CacheChange_t* inner,
             CacheChange_t* outer) override;
 
+    /**
+     * Find a specific change in the history.
+     * No Thread Safe
+     * Changes are kept sorted by sequence number, so they are looked for with a binary search.
+     * @param ch Pointer to the CacheChange_t to search for.
+     * @return an iterator if a suitable change is found
+     */
+    RTPS_DllAPI const_iterator find_change_nts(
+            CacheChange_t* ch) override;
+
     //! Introduce base class method into scope
     using History::remove_change;
 
@@ -150,6 +160,10 @@ protected:
     RTPS_DllAPI void do_release_cache(
             CacheChange_t* ch) override;
 
+    CacheChange_t* lookup_change_nts(
+            const SequenceNumber_t& seq,
+            const GUID_t& guid) const override;
+
     /**
      * Introduce a change into the history, and let the associated writer send it.
      *
@@ -20,7 +20,10 @@
 #define _FASTDDS_RTPS_MESSAGERECEIVER_H_
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
+#include <atomic>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <unordered_map>
 
 #include <fastdds/rtps/common/all_common.h>
@@ -34,6 +37,7 @@ class RTPSParticipantImpl;
 class Endpoint;
 class RTPSWriter;
 class RTPSReader;
+class IPayloadPool;
 struct SubmessageHeader_t;
 
 /**
@@ -52,6 +56,17 @@ public:
             RTPSParticipantImpl* participant,
             uint32_t rec_buffer_size);
 
+    /**
+     * Creates a receiver for the same participant and associated endpoints than another one.
+     * Each receiver keeps the state of the message it is processing, so this allows processing several messages
+     * received on the same channel at the same time.
+     * @param endpoints_owner Receiver whose participant and associated endpoints are used.
+     * @param rec_buffer_size
+     */
+    MessageReceiver(
+            const MessageReceiver& endpoints_owner,
+            uint32_t rec_buffer_size);
+
     virtual ~MessageReceiver();
 
     /**
@@ -59,11 +74,14 @@ public:
      * @param [in] source_locator Locator indicating the sending address.
      * @param [in] reception_locator Locator indicating the listening address.
      * @param [in] msg Pointer to the message
+     * @param [in] buffer_owner Payload pool owning the buffer of the message, if any. Payloads of the DATA
+     * submessages carried by the message are then assigned to this pool instead of being copied by the readers.
      */
     void processCDRMsg(
             const Locator_t& source_locator,
             const Locator_t& reception_locator,
-            CDRMessage_t* msg);
+            CDRMessage_t* msg,
+            IPayloadPool* buffer_owner = nullptr);
 
     // Functions to associate/remove associatedendpoints
     void associateEndpoint(
@@ -73,9 +91,31 @@ public:
 
 private:
 
-    mutable eprosima::shared_mutex mtx_;
-    std::vector<RTPSWriter*> associated_writers_;
-    std::unordered_map<EntityId_t, std::vector<RTPSReader*>> associated_readers_;
+    //! Endpoints the messages are delivered to. It is never modified, but replaced by a new one (copy on write).
+    struct EndpointTable
+    {
+        std::vector<RTPSWriter*> writers;
+        std::unordered_map<EntityId_t, std::vector<RTPSReader*>> readers;
+    };
+
+    struct AssociatedEndpoints
+    {
+        //! Serializes the updates of the table
+        std::mutex mtx;
+        //! Current table. Only accessed with the atomic functions for shared_ptr.
+        std::shared_ptr<const EndpointTable> table = std::make_shared<const EndpointTable>();
+        //! Incremented when an endpoint is removed. Its parity selects the counter of new messages.
+        std::atomic<uint32_t> epoch{0};
+        //! Messages being processed, counted on the parity of the epoch they started on
+        std::atomic<uint32_t> in_flight[2] = {{0}, {0}};
+    };
+
+    //! Shared with the receivers created from this one
+    std::shared_ptr<AssociatedEndpoints> endpoints_;
+    //! Table taken when the message being processed was received
+    std::shared_ptr<const EndpointTable> current_endpoints_;
+    //! Counter of AssociatedEndpoints::in_flight holding the message being processed
+    std::atomic<uint32_t>* current_in_flight_ = nullptr;
 
     RTPSParticipantImpl* participant_;
     //!Protocol version of the message
@@ -90,6 +130,12 @@ private:
     bool have_timestamp_;
     //!Timestamp associated with the message
     Time_t timestamp_;
+    //!Payload pool owning the buffer of the message, if any
+    IPayloadPool* buffer_owner_ = nullptr;
+    //!Buffer of the message, as received from the transport
+    const octet* received_buffer_ = nullptr;
+    //!Whether the message was received on a shared memory locator
+    bool shm_reception_ = false;
 
 #if HAVE_SECURITY
     //!Buffer to process the decoded RTPS message
@@ -117,6 +163,25 @@ private:
     //!Reset the MessageReceiver to process a new message.
     void reset();
 
+    //! Processes a message with the current endpoints.
+    void process_message(
+            const Locator_t& source_locator,
+            const Locator_t& reception_locator,
+            CDRMessage_t* msg,
+            IPayloadPool* buffer_owner);
+
+    /**
+     * Replaces the table of associated endpoints.
+     * @param previous Table being replaced. Must be the current one.
+     * @param table New table.
+     * @param wait_previous Whether to wait until the messages being processed with the previous table, or any older
+     * one, are done. Required when an endpoint is removed, as it is destroyed afterwards.
+     */
+    void replace_endpoints(
+            std::shared_ptr<const EndpointTable>&& previous,
+            std::shared_ptr<const EndpointTable>&& table,
+            bool wait_previous);
+
     /**
      * Check the RTPSHeader of a received message.
      * @param msg Pointer to the message.
@@ -135,7 +200,7 @@ private:
             SubmessageHeader_t* smh) const;
 
     /**
-     * Find if there is a reader (in associated_readers_) that will accept a msg directed
+     * Find if there is a reader (in associated endpoints) that will accept a msg directed
      * to the given entity ID.
      */
     bool willAReaderAcceptMsgDirectedTo(
@@ -143,7 +208,7 @@ private:
             RTPSReader*& first_reader) const;
 
     /**
-     * Find all readers (in associated_readers_), with the given entity ID, and call the
+     * Find all readers (in associated endpoints), with the given entity ID, and call the
      * callback provided.
      */
     template<typename Functor>
@@ -72,6 +72,17 @@ public:
      */
     virtual const std::vector<GUID_t>& remote_guids() const = 0;
 
+    /**
+     * Check if all the destinations can receive descriptors of payloads allocated on shared memory segments.
+     *
+     * @return true when there is at least one destination locator, all of them are shared memory locators, and all
+     * the destination readers announced they accept the descriptors, false otherwise.
+     */
+    virtual bool destinations_accept_shm_payload_descriptors() const
+    {
+        return false;
+    }
+
     /**
      * Send a message through this interface.
      *
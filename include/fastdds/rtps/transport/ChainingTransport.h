@@ -169,6 +169,16 @@ public:
         return low_level_transport_->is_localhost_allowed();
     }
 
+    /*!
+     * Call the low-level transport `update_general_threads()`.
+     * Updates the settings of the threads of the transport that do not receive on a port.
+     */
+    RTPS_DllAPI void update_general_threads(
+            const std::function<ThreadSettings(const ThreadSettings&)>& update) override
+    {
+        low_level_transport_->update_general_threads(update);
+    }
+
     /*!
      * Call the low-level transport `DoInputLocatorsMatch()`.
      * Must report whether two locators map to the same internal channel.
@@ -39,6 +39,9 @@ constexpr uint8_t s_defaultTTL = 1;
  *
  * - \c TTL: time to live, in number of hops.
  *
+ * - \c receive_buffer_pool_size: number of buffers each reception channel receives into, which can be referenced
+ *   by the received samples instead of copying their payload. 0 (default) receives on a single buffer per channel.
+ *
  * @ingroup RTPS_MODULE
  * */
 struct SocketTransportDescriptor : public PortBasedTransportDescriptor
@@ -51,6 +54,7 @@ struct SocketTransportDescriptor : public PortBasedTransportDescriptor
         , sendBufferSize(0)
         , receiveBufferSize(0)
         , TTL(s_defaultTTL)
+        , receive_buffer_pool_size(0)
     {
     }
 
@@ -78,6 +82,7 @@ struct SocketTransportDescriptor : public PortBasedTransportDescriptor
                this->receiveBufferSize == t.receiveBufferSize &&
                this->interfaceWhiteList == t.interfaceWhiteList &&
                this->TTL == t.TTL &&
+               this->receive_buffer_pool_size == t.receive_buffer_pool_size &&
                PortBasedTransportDescriptor::operator ==(t));
     }
 
@@ -89,6 +94,8 @@ struct SocketTransportDescriptor : public PortBasedTransportDescriptor
     std::vector<std::string> interfaceWhiteList;
     //! Specified time to live (8bit - 255 max TTL)
     uint8_t TTL;
+    //! Number of pooled buffers each reception channel receives into. 0 disables the pool.
+    uint32_t receive_buffer_pool_size;
 };
 
 } // namespace rtps
@@ -53,6 +53,16 @@ namespace rtps {
  *
  * - \c tls_config: Configuration for TLS.
  *
+ * - \c async_send: true to queue the outgoing messages of each connection and write them asynchronously,
+ * coalescing the queued messages on a single gather write.
+ *
+ * - \c send_queue_max_bytes: maximum number of bytes waiting to be written on each connection when \c async_send
+ * is enabled.
+ *
+ * - \c send_queue_full_policy: what to do with a message that does not fit on the send queue of its connection.
+ *
+ * - \c send_queue_block_timeout_ms: maximum time to wait for room on a full send queue with the BLOCK policy (in ms).
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct TCPTransportDescriptor : public SocketTransportDescriptor
@@ -238,6 +248,20 @@ struct TCPTransportDescriptor : public SocketTransportDescriptor
 
     };
 
+    /**
+     * Policy applied when the send queue of a connection is full.
+     *
+     * - DROP: the message is discarded and the send operation fails.
+     *
+     * - BLOCK: the sender waits for room on the queue up to \c send_queue_block_timeout_ms, and the message is
+     * discarded if there is still no room.
+     */
+    enum SendQueueFullPolicy : uint8_t
+    {
+        DROP,
+        BLOCK
+    };
+
     //! List of ports to listen as server
     std::vector<uint16_t> listening_ports;
     //! Frequency of RTCP keep alive requests (ms)
@@ -270,6 +294,15 @@ struct TCPTransportDescriptor : public SocketTransportDescriptor
     //! Configuration of the TLS (Transport Layer Security)
     TLSConfig tls_config;
 
+    //! Whether the messages are queued and written asynchronously on each connection
+    bool async_send;
+    //! Maximum number of bytes waiting to be written on each connection
+    uint32_t send_queue_max_bytes;
+    //! What to do with a message that does not fit on the send queue
+    SendQueueFullPolicy send_queue_full_policy;
+    //! Maximum time to wait for room on a full send queue with the BLOCK policy (ms)
+    uint32_t send_queue_block_timeout_ms;
+
     //! Thread settings for keep alive thread
     ThreadSettings keep_alive_thread;
 
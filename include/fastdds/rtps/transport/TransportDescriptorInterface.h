@@ -92,6 +92,17 @@ struct TransportDescriptorInterface
                this->maxInitialPeersRange == t.max_initial_peers_range());
     }
 
+    /**
+     * Whether this descriptor configures a transport the same way as the given one, so a transport created from one
+     * of them can be used in place of a transport created from the other.
+     * Descriptors not overriding it are only equivalent to themselves.
+     */
+    virtual RTPS_DllAPI bool is_equivalent(
+            const TransportDescriptorInterface& t) const
+    {
+        return this == &t;
+    }
+
     //! Maximum size of a single message in the transport
     uint32_t maxMessageSize;
 
@@ -15,10 +15,12 @@
 #ifndef _FASTDDS_TRANSPORT_INTERFACE_H
 #define _FASTDDS_TRANSPORT_INTERFACE_H
 
+#include <functional>
 #include <memory>
 #include <vector>
 
 #include <fastdds/rtps/attributes/PropertyPolicy.h>
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/LocatorSelector.hpp>
 #include <fastdds/rtps/common/PortParameters.h>
@@ -276,6 +278,18 @@ public:
         return true;
     }
 
+    /**
+     * Updates the settings of the threads of the transport that do not receive on a port.
+     * Called before the transport is initialized.
+     *
+     * @param update Function returning the new settings of a thread from its current ones.
+     */
+    virtual void update_general_threads(
+            const std::function<ThreadSettings(const ThreadSettings&)>& update)
+    {
+        static_cast<void>(update);
+    }
+
 protected:
 
     TransportInterface(
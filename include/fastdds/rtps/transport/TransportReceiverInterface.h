@@ -18,6 +18,14 @@
 #include <fastdds/rtps/common/Locator.h>
 
 namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class IPayloadPool;
+
+} // namespace rtps
+} // namespace fastrtps
+
 namespace fastdds {
 namespace rtps {
 
@@ -44,6 +52,27 @@ public:
             const uint32_t size,
             const Locator& local_locator,
             const Locator& remote_locator) = 0;
+
+    /**
+     * Method to be called by the transport when receiving data on a buffer managed by a payload pool.
+     * Payloads carried by the message may then be referenced by the received samples instead of copied.
+     * Receivers that do not support it process the message as if it was received on a transport owned buffer.
+     * @param data Pointer to the received data.
+     * @param size Number of bytes received.
+     * @param local_locator Locator identifying the local endpoint.
+     * @param remote_locator Locator identifying the remote endpoint.
+     * @param buffer_owner Payload pool owning the buffer where the data was received.
+     */
+    virtual void OnDataReceived(
+            const fastrtps::rtps::octet* data,
+            const uint32_t size,
+            const Locator& local_locator,
+            const Locator& remote_locator,
+            fastrtps::rtps::IPayloadPool* buffer_owner)
+    {
+        static_cast<void>(buffer_owner);
+        OnDataReceived(data, size, local_locator, remote_locator);
+    }
 };
 
 } // namespace rtps
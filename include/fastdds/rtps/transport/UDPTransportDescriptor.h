@@ -31,6 +31,9 @@ namespace rtps {
  * immediately if the buffer is full, but no error will be returned to the upper layer. This means that the
  * application will behave as if the datagram is sent and lost.
  *
+ * - \c unicast_sockets_per_port: number of sockets opened on each unicast input port, each one listened by its own
+ * thread.
+ *
  * @ingroup TRANSPORT_MODULE
  */
 struct UDPTransportDescriptor : public SocketTransportDescriptor
@@ -68,6 +71,21 @@ struct UDPTransportDescriptor : public SocketTransportDescriptor
      * datagram. This may hinder performance on high-frequency writers.
      */
     bool non_blocking_send = false;
+
+    /**
+     * Number of sockets opened on each unicast input port.
+     *
+     * When greater than 1, the sockets are opened with SO_REUSEPORT, and each one is listened by its own thread.
+     * The kernel distributes the incoming datagrams between them by their source, so the datagrams of a remote
+     * participant are always received in order by the same thread.
+     * When the reception threads of the port are configured with an affinity of several CPUs, each thread is pinned
+     * to one of them in turn.
+     * Opening the port fails when it is already used by another socket or by the group of another transport, as
+     * with a single socket.
+     *
+     * Only supported on Linux. On other platforms a single socket is always opened.
+     */
+    uint32_t unicast_sockets_per_port = 1;
 };
 
 } // namespace rtps
@@ -47,6 +47,9 @@ struct UDPv4TransportDescriptor : public UDPTransportDescriptor
 
     RTPS_DllAPI bool operator ==(
             const UDPv4TransportDescriptor& t) const;
+
+    RTPS_DllAPI bool is_equivalent(
+            const TransportDescriptorInterface& t) const override;
 };
 
 } // namespace rtps
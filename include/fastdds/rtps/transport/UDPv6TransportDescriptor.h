@@ -49,6 +49,9 @@ struct UDPv6TransportDescriptor : public UDPTransportDescriptor
 
     RTPS_DllAPI bool operator ==(
             const UDPv6TransportDescriptor& t) const;
+
+    RTPS_DllAPI bool is_equivalent(
+            const TransportDescriptorInterface& t) const override;
 };
 
 } // namespace rtps
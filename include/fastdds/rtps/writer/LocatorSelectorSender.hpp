@@ -66,6 +66,14 @@ public:
         return all_remote_readers;
     }
 
+    /*!
+     * Check if all the selected destinations can receive descriptors of payloads allocated on shared memory segments.
+     *
+     * @return true when there is at least one selected locator, all of them are shared memory locators, and all the
+     * selected readers accept the descriptors.
+     */
+    bool destinations_accept_shm_payload_descriptors() const override;
+
     /*!
      * Send a message through this interface.
      *
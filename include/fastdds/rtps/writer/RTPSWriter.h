@@ -520,6 +520,21 @@ public:
             const LocatorSelectorSender& locator_selector,
             std::chrono::steady_clock::time_point& max_blocking_time_point) const;
 
+    /**
+     * Starts keeping the new changes, instead of passing them to the flow controller, until end_batch() is called.
+     * Only has effect on synchronous writers, as the asynchronous ones already send the pending changes together.
+     * @note The writer mutex should be kept locked until end_batch() is called.
+     */
+    void begin_batch();
+
+    /**
+     * Sends the changes added since begin_batch() together, on as few RTPS messages as possible.
+     * Changes that could not be delivered are passed to the flow controller.
+     * @param max_blocking_time Future timepoint where blocking send should end.
+     */
+    void end_batch(
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
 protected:
 
     //!Is the data sent directly or announced by HB and THEN sent to the ones who ask for it?.
@@ -536,6 +551,10 @@ protected:
     bool is_async_ = false;
     //!Separate sending activated
     bool m_separateSendingEnabled = false;
+    //! Whether the new changes are being kept until the end of a batch
+    bool batching_ = false;
+    //! New changes kept until the end of the batch. Removed changes are set to nullptr.
+    std::vector<CacheChange_t*> batched_changes_;
 
     //! The liveliness kind of this writer
     LivelinessQosPolicyKind liveliness_kind_;
@@ -563,6 +582,20 @@ protected:
             CacheChange_t* change,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time) = 0;
 
+    /**
+     * Pass a new change to the flow controller, or keep it when a batch is being written.
+     * After this call the change pointer cannot be used, as the flow controller may remove it before returning.
+     * @param change Pointer to the new change.
+     * @param[in] max_blocking_time Maximum time this method has to complete the task.
+     */
+    void add_new_sample_nts(
+            CacheChange_t* change,
+            const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
+
+    //! Forget a change removed from the history while being kept on the current batch.
+    void remove_batched_change_nts(
+            CacheChange_t* change);
+
     /**
      * Indicate the writer that a change has been removed by the history due to some HistoryQos requirement.
      * @param a_change Pointer to the change that is going to be removed.
@@ -181,6 +181,22 @@ public:
         return guid_as_vector_;
     }
 
+    /**
+     * Set whether the remote reader accepts descriptors of payloads allocated on shared memory segments.
+     *
+     * @param accepted  Whether the remote reader announced it accepts the descriptors.
+     */
+    void shm_payload_descriptors(
+            bool accepted);
+
+    /**
+     * Check if the remote reader can receive descriptors of payloads allocated on shared memory segments.
+     *
+     * @return true when the reader is remote, it accepts the descriptors, it has locators, and all of them are
+     * shared memory locators.
+     */
+    bool destinations_accept_shm_payload_descriptors() const override;
+
     /**
      * Send a message through this interface.
      *
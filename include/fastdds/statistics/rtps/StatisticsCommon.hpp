@@ -47,6 +47,9 @@ namespace statistics {
 // Members are private details
 struct StatisticsAncillary;
 
+// Periodic publisher of aggregated events
+class StatisticsAggregator;
+
 class StatisticsListenersImpl
 {
     std::unique_ptr<StatisticsAncillary> members_;
@@ -109,6 +112,22 @@ protected:
     bool are_statistics_writers_enabled(
             uint32_t checked_enabled_writers);
 
+    /**
+     * @brief Switch to aggregated mode: the counting events are only recorded, and the aggregator
+     * periodically publishes them to the listeners.
+     *
+     * @param aggregator The aggregator publishing the events of this entity
+     */
+    void set_statistics_aggregator_impl(
+            std::shared_ptr<StatisticsAggregator> aggregator);
+
+    /**
+     * @brief Check whether the counting events are published by an aggregator
+     *
+     * @return True if the events are aggregated, false if they are published immediately
+     */
+    bool is_statistics_aggregated() const;
+
     /**
      * Lambda function to traverse the listener collection
      * @param f function object to apply to each listener
@@ -0,0 +1,414 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TYPES_FLAT_DYNAMIC_DATA_H
+#define TYPES_FLAT_DYNAMIC_DATA_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastrtps/types/TypesBase.h>
+#include <fastrtps/types/DynamicTypePtr.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+/**
+ * Storage layout of the samples of a DynamicType, computed once per type and shared by all the FlatDynamicData
+ * objects of that type.
+ *
+ * Every value has a fixed-size slot at a precomputed offset: primitives and enumerations are stored as their native
+ * type, structures and arrays are laid out inline, and strings and sequences are stored as a span (offset and length)
+ * pointing to the variable-size tail of the same buffer.
+ *
+ * Only structures, arrays, sequences, strings, enumerations, aliases and primitive types are supported.
+ */
+class FlatDynamicLayout
+{
+public:
+
+    struct Node;
+
+    //! Member of a structure
+    struct Member
+    {
+        //! Id of the member on the DynamicType
+        MemberId id;
+        //! Name of the member on the DynamicType
+        std::string name;
+        //! Offset of the member from the beginning of the structure
+        uint32_t offset;
+        //! Whether the member is serialized
+        bool serialized;
+        //! Layout of the member
+        const Node* node;
+    };
+
+    //! Layout of a value
+    struct Node
+    {
+        //! Kind of the value, with aliases resolved
+        TypeKind kind;
+        //! Size of the slot of the value, padded to its alignment
+        uint32_t size;
+        //! Alignment of the slot of the value
+        uint32_t alignment;
+        //! Maximum length of strings and sequences (BOUND_UNLIMITED when not bounded), number of elements of arrays
+        uint32_t bound;
+        //! Whether the value has no string or sequence, i.e. it is fully stored on its slot
+        bool is_plain;
+        //! Minimum number of bytes of the value on the CDR representation, without padding
+        uint32_t min_serialized_size;
+        //! Element of arrays and sequences
+        const Node* element;
+        //! Members of structures, ordered by id
+        std::vector<Member> members;
+    };
+
+    /**
+     * Compute the layout of a type.
+     * @param type Type of the samples.
+     * @return The layout, or nullptr if the type holds a kind not supported by the flat representation.
+     */
+    RTPS_DllAPI static std::shared_ptr<const FlatDynamicLayout> create(
+            const DynamicType_ptr& type);
+
+    //! Layout of the whole sample
+    RTPS_DllAPI const Node* root() const
+    {
+        return root_;
+    }
+
+    //! Type the layout was computed from
+    RTPS_DllAPI const DynamicType_ptr& type() const
+    {
+        return type_;
+    }
+
+    FlatDynamicLayout(
+            const FlatDynamicLayout&) = delete;
+
+    FlatDynamicLayout& operator =(
+            const FlatDynamicLayout&) = delete;
+
+private:
+
+    FlatDynamicLayout() = default;
+
+    const Node* build_node(
+            const DynamicType_ptr& type);
+
+    bool add_members(
+            const DynamicType_ptr& type,
+            Node& node);
+
+    DynamicType_ptr type_;
+    const Node* root_ = nullptr;
+    std::vector<std::unique_ptr<Node>> nodes_;
+};
+
+/**
+ * Sample of a DynamicType stored on a single contiguous buffer.
+ *
+ * Unlike DynamicData, which allocates every member separately and looks them up on maps, all the values of the sample
+ * live on one buffer at the offsets given by a FlatDynamicLayout. Values are accessed through Ref handles, and the
+ * sample is serialized and deserialized in a single linear pass over the layout, producing the same CDR
+ * representation as DynamicData.
+ *
+ * Strings and sequences grow by appending a new region to the tail of the buffer; the space they leave is recovered
+ * when the sample is deserialized or cleared.
+ */
+class FlatDynamicData
+{
+public:
+
+    /**
+     * Handle to a value of the sample: the sample itself, a member of a structure or an element of a collection.
+     * Handles to the elements of a sequence, and to anything inside them, are invalidated when the sequence is
+     * resized or the sample is cleared or deserialized.
+     */
+    class Ref
+    {
+    public:
+
+        Ref() = default;
+
+        //! Whether the handle refers to a value
+        bool is_valid() const
+        {
+            return nullptr != node_;
+        }
+
+        //! Kind of the value
+        TypeKind kind() const
+        {
+            return nullptr != node_ ? node_->kind : TK_NONE;
+        }
+
+    private:
+
+        friend class FlatDynamicData;
+
+        Ref(
+                const FlatDynamicLayout::Node* node,
+                uint32_t offset)
+            : node_(node)
+            , offset_(offset)
+        {
+        }
+
+        const FlatDynamicLayout::Node* node_ = nullptr;
+        uint32_t offset_ = 0;
+    };
+
+    /**
+     * Create an empty sample: numbers are zero, and strings and sequences are empty.
+     * @param layout Layout of the type of the sample.
+     */
+    RTPS_DllAPI explicit FlatDynamicData(
+            std::shared_ptr<const FlatDynamicLayout> layout);
+
+    //! Layout of the sample
+    RTPS_DllAPI const std::shared_ptr<const FlatDynamicLayout>& layout() const
+    {
+        return layout_;
+    }
+
+    //! Handle to the whole sample
+    RTPS_DllAPI Ref root() const
+    {
+        return Ref(layout_->root(), 0);
+    }
+
+    //! Reset the sample to its empty state, recovering the space of strings and sequences.
+    RTPS_DllAPI void clear();
+
+    RTPS_DllAPI ReturnCode_t get_member(
+            Ref& member,
+            const Ref& structure,
+            MemberId id) const;
+
+    RTPS_DllAPI ReturnCode_t get_member_by_name(
+            Ref& member,
+            const Ref& structure,
+            const std::string& name) const;
+
+    RTPS_DllAPI ReturnCode_t get_element(
+            Ref& element,
+            const Ref& collection,
+            uint32_t index) const;
+
+    //! Number of elements of an array or sequence, or number of members of a structure
+    RTPS_DllAPI uint32_t get_item_count(
+            const Ref& ref) const;
+
+    /**
+     * Change the length of a sequence. New elements are empty.
+     * @param sequence Handle to the sequence.
+     * @param length New length.
+     * @return RETCODE_BAD_PARAMETER if the handle is not a sequence or the length exceeds its bound.
+     */
+    RTPS_DllAPI ReturnCode_t resize(
+            const Ref& sequence,
+            uint32_t length);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            bool& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            bool value);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            octet& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            octet value);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            char& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            char value);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            wchar_t& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            wchar_t value);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            int16_t& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            int16_t value);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            uint16_t& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            uint16_t value);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            int32_t& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            int32_t value);
+
+    //! Also used for enumerations
+    RTPS_DllAPI ReturnCode_t get_value(
+            uint32_t& value,
+            const Ref& ref) const;
+
+    //! Also used for enumerations
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            uint32_t value);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            int64_t& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            int64_t value);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            uint64_t& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            uint64_t value);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            float& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            float value);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            double& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            double value);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            long double& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            long double value);
+
+    RTPS_DllAPI ReturnCode_t get_value(
+            std::string& value,
+            const Ref& ref) const;
+
+    RTPS_DllAPI ReturnCode_t set_value(
+            const Ref& ref,
+            const std::string& value);
+
+    //! Size of the CDR representation of the sample
+    RTPS_DllAPI size_t getCdrSerializedSize(
+            size_t current_alignment = 0) const;
+
+    RTPS_DllAPI void serialize(
+            eprosima::fastcdr::Cdr& cdr) const;
+
+    /**
+     * Replace the contents of the sample with a CDR representation.
+     * @param cdr Deserializer positioned at the beginning of the sample.
+     * @return false if the representation is not valid for the type. The sample is left empty in that case.
+     */
+    RTPS_DllAPI bool deserialize(
+            eprosima::fastcdr::Cdr& cdr);
+
+private:
+
+    //! Span of the tail of the buffer used by a string or a sequence
+    struct Span
+    {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    template<typename T>
+    ReturnCode_t get_primitive(
+            T& value,
+            const Ref& ref,
+            TypeKind kind) const;
+
+    template<typename T>
+    ReturnCode_t set_primitive(
+            const Ref& ref,
+            T value,
+            TypeKind kind);
+
+    Span get_span(
+            uint32_t offset) const;
+
+    void set_span(
+            uint32_t offset,
+            const Span& span);
+
+    bool append(
+            uint64_t size,
+            uint32_t alignment,
+            uint32_t& offset);
+
+    size_t serialized_size(
+            const FlatDynamicLayout::Node* node,
+            uint32_t offset,
+            size_t current_alignment) const;
+
+    void serialize(
+            eprosima::fastcdr::Cdr& cdr,
+            const FlatDynamicLayout::Node* node,
+            uint32_t offset) const;
+
+    void deserialize(
+            eprosima::fastcdr::Cdr& cdr,
+            const FlatDynamicLayout::Node* node,
+            uint32_t offset);
+
+    std::shared_ptr<const FlatDynamicLayout> layout_;
+    std::vector<uint8_t> buffer_;
+};
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // TYPES_FLAT_DYNAMIC_DATA_H
@@ -24,6 +24,7 @@
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 #include <fastdds/dds/domain/qos/DomainParticipantFactoryQos.hpp>
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/attributes/ThreadTopologyPolicy.hpp>
 #include <fastdds/rtps/transport/PortBasedTransportDescriptor.hpp>
 #include <fastdds/rtps/transport/SocketTransportDescriptor.h>
 #include <fastrtps/attributes/LibrarySettingsAttributes.h>
@@ -544,6 +545,16 @@ protected:
             rtps::SendBuffersAllocationAttributes& allocation,
             uint8_t ident);
 
+    RTPS_DllAPI static XMLP_ret getXMLPayloadPoolsAllocationAttributes(
+            tinyxml2::XMLElement* elem,
+            rtps::PayloadPoolsAllocationAttributes& allocation,
+            uint8_t ident);
+
+    RTPS_DllAPI static XMLP_ret getXMLThreadTopologyPolicy(
+            tinyxml2::XMLElement* elem,
+            fastdds::rtps::ThreadTopologyPolicy& policy,
+            uint8_t ident);
+
     RTPS_DllAPI static XMLP_ret getXMLDiscoverySettings(
             tinyxml2::XMLElement* elem,
             rtps::DiscoverySettings& settings,
@@ -609,6 +620,11 @@ protected:
             rtps::ParticipantFilteringFlags_t* e,
             uint8_t ident);
 
+    RTPS_DllAPI static XMLP_ret getXMLEnum(
+            tinyxml2::XMLElement* elem,
+            rtps::DiscoveryBackupFormat* e,
+            uint8_t ident);
+
     RTPS_DllAPI static XMLP_ret getXMLRemoteServer(
             tinyxml2::XMLElement* elem,
             eprosima::fastdds::rtps::RemoteServerAttributes& server,
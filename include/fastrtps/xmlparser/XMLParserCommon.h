@@ -59,7 +59,9 @@ extern const char* TCP_WAN_ADDR;
 extern const char* RECEIVE_BUFFER_SIZE;
 extern const char* SEND_BUFFER_SIZE;
 extern const char* TTL;
+extern const char* RECEIVE_BUFFER_POOL_SIZE;
 extern const char* NON_BLOCKING_SEND;
+extern const char* UNICAST_SOCKETS_PER_PORT;
 extern const char* WHITE_LIST;
 extern const char* INTERFACE;
 extern const char* MAX_MESSAGE_SIZE;
@@ -70,6 +72,12 @@ extern const char* MAX_LOGICAL_PORT;
 extern const char* LOGICAL_PORT_RANGE;
 extern const char* LOGICAL_PORT_INCREMENT;
 extern const char* ENABLE_TCP_NODELAY;
+extern const char* ASYNC_SEND;
+extern const char* SEND_QUEUE_MAX_BYTES;
+extern const char* SEND_QUEUE_FULL_POLICY;
+extern const char* SEND_QUEUE_BLOCK_TIMEOUT_MS;
+extern const char* DROP;
+extern const char* BLOCK;
 extern const char* METADATA_LOGICAL_PORT;
 extern const char* LISTENING_PORTS;
 extern const char* CALCULATE_CRC;
@@ -88,6 +96,10 @@ extern const char* DEFAULT_RECEPTION_THREADS;
 extern const char* RECEPTION_THREADS;
 extern const char* RECEPTION_THREAD;
 extern const char* DUMP_THREAD;
+extern const char* LOCK_FREE_SEGMENT_ALLOCATION;
+extern const char* SEGMENT_HUGE_PAGES;
+extern const char* SEGMENT_NUMA_NODE;
+extern const char* LISTENER_SPIN_BUDGET_US;
 extern const char* ON;
 extern const char* AUTO;
 extern const char* THREAD_SETTINGS;
@@ -152,11 +164,18 @@ extern const char* DYNAMIC_LC;
 extern const char* MAX_PROPERTIES;
 extern const char* MAX_USER_DATA;
 extern const char* MAX_PARTITIONS;
+extern const char* PAYLOAD_POOLS;
+extern const char* USE_HUGE_PAGES;
+extern const char* PREFAULT;
+extern const char* NUMA_NODE;
 extern const char* TIMED_EVENTS_THREAD;
 extern const char* DISCOVERY_SERVER_THREAD;
 extern const char* SECURITY_LOG_THREAD;
 extern const char* BUILTIN_TRANSPORTS_RECEPTION_THREADS;
 extern const char* BUILTIN_CONTROLLERS_SENDER_THREAD;
+extern const char* THREAD_TOPOLOGY;
+extern const char* ISOLATE_RECEIVE_CORES;
+extern const char* AUTO_SPREAD;
 
 /// Publisher-subscriber attributes
 extern const char* TOPIC;
@@ -303,6 +322,9 @@ extern const char* IGNORE_PARTICIPANT_FLAGS;
 extern const char* FILTER_DIFFERENT_HOST;
 extern const char* FILTER_DIFFERENT_PROCESS;
 extern const char* FILTER_SAME_PROCESS;
+extern const char* BACKUP_FORMAT;
+extern const char* BINARY;
+extern const char* JSON;
 extern const char* TYPELOOKUP_CONFIG;
 extern const char* TYPELOOKUP_USE_SERVER;
 extern const char* TYPELOOKUP_USE_CLIENT;
@@ -0,0 +1,1135 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <fastrtps/types/FlatDynamicData.h>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <map>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/exceptions/BadParamException.h>
+#include <fastcdr/exceptions/Exception.h>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeMember.h>
+#include <fastrtps/types/MemberDescriptor.h>
+#include <fastrtps/types/TypeDescriptor.h>
+
+#if FASTCDR_VERSION_MAJOR == 1
+#define serialize_array serializeArray
+#define deserialize_array deserializeArray
+#define get_state getState
+#define set_state setState
+#endif // FASTCDR_VERSION_MAJOR == 1
+
+namespace eprosima {
+namespace fastrtps {
+namespace types {
+
+namespace {
+
+constexpr uint32_t span_size = 2 * sizeof(uint32_t);
+
+uint64_t align_to(
+        uint64_t offset,
+        uint32_t alignment)
+{
+    return (offset + alignment - 1) & ~static_cast<uint64_t>(alignment - 1);
+}
+
+bool is_primitive(
+        TypeKind kind)
+{
+    switch (kind)
+    {
+        case TK_BOOLEAN:
+        case TK_BYTE:
+        case TK_CHAR8:
+        case TK_CHAR16:
+        case TK_INT16:
+        case TK_UINT16:
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_ENUM:
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT32:
+        case TK_FLOAT64:
+        case TK_FLOAT128:
+            return true;
+        default:
+            return false;
+    }
+}
+
+// Size and alignment of a primitive on the CDR representation
+void primitive_cdr_size(
+        TypeKind kind,
+        size_t& size,
+        size_t& alignment)
+{
+    switch (kind)
+    {
+        case TK_INT16:
+        case TK_UINT16:
+            size = alignment = 2;
+            break;
+        case TK_CHAR16:
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_ENUM:
+        case TK_FLOAT32:
+            size = alignment = 4;
+            break;
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+            size = alignment = 8;
+            break;
+        case TK_FLOAT128:
+            size = 16;
+            alignment = 8;
+            break;
+        default:
+            size = alignment = 1;
+            break;
+    }
+}
+
+void serialize_primitives(
+        eprosima::fastcdr::Cdr& cdr,
+        TypeKind kind,
+        const uint8_t* data,
+        size_t count)
+{
+    switch (kind)
+    {
+        case TK_BOOLEAN:
+            cdr.serialize_array(reinterpret_cast<const bool*>(data), count);
+            break;
+        case TK_BYTE:
+            cdr.serialize_array(data, count);
+            break;
+        case TK_CHAR8:
+            cdr.serialize_array(reinterpret_cast<const char*>(data), count);
+            break;
+        case TK_CHAR16:
+            cdr.serialize_array(reinterpret_cast<const wchar_t*>(data), count);
+            break;
+        case TK_INT16:
+            cdr.serialize_array(reinterpret_cast<const int16_t*>(data), count);
+            break;
+        case TK_UINT16:
+            cdr.serialize_array(reinterpret_cast<const uint16_t*>(data), count);
+            break;
+        case TK_INT32:
+            cdr.serialize_array(reinterpret_cast<const int32_t*>(data), count);
+            break;
+        case TK_UINT32:
+        case TK_ENUM:
+            cdr.serialize_array(reinterpret_cast<const uint32_t*>(data), count);
+            break;
+        case TK_INT64:
+            cdr.serialize_array(reinterpret_cast<const int64_t*>(data), count);
+            break;
+        case TK_UINT64:
+            cdr.serialize_array(reinterpret_cast<const uint64_t*>(data), count);
+            break;
+        case TK_FLOAT32:
+            cdr.serialize_array(reinterpret_cast<const float*>(data), count);
+            break;
+        case TK_FLOAT64:
+            cdr.serialize_array(reinterpret_cast<const double*>(data), count);
+            break;
+        case TK_FLOAT128:
+            cdr.serialize_array(reinterpret_cast<const long double*>(data), count);
+            break;
+        default:
+            break;
+    }
+}
+
+void deserialize_primitives(
+        eprosima::fastcdr::Cdr& cdr,
+        TypeKind kind,
+        uint8_t* data,
+        size_t count)
+{
+    switch (kind)
+    {
+        case TK_BOOLEAN:
+            cdr.deserialize_array(reinterpret_cast<bool*>(data), count);
+            break;
+        case TK_BYTE:
+            cdr.deserialize_array(data, count);
+            break;
+        case TK_CHAR8:
+            cdr.deserialize_array(reinterpret_cast<char*>(data), count);
+            break;
+        case TK_CHAR16:
+            cdr.deserialize_array(reinterpret_cast<wchar_t*>(data), count);
+            break;
+        case TK_INT16:
+            cdr.deserialize_array(reinterpret_cast<int16_t*>(data), count);
+            break;
+        case TK_UINT16:
+            cdr.deserialize_array(reinterpret_cast<uint16_t*>(data), count);
+            break;
+        case TK_INT32:
+            cdr.deserialize_array(reinterpret_cast<int32_t*>(data), count);
+            break;
+        case TK_UINT32:
+        case TK_ENUM:
+            cdr.deserialize_array(reinterpret_cast<uint32_t*>(data), count);
+            break;
+        case TK_INT64:
+            cdr.deserialize_array(reinterpret_cast<int64_t*>(data), count);
+            break;
+        case TK_UINT64:
+            cdr.deserialize_array(reinterpret_cast<uint64_t*>(data), count);
+            break;
+        case TK_FLOAT32:
+            cdr.deserialize_array(reinterpret_cast<float*>(data), count);
+            break;
+        case TK_FLOAT64:
+            cdr.deserialize_array(reinterpret_cast<double*>(data), count);
+            break;
+        case TK_FLOAT128:
+            cdr.deserialize_array(reinterpret_cast<long double*>(data), count);
+            break;
+        default:
+            break;
+    }
+}
+
+// Throws if the CDR buffer has less than the given number of bytes left.
+// Avoids growing the sample for a length that cannot be read.
+void check_available(
+        eprosima::fastcdr::Cdr& cdr,
+        size_t length)
+{
+    eprosima::fastcdr::Cdr::state state = cdr.get_state();
+    cdr.jump(length);
+    cdr.set_state(state);
+}
+
+DynamicType_ptr resolve_alias(
+        DynamicType_ptr type)
+{
+    while (type != nullptr && TK_ALIAS == type->get_kind())
+    {
+        type = type->get_type_descriptor()->get_base_type();
+    }
+    return type;
+}
+
+void collect_members(
+        const DynamicType_ptr& type,
+        std::map<MemberId, DynamicTypeMember*>& members)
+{
+    // Members of the base structure are first on the serialized representation
+    DynamicType_ptr base = resolve_alias(type->get_type_descriptor()->get_base_type());
+    if (base != nullptr)
+    {
+        collect_members(base, members);
+    }
+
+    std::map<MemberId, DynamicTypeMember*> own_members;
+    type->get_all_members(own_members);
+    members.insert(own_members.begin(), own_members.end());
+}
+
+} // namespace
+
+std::shared_ptr<const FlatDynamicLayout> FlatDynamicLayout::create(
+        const DynamicType_ptr& type)
+{
+    if (type == nullptr)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error creating FlatDynamicLayout. Invalid dynamic type");
+        return nullptr;
+    }
+
+    std::shared_ptr<FlatDynamicLayout> layout(new FlatDynamicLayout());
+    layout->type_ = type;
+    layout->root_ = layout->build_node(type);
+    if (nullptr == layout->root_)
+    {
+        return nullptr;
+    }
+    return layout;
+}
+
+const FlatDynamicLayout::Node* FlatDynamicLayout::build_node(
+        const DynamicType_ptr& type)
+{
+    DynamicType_ptr resolved = resolve_alias(type);
+    if (resolved == nullptr)
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error creating FlatDynamicLayout. Alias without base type");
+        return nullptr;
+    }
+
+    std::unique_ptr<Node> node(new Node());
+    node->kind = resolved->get_kind();
+    node->size = 0;
+    node->alignment = 1;
+    node->bound = 0;
+    node->is_plain = true;
+    node->min_serialized_size = 0;
+    node->element = nullptr;
+
+    switch (node->kind)
+    {
+        case TK_BOOLEAN:
+            node->size = sizeof(bool);
+            node->alignment = alignof(bool);
+            break;
+        case TK_BYTE:
+            node->size = sizeof(octet);
+            break;
+        case TK_CHAR8:
+            node->size = sizeof(char);
+            break;
+        case TK_CHAR16:
+            node->size = sizeof(wchar_t);
+            node->alignment = alignof(wchar_t);
+            break;
+        case TK_INT16:
+        case TK_UINT16:
+            node->size = node->alignment = sizeof(uint16_t);
+            break;
+        case TK_INT32:
+        case TK_UINT32:
+        case TK_ENUM:
+        case TK_FLOAT32:
+            node->size = node->alignment = sizeof(uint32_t);
+            break;
+        case TK_INT64:
+        case TK_UINT64:
+        case TK_FLOAT64:
+            node->size = node->alignment = sizeof(uint64_t);
+            break;
+        case TK_FLOAT128:
+            node->size = sizeof(long double);
+            node->alignment = alignof(long double);
+            break;
+        case TK_STRING8:
+            node->size = span_size;
+            node->alignment = alignof(uint32_t);
+            node->bound = resolved->get_bounds();
+            node->is_plain = false;
+            // The length
+            node->min_serialized_size = sizeof(uint32_t);
+            break;
+        case TK_SEQUENCE:
+            node->element = build_node(resolved->get_type_descriptor()->get_element_type());
+            if (nullptr == node->element)
+            {
+                return nullptr;
+            }
+            node->size = span_size;
+            node->alignment = alignof(uint32_t);
+            node->bound = resolved->get_bounds();
+            node->is_plain = false;
+            // The length
+            node->min_serialized_size = sizeof(uint32_t);
+            break;
+        case TK_ARRAY:
+        {
+            node->element = build_node(resolved->get_type_descriptor()->get_element_type());
+            if (nullptr == node->element)
+            {
+                return nullptr;
+            }
+            node->bound = resolved->get_total_bounds();
+            uint64_t size = static_cast<uint64_t>(node->element->size) * node->bound;
+            if (size > std::numeric_limits<uint32_t>::max())
+            {
+                EPROSIMA_LOG_ERROR(DYN_TYPES, "Error creating FlatDynamicLayout. Array " << resolved->get_name()
+                                                                                         << " is too large");
+                return nullptr;
+            }
+            node->size = static_cast<uint32_t>(size);
+            node->alignment = node->element->alignment;
+            node->is_plain = node->element->is_plain;
+            node->min_serialized_size = static_cast<uint32_t>(std::min<uint64_t>(
+                        static_cast<uint64_t>(node->element->min_serialized_size) * node->bound,
+                        std::numeric_limits<uint32_t>::max()));
+            break;
+        }
+        case TK_STRUCTURE:
+            if (!add_members(resolved, *node))
+            {
+                return nullptr;
+            }
+            break;
+        default:
+            EPROSIMA_LOG_WARNING(DYN_TYPES, "Type " << resolved->get_name() << " of kind "
+                                                    << static_cast<uint32_t>(node->kind)
+                                                    << " is not supported by FlatDynamicData");
+            return nullptr;
+    }
+
+    if (is_primitive(node->kind))
+    {
+        size_t size = 0;
+        size_t alignment = 0;
+        primitive_cdr_size(node->kind, size, alignment);
+        node->min_serialized_size = static_cast<uint32_t>(size);
+    }
+
+    nodes_.push_back(std::move(node));
+    return nodes_.back().get();
+}
+
+bool FlatDynamicLayout::add_members(
+        const DynamicType_ptr& type,
+        Node& node)
+{
+    std::map<MemberId, DynamicTypeMember*> members;
+    collect_members(type, members);
+
+    uint64_t offset = 0;
+    uint64_t min_serialized_size = 0;
+    for (const auto& it : members)
+    {
+        const MemberDescriptor* descriptor = it.second->get_descriptor();
+        const Node* member_node = build_node(descriptor->get_type());
+        if (nullptr == member_node)
+        {
+            return false;
+        }
+
+        offset = align_to(offset, member_node->alignment);
+        node.members.push_back(Member{it.first, descriptor->get_name(), static_cast<uint32_t>(offset),
+                                      !descriptor->annotation_is_non_serialized(), member_node});
+        offset += member_node->size;
+        node.alignment = std::max(node.alignment, member_node->alignment);
+        node.is_plain = node.is_plain && member_node->is_plain;
+        if (!descriptor->annotation_is_non_serialized())
+        {
+            min_serialized_size += member_node->min_serialized_size;
+        }
+    }
+    node.min_serialized_size = static_cast<uint32_t>(std::min<uint64_t>(min_serialized_size,
+                std::numeric_limits<uint32_t>::max()));
+
+    offset = align_to(offset, node.alignment);
+    if (offset > std::numeric_limits<uint32_t>::max())
+    {
+        EPROSIMA_LOG_ERROR(DYN_TYPES, "Error creating FlatDynamicLayout. Structure " << type->get_name()
+                                                                                     << " is too large");
+        return false;
+    }
+    node.size = static_cast<uint32_t>(offset);
+    return true;
+}
+
+FlatDynamicData::FlatDynamicData(
+        std::shared_ptr<const FlatDynamicLayout> layout)
+    : layout_(std::move(layout))
+{
+    clear();
+}
+
+void FlatDynamicData::clear()
+{
+    // Keeps the capacity, so a sample reused for deserialization stops allocating once it has seen its largest value
+    buffer_.assign(layout_->root()->size, 0);
+}
+
+ReturnCode_t FlatDynamicData::get_member(
+        Ref& member,
+        const Ref& structure,
+        MemberId id) const
+{
+    if (TK_STRUCTURE != structure.kind())
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    const std::vector<FlatDynamicLayout::Member>& members = structure.node_->members;
+    auto it = std::lower_bound(members.begin(), members.end(), id,
+                    [](const FlatDynamicLayout::Member& m, MemberId value)
+                    {
+                        return m.id < value;
+                    });
+    if (it == members.end() || it->id != id)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    member = Ref(it->node, structure.offset_ + it->offset);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::get_member_by_name(
+        Ref& member,
+        const Ref& structure,
+        const std::string& name) const
+{
+    if (TK_STRUCTURE != structure.kind())
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    for (const FlatDynamicLayout::Member& m : structure.node_->members)
+    {
+        if (m.name == name)
+        {
+            member = Ref(m.node, structure.offset_ + m.offset);
+            return ReturnCode_t::RETCODE_OK;
+        }
+    }
+    return ReturnCode_t::RETCODE_BAD_PARAMETER;
+}
+
+ReturnCode_t FlatDynamicData::get_element(
+        Ref& element,
+        const Ref& collection,
+        uint32_t index) const
+{
+    uint32_t base = 0;
+    switch (collection.kind())
+    {
+        case TK_ARRAY:
+            if (index >= collection.node_->bound)
+            {
+                return ReturnCode_t::RETCODE_BAD_PARAMETER;
+            }
+            base = collection.offset_;
+            break;
+        case TK_SEQUENCE:
+        {
+            Span span = get_span(collection.offset_);
+            if (index >= span.length)
+            {
+                return ReturnCode_t::RETCODE_BAD_PARAMETER;
+            }
+            base = span.offset;
+            break;
+        }
+        default:
+            return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    const FlatDynamicLayout::Node* element_node = collection.node_->element;
+    element = Ref(element_node, base + index * element_node->size);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+uint32_t FlatDynamicData::get_item_count(
+        const Ref& ref) const
+{
+    switch (ref.kind())
+    {
+        case TK_ARRAY:
+            return ref.node_->bound;
+        case TK_SEQUENCE:
+            return get_span(ref.offset_).length;
+        case TK_STRUCTURE:
+            return static_cast<uint32_t>(ref.node_->members.size());
+        default:
+            return 0;
+    }
+}
+
+ReturnCode_t FlatDynamicData::resize(
+        const Ref& sequence,
+        uint32_t length)
+{
+    if (TK_SEQUENCE != sequence.kind() ||
+            (BOUND_UNLIMITED != sequence.node_->bound && length > sequence.node_->bound))
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    Span span = get_span(sequence.offset_);
+    if (length > span.length)
+    {
+        // Existing elements are moved to a new region at the tail. Their strings and sequences are not moved, as
+        // elements only hold spans to them.
+        const uint32_t element_size = sequence.node_->element->size;
+        uint32_t offset = 0;
+        if (!append(static_cast<uint64_t>(length) * element_size, sequence.node_->element->alignment, offset))
+        {
+            return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+        }
+        if (span.length > 0)
+        {
+            memcpy(&buffer_[offset], &buffer_[span.offset], static_cast<size_t>(span.length) * element_size);
+        }
+        span.offset = offset;
+    }
+    span.length = length;
+    set_span(sequence.offset_, span);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+template<typename T>
+ReturnCode_t FlatDynamicData::get_primitive(
+        T& value,
+        const Ref& ref,
+        TypeKind kind) const
+{
+    if (kind != ref.kind())
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    memcpy(&value, &buffer_[ref.offset_], sizeof(T));
+    return ReturnCode_t::RETCODE_OK;
+}
+
+template<typename T>
+ReturnCode_t FlatDynamicData::set_primitive(
+        const Ref& ref,
+        T value,
+        TypeKind kind)
+{
+    if (kind != ref.kind())
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+    memcpy(&buffer_[ref.offset_], &value, sizeof(T));
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        bool& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_BOOLEAN);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        bool value)
+{
+    return set_primitive(ref, value, TK_BOOLEAN);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        octet& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_BYTE);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        octet value)
+{
+    return set_primitive(ref, value, TK_BYTE);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        char& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_CHAR8);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        char value)
+{
+    return set_primitive(ref, value, TK_CHAR8);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        wchar_t& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_CHAR16);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        wchar_t value)
+{
+    return set_primitive(ref, value, TK_CHAR16);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        int16_t& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_INT16);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        int16_t value)
+{
+    return set_primitive(ref, value, TK_INT16);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        uint16_t& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_UINT16);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        uint16_t value)
+{
+    return set_primitive(ref, value, TK_UINT16);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        int32_t& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_INT32);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        int32_t value)
+{
+    return set_primitive(ref, value, TK_INT32);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        uint32_t& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_ENUM == ref.kind() ? TK_ENUM : TK_UINT32);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        uint32_t value)
+{
+    return set_primitive(ref, value, TK_ENUM == ref.kind() ? TK_ENUM : TK_UINT32);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        int64_t& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_INT64);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        int64_t value)
+{
+    return set_primitive(ref, value, TK_INT64);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        uint64_t& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_UINT64);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        uint64_t value)
+{
+    return set_primitive(ref, value, TK_UINT64);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        float& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_FLOAT32);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        float value)
+{
+    return set_primitive(ref, value, TK_FLOAT32);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        double& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_FLOAT64);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        double value)
+{
+    return set_primitive(ref, value, TK_FLOAT64);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        long double& value,
+        const Ref& ref) const
+{
+    return get_primitive(value, ref, TK_FLOAT128);
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        long double value)
+{
+    return set_primitive(ref, value, TK_FLOAT128);
+}
+
+ReturnCode_t FlatDynamicData::get_value(
+        std::string& value,
+        const Ref& ref) const
+{
+    if (TK_STRING8 != ref.kind())
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    Span span = get_span(ref.offset_);
+    if (0 == span.length)
+    {
+        value.clear();
+    }
+    else
+    {
+        value.assign(reinterpret_cast<const char*>(&buffer_[span.offset]), span.length);
+    }
+    return ReturnCode_t::RETCODE_OK;
+}
+
+ReturnCode_t FlatDynamicData::set_value(
+        const Ref& ref,
+        const std::string& value)
+{
+    if (TK_STRING8 != ref.kind() ||
+            (BOUND_UNLIMITED != ref.node_->bound && value.size() > ref.node_->bound))
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+    Span span = get_span(ref.offset_);
+    if (value.empty())
+    {
+        span.length = 0;
+        set_span(ref.offset_, span);
+        return ReturnCode_t::RETCODE_OK;
+    }
+
+    // Strings keep their null terminator, so they are serialized with a single copy
+    if (value.size() > span.length)
+    {
+        if (!append(value.size() + 1, 1, span.offset))
+        {
+            return ReturnCode_t::RETCODE_OUT_OF_RESOURCES;
+        }
+    }
+    memcpy(&buffer_[span.offset], value.data(), value.size());
+    buffer_[span.offset + value.size()] = 0;
+    span.length = static_cast<uint32_t>(value.size());
+    set_span(ref.offset_, span);
+    return ReturnCode_t::RETCODE_OK;
+}
+
+size_t FlatDynamicData::getCdrSerializedSize(
+        size_t current_alignment) const
+{
+    return serialized_size(layout_->root(), 0, current_alignment) - current_alignment;
+}
+
+void FlatDynamicData::serialize(
+        eprosima::fastcdr::Cdr& cdr) const
+{
+    serialize(cdr, layout_->root(), 0);
+}
+
+bool FlatDynamicData::deserialize(
+        eprosima::fastcdr::Cdr& cdr)
+{
+    clear();
+    try
+    {
+        deserialize(cdr, layout_->root(), 0);
+    }
+    catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+    {
+        clear();
+        return false;
+    }
+    return true;
+}
+
+FlatDynamicData::Span FlatDynamicData::get_span(
+        uint32_t offset) const
+{
+    Span span;
+    memcpy(&span.offset, &buffer_[offset], sizeof(uint32_t));
+    memcpy(&span.length, &buffer_[offset + sizeof(uint32_t)], sizeof(uint32_t));
+    return span;
+}
+
+void FlatDynamicData::set_span(
+        uint32_t offset,
+        const Span& span)
+{
+    memcpy(&buffer_[offset], &span.offset, sizeof(uint32_t));
+    memcpy(&buffer_[offset + sizeof(uint32_t)], &span.length, sizeof(uint32_t));
+}
+
+bool FlatDynamicData::append(
+        uint64_t size,
+        uint32_t alignment,
+        uint32_t& offset)
+{
+    uint64_t start = align_to(buffer_.size(), alignment);
+    if (start + size > std::numeric_limits<uint32_t>::max())
+    {
+        return false;
+    }
+
+    buffer_.resize(static_cast<size_t>(start + size), 0);
+    offset = static_cast<uint32_t>(start);
+    return true;
+}
+
+size_t FlatDynamicData::serialized_size(
+        const FlatDynamicLayout::Node* node,
+        uint32_t offset,
+        size_t current_alignment) const
+{
+    switch (node->kind)
+    {
+        case TK_STRUCTURE:
+            for (const FlatDynamicLayout::Member& member : node->members)
+            {
+                if (member.serialized)
+                {
+                    current_alignment = serialized_size(member.node, offset + member.offset, current_alignment);
+                }
+            }
+            return current_alignment;
+
+        case TK_STRING8:
+            current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+            return current_alignment + get_span(offset).length + 1;
+
+        case TK_ARRAY:
+        case TK_SEQUENCE:
+        {
+            uint32_t count = node->bound;
+            if (TK_SEQUENCE == node->kind)
+            {
+                Span span = get_span(offset);
+                current_alignment += 4 + eprosima::fastcdr::Cdr::alignment(current_alignment, 4);
+                count = span.length;
+                offset = span.offset;
+            }
+
+            const FlatDynamicLayout::Node* element = node->element;
+            if (0 < count && is_primitive(element->kind))
+            {
+                size_t size = 0;
+                size_t alignment = 0;
+                primitive_cdr_size(element->kind, size, alignment);
+                current_alignment += eprosima::fastcdr::Cdr::alignment(current_alignment, alignment);
+                return current_alignment + size * count;
+            }
+
+            for (uint32_t idx = 0; idx < count; ++idx)
+            {
+                current_alignment = serialized_size(element, offset + idx * element->size, current_alignment);
+            }
+            return current_alignment;
+        }
+
+        default:
+        {
+            size_t size = 0;
+            size_t alignment = 0;
+            primitive_cdr_size(node->kind, size, alignment);
+            return current_alignment + size + eprosima::fastcdr::Cdr::alignment(current_alignment, alignment);
+        }
+    }
+}
+
+void FlatDynamicData::serialize(
+        eprosima::fastcdr::Cdr& cdr,
+        const FlatDynamicLayout::Node* node,
+        uint32_t offset) const
+{
+    switch (node->kind)
+    {
+        case TK_STRUCTURE:
+            for (const FlatDynamicLayout::Member& member : node->members)
+            {
+                if (member.serialized)
+                {
+                    serialize(cdr, member.node, offset + member.offset);
+                }
+            }
+            break;
+
+        case TK_STRING8:
+        {
+            // Same representation as serializing a std::string: length including the null terminator, then the
+            // characters.
+            Span span = get_span(offset);
+            cdr << static_cast<uint32_t>(span.length + 1);
+            if (0 == span.length)
+            {
+                cdr << static_cast<char>(0);
+            }
+            else
+            {
+                cdr.serialize_array(reinterpret_cast<const char*>(&buffer_[span.offset]), span.length + 1);
+            }
+            break;
+        }
+
+        case TK_ARRAY:
+        case TK_SEQUENCE:
+        {
+            uint32_t count = node->bound;
+            if (TK_SEQUENCE == node->kind)
+            {
+                Span span = get_span(offset);
+                cdr << span.length;
+                count = span.length;
+                offset = span.offset;
+            }
+
+            const FlatDynamicLayout::Node* element = node->element;
+            if (0 < count && is_primitive(element->kind))
+            {
+                serialize_primitives(cdr, element->kind, &buffer_[offset], count);
+            }
+            else
+            {
+                for (uint32_t idx = 0; idx < count; ++idx)
+                {
+                    serialize(cdr, element, offset + idx * element->size);
+                }
+            }
+            break;
+        }
+
+        default:
+            serialize_primitives(cdr, node->kind, &buffer_[offset], 1);
+            break;
+    }
+}
+
+void FlatDynamicData::deserialize(
+        eprosima::fastcdr::Cdr& cdr,
+        const FlatDynamicLayout::Node* node,
+        uint32_t offset)
+{
+    switch (node->kind)
+    {
+        case TK_STRUCTURE:
+            for (const FlatDynamicLayout::Member& member : node->members)
+            {
+                if (member.serialized)
+                {
+                    deserialize(cdr, member.node, offset + member.offset);
+                }
+            }
+            break;
+
+        case TK_STRING8:
+        {
+            uint32_t length = 0;
+            cdr >> length;
+            if (0 == length)
+            {
+                break;
+            }
+
+            check_available(cdr, length);
+            Span span{0, 0};
+            // One more octet, as the null terminator is optional on the representation
+            if (!append(static_cast<uint64_t>(length) + 1, 1, span.offset))
+            {
+                throw eprosima::fastcdr::exception::BadParamException("String too large");
+            }
+            char* chars = reinterpret_cast<char*>(&buffer_[span.offset]);
+            cdr.deserialize_array(chars, length);
+            span.length = (0 == chars[length - 1]) ? length - 1 : length;
+            if (BOUND_UNLIMITED != node->bound && span.length > node->bound)
+            {
+                throw eprosima::fastcdr::exception::BadParamException("String exceeds its bound");
+            }
+            set_span(offset, span);
+            break;
+        }
+
+        case TK_ARRAY:
+        case TK_SEQUENCE:
+        {
+            const FlatDynamicLayout::Node* element = node->element;
+            const bool primitive_elements = is_primitive(element->kind);
+            uint32_t count = node->bound;
+            if (TK_SEQUENCE == node->kind)
+            {
+                cdr >> count;
+                if (BOUND_UNLIMITED != node->bound && count > node->bound)
+                {
+                    throw eprosima::fastcdr::exception::BadParamException("Sequence exceeds its bound");
+                }
+                if (0 == count)
+                {
+                    break;
+                }
+
+                // Every element takes at least one byte, so a forged length cannot grow the sample beyond the size
+                // of the buffer
+                uint64_t min_element_size = std::max<uint64_t>(element->min_serialized_size, 1u);
+                check_available(cdr, static_cast<size_t>(std::min<uint64_t>(min_element_size * count,
+                        std::numeric_limits<size_t>::max())));
+
+                Span span{0, count};
+                if (!append(static_cast<uint64_t>(count) * element->size, element->alignment, span.offset))
+                {
+                    throw eprosima::fastcdr::exception::BadParamException("Sequence too large");
+                }
+                set_span(offset, span);
+                offset = span.offset;
+            }
+
+            if (0 < count && primitive_elements)
+            {
+                deserialize_primitives(cdr, element->kind, &buffer_[offset], count);
+            }
+            else
+            {
+                for (uint32_t idx = 0; idx < count; ++idx)
+                {
+                    deserialize(cdr, element, offset + idx * element->size);
+                }
+            }
+            break;
+        }
+
+        default:
+            deserialize_primitives(cdr, node->kind, &buffer_[offset], 1);
+            break;
+    }
+}
+
+} // namespace types
+} // namespace fastrtps
+} // namespace eprosima
@@ -2279,7 +2279,9 @@ bool DomainParticipantImpl::can_qos_be_updated(
                 !(strcmp(to.wire_protocol().builtin.discovery_config.static_edp_xml_config(),
                 from.wire_protocol().builtin.discovery_config.static_edp_xml_config()) == 0) ||
                 !(to.wire_protocol().builtin.discovery_config.ignoreParticipantFlags ==
-                from.wire_protocol().builtin.discovery_config.ignoreParticipantFlags))))
+                from.wire_protocol().builtin.discovery_config.ignoreParticipantFlags) ||
+                !(to.wire_protocol().builtin.discovery_config.backup_format ==
+                from.wire_protocol().builtin.discovery_config.backup_format))))
         {
             updatable = false;
             EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK, "WireProtocolConfigQos cannot be changed after the participant is enabled, "
@@ -2348,6 +2350,12 @@ bool DomainParticipantImpl::can_qos_be_updated(
                 "Participant security_log_thread cannot be changed after the participant is enabled");
     }
 #endif // if HAVE_SECURITY
+    if (to.thread_topology() != from.thread_topology())
+    {
+        updatable = false;
+        EPROSIMA_LOG_WARNING(RTPS_QOS_CHECK,
+                "Participant thread_topology cannot be changed after the participant is enabled");
+    }
     return updatable;
 }
 
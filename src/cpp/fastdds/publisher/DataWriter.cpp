@@ -98,6 +98,12 @@ ReturnCode_t DataWriter::write(
     return impl_->write(data, handle);
 }
 
+ReturnCode_t DataWriter::write_batch(
+        const std::vector<void*>& samples)
+{
+    return impl_->write_batch(samples);
+}
+
 ReturnCode_t DataWriter::write_w_timestamp(
         void* data,
         const InstanceHandle_t& handle,
@@ -563,6 +563,24 @@ bool DataWriterHistory::wait_for_acknowledgement_last_change(
     return false;
 }
 
+bool DataWriterHistory::may_block_adding_change(
+        const InstanceHandle_t& handle)
+{
+    if (m_isHistoryFull)
+    {
+        return true;
+    }
+
+    if (WITH_KEY == topic_att_.getTopicKind() && KEEP_ALL_HISTORY_QOS == history_qos_.kind)
+    {
+        t_m_Inst_Caches::iterator vit = keyed_changes_.find(handle);
+        return vit != keyed_changes_.end() &&
+               vit->second.cache_changes.size() >= static_cast<size_t>(resource_limited_qos_.max_samples_per_instance);
+    }
+
+    return false;
+}
+
 bool DataWriterHistory::change_is_acked_or_fully_delivered(
         const CacheChange_t* change)
 {
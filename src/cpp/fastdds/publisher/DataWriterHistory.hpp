@@ -235,6 +235,15 @@ public:
             std::unique_lock<fastrtps::RecursiveTimedMutex>& lock,
             const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time);
 
+    /**
+     * Checks whether adding a change to an instance may have to wait for other changes to be acknowledged, either
+     * because the history is full or because the instance reached its max_samples_per_instance limit.
+     * @param handle Instance's handle. Ignored for topics with no key.
+     * @return true when adding the change may block.
+     */
+    bool may_block_adding_change(
+            const fastrtps::rtps::InstanceHandle_t& handle);
+
 private:
 
     typedef std::map<fastrtps::rtps::InstanceHandle_t, detail::DataWriterInstance> t_m_Inst_Caches;
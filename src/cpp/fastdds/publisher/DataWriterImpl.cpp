@@ -54,12 +54,17 @@
 #include <rtps/history/TopicPayloadPoolRegistry.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/RTPSDomainImpl.hpp>
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+#include <rtps/transport/shared_mem/SharedMemPayloadPool.hpp>
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
 
 #ifdef FASTDDS_STATISTICS
 #include <statistics/fastdds/domain/DomainParticipantImpl.hpp>
 #include <statistics/types/monitorservice_types.h>
 #endif //FASTDDS_STATISTICS
 
+#include <utils/tracing/Tracepoints.hpp>
+
 using namespace eprosima::fastrtps;
 using namespace eprosima::fastrtps::rtps;
 using namespace std::chrono;
@@ -88,6 +93,27 @@ static bool qos_has_pull_mode_request(
     return (nullptr != push_mode) && ("false" == *push_mode);
 }
 
+static uint32_t qos_shm_payload_segment_size(
+        const DataWriterQos& qos)
+{
+    uint32_t segment_size = 0u;
+    auto segment_size_property = PropertyPolicyHelper::find_property(qos.properties(),
+                    parameter_shm_payload_segment_size);
+    if (nullptr != segment_size_property)
+    {
+        try
+        {
+            segment_size = static_cast<uint32_t>(std::stoul(*segment_size_property));
+        }
+        catch (const std::exception&)
+        {
+            EPROSIMA_LOG_ERROR(DATA_WRITER, "Invalid value for property " << parameter_shm_payload_segment_size
+                                                                          << ": " << *segment_size_property);
+        }
+    }
+    return segment_size;
+}
+
 class DataWriterImpl::LoanCollection
 {
 public:
@@ -652,6 +678,71 @@ ReturnCode_t DataWriterImpl::write(
     return ret;
 }
 
+ReturnCode_t DataWriterImpl::write_batch(
+        const std::vector<void*>& samples)
+{
+    if (writer_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    EPROSIMA_LOG_INFO(DATA_WRITER, "Writing a batch of " << samples.size() << " samples");
+
+    auto max_blocking_time = steady_clock::now() +
+            microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+
+    // Each sample locks the writer mutex again, which is cheap as it is recursive
+#if HAVE_STRICT_REALTIME
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex(), std::defer_lock);
+    if (!lock.try_lock_until(max_blocking_time))
+    {
+        return ReturnCode_t::RETCODE_TIMEOUT;
+    }
+#else
+    std::unique_lock<RecursiveTimedMutex> lock(writer_->getMutex());
+#endif // if HAVE_STRICT_REALTIME
+
+    ReturnCode_t ret = ReturnCode_t::RETCODE_OK;
+    writer_->begin_batch();
+    for (void* data : samples)
+    {
+        WriteParams wparams;
+        InstanceHandle_t handle;
+        if (nullptr != data && type_->m_isGetKeyDefined)
+        {
+            bool is_key_protected = false;
+#if HAVE_SECURITY
+            is_key_protected = writer_->getAttributes().security_attributes().is_key_protected;
+#endif // if HAVE_SECURITY
+            type_->getKey(data, &handle, is_key_protected);
+        }
+
+        if (history_.may_block_adding_change(handle))
+        {
+            // Making room may require waiting for the samples to be acknowledged, either on the whole history or on
+            // the instance of this one. The ones on the batch are sent, and the writer mutex is fully released while
+            // this one is added.
+            writer_->end_batch(max_blocking_time);
+            lock.unlock();
+            ret = create_new_change_with_params(ALIVE, data, wparams, handle);
+            lock.lock();
+            writer_->begin_batch();
+        }
+        else
+        {
+            ret = create_new_change_with_params(ALIVE, data, wparams, handle);
+        }
+
+        if (ReturnCode_t::RETCODE_OK != ret)
+        {
+            break;
+        }
+    }
+    writer_->end_batch(max_blocking_time);
+
+    return ret;
+}
+
 ReturnCode_t DataWriterImpl::write_w_timestamp(
         void* data,
         const InstanceHandle_t& handle,
@@ -945,6 +1036,8 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
         WriteParams& wparams,
         const InstanceHandle_t& handle)
 {
+    FASTDDS_TRACEPOINT_SCOPE(tracepoint, "DataWriter::write", guid_, SequenceNumber_t::unknown());
+
     // Block lowlevel writer
     auto max_blocking_time = steady_clock::now() +
             microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
@@ -1008,6 +1101,8 @@ ReturnCode_t DataWriterImpl::perform_create_new_change(
             return ReturnCode_t::RETCODE_TIMEOUT;
         }
 
+        FASTDDS_TRACEPOINT_SAMPLE(tracepoint, ch->writerGUID, ch->sequenceNumber);
+
         if (qos_.deadline().period != c_TimeInfinite)
         {
             if (!history_.set_next_deadline(
@@ -2007,6 +2102,7 @@ std::shared_ptr<IPayloadPool> DataWriterImpl::get_payload_pool()
         }
 
         PoolConfig config = PoolConfig::from_history_attributes(history_.m_att);
+        config.placement = publisher_->rtps_participant()->getRTPSParticipantAttributes().allocation.payload_pools;
 
         // Avoid calling the serialization size functors on PREALLOCATED mode
         fixed_payload_size_ = config.memory_policy == PREALLOCATED_MEMORY_MODE ? config.payload_initial_size : 0u;
@@ -2018,10 +2114,26 @@ std::shared_ptr<IPayloadPool> DataWriterImpl::get_payload_pool()
         }
         else
         {
-            payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_name(), config);
-            if (!std::static_pointer_cast<ITopicPayloadPool>(payload_pool_)->reserve_history(config, false))
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+            uint32_t shm_segment_size = qos_shm_payload_segment_size(qos_);
+            if (0u < shm_segment_size)
             {
-                payload_pool_.reset();
+                payload_pool_ = fastdds::rtps::SharedMemPayloadPool::create(shm_segment_size, config);
+                is_shm_payload_pool_ = static_cast<bool>(payload_pool_);
+                if (!is_shm_payload_pool_)
+                {
+                    EPROSIMA_LOG_WARNING(DATA_WRITER, "Could not create shared memory payload pool. "
+                            "Payloads will be allocated on the process memory.");
+                }
+            }
+            if (!is_shm_payload_pool_)
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+            {
+                payload_pool_ = TopicPayloadPoolRegistry::get(topic_->get_name(), config);
+                if (!std::static_pointer_cast<ITopicPayloadPool>(payload_pool_)->reserve_history(config, false))
+                {
+                    payload_pool_.reset();
+                }
             }
         }
 
@@ -2043,7 +2155,7 @@ bool DataWriterImpl::release_payload_pool()
 
     bool result = true;
 
-    if (is_data_sharing_compatible_ || is_custom_payload_pool_)
+    if (is_data_sharing_compatible_ || is_custom_payload_pool_ || is_shm_payload_pool_)
     {
         // No-op
     }
@@ -2055,6 +2167,7 @@ bool DataWriterImpl::release_payload_pool()
     }
 
     payload_pool_.reset();
+    is_shm_payload_pool_ = false;
 
     return result;
 }
@@ -203,6 +203,16 @@ public:
             void* data,
             const InstanceHandle_t& handle);
 
+    /**
+     * Write several samples, amortizing the writer mutex and sending them together.
+     *
+     * @param[in] samples Pointers to the data of the samples to publish.
+     *
+     * @return RETCODE_OK if all the samples are written, or the code of the first one that failed.
+     */
+    ReturnCode_t write_batch(
+            const std::vector<void*>& samples);
+
     /**
      * @brief Implementation of the DDS `write_w_timestamp` operation.
      *
@@ -496,6 +506,9 @@ protected:
 
     bool is_custom_payload_pool_ = false;
 
+    //! Whether payloads are allocated on a shared memory segment (see parameter_shm_payload_segment_size)
+    bool is_shm_payload_pool_ = false;
+
     std::unique_ptr<LoanCollection> loans_;
 
     fastrtps::rtps::GUID_t guid_;
@@ -272,6 +272,34 @@ ReturnCode_t DataReader::take_next_sample(
     return impl_->take_next_sample(data, info);
 }
 
+ReturnCode_t DataReader::read_batch(
+        void* data_values,
+        size_t sample_size,
+        int32_t max_samples,
+        SampleInfoBatch& sample_infos,
+        int32_t& num_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return impl_->read_batch(data_values, sample_size, max_samples, sample_infos, num_samples,
+                   sample_states, view_states, instance_states);
+}
+
+ReturnCode_t DataReader::take_batch(
+        void* data_values,
+        size_t sample_size,
+        int32_t max_samples,
+        SampleInfoBatch& sample_infos,
+        int32_t& num_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return impl_->take_batch(data_values, sample_size, max_samples, sample_infos, num_samples,
+                   sample_states, view_states, instance_states);
+}
+
 ReturnCode_t DataReader::get_first_untaken_info(
         SampleInfo* info)
 {
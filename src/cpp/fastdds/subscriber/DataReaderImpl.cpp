@@ -50,6 +50,7 @@
 #include <fastdds/domain/DomainParticipantImpl.hpp>
 
 #include <fastdds/subscriber/SubscriberImpl.hpp>
+#include <fastdds/subscriber/DataReaderImpl/BatchReadTakeCommand.hpp>
 #include <fastdds/subscriber/DataReaderImpl/ReadTakeCommand.hpp>
 #include <fastdds/subscriber/DataReaderImpl/StateFilter.hpp>
 
@@ -66,6 +67,8 @@
 #include <statistics/types/monitorservice_types.h>
 #endif //FASTDDS_STATISTICS
 
+#include <utils/tracing/Tracepoints.hpp>
+
 using eprosima::fastrtps::RecursiveTimedMutex;
 using eprosima::fastrtps::c_TimeInfinite;
 
@@ -93,6 +96,27 @@ static bool qos_has_unique_network_request(
     return nullptr != PropertyPolicyHelper::find_property(qos.properties(), "fastdds.unique_network_flows");
 }
 
+static uint32_t qos_uint32_property(
+        const DataReaderQos& qos,
+        const char* property_name,
+        uint32_t default_value)
+{
+    uint32_t value = default_value;
+    auto property = PropertyPolicyHelper::find_property(qos.properties(), property_name);
+    if (nullptr != property)
+    {
+        try
+        {
+            value = static_cast<uint32_t>(std::stoul(*property));
+        }
+        catch (const std::exception&)
+        {
+            EPROSIMA_LOG_ERROR(DATA_READER, "Invalid value for property " << property_name << ": " << *property);
+        }
+    }
+    return value;
+}
+
 static bool qos_has_specific_locators(
         const DataReaderQos& qos)
 {
@@ -255,6 +279,19 @@ ReturnCode_t DataReaderImpl::enable()
                     },
                     qos_.lifespan().duration.to_ns() * 1e-6);
 
+    notification_coalescing_samples_ = qos_uint32_property(qos_, "fastdds.notification_coalescing_samples", 0u);
+    notification_coalescing_period_us_ = qos_uint32_property(qos_, "fastdds.notification_coalescing_period_us", 1000u);
+    if (1u < notification_coalescing_samples_)
+    {
+        pending_changes_.reserve(notification_coalescing_samples_);
+        coalescing_timer_ = new TimedEvent(subscriber_->get_participant()->get_resource_event(),
+                        [&]() -> bool
+                        {
+                            return coalescing_period_expired();
+                        },
+                        notification_coalescing_period_us_ * 1e-3);
+    }
+
     // Register the reader
     ReaderQos rqos = qos_.get_readerqos(subscriber_->get_qos());
     if (!is_datasharing_compatible)
@@ -302,6 +339,8 @@ void DataReaderImpl::disable()
 
 void DataReaderImpl::stop()
 {
+    delete coalescing_timer_;
+    coalescing_timer_ = nullptr;
     delete lifespan_timer_;
     delete deadline_timer_;
 
@@ -520,6 +559,7 @@ ReturnCode_t DataReaderImpl::read_or_take(
     std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
 #endif // if HAVE_STRICT_REALTIME
 
+    process_pending_changes_nts();
     set_read_communication_status(false);
 
     auto it = history_.lookup_available_instance(handle, exact_instance);
@@ -719,6 +759,7 @@ ReturnCode_t DataReaderImpl::read_or_take_next_sample(
     std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
 #endif // if HAVE_STRICT_REALTIME
 
+    process_pending_changes_nts();
     set_read_communication_status(false);
 
     auto it = history_.lookup_available_instance(HANDLE_NIL, false);
@@ -763,6 +804,108 @@ ReturnCode_t DataReaderImpl::take_next_sample(
     return read_or_take_next_sample(data, info, true);
 }
 
+ReturnCode_t DataReaderImpl::read_or_take_batch(
+        void* data_values,
+        size_t sample_size,
+        int32_t max_samples,
+        SampleInfoBatch& sample_infos,
+        int32_t& num_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states,
+        bool should_take)
+{
+    num_samples = 0;
+
+    if (reader_ == nullptr)
+    {
+        return ReturnCode_t::RETCODE_NOT_ENABLED;
+    }
+
+    // Type should be plain, so samples can be copied straight from the payloads
+    if (!type_->is_plain() || SerializedPayload_t::representation_header_size > type_->m_typeSize)
+    {
+        return ReturnCode_t::RETCODE_ILLEGAL_OPERATION;
+    }
+
+    // The caller array should be able to hold max_samples samples, which should fit on a payload
+    if (nullptr == data_values || max_samples <= 0 || 0 == sample_size ||
+            sample_size > type_->m_typeSize - SerializedPayload_t::representation_header_size)
+    {
+        return ReturnCode_t::RETCODE_BAD_PARAMETER;
+    }
+
+#if HAVE_STRICT_REALTIME
+    auto max_blocking_time = std::chrono::steady_clock::now() +
+            std::chrono::microseconds(::TimeConv::Time_t2MicroSecondsInt64(qos_.reliability().max_blocking_time));
+    std::unique_lock<RecursiveTimedMutex> lock(reader_->getMutex(), std::defer_lock);
+
+    if (!lock.try_lock_until(max_blocking_time))
+    {
+        return ReturnCode_t::RETCODE_TIMEOUT;
+    }
+#else
+    std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
+#endif // if HAVE_STRICT_REALTIME
+
+    process_pending_changes_nts();
+    set_read_communication_status(false);
+
+    auto it = history_.lookup_available_instance(HANDLE_NIL, false);
+    if (!it.first)
+    {
+        return ReturnCode_t::RETCODE_NO_DATA;
+    }
+
+    detail::StateFilter states = { sample_states, view_states, instance_states };
+    detail::BatchReadTakeCommand cmd(
+        *this,
+        data_values,
+        sample_size,
+        max_samples,
+        sample_infos,
+        states,
+        it.second);
+
+    while (!cmd.is_finished())
+    {
+        cmd.add_instance(should_take);
+    }
+    num_samples = cmd.num_samples();
+
+    try_notify_read_conditions();
+
+    return cmd.return_value();
+}
+
+ReturnCode_t DataReaderImpl::read_batch(
+        void* data_values,
+        size_t sample_size,
+        int32_t max_samples,
+        SampleInfoBatch& sample_infos,
+        int32_t& num_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return read_or_take_batch(data_values, sample_size, max_samples, sample_infos, num_samples,
+                   sample_states, view_states, instance_states, false);
+}
+
+ReturnCode_t DataReaderImpl::take_batch(
+        void* data_values,
+        size_t sample_size,
+        int32_t max_samples,
+        SampleInfoBatch& sample_infos,
+        int32_t& num_samples,
+        SampleStateMask sample_states,
+        ViewStateMask view_states,
+        InstanceStateMask instance_states)
+{
+    return read_or_take_batch(data_values, sample_size, max_samples, sample_infos, num_samples,
+                   sample_states, view_states, instance_states, true);
+}
+
 ReturnCode_t DataReaderImpl::get_first_untaken_info(
         SampleInfo* info)
 {
@@ -771,6 +914,9 @@ ReturnCode_t DataReaderImpl::get_first_untaken_info(
         return ReturnCode_t::RETCODE_NOT_ENABLED;
     }
 
+    std::lock_guard<RecursiveTimedMutex> _(reader_->getMutex());
+    process_pending_changes_nts();
+
     if (history_.get_first_untaken_info(*info))
     {
         return ReturnCode_t::RETCODE_OK;
@@ -895,30 +1041,12 @@ void DataReaderImpl::InnerDataReaderListener::on_data_available(
         const SequenceNumber_t& last_sequence,
         bool& should_notify_individual_changes)
 {
+    FASTDDS_TRACEPOINT_SCOPE(tracepoint, "DataReader::on_data_available", writer_guid, last_sequence);
     should_notify_individual_changes = false;
 
     if (data_reader_->on_data_available(writer_guid, first_sequence, last_sequence))
     {
-        auto user_reader = data_reader_->user_datareader_;
-
-        //First check if we can handle with on_data_on_readers
-        SubscriberListener* subscriber_listener =
-                data_reader_->subscriber_->get_listener_for(StatusMask::data_on_readers());
-        if (subscriber_listener != nullptr)
-        {
-            subscriber_listener->on_data_on_readers(data_reader_->subscriber_->user_subscriber_);
-        }
-        else
-        {
-            // If not, try with on_data_available
-            DataReaderListener* listener = data_reader_->get_listener_for(StatusMask::data_available());
-            if (listener != nullptr)
-            {
-                listener->on_data_available(user_reader);
-            }
-        }
-
-        data_reader_->set_read_communication_status(true);
+        data_reader_->notify_data_available();
     }
 }
 
@@ -1054,6 +1182,25 @@ bool DataReaderImpl::on_data_available(
     bool ret_val = false;
 
     std::lock_guard<RecursiveTimedMutex> guard(reader_->getMutex());
+    if (nullptr != coalescing_timer_)
+    {
+        // Keep the range until enough samples are received, or the coalescing period expires
+        bool was_empty = pending_changes_.empty();
+        pending_changes_.push_back({writer_guid, first_sequence, last_sequence});
+        pending_samples_ += static_cast<uint32_t>((last_sequence - first_sequence).to64long()) + 1u;
+        if (pending_samples_ < notification_coalescing_samples_)
+        {
+            if (was_empty)
+            {
+                coalescing_timer_->restart_timer();
+            }
+            return false;
+        }
+
+        coalescing_timer_->cancel_timer();
+        return process_pending_changes_nts();
+    }
+
     for (auto seq = first_sequence; seq <= last_sequence; ++seq)
     {
         CacheChange_t* change = nullptr;
@@ -1069,9 +1216,74 @@ bool DataReaderImpl::on_data_available(
     return ret_val;
 }
 
+bool DataReaderImpl::process_pending_changes_nts()
+{
+    if (pending_changes_.empty())
+    {
+        return false;
+    }
+
+    bool ret_val = false;
+
+    for (const PendingChanges& pending : pending_changes_)
+    {
+        for (auto seq = pending.first_sequence; seq <= pending.last_sequence; ++seq)
+        {
+            CacheChange_t* change = nullptr;
+
+            // The change may have already been removed from the history
+            if (history_.get_change(seq, pending.writer_guid, &change))
+            {
+                ret_val |= on_new_cache_change_added(change);
+            }
+        }
+    }
+    pending_changes_.clear();
+    pending_samples_ = 0;
+
+    try_notify_read_conditions();
+
+    return ret_val;
+}
+
+void DataReaderImpl::notify_data_available()
+{
+    //First check if we can handle with on_data_on_readers
+    SubscriberListener* subscriber_listener = subscriber_->get_listener_for(StatusMask::data_on_readers());
+    if (subscriber_listener != nullptr)
+    {
+        subscriber_listener->on_data_on_readers(subscriber_->user_subscriber_);
+    }
+    else
+    {
+        // If not, try with on_data_available
+        DataReaderListener* listener = get_listener_for(StatusMask::data_available());
+        if (listener != nullptr)
+        {
+            listener->on_data_available(user_datareader_);
+        }
+    }
+
+    set_read_communication_status(true);
+}
+
+bool DataReaderImpl::coalescing_period_expired()
+{
+    std::lock_guard<RecursiveTimedMutex> guard(reader_->getMutex());
+
+    if (process_pending_changes_nts())
+    {
+        notify_data_available();
+    }
+
+    return false;
+}
+
 bool DataReaderImpl::on_new_cache_change_added(
         const CacheChange_t* const change)
 {
+    FASTDDS_TRACEPOINT_SCOPE(tracepoint, "DataReader::on_new_cache_change_added", change->writerGUID,
+            change->sequenceNumber);
     std::lock_guard<RecursiveTimedMutex> guard(reader_->getMutex());
 
     CacheChange_t* new_change = const_cast<CacheChange_t*>(change);
@@ -1780,6 +1992,7 @@ std::shared_ptr<IPayloadPool> DataReaderImpl::get_payload_pool()
     }
 
     PoolConfig config = PoolConfig::from_history_attributes(history_.m_att);
+    config.placement = subscriber_->rtps_participant()->getRTPSParticipantAttributes().allocation.payload_pools;
 
     if (!sample_pool_)
     {
@@ -22,12 +22,14 @@
 #ifndef DOXYGEN_SHOULD_SKIP_THIS_PUBLIC
 
 #include <mutex>
+#include <vector>
 
 #include <fastdds/dds/core/LoanableCollection.hpp>
 #include <fastdds/dds/core/LoanableSequence.hpp>
 #include <fastdds/dds/core/status/StatusMask.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleInfoBatch.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/topic/TypeSupport.hpp>
 #include <fastdds/dds/subscriber/ReadCondition.hpp>
@@ -74,6 +76,7 @@ using SampleInfoSeq = LoanableSequence<SampleInfo>;
 namespace detail {
 
 struct ReadTakeCommand;
+struct BatchReadTakeCommand;
 class ReadConditionImpl;
 
 } // namespace detail
@@ -85,6 +88,7 @@ class ReadConditionImpl;
 class DataReaderImpl
 {
     friend struct detail::ReadTakeCommand;
+    friend struct detail::BatchReadTakeCommand;
     friend class detail::ReadConditionImpl;
 
 protected:
@@ -192,6 +196,26 @@ public:
             void* data,
             SampleInfo* info);
 
+    ReturnCode_t read_batch(
+            void* data_values,
+            size_t sample_size,
+            int32_t max_samples,
+            SampleInfoBatch& sample_infos,
+            int32_t& num_samples,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
+    ReturnCode_t take_batch(
+            void* data_values,
+            size_t sample_size,
+            int32_t max_samples,
+            SampleInfoBatch& sample_infos,
+            int32_t& num_samples,
+            SampleStateMask sample_states = ANY_SAMPLE_STATE,
+            ViewStateMask view_states = ANY_VIEW_STATE,
+            InstanceStateMask instance_states = ANY_INSTANCE_STATE);
+
     ///@}
 
     ReturnCode_t return_loan(
@@ -486,6 +510,29 @@ protected:
     //! The lifespan duration
     std::chrono::duration<double, std::ratio<1, 1000000>> lifespan_duration_us_;
 
+    //! A range of changes of a writer pending to be processed
+    struct PendingChanges
+    {
+        fastrtps::rtps::GUID_t writer_guid;
+        fastrtps::rtps::SequenceNumber_t first_sequence;
+        fastrtps::rtps::SequenceNumber_t last_sequence;
+    };
+
+    //! Number of received samples after which data available is notified. Values below 2 disable coalescing
+    uint32_t notification_coalescing_samples_ = 0;
+
+    //! Maximum time, in microseconds, the notification of the received samples is delayed
+    uint32_t notification_coalescing_period_us_ = 0;
+
+    //! Changes received and not processed yet, while coalescing notifications
+    std::vector<PendingChanges> pending_changes_;
+
+    //! Number of samples in pending_changes_
+    uint32_t pending_samples_ = 0;
+
+    //! A timer used to notify pending changes when the coalescing period expires
+    fastrtps::rtps::TimedEvent* coalescing_timer_ = nullptr;
+
     DataReader* user_datareader_ = nullptr;
 
     std::shared_ptr<detail::SampleLoanManager> sample_pool_;
@@ -569,6 +616,17 @@ protected:
             SampleInfo* info,
             bool should_take);
 
+    ReturnCode_t read_or_take_batch(
+            void* data_values,
+            size_t sample_size,
+            int32_t max_samples,
+            SampleInfoBatch& sample_infos,
+            int32_t& num_samples,
+            SampleStateMask sample_states,
+            ViewStateMask view_states,
+            InstanceStateMask instance_states,
+            bool should_take);
+
     void set_read_communication_status(
             bool trigger_value);
 
@@ -580,6 +638,23 @@ protected:
             const fastrtps::rtps::SequenceNumber_t& first_sequence,
             const fastrtps::rtps::SequenceNumber_t& last_sequence);
 
+    /**
+     * @brief Processes the changes whose notification was being coalesced.
+     * The reader mutex should be locked when calling this method.
+     * @return True if any of the changes was added to the history of an instance
+     */
+    bool process_pending_changes_nts();
+
+    /**
+     * @brief Notifies data available to the listeners and sets the read communication status.
+     */
+    void notify_data_available();
+
+    /**
+     * @brief A method called when the notification coalescing timer expires
+     */
+    bool coalescing_period_expired();
+
     /**
      * @brief A method called when a new cache change is added
      * @param change The cache change that has been added
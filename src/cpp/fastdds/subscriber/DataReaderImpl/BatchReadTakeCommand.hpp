@@ -0,0 +1,393 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BatchReadTakeCommand.hpp
+ */
+
+#ifndef _FASTDDS_SUBSCRIBER_DATAREADERIMPL_BATCHREADTAKECOMMAND_HPP_
+#define _FASTDDS_SUBSCRIBER_DATAREADERIMPL_BATCHREADTAKECOMMAND_HPP_
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+
+#include <fastdds/dds/subscriber/SampleInfoBatch.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include <fastrtps/types/TypesBase.h>
+
+#include <fastdds/subscriber/DataReaderImpl.hpp>
+#include <fastdds/subscriber/DataReaderImpl/StateFilter.hpp>
+#include <fastdds/subscriber/history/DataReaderHistory.hpp>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+
+#include <rtps/reader/WriterProxy.h>
+#include <rtps/DataSharing/DataSharingPayloadPool.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace dds {
+namespace detail {
+
+/**
+ * Traverses the history like ReadTakeCommand, but copies the samples of a plain type straight from the payloads
+ * into a contiguous caller-provided array, and fills the sample information on a SampleInfoBatch.
+ * No type support method is called per sample, and no loans are involved.
+ */
+struct BatchReadTakeCommand
+{
+    using ReturnCode_t = eprosima::fastrtps::types::ReturnCode_t;
+    using history_type = eprosima::fastdds::dds::detail::DataReaderHistory;
+    using CacheChange_t = eprosima::fastrtps::rtps::CacheChange_t;
+    using RTPSReader = eprosima::fastrtps::rtps::RTPSReader;
+    using WriterProxy = eprosima::fastrtps::rtps::WriterProxy;
+    using DataSharingPayloadPool = eprosima::fastrtps::rtps::DataSharingPayloadPool;
+    using SerializedPayload_t = eprosima::fastrtps::rtps::SerializedPayload_t;
+
+    BatchReadTakeCommand(
+            DataReaderImpl& reader,
+            void* data_values,
+            size_t sample_size,
+            int32_t max_samples,
+            SampleInfoBatch& sample_infos,
+            const StateFilter& states,
+            const history_type::instance_info& instance)
+        : type_(reader.type_)
+        , history_(reader.history_)
+        , reader_(reader.reader_)
+        , data_values_(static_cast<uint8_t*>(data_values))
+        , sample_size_(sample_size)
+        , sample_infos_(sample_infos)
+        , remaining_samples_(max_samples)
+        , states_(states)
+        , instance_(instance)
+        , handle_(instance->first)
+    {
+        assert(0 < remaining_samples_);
+        assert(nullptr != data_values_);
+    }
+
+    bool add_instance(
+            bool take_samples)
+    {
+        // Advance to the first instance with a valid state
+        if (!go_to_first_valid_instance())
+        {
+            return false;
+        }
+
+        // Traverse changes on current instance
+        int32_t first_slot = current_slot_;
+        auto it = instance_->second->cache_changes.begin();
+        while (!finished_ && it != instance_->second->cache_changes.end())
+        {
+            CacheChange_t* change = *it;
+            SampleStateKind check;
+            check = change->isRead ? SampleStateKind::READ_SAMPLE_STATE : SampleStateKind::NOT_READ_SAMPLE_STATE;
+            if ((check & states_.sample_states) != 0)
+            {
+                WriterProxy* wp = nullptr;
+                bool is_future_change = false;
+                bool remove_change = false;
+                if (reader_->begin_sample_access_nts(change, wp, is_future_change))
+                {
+                    //Check if the payload is dirty
+                    remove_change = !check_datasharing_validity(change);
+                }
+                else
+                {
+                    remove_change = true;
+                }
+
+                if (remove_change)
+                {
+                    // Remove from history
+                    history_.remove_change_sub(change, it);
+
+                    // Current iterator will point to change next to the one removed. Avoid incrementing.
+                    continue;
+                }
+
+                // If the change is in the future we can skip the remaining changes in the history, as they will be
+                // in the future also
+                if (!is_future_change)
+                {
+                    // Add sample and info to the batch
+                    ReturnCode_t previous_return_value = return_value_;
+                    bool added = add_sample(*it, remove_change);
+                    history_.change_was_processed_nts(change, added);
+                    reader_->end_sample_access_nts(change, wp, added);
+
+                    // Check if the payload was overridden while being copied
+                    if (added && !check_datasharing_validity(change))
+                    {
+                        --current_slot_;
+                        ++remaining_samples_;
+                        return_value_ = previous_return_value;
+                        finished_ = false;
+
+                        remove_change = true;
+                        added = false;
+                    }
+
+                    if (remove_change || (added && take_samples))
+                    {
+                        // Remove from history
+                        history_.remove_change_sub(change, it);
+
+                        // Current iterator will point to change next to the one removed. Avoid incrementing.
+                        continue;
+                    }
+                }
+            }
+
+            // Go to next sample on instance
+            ++it;
+        }
+
+        bool ret_val = false;
+        if (current_slot_ > first_slot)
+        {
+            history_.instance_viewed_nts(instance_->second);
+            ret_val = true;
+
+            // complete sample ranks
+            if (nullptr != sample_infos_.sample_ranks)
+            {
+                int32_t n = 0;
+                for (int32_t slot = current_slot_; slot > first_slot; ++n)
+                {
+                    sample_infos_.sample_ranks[--slot] = n;
+                }
+            }
+        }
+
+        next_instance();
+
+        return ret_val;
+    }
+
+    inline bool is_finished() const
+    {
+        return finished_;
+    }
+
+    inline ReturnCode_t return_value() const
+    {
+        return return_value_;
+    }
+
+    //! @return the number of samples added to the batch
+    inline int32_t num_samples() const
+    {
+        return current_slot_;
+    }
+
+private:
+
+    const TypeSupport& type_;
+    history_type& history_;
+    RTPSReader* reader_;
+    uint8_t* data_values_;
+    size_t sample_size_;
+    SampleInfoBatch& sample_infos_;
+    int32_t remaining_samples_;
+    StateFilter states_;
+    history_type::instance_info instance_;
+    InstanceHandle_t handle_;
+
+    bool finished_ = false;
+    ReturnCode_t return_value_ = ReturnCode_t::RETCODE_NO_DATA;
+
+    int32_t current_slot_ = 0;
+
+    bool go_to_first_valid_instance()
+    {
+        while (!is_current_instance_valid())
+        {
+            if (!next_instance())
+            {
+                finished_ = true;
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool is_current_instance_valid()
+    {
+        // Check instance_state against states_.instance_states and view_state against states_.view_states
+        auto instance_state = instance_->second->instance_state;
+        auto view_state = instance_->second->view_state;
+        return (0 != (states_.instance_states & instance_state)) && (0 != (states_.view_states & view_state));
+    }
+
+    bool next_instance()
+    {
+        history_.check_and_remove_instance(instance_);
+
+        auto result = history_.next_available_instance_nts(handle_, instance_);
+        if (!result.first)
+        {
+            finished_ = true;
+            return false;
+        }
+
+        instance_ = result.second;
+        handle_ = instance_->first;
+        return true;
+    }
+
+    bool add_sample(
+            const DataReaderCacheChange& item,
+            bool& deserialization_error)
+    {
+        bool ret_val = false;
+        deserialization_error = false;
+
+        if (remaining_samples_ > 0)
+        {
+            bool valid_data = (eprosima::fastrtps::rtps::ALIVE == item->kind);
+            if (valid_data && !copy_sample(item))
+            {
+                deserialization_error = true;
+                return false;
+            }
+
+            generate_info(item, valid_data);
+
+            // Mark that some data is available
+            return_value_ = ReturnCode_t::RETCODE_OK;
+            ++current_slot_;
+            --remaining_samples_;
+            ret_val = true;
+        }
+
+        // Finish when there are no remaining samples
+        finished_ = (remaining_samples_ == 0);
+        return ret_val;
+    }
+
+    bool copy_sample(
+            CacheChange_t* change)
+    {
+        SerializedPayload_t& payload = change->serializedPayload;
+        if (payload.length < SerializedPayload_t::representation_header_size)
+        {
+            return false;
+        }
+
+        uint8_t* sample = data_values_ + (static_cast<size_t>(current_slot_) * sample_size_);
+
+        // The encapsulation on the representation header is the one used by the writer, as the encapsulation field
+        // of received payloads is not filled. Its lowest bit tells the byte order of the serialized data.
+        uint16_t encapsulation = static_cast<uint16_t>((payload.data[0] << 8) | payload.data[1]);
+        if ((encapsulation & 0x1) != (DEFAULT_ENCAPSULATION & 0x1))
+        {
+            // Swapping the bytes requires knowing the type, so leave it to the type support
+            return type_->deserialize(&payload, sample);
+        }
+
+        // Plain types are serialized with the same layout they have in memory, right after the encapsulation
+        size_t copy_size = (std::min)(sample_size_,
+                        static_cast<size_t>(payload.length - SerializedPayload_t::representation_header_size));
+        memcpy(sample, payload.data + SerializedPayload_t::representation_header_size, copy_size);
+        if (copy_size < sample_size_)
+        {
+            memset(sample + copy_size, 0, sample_size_ - copy_size);
+        }
+        return true;
+    }
+
+    void generate_info(
+            const DataReaderCacheChange& item,
+            bool valid_data)
+    {
+        const DataReaderInstance& instance = *instance_->second;
+        if (nullptr != sample_infos_.sample_states)
+        {
+            sample_infos_.sample_states[current_slot_] = item->isRead ? READ_SAMPLE_STATE : NOT_READ_SAMPLE_STATE;
+        }
+        if (nullptr != sample_infos_.view_states)
+        {
+            sample_infos_.view_states[current_slot_] = instance.view_state;
+        }
+        if (nullptr != sample_infos_.instance_states)
+        {
+            sample_infos_.instance_states[current_slot_] = instance.instance_state;
+        }
+        if (nullptr != sample_infos_.sample_ranks)
+        {
+            sample_infos_.sample_ranks[current_slot_] = 0;
+        }
+        if (nullptr != sample_infos_.source_timestamps)
+        {
+            sample_infos_.source_timestamps[current_slot_] = item->sourceTimestamp;
+        }
+        if (nullptr != sample_infos_.reception_timestamps)
+        {
+            sample_infos_.reception_timestamps[current_slot_] = item->reader_info.receptionTimestamp;
+        }
+        if (nullptr != sample_infos_.instance_handles)
+        {
+            sample_infos_.instance_handles[current_slot_] = item->instanceHandle;
+        }
+        if (nullptr != sample_infos_.publication_handles)
+        {
+            sample_infos_.publication_handles[current_slot_] = InstanceHandle_t(item->writerGUID);
+        }
+        if (nullptr != sample_infos_.sequence_numbers)
+        {
+            sample_infos_.sequence_numbers[current_slot_] = item->sequenceNumber;
+        }
+        if (nullptr != sample_infos_.valid_data)
+        {
+            sample_infos_.valid_data[current_slot_] = valid_data;
+        }
+    }
+
+    bool check_datasharing_validity(
+            CacheChange_t* change)
+    {
+        bool is_valid = true;
+        DataSharingPayloadPool* pool = dynamic_cast<DataSharingPayloadPool*>(change->payload_owner());
+        if (pool)
+        {
+            //Check if the payload is dirty
+            is_valid = pool->is_sample_valid(*change);
+        }
+
+        if (!is_valid)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_READER,
+                    "Change " << change->sequenceNumber << " from " << change->writerGUID << " is overidden");
+            return false;
+        }
+
+        return true;
+    }
+
+};
+
+} /* namespace detail */
+} /* namespace dds */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif  // _FASTDDS_SUBSCRIBER_DATAREADERIMPL_BATCHREADTAKECOMMAND_HPP_
@@ -41,6 +41,7 @@
 
 #include <rtps/reader/WriterProxy.h>
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
+#include <utils/tracing/Tracepoints.hpp>
 
 
 namespace eprosima {
@@ -147,6 +148,11 @@ struct ReadTakeCommand
                     // Add sample and info to collections
                     ReturnCode_t previous_return_value = return_value_;
                     bool added = add_sample(*it, remove_change);
+                    if (added)
+                    {
+                        FASTDDS_TRACEPOINT_INSTANT(take_samples ? "DataReader::take" : "DataReader::read",
+                                change->writerGUID, change->sequenceNumber);
+                    }
                     history_.change_was_processed_nts(change, added);
                     reader_->end_sample_access_nts(change, wp, added);
 
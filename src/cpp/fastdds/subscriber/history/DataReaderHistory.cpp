@@ -16,6 +16,7 @@
  * @file DataReaderHistory.cpp
  */
 
+#include <algorithm>
 #include <limits>
 #include <memory>
 #include <mutex>
@@ -389,6 +390,8 @@ bool DataReaderHistory::find_key(
     {
         if (InstanceStateKind::ALIVE_INSTANCE_STATE != vit->second->instance_state)
         {
+            // A disposed instance keeps its alive writers, which should not index it anymore
+            remove_instance_writers(vit->first, *vit->second);
             data_available_instances_.erase(vit->first);
             instances_.erase(vit);
             vit_out = instances_.emplace(handle,
@@ -535,7 +538,12 @@ bool DataReaderHistory::set_next_deadline(
 
     if (deadline_missed)
     {
+        GUID_t owner = it->second->current_owner.first;
         it->second->deadline_missed();
+        if (!is_writer_alive(*it->second, owner))
+        {
+            remove_writer_instance(owner, handle);
+        }
     }
     it->second->next_deadline_us = next_deadline_us;
     return true;
@@ -850,9 +858,36 @@ bool DataReaderHistory::update_instance_nts(
     assert(vit != instances_.end());
     assert(false == change->isRead);
     ++counters_.samples_unread;
+
+    // A disposed instance becoming alive again drops all of its alive writers, so its index entries are rebuilt
+    bool was_disposed = InstanceStateKind::NOT_ALIVE_DISPOSED_INSTANCE_STATE == vit->second->instance_state;
+    if (was_disposed)
+    {
+        remove_instance_writers(vit->first, *vit->second);
+    }
+
+    bool was_alive = is_writer_alive(*vit->second, change->writerGUID);
     bool ret =
             vit->second->update_state(counters_, change->kind, change->writerGUID,
                     change->reader_info.writer_ownership_strength);
+    bool is_alive = is_writer_alive(*vit->second, change->writerGUID);
+
+    // Keep the index of instances per writer up to date
+    if (was_disposed)
+    {
+        for (const DataReaderInstance::WriterOwnership& writer : vit->second->alive_writers)
+        {
+            writer_instances_[writer.first].insert(vit->first);
+        }
+    }
+    else if (is_alive && !was_alive)
+    {
+        writer_instances_[change->writerGUID].insert(vit->first);
+    }
+    else if (was_alive && !is_alive)
+    {
+        remove_writer_instance(change->writerGUID, vit->first);
+    }
     change->reader_info.disposed_generation_count = vit->second->disposed_generation_count;
     change->reader_info.no_writers_generation_count = vit->second->no_writers_generation_count;
 
@@ -862,10 +897,22 @@ bool DataReaderHistory::update_instance_nts(
 void DataReaderHistory::writer_not_alive(
         const GUID_t& writer_guid)
 {
-    for (auto& it : instances_)
+    auto wit = writer_instances_.find(writer_guid);
+    if (wit == writer_instances_.end())
+    {
+        return;
+    }
+
+    for (const InstanceHandle_t& handle : wit->second)
     {
-        it.second->writer_removed(counters_, writer_guid);
+        auto it = instances_.find(handle);
+        if (it != instances_.end())
+        {
+            it->second->writer_removed(counters_, writer_guid);
+        }
     }
+
+    writer_instances_.erase(wit);
 }
 
 StateFilter DataReaderHistory::get_mask_status() const noexcept
@@ -890,12 +937,69 @@ void DataReaderHistory::writer_update_its_ownership_strength_nts(
         const GUID_t& writer_guid,
         const uint32_t ownership_strength)
 {
-    for (auto& instance : instances_)
+    auto wit = writer_instances_.find(writer_guid);
+    if (wit == writer_instances_.end())
+    {
+        return;
+    }
+
+    // Instances on which the writer is no longer alive are dropped from the index on the way
+    for (auto hit = wit->second.begin(); hit != wit->second.end();)
+    {
+        auto it = instances_.find(*hit);
+        if (it != instances_.end() && is_writer_alive(*it->second, writer_guid))
+        {
+            it->second->writer_update_its_ownership_strength(writer_guid, ownership_strength);
+            ++hit;
+        }
+        else
+        {
+            hit = wit->second.erase(hit);
+        }
+    }
+
+    if (wit->second.empty())
+    {
+        writer_instances_.erase(wit);
+    }
+}
+
+void DataReaderHistory::remove_writer_instance(
+        const GUID_t& writer_guid,
+        const InstanceHandle_t& handle)
+{
+    auto wit = writer_instances_.find(writer_guid);
+    if (wit != writer_instances_.end())
     {
-        instance.second->writer_update_its_ownership_strength(writer_guid, ownership_strength);
+        wit->second.erase(handle);
+        if (wit->second.empty())
+        {
+            writer_instances_.erase(wit);
+        }
+    }
+}
+
+void DataReaderHistory::remove_instance_writers(
+        const InstanceHandle_t& handle,
+        const DataReaderInstance& instance)
+{
+    for (const DataReaderInstance::WriterOwnership& writer : instance.alive_writers)
+    {
+        remove_writer_instance(writer.first, handle);
     }
 }
 
+bool DataReaderHistory::is_writer_alive(
+        const DataReaderInstance& instance,
+        const GUID_t& writer_guid)
+{
+    return std::any_of(instance.alive_writers.begin(), instance.alive_writers.end(),
+                   [&writer_guid](const DataReaderInstance::WriterOwnership& item)
+                   {
+                       return item.first == writer_guid;
+                   });
+}
+
 } // namespace detail
 } // namsepace dds
 } // namespace fastdds
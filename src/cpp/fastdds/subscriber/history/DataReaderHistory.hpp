@@ -23,6 +23,7 @@
 #include <functional>
 #include <map>
 #include <memory>
+#include <set>
 #include <utility>
 
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
@@ -366,6 +367,18 @@ public:
             const GUID_t& writer_guid,
             const uint32_t ownership_strength) override;
 
+    /*!
+     * @brief Number of instances indexed for a writer, which are those on which the writer is alive.
+     *
+     * @param[in] writer_guid Guid of the writer.
+     */
+    size_t writer_instances_count_nts(
+            const GUID_t& writer_guid) const
+    {
+        auto wit = writer_instances_.find(writer_guid);
+        return wit == writer_instances_.end() ? 0u : wit->second.size();
+    }
+
 private:
 
     //!Resource limits for allocating the array of changes per instance
@@ -376,6 +389,8 @@ private:
     InstanceCollection instances_;
     //!Collection of DataReaderInstance objects with available data, accessible by their handle
     InstanceCollection data_available_instances_;
+    //!Handles of the instances on which each writer is alive, to only visit those on writer events.
+    std::map<GUID_t, std::set<InstanceHandle_t>> writer_instances_;
     //!HistoryQosPolicy values.
     HistoryQosPolicy history_qos_;
     //!ResourceLimitsQosPolicy values.
@@ -466,6 +481,20 @@ private:
             CacheChange_t* a_change,
             DataReaderInstance& instance);
 
+    static bool is_writer_alive(
+            const DataReaderInstance& instance,
+            const GUID_t& writer_guid);
+
+    //! Removes an instance from the handles indexed for a writer
+    void remove_writer_instance(
+            const GUID_t& writer_guid,
+            const InstanceHandle_t& handle);
+
+    //! Removes an instance from the handles indexed for each of its alive writers
+    void remove_instance_writers(
+            const InstanceHandle_t& handle,
+            const DataReaderInstance& instance);
+
 };
 
 } // namespace detail
@@ -162,6 +162,7 @@ void set_qos_from_attributes(
 #if HAVE_SECURITY
     qos.security_log_thread() = attr.security_log_thread;
 #endif // if HAVE_SECURITY
+    qos.thread_topology() = attr.thread_topology;
 
     // Merge attributes and qos properties
     for (auto property : attr.properties.properties())
@@ -208,6 +209,7 @@ void set_attributes_from_qos(
 #if HAVE_SECURITY
     attr.security_log_thread = qos.security_log_thread();
 #endif // if HAVE_SECURITY
+    attr.thread_topology = qos.thread_topology();
 }
 
 void set_qos_from_attributes(
@@ -101,7 +101,8 @@ std::shared_ptr<DataSharingPayloadPool> DataSharingPayloadPool::get_writer_pool(
 
     return std::make_shared<WriterPool>(
         config.maximum_size,
-        config.payload_initial_size);
+        config.payload_initial_size,
+        config.placement);
 }
 
 }  // namespace rtps
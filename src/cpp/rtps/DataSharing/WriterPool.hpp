@@ -25,6 +25,7 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <rtps/DataSharing/DataSharingPayloadPool.hpp>
 #include <utils/collections/FixedSizeQueue.hpp>
+#include <utils/memory/MemoryPlacement.hpp>
 
 #include <memory>
 
@@ -39,11 +40,13 @@ public:
 
     WriterPool(
             uint32_t pool_size,
-            uint32_t payload_size)
+            uint32_t payload_size,
+            const PayloadPoolsAllocationAttributes& placement = PayloadPoolsAllocationAttributes())
         : max_data_size_(payload_size)
         , pool_size_(pool_size)
         , free_history_size_(0)
         , writer_(nullptr)
+        , placement_(placement)
     {
     }
 
@@ -210,6 +213,18 @@ public:
             // which is not considered in sizeof(PayloadNode).
             payloads_pool_ = static_cast<octet*>(local_segment->get().allocate(size_for_payloads_pool));
 
+            utilities::memory::MemoryPlacement memory_placement;
+            memory_placement.use_huge_pages = placement_.use_huge_pages;
+            memory_placement.prefault = placement_.prefault;
+            memory_placement.numa_node = placement_.numa_node;
+            if (!memory_placement.is_default() &&
+                    !utilities::memory::apply_memory_placement(payloads_pool_, size_for_payloads_pool,
+                    memory_placement))
+            {
+                EPROSIMA_LOG_WARNING(DATASHARING_PAYLOADPOOL, "Could not apply the requested memory placement to "
+                        << segment_name_);
+            }
+
             // Initialize each node in the pool
             free_payloads_.init(pool_size_);
             octet* payload = payloads_pool_;
@@ -363,6 +378,8 @@ private:
 
     const RTPSWriter* writer_;      //< Writer that is owner of the pool
 
+    PayloadPoolsAllocationAttributes placement_;    //< Placement of the memory of the payloads
+
     bool is_initialized_ = false;   //< Whether the pool has been initialized on shared memory
 
 };
@@ -1279,6 +1279,38 @@ void ReaderProxyData::set_remote_locators(
     }
 }
 
+void ReaderProxyData::shm_payload_descriptors(
+        bool accepted)
+{
+    std::pair<std::string, std::string> pair(fastdds::dds::parameter_shm_payload_descriptors,
+            accepted ? "true" : "false");
+    auto it = std::find_if(m_properties.begin(), m_properties.end(),
+                    [&pair](const ParameterPropertyList_t::const_iterator::reference p)
+                    {
+                        return pair.first == p.first();
+                    });
+    if (it != m_properties.end())
+    {
+        m_properties.set_property(it, pair);
+    }
+    else
+    {
+        m_properties.push_back(pair);
+    }
+}
+
+bool ReaderProxyData::shm_payload_descriptors() const
+{
+    for (const auto& property : m_properties)
+    {
+        if (fastdds::dds::parameter_shm_payload_descriptors == property.first())
+        {
+            return "true" == property.second();
+        }
+    }
+    return false;
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
@@ -58,6 +58,8 @@ DiscoveryDataBase::~DiscoveryDataBase()
 
     if (is_persistent_)
     {
+        // Writes the pending records before closing the files
+        backup_writer_.reset();
         backup_file_.close();
     }
 }
@@ -338,10 +340,7 @@ bool DiscoveryDataBase::update(
     {
         // Does not allow to the server to erase the ddb before this message has been processed
         std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        backup_change_(change);
     }
 
     if (!enabled_)
@@ -370,10 +369,7 @@ bool DiscoveryDataBase::update(
     {
         // Does not allow to the server to erase the ddb before this message has been process
         std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
-        nlohmann::json j;
-        ddb::to_json(j, *change);
-        backup_file_ << j;
-        backup_file_.flush();
+        backup_change_(change);
     }
 
     if (!enabled_)
@@ -678,7 +674,7 @@ void DiscoveryDataBase::create_new_participant_from_change_(
 {
     fastrtps::rtps::GUID_t change_guid = guid_from_change(ch);
 
-    std::pair<std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator, bool> ret =
+    std::pair<ParticipantsMap::iterator, bool> ret =
             participants_.insert(
         std::make_pair(
             change_guid.guidPrefix,
@@ -863,7 +859,7 @@ void DiscoveryDataBase::create_writers_from_change_(
             topic_name == virtual_topic_,
             server_guid_prefix_);
 
-        std::pair<std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator, bool> ret =
+        std::pair<EndpointsMap::iterator, bool> ret =
                 writers_.insert(std::make_pair(writer_guid, tmp_writer));
         if (!ret.second)
         {
@@ -876,7 +872,7 @@ void DiscoveryDataBase::create_writers_from_change_(
         new_updates_++;
 
         // Add entry to participants_[guid_prefix]::writers
-        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
+        ParticipantsMap::iterator writer_part_it =
                 participants_.find(writer_guid.guidPrefix);
         if (writer_part_it != participants_.end())
         {
@@ -981,7 +977,7 @@ void DiscoveryDataBase::create_readers_from_change_(
             topic_name == virtual_topic_,
             server_guid_prefix_);
 
-        std::pair<std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator, bool> ret =
+        std::pair<EndpointsMap::iterator, bool> ret =
                 readers_.insert(std::make_pair(reader_guid, tmp_reader));
         if (!ret.second)
         {
@@ -994,7 +990,7 @@ void DiscoveryDataBase::create_readers_from_change_(
         new_updates_++;
 
         // Add entry to participants_[guid_prefix]::readers
-        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
+        ParticipantsMap::iterator reader_part_it =
                 participants_.find(reader_guid.guidPrefix);
         if (reader_part_it != participants_.end())
         {
@@ -1233,7 +1229,7 @@ void DiscoveryDataBase::process_dispose_participant_(
     const eprosima::fastrtps::rtps::GUID_t& participant_guid = guid_from_change(ch);
 
     // Change DATA(p) with DATA(Up) in participants map
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator pit =
+    ParticipantsMap::iterator pit =
             participants_.find(participant_guid.guidPrefix);
     if (pit != participants_.end())
     {
@@ -1303,7 +1299,7 @@ void DiscoveryDataBase::process_dispose_writer_(
     const eprosima::fastrtps::rtps::GUID_t& writer_guid = guid_from_change(ch);
 
     // Check if the writer is still alive (if DATA(Up) is processed before it will be erased)
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator wit = writers_.find(writer_guid);
+    EndpointsMap::iterator wit = writers_.find(writer_guid);
     if (wit != writers_.end())
     {
         // Change DATA(w) with DATA(Uw)
@@ -1333,7 +1329,7 @@ void DiscoveryDataBase::process_dispose_reader_(
 
     // Check if the writer is still alive (if DATA(Up) is processed before it will be erased)
 
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator rit = readers_.find(reader_guid);
+    EndpointsMap::iterator rit = readers_.find(reader_guid);
     if (rit != readers_.end())
     {
         // Change DATA(r) with DATA(Ur)
@@ -1368,118 +1364,53 @@ bool DiscoveryDataBase::process_dirty_topics()
     // Get shared lock
     std::lock_guard<std::recursive_mutex> guard(mutex_);
 
-    // Iterator objects are declared here because they are reused in each iteration of the loops
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_reader_it;
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator parts_writer_it;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator readers_it;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator writers_it;
-
-    // Iterate over dirty_topics_
-    for (auto topic_it = dirty_topics_.begin(); topic_it != dirty_topics_.end();)
+    // The topics are evaluated only reading the database, so they can be processed in parallel.
+    // Their results are applied afterwards in the order of dirty_topics_, so the changes to send are the same
+    // regardless of the number of threads
+    std::vector<DirtyTopicResult> results(dirty_topics_.size());
+    if (workers_ && dirty_topics_.size() > 1)
     {
-        EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Processing topic: " << *topic_it);
-        // Flag to store whether a topic can be cleared.
-        bool is_clearable = true;
-
-        // Get all the writers in the topic
-        std::vector<fastrtps::rtps::GUID_t> writers;
-        auto ret = writers_by_topic_.find(*topic_it);
-        if (ret != writers_by_topic_.end())
-        {
-            writers = ret->second;
-        }
-        // Get all the readers in the topic
-        std::vector<fastrtps::rtps::GUID_t> readers;
-        ret = readers_by_topic_.find(*topic_it);
-        if (ret != readers_by_topic_.end())
+        std::vector<std::vector<size_t>> shards(workers_->num_shards());
+        std::hash<std::string> topic_hash;
+        for (size_t i = 0; i < dirty_topics_.size(); ++i)
         {
-            readers = ret->second;
+            shards[topic_hash(dirty_topics_[i]) % shards.size()].push_back(i);
         }
 
-        for (fastrtps::rtps::GUID_t writer: writers)
-        // Iterate over writers in the topic:
-        {
-            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "[" << *topic_it << "]" << " Processing writer: " << writer);
-            // Iterate over readers in the topic:
-            for (fastrtps::rtps::GUID_t reader : readers)
-            {
-                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "[" << *topic_it << "]" << " Processing reader: " << reader);
-                // Find participants with writer info and participant with reader info in participants_
-                parts_reader_it = participants_.find(reader.guidPrefix);
-                parts_writer_it = participants_.find(writer.guidPrefix);
-                // Find reader info in readers_
-                readers_it = readers_.find(reader);
-                // Find writer info in writers_
-                writers_it = writers_.find(writer);
-
-                // Check in `participants_` whether the client with the reader has acknowledge the PDP of the client
-                // with the writer.
-                if (parts_reader_it != participants_.end())
+        workers_->run([this, &shards, &results](uint32_t shard)
                 {
-                    if (parts_reader_it->second.is_matched(writer.guidPrefix))
-                    {
-                        // Check the status of the writer in `readers_[reader]::relevant_participants_builtin_ack_status`.
-                        if (readers_it != readers_.end() &&
-                                readers_it->second.is_relevant_participant(writer.guidPrefix) &&
-                                !readers_it->second.is_matched(writer.guidPrefix))
-                        {
-                            // If the status is 0, add DATA(r) to a `edp_publications_to_send_` (if it's not there).
-                            if (add_edp_subscriptions_to_send_(readers_it->second.change()))
-                            {
-                                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(r) to send: "
-                                        << readers_it->second.change()->instanceHandle);
-                            }
-                        }
-                    }
-                    else if (parts_reader_it->second.is_relevant_participant(writer.guidPrefix))
+                    for (size_t i : shards[shard])
                     {
-                        // Add DATA(p) of the client with the writer to `pdp_to_send_` (if it's not there).
-                        if (add_pdp_to_send_(parts_reader_it->second.change()))
-                        {
-                            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind readers' DATA(p) to send: "
-                                    << parts_reader_it->second.change()->instanceHandle);
-                        }
-                        // Set topic as not-clearable.
-                        is_clearable = false;
+                        process_dirty_topic_(dirty_topics_[i], results[i]);
                     }
-                }
+                });
+    }
+    else
+    {
+        for (size_t i = 0; i < dirty_topics_.size(); ++i)
+        {
+            process_dirty_topic_(dirty_topics_[i], results[i]);
+        }
+    }
 
-                // Check in `participants_` whether the client with the writer has acknowledge the PDP of the client
-                // with the reader.
-                if (parts_writer_it != participants_.end())
-                {
-                    if (parts_writer_it->second.is_matched(reader.guidPrefix))
-                    {
-                        // Check the status of the reader in `writers_[writer]::relevant_participants_builtin_ack_status`.
-                        if (writers_it != writers_.end() &&
-                                writers_it->second.is_relevant_participant(reader.guidPrefix) &&
-                                !writers_it->second.is_matched(reader.guidPrefix))
-                        {
-                            // If the status is 0, add DATA(w) to a `edp_subscriptions_to_send_` (if it's not there).
-                            if (add_edp_publications_to_send_(writers_it->second.change()))
-                            {
-                                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind DATA(w) to send: "
-                                        << writers_it->second.change()->instanceHandle);
-                            }
-                        }
-                    }
-                    else if (parts_writer_it->second.is_relevant_participant(reader.guidPrefix))
-                    {
-                        // Add DATA(p) of the client with the reader to `pdp_to_send_` (if it's not there).
-                        if (add_pdp_to_send_(parts_writer_it->second.change()))
-                        {
-                            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Addind writers' DATA(p) to send: "
-                                    << parts_writer_it->second.change()->instanceHandle);
-                        }
-                        // Set topic as not-clearable.
-                        is_clearable = false;
-                    }
-                }
-            }
+    auto result_it = results.begin();
+    for (auto topic_it = dirty_topics_.begin(); topic_it != dirty_topics_.end(); ++result_it)
+    {
+        for (fastrtps::rtps::CacheChange_t* change : result_it->pdp_to_send)
+        {
+            add_pdp_to_send_(change);
+        }
+        for (fastrtps::rtps::CacheChange_t* change : result_it->edp_publications_to_send)
+        {
+            add_edp_publications_to_send_(change);
+        }
+        for (fastrtps::rtps::CacheChange_t* change : result_it->edp_subscriptions_to_send)
+        {
+            add_edp_subscriptions_to_send_(change);
         }
 
         // Check whether the topic is still dirty or it can be cleared
-        if (is_clearable)
+        if (result_it->is_clearable)
         {
             // Delete topic from dirty_topics_
             EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Topic " << *topic_it << " has been cleaned");
@@ -1499,6 +1430,100 @@ bool DiscoveryDataBase::process_dirty_topics()
     return !dirty_topics_.empty();
 }
 
+void DiscoveryDataBase::process_dirty_topic_(
+        const std::string& topic,
+        DirtyTopicResult& result) const
+{
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Processing topic: " << topic);
+
+    // Add a change to one of the collections of the result, unless it is already there
+    auto add_to_send = [](
+        std::vector<fastrtps::rtps::CacheChange_t*>& to_send,
+        fastrtps::rtps::CacheChange_t* change)
+            {
+                if (std::find(to_send.begin(), to_send.end(), change) == to_send.end())
+                {
+                    to_send.push_back(change);
+                }
+            };
+
+    // Get all the writers and readers in the topic
+    static const std::vector<fastrtps::rtps::GUID_t> no_endpoints;
+    auto ret = writers_by_topic_.find(topic);
+    const std::vector<fastrtps::rtps::GUID_t>& writers =
+            ret != writers_by_topic_.end() ? ret->second : no_endpoints;
+    ret = readers_by_topic_.find(topic);
+    const std::vector<fastrtps::rtps::GUID_t>& readers =
+            ret != readers_by_topic_.end() ? ret->second : no_endpoints;
+
+    // Iterate over writers in the topic:
+    for (const fastrtps::rtps::GUID_t& writer : writers)
+    {
+        EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "[" << topic << "]" << " Processing writer: " << writer);
+        // Find participant with writer info in participants_
+        auto parts_writer_it = participants_.find(writer.guidPrefix);
+        // Find writer info in writers_
+        auto writers_it = writers_.find(writer);
+
+        // Iterate over readers in the topic:
+        for (const fastrtps::rtps::GUID_t& reader : readers)
+        {
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "[" << topic << "]" << " Processing reader: " << reader);
+            // Find participant with reader info in participants_
+            auto parts_reader_it = participants_.find(reader.guidPrefix);
+
+            // Check in `participants_` whether the client with the reader has acknowledge the PDP of the client
+            // with the writer.
+            if (parts_reader_it != participants_.end())
+            {
+                if (parts_reader_it->second.is_matched(writer.guidPrefix))
+                {
+                    // Check the status of the writer in `readers_[reader]::relevant_participants_builtin_ack_status`.
+                    auto readers_it = readers_.find(reader);
+                    if (readers_it != readers_.end() &&
+                            readers_it->second.is_relevant_participant(writer.guidPrefix) &&
+                            !readers_it->second.is_matched(writer.guidPrefix))
+                    {
+                        // If the status is 0, add DATA(r) to a `edp_publications_to_send_` (if it's not there).
+                        add_to_send(result.edp_subscriptions_to_send, readers_it->second.change());
+                    }
+                }
+                else if (parts_reader_it->second.is_relevant_participant(writer.guidPrefix))
+                {
+                    // Add DATA(p) of the client with the writer to `pdp_to_send_` (if it's not there).
+                    add_to_send(result.pdp_to_send, parts_reader_it->second.change());
+                    // Set topic as not-clearable.
+                    result.is_clearable = false;
+                }
+            }
+
+            // Check in `participants_` whether the client with the writer has acknowledge the PDP of the client
+            // with the reader.
+            if (parts_writer_it != participants_.end())
+            {
+                if (parts_writer_it->second.is_matched(reader.guidPrefix))
+                {
+                    // Check the status of the reader in `writers_[writer]::relevant_participants_builtin_ack_status`.
+                    if (writers_it != writers_.end() &&
+                            writers_it->second.is_relevant_participant(reader.guidPrefix) &&
+                            !writers_it->second.is_matched(reader.guidPrefix))
+                    {
+                        // If the status is 0, add DATA(w) to a `edp_subscriptions_to_send_` (if it's not there).
+                        add_to_send(result.edp_publications_to_send, writers_it->second.change());
+                    }
+                }
+                else if (parts_writer_it->second.is_relevant_participant(reader.guidPrefix))
+                {
+                    // Add DATA(p) of the client with the reader to `pdp_to_send_` (if it's not there).
+                    add_to_send(result.pdp_to_send, parts_writer_it->second.change());
+                    // Set topic as not-clearable.
+                    result.is_clearable = false;
+                }
+            }
+        }
+    }
+}
+
 bool DiscoveryDataBase::delete_entity_of_change(
         fastrtps::rtps::CacheChange_t* change)
 {
@@ -1969,7 +1994,7 @@ void DiscoveryDataBase::remove_writer_from_topic_(
 {
     if (topic_name == virtual_topic_)
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it;
+        TopicEndpointsMap::iterator topic_it;
         for (topic_it = writers_by_topic_.begin(); topic_it != writers_by_topic_.end(); topic_it++)
         {
             for (std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator writer_it = topic_it->second.begin();
@@ -1986,7 +2011,7 @@ void DiscoveryDataBase::remove_writer_from_topic_(
     }
     else
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it =
+        TopicEndpointsMap::iterator topic_it =
                 writers_by_topic_.find(topic_name);
         if (topic_it != writers_by_topic_.end())
         {
@@ -2017,7 +2042,7 @@ void DiscoveryDataBase::remove_reader_from_topic_(
 
     if (topic_name == virtual_topic_)
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it;
+        TopicEndpointsMap::iterator topic_it;
         for (topic_it = readers_by_topic_.begin(); topic_it != readers_by_topic_.end(); topic_it++)
         {
             for (std::vector<eprosima::fastrtps::rtps::GUID_t>::iterator reader_it = topic_it->second.begin();
@@ -2034,7 +2059,7 @@ void DiscoveryDataBase::remove_reader_from_topic_(
     }
     else
     {
-        std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>::iterator topic_it =
+        TopicEndpointsMap::iterator topic_it =
                 readers_by_topic_.find(topic_name);
         if (topic_it != readers_by_topic_.end())
         {
@@ -2203,9 +2228,9 @@ bool DiscoveryDataBase::delete_participant_entity_(
     return true;
 }
 
-std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator
+DiscoveryDataBase::ParticipantsMap::iterator
 DiscoveryDataBase::delete_participant_entity_(
-        std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator it)
+        ParticipantsMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting participant: " << it->first);
     if (it == participants_.end())
@@ -2230,8 +2255,8 @@ bool DiscoveryDataBase::delete_reader_entity_(
     return true;
 }
 
-std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator DiscoveryDataBase::delete_reader_entity_(
-        std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it)
+DiscoveryDataBase::EndpointsMap::iterator DiscoveryDataBase::delete_reader_entity_(
+        EndpointsMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting reader: " << it->first.guidPrefix);
     if (it == readers_.end())
@@ -2279,8 +2304,8 @@ bool DiscoveryDataBase::delete_writer_entity_(
     return true;
 }
 
-std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator DiscoveryDataBase::delete_writer_entity_(
-        std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it)
+DiscoveryDataBase::EndpointsMap::iterator DiscoveryDataBase::delete_writer_entity_(
+        EndpointsMap::iterator it)
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Deleting writer: " << it->first.guidPrefix);
     if (it == writers_.end())
@@ -2514,7 +2539,7 @@ bool DiscoveryDataBase::from_json(
             add_writer_to_topic_(guid_aux, topic);
 
             // Add writer to its participant
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator writer_part_it =
+            ParticipantsMap::iterator writer_part_it =
                     participants_.find(guid_aux.guidPrefix);
             if (writer_part_it != participants_.end())
             {
@@ -2572,7 +2597,7 @@ bool DiscoveryDataBase::from_json(
             add_reader_to_topic_(guid_aux, topic);
 
             // Add reader to its participant
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator reader_part_it =
+            ParticipantsMap::iterator reader_part_it =
                     participants_.find(guid_aux.guidPrefix);
             if (reader_part_it != participants_.end())
             {
@@ -2606,6 +2631,161 @@ bool DiscoveryDataBase::from_json(
     return true;
 }
 
+void DiscoveryDataBase::to_binary(
+        std::vector<fastrtps::rtps::octet>& buffer) const
+{
+    write_backup_header(buffer, BackupFileKind::SNAPSHOT);
+
+    // Every record is prefixed with its size, that is only known once it has been serialized
+    auto append_record = [&buffer](
+        BackupEntityKind kind,
+        const fastrtps::rtps::GUID_t& guid,
+        const DiscoverySharedInfo& info)
+            {
+                size_t size_pos = buffer.size();
+                binary_append(buffer, uint32_t(0));
+                binary_append(buffer, kind);
+                binary_append(buffer, guid);
+                info.to_binary(buffer);
+                uint32_t record_size = static_cast<uint32_t>(buffer.size() - size_pos - sizeof(uint32_t));
+                memcpy(&buffer[size_pos], &record_size, sizeof(record_size));
+            };
+
+    // The own server entities are not stored in the db, because in relaunch the must be created again
+    // Participants go first, as endpoints are added to them on restore
+    for (const auto& participant : participants_)
+    {
+        if (participant.first != server_guid_prefix_)
+        {
+            append_record(BackupEntityKind::PARTICIPANT,
+                    fastrtps::rtps::GUID_t(participant.first, fastrtps::rtps::c_EntityId_RTPSParticipant),
+                    participant.second);
+        }
+    }
+
+    for (const auto& writer : writers_)
+    {
+        if (writer.first.guidPrefix != server_guid_prefix_)
+        {
+            append_record(BackupEntityKind::WRITER, writer.first, writer.second);
+        }
+    }
+
+    for (const auto& reader : readers_)
+    {
+        if (reader.first.guidPrefix != server_guid_prefix_)
+        {
+            append_record(BackupEntityKind::READER, reader.first, reader.second);
+        }
+    }
+}
+
+bool DiscoveryDataBase::from_binary(
+        const std::vector<BackupEntityRecord>& records,
+        std::map<eprosima::fastrtps::rtps::InstanceHandle_t, fastrtps::rtps::CacheChange_t*>& changes_map)
+{
+    // Changes are taken from changes_map, with already created changes
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Raising DDB from binary Backup");
+
+    // The records are checked before creating any entity, so the database is left untouched when they are
+    // corrupted, and the caller keeps the ownership of all the changes
+    std::set<fastrtps::rtps::GuidPrefix_t> restored_participants;
+    std::set<fastrtps::rtps::GUID_t> restored_endpoints;
+    for (const BackupEntityRecord& record : records)
+    {
+        if (changes_map.find(record.change.instance_handle) == changes_map.end())
+        {
+            EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Entity " << record.guid << " without change");
+            return false;
+        }
+
+        bool repeated = false;
+        if (BackupEntityKind::PARTICIPANT == record.kind)
+        {
+            repeated = !restored_participants.insert(record.guid.guidPrefix).second ||
+                    participants_.find(record.guid.guidPrefix) != participants_.end();
+        }
+        else
+        {
+            if (restored_participants.find(record.guid.guidPrefix) == restored_participants.end() &&
+                    participants_.find(record.guid.guidPrefix) == participants_.end())
+            {
+                // Endpoint without participant, corrupted DDB
+                EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Endpoint " << record.guid << " without participant");
+                return false;
+            }
+            repeated = !restored_endpoints.insert(record.guid).second ||
+                    writers_.find(record.guid) != writers_.end() || readers_.find(record.guid) != readers_.end();
+        }
+
+        if (repeated)
+        {
+            EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Entity " << record.guid << " restored twice");
+            return false;
+        }
+    }
+
+    for (const BackupEntityRecord& record : records)
+    {
+        fastrtps::rtps::CacheChange_t* change = changes_map.find(record.change.instance_handle)->second;
+
+        if (BackupEntityKind::PARTICIPANT == record.kind)
+        {
+            DiscoveryParticipantChangeData dpcd(record.metatraffic_locators, record.is_client, record.is_local);
+            DiscoveryParticipantInfo dpi(change, server_guid_prefix_, dpcd);
+            for (const auto& ack : record.ack_status)
+            {
+                dpi.add_or_update_ack_participant(ack.first, ack.second);
+            }
+            participants_.insert(std::make_pair(record.guid.guidPrefix, dpi));
+
+            EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Participant " << record.guid.guidPrefix << " created");
+        }
+        else
+        {
+            DiscoveryEndpointInfo dei(change, record.topic, record.topic == virtual_topic_, server_guid_prefix_);
+            for (const auto& ack : record.ack_status)
+            {
+                dei.add_or_update_ack_participant(ack.first, ack.second);
+            }
+
+            // The participant is known to exist, as the records have been checked
+            auto part_it = participants_.find(record.guid.guidPrefix);
+
+            // Add the endpoint to the endpoints by topic, which will create the topic if necessary,
+            // and to its participant
+            if (BackupEntityKind::WRITER == record.kind)
+            {
+                writers_.insert(std::make_pair(record.guid, dei));
+                add_writer_to_topic_(record.guid, record.topic);
+                part_it->second.add_writer(record.guid);
+                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Writer " << record.guid << " created");
+            }
+            else
+            {
+                readers_.insert(std::make_pair(record.guid, dei));
+                add_reader_to_topic_(record.guid, record.topic);
+                part_it->second.add_reader(record.guid);
+                EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Reader " << record.guid << " created");
+            }
+        }
+
+        // In case the change is NOT ALIVE it must be set as dispose so it can be communicate to others and erased
+        if (change->kind != fastrtps::rtps::ALIVE)
+        {
+            disposals_.push_back(change);
+        }
+    }
+
+    // Set dirty topics to all, so next iteration every message pending is sent
+    set_dirty_topic_(virtual_topic_);
+
+    // Announce own server
+    server_acked_by_all(false);
+
+    return true;
+}
+
 void DiscoveryDataBase::clean_backup()
 {
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Restoring queue DDB in json backup");
@@ -2624,6 +2804,64 @@ void DiscoveryDataBase::persistence_enable(
     backup_file_.open(backup_file_name_, std::ios::app);
 }
 
+void DiscoveryDataBase::persistence_enable(
+        const std::string& backup_file_name,
+        const std::string& snapshot_file_name,
+        std::chrono::milliseconds flush_period,
+        const fastdds::rtps::ThreadSettings& thread_settings,
+        uint32_t thread_id)
+{
+    is_persistent_ = true;
+    backup_file_name_ = backup_file_name;
+    backup_writer_.reset(new BackupFileWriter(
+                backup_file_name, snapshot_file_name, flush_period, thread_settings, thread_id));
+}
+
+void DiscoveryDataBase::enable_parallel_processing(
+        uint32_t num_threads,
+        const fastdds::rtps::ThreadSettings& thread_settings,
+        uint32_t thread_id)
+{
+    std::lock_guard<std::recursive_mutex> guard(mutex_);
+    if (num_threads > 1)
+    {
+        workers_.reset(new DiscoveryDataBaseWorkers(num_threads, thread_settings, thread_id));
+    }
+    else
+    {
+        workers_.reset();
+    }
+}
+
+void DiscoveryDataBase::store_binary_backup()
+{
+    EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Storing DDB in binary backup");
+
+    // No change may be recorded between taking the snapshot and queuing it, or the snapshot would discard it
+    std::lock_guard<std::recursive_mutex> guard(data_queues_mutex_);
+    std::vector<fastrtps::rtps::octet> snapshot;
+    to_binary(snapshot);
+    backup_writer_->store_snapshot(std::move(snapshot));
+}
+
+void DiscoveryDataBase::backup_change_(
+        eprosima::fastrtps::rtps::CacheChange_t* change)
+{
+    if (backup_writer_)
+    {
+        std::vector<fastrtps::rtps::octet> record;
+        ddb::to_binary(record, *change);
+        backup_writer_->append_change(std::move(record));
+    }
+    else
+    {
+        nlohmann::json j;
+        ddb::to_json(j, *change);
+        backup_file_ << j;
+        backup_file_.flush();
+    }
+}
+
 bool DiscoveryDataBase::is_participant_local(
         const eprosima::fastrtps::rtps::GuidPrefix_t& participant_prefix)
 {
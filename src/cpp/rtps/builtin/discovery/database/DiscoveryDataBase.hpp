@@ -20,11 +20,14 @@
 #ifndef _FASTDDS_RTPS_DISCOVERY_DATABASE_H_
 #define _FASTDDS_RTPS_DISCOVERY_DATABASE_H_
 
+#include <chrono>
 #include <fstream>
 #include <iostream>
 #include <map>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 #include <fastrtps/utils/fixed_size_string.hpp>
@@ -36,7 +39,10 @@
 #include <rtps/builtin/discovery/database/DiscoveryDataFilter.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryParticipantInfo.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryEndpointInfo.hpp>
+#include <rtps/builtin/discovery/database/DiscoveryDataBaseWorkers.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryDataQueueInfo.hpp>
+#include <rtps/builtin/discovery/database/backup/BackupFileWriter.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
 
 #include <nlohmann/json.hpp>
 
@@ -45,6 +51,39 @@ namespace fastdds {
 namespace rtps {
 namespace ddb {
 
+//! Hash of GUID prefixes for the hash maps of the discovery database
+struct GuidPrefixHash
+{
+    std::size_t operator ()(
+            const eprosima::fastrtps::rtps::GuidPrefix_t& prefix) const noexcept
+    {
+        // FNV-1a. The first bytes of the prefixes are usually shared by all the participants of a host
+        std::size_t hash = 2166136261u;
+        for (eprosima::fastrtps::rtps::octet byte : prefix.value)
+        {
+            hash = (hash ^ byte) * 16777619u;
+        }
+        return hash;
+    }
+
+};
+
+//! Hash of GUIDs for the hash maps of the discovery database
+struct GuidHash
+{
+    std::size_t operator ()(
+            const eprosima::fastrtps::rtps::GUID_t& guid) const noexcept
+    {
+        std::size_t hash = GuidPrefixHash()(guid.guidPrefix);
+        for (eprosima::fastrtps::rtps::octet byte : guid.entityId.value)
+        {
+            hash = (hash ^ byte) * 16777619u;
+        }
+        return hash;
+    }
+
+};
+
 /**
  * Class to manage the discovery data base
  *@ingroup DISCOVERY_MODULE
@@ -57,6 +96,11 @@ class DiscoveryDataBase
 
 public:
 
+    using ParticipantsMap = std::unordered_map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo,
+                    GuidPrefixHash>;
+    using EndpointsMap = std::unordered_map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo, GuidHash>;
+    using TopicEndpointsMap = std::unordered_map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>>;
+
     class AckedFunctor;
 
     ////////////
@@ -148,6 +192,23 @@ public:
     void persistence_enable(
             std::string backup_file_name);
 
+    // enable ddb in persistence mode with the binary backup format
+    // Every change is appended to backup_file_name, and the snapshots replace snapshot_file_name, from a dedicated
+    // thread that syncs the files to disk at most once per flush_period
+    void persistence_enable(
+            const std::string& backup_file_name,
+            const std::string& snapshot_file_name,
+            std::chrono::milliseconds flush_period,
+            const fastdds::rtps::ThreadSettings& thread_settings,
+            uint32_t thread_id);
+
+    // Process the dirty topics in parallel, sharding them across num_threads threads by the hash of their name
+    // The thread calling process_dirty_topics() takes part on the processing, so num_threads - 1 threads are created
+    void enable_parallel_processing(
+            uint32_t num_threads,
+            const fastdds::rtps::ThreadSettings& thread_settings,
+            uint32_t thread_id);
+
     //! Disable the possibility to add new entries to the database
     void disable()
     {
@@ -307,6 +368,16 @@ public:
             nlohmann::json& j,
             std::map<eprosima::fastrtps::rtps::InstanceHandle_t, fastrtps::rtps::CacheChange_t*>& changes_map);
 
+    // Append a binary snapshot of the database to a buffer, header included
+    void to_binary(
+            std::vector<eprosima::fastrtps::rtps::octet>& buffer) const;
+
+    // Create the entities of a binary snapshot, taking the ownership of the changes in changes_map
+    // When the records are corrupted nothing is created, and false is returned
+    bool from_binary(
+            const std::vector<BackupEntityRecord>& records,
+            std::map<eprosima::fastrtps::rtps::InstanceHandle_t, fastrtps::rtps::CacheChange_t*>& changes_map);
+
     // This function erase the last backup and all the changes that has arrived since then and create
     // a new backup that shows the actual state of the database
     // This way we can simulate the state of the database from a clean state of json backup, or from
@@ -316,6 +387,12 @@ public:
     // This function must be called with the incoming datas blocked
     void clean_backup();
 
+    // Binary format counterpart of storing the json backup and calling clean_backup()
+    // The snapshot is serialized in the calling thread, and written by the backup thread after the changes
+    // already queued, that it replaces
+    // The incoming datas are blocked while the snapshot is serialized and queued
+    void store_binary_backup();
+
     // Lock the incoming of new data to the DDB queue. This locks the Listener as well
     void lock_incoming_data()
     {
@@ -355,6 +432,25 @@ public:
 
 protected:
 
+    //! Changes to send and clearability computed for a dirty topic
+    struct DirtyTopicResult
+    {
+        bool is_clearable = true;
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*> pdp_to_send;
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_publications_to_send;
+        std::vector<eprosima::fastrtps::rtps::CacheChange_t*> edp_subscriptions_to_send;
+    };
+
+    // Compute the changes to send for the endpoints of a dirty topic
+    // It only reads the database, so several topics can be processed at the same time
+    void process_dirty_topic_(
+            const std::string& topic,
+            DirtyTopicResult& result) const;
+
+    // Store a change in the backup, in the format the persistence was enabled with
+    void backup_change_(
+            eprosima::fastrtps::rtps::CacheChange_t* change);
+
     // change a cacheChange by update or new disposal
     void update_change_and_unmatch_(
             fastrtps::rtps::CacheChange_t* new_change,
@@ -446,22 +542,22 @@ protected:
     bool delete_participant_entity_(
             const fastrtps::rtps::GuidPrefix_t& guid_prefix);
 
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator delete_participant_entity_(
-            std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo>::iterator it);
+    ParticipantsMap::iterator delete_participant_entity_(
+            ParticipantsMap::iterator it);
 
     // delete an entity and set its change to release. Assumes the entity has been unmatched before
     bool delete_writer_entity_(
             const fastrtps::rtps::GUID_t& guid);
 
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_writer_entity_(
-            std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
+    EndpointsMap::iterator delete_writer_entity_(
+            EndpointsMap::iterator it);
 
     // delete an entity and set its change to release. Assumes the entity has been unmatched before
     bool delete_reader_entity_(
             const fastrtps::rtps::GUID_t& guid);
 
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator delete_reader_entity_(
-            std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo>::iterator it);
+    EndpointsMap::iterator delete_reader_entity_(
+            EndpointsMap::iterator it);
 
     // return if there are more than one writer in the participant in the same topic
     bool repeated_writer_topic_(
@@ -526,25 +622,28 @@ protected:
     fastrtps::DBQueue<eprosima::fastdds::rtps::ddb::DiscoveryEDPDataQueueInfo> edp_data_queue_;
 
     //! Covenient per-topic mapping of readers and writers to speed-up queries
-    std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>> readers_by_topic_;
-    std::map<std::string, std::vector<eprosima::fastrtps::rtps::GUID_t>> writers_by_topic_;
+    TopicEndpointsMap readers_by_topic_;
+    TopicEndpointsMap writers_by_topic_;
 
     //! Collection of participant proxies that:
     //  - stores the CacheChange_t
     //  - keeps track of its acknowledgement status
     //  - keeps an account of participant's readers and writers
-    std::map<eprosima::fastrtps::rtps::GuidPrefix_t, DiscoveryParticipantInfo> participants_;
+    ParticipantsMap participants_;
 
     //! Collection of reader and writer proxies that:
     //  - stores the CacheChange_t
     //  - keeps track of its acknowledgement status
     //  - stores the topic name (only matching criteria available)
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo> readers_;
-    std::map<eprosima::fastrtps::rtps::GUID_t, DiscoveryEndpointInfo> writers_;
+    EndpointsMap readers_;
+    EndpointsMap writers_;
 
     //! Collection of topics whose related endpoints have changed and require a match recalculation
     std::vector<std::string> dirty_topics_;
 
+    //! Threads processing the dirty topics. Only created when the parallel processing is enabled
+    std::unique_ptr<DiscoveryDataBaseWorkers> workers_;
+
     //! Collection of changes to take out of the server builtin writers
     std::vector<eprosima::fastrtps::rtps::CacheChange_t*> disposals_;
 
@@ -591,6 +690,9 @@ protected:
     // This file will keep open to write it fast every time a new cache arrives
     // It needs a flush every time a new change is added
     std::ofstream backup_file_;
+
+    // Writer of the binary backup files. Only created with the binary backup format
+    std::unique_ptr<BackupFileWriter> backup_writer_;
 };
 
 
@@ -0,0 +1,114 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryDataBaseWorkers.cpp
+ *
+ */
+
+#include <rtps/builtin/discovery/database/DiscoveryDataBaseWorkers.hpp>
+
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+DiscoveryDataBaseWorkers::DiscoveryDataBaseWorkers(
+        uint32_t num_shards,
+        const fastdds::rtps::ThreadSettings& thread_settings,
+        uint32_t thread_id)
+    : num_shards_(num_shards > 0 ? num_shards : 1)
+{
+    threads_.reserve(num_shards_ - 1);
+    for (uint32_t shard = 1; shard < num_shards_; ++shard)
+    {
+        threads_.push_back(create_thread([this, shard]()
+                {
+                    worker_loop(shard);
+                }, thread_settings, "dds.ds_wrk.%u.%u", thread_id, shard));
+    }
+}
+
+DiscoveryDataBaseWorkers::~DiscoveryDataBaseWorkers()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    work_cv_.notify_all();
+    for (eprosima::thread& thread : threads_)
+    {
+        if (thread.joinable())
+        {
+            thread.join();
+        }
+    }
+}
+
+void DiscoveryDataBaseWorkers::run(
+        const Task& task)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        task_ = &task;
+        pending_ = num_shards_ - 1;
+        ++round_;
+    }
+    work_cv_.notify_all();
+
+    task(0);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_cv_.wait(lock, [this]()
+            {
+                return 0 == pending_;
+            });
+    task_ = nullptr;
+}
+
+void DiscoveryDataBaseWorkers::worker_loop(
+        uint32_t shard)
+{
+    uint64_t last_round = 0;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true)
+    {
+        work_cv_.wait(lock, [this, &last_round]()
+                {
+                    return stop_ || round_ != last_round;
+                });
+        if (stop_)
+        {
+            break;
+        }
+
+        last_round = round_;
+        const Task* task = task_;
+        lock.unlock();
+        (*task)(shard);
+        lock.lock();
+
+        if (0 == --pending_)
+        {
+            done_cv_.notify_one();
+        }
+    }
+}
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
@@ -0,0 +1,110 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DiscoveryDataBaseWorkers.hpp
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_DISCOVERY_DATABASE_WORKERS_H_
+#define _FASTDDS_RTPS_DISCOVERY_DATABASE_WORKERS_H_
+
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+
+#include <utils/thread.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+/**
+ * Pool of threads the DiscoveryDataBase uses to process its shards in parallel.
+ *
+ * Each call to run() executes a task once per shard, and returns when all of them have finished.
+ * The calling thread processes shard 0, and every other shard is always processed by the same worker thread.
+ *@ingroup DISCOVERY_MODULE
+ */
+class DiscoveryDataBaseWorkers
+{
+public:
+
+    using Task = std::function<void (uint32_t shard)>;
+
+    /**
+     * Constructor. Starts the worker threads.
+     * @param num_shards      Number of shards. One thread less than shards is created.
+     * @param thread_settings Settings of the worker threads.
+     * @param thread_id       Identifier used to name the worker threads.
+     */
+    DiscoveryDataBaseWorkers(
+            uint32_t num_shards,
+            const fastdds::rtps::ThreadSettings& thread_settings,
+            uint32_t thread_id);
+
+    //! Destructor. Stops the worker threads.
+    ~DiscoveryDataBaseWorkers();
+
+    DiscoveryDataBaseWorkers(
+            const DiscoveryDataBaseWorkers&) = delete;
+    DiscoveryDataBaseWorkers& operator =(
+            const DiscoveryDataBaseWorkers&) = delete;
+
+    uint32_t num_shards() const
+    {
+        return num_shards_;
+    }
+
+    /**
+     * Execute a task on every shard, and wait for all of them to finish.
+     * Not thread safe. Only one task may be run at a time.
+     * @param task Task to execute, receiving the shard it has to process.
+     */
+    void run(
+            const Task& task);
+
+private:
+
+    void worker_loop(
+            uint32_t shard);
+
+    uint32_t num_shards_;
+
+    std::mutex mutex_;
+    std::condition_variable work_cv_;
+    std::condition_variable done_cv_;
+
+    //! Task of the current round
+    const Task* task_ = nullptr;
+    //! Incremented on every run() call, so the workers know there is a new task
+    uint64_t round_ = 0;
+    //! Number of workers that have not yet finished the current round
+    uint32_t pending_ = 0;
+    bool stop_ = false;
+
+    std::vector<eprosima::thread> threads_;
+};
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_DISCOVERY_DATABASE_WORKERS_H_ */
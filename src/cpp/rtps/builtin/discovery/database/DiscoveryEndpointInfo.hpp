@@ -25,6 +25,7 @@
 #include <fastrtps/utils/fixed_size_string.hpp>
 
 #include <rtps/builtin/discovery/database/DiscoverySharedInfo.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
 
 #include <nlohmann/json.hpp>
 
@@ -80,6 +81,13 @@ public:
         j["topic"] = topic_;
     }
 
+    void to_binary(
+            std::vector<eprosima::fastrtps::rtps::octet>& buffer) const
+    {
+        DiscoverySharedInfo::to_binary(buffer);
+        binary_append(buffer, topic_);
+    }
+
 private:
 
     std::string topic_;
@@ -24,6 +24,7 @@
 #include <fastdds/dds/core/policy/ParameterTypes.hpp>
 
 #include <nlohmann/json.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
 #include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
 
 namespace eprosima {
@@ -78,6 +79,15 @@ public:
         j["metatraffic_locators"] = object_to_string(metatraffic_locators_);
     }
 
+    void to_binary(
+            std::vector<fastrtps::rtps::octet>& buffer) const
+    {
+        binary_append(buffer, static_cast<uint8_t>(is_client_ ? 1u : 0u));
+        binary_append(buffer, static_cast<uint8_t>(is_local_ ? 1u : 0u));
+        binary_append(buffer, metatraffic_locators_.unicast);
+        binary_append(buffer, metatraffic_locators_.multicast);
+    }
+
 private:
 
     // The metatraffic locators of from the serialized payload
@@ -96,6 +96,13 @@ void DiscoveryParticipantInfo::to_json(
     participant_change_data_.to_json(j);
 }
 
+void DiscoveryParticipantInfo::to_binary(
+        std::vector<eprosima::fastrtps::rtps::octet>& buffer) const
+{
+    DiscoverySharedInfo::to_binary(buffer);
+    participant_change_data_.to_binary(buffer);
+}
+
 } /* namespace ddb */
 } /* namespace rtps */
 } /* namespace fastdds */
@@ -129,6 +129,9 @@ public:
     void to_json(
             nlohmann::json& j) const;
 
+    void to_binary(
+            std::vector<eprosima::fastrtps::rtps::octet>& buffer) const;
+
 private:
 
     std::vector<eprosima::fastrtps::rtps::GUID_t> readers_;
@@ -25,6 +25,7 @@
 #include <rtps/builtin/discovery/database/DiscoveryParticipantsAckStatus.hpp>
 
 #include <nlohmann/json.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
 #include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
 
 namespace eprosima {
@@ -106,6 +107,17 @@ void DiscoveryParticipantsAckStatus::to_json(
     }
 }
 
+void DiscoveryParticipantsAckStatus::to_binary(
+        std::vector<eprosima::fastrtps::rtps::octet>& buffer) const
+{
+    binary_append(buffer, static_cast<uint32_t>(relevant_participants_map_.size()));
+    for (auto it = relevant_participants_map_.begin(); it != relevant_participants_map_.end(); ++it)
+    {
+        binary_append(buffer, it->first);
+        binary_append(buffer, static_cast<uint8_t>(it->second ? 1u : 0u));
+    }
+}
+
 } /* namespace ddb */
 } /* namespace rtps */
 } /* namespace fastdds */
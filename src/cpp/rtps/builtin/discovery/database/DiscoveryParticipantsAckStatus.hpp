@@ -67,6 +67,9 @@ public:
     void to_json(
             nlohmann::json& j) const;
 
+    void to_binary(
+            std::vector<eprosima::fastrtps::rtps::octet>& buffer) const;
+
 private:
 
     std::map<eprosima::fastrtps::rtps::GuidPrefix_t, bool> relevant_participants_map_;
@@ -23,6 +23,7 @@
 #include <rtps/builtin/discovery/database/DiscoverySharedInfo.hpp>
 
 #include <nlohmann/json.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
 #include <rtps/builtin/discovery/database/backup/SharedBackupFunctions.hpp>
 
 namespace eprosima {
@@ -66,6 +67,13 @@ void DiscoverySharedInfo::to_json(
     j["ack_status"] = j_ack;
 }
 
+void DiscoverySharedInfo::to_binary(
+        std::vector<eprosima::fastrtps::rtps::octet>& buffer) const
+{
+    ddb::to_binary(buffer, *change_);
+    relevant_participants_builtin_ack_status_.to_binary(buffer);
+}
+
 } /* namespace ddb */
 } /* namespace rtps */
 } /* namespace fastdds */
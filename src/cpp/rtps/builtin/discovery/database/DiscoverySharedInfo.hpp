@@ -102,6 +102,9 @@ public:
     virtual void to_json(
             nlohmann::json& j) const;
 
+    virtual void to_binary(
+            std::vector<eprosima::fastrtps::rtps::octet>& buffer) const;
+
 protected:
 
     eprosima::fastrtps::rtps::CacheChange_t* change_;
@@ -0,0 +1,249 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BackupFileWriter.cpp
+ *
+ */
+
+#include <rtps/builtin/discovery/database/backup/BackupFileWriter.hpp>
+
+#include <cstdio>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif // ifdef _WIN32
+
+#include <fastdds/dds/log/Log.hpp>
+
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+using fastrtps::rtps::octet;
+
+namespace {
+
+//! Flush a file to the OS and then to the disk
+bool sync_file(
+        FILE* file)
+{
+    if (0 != fflush(file))
+    {
+        return false;
+    }
+#ifdef _WIN32
+    return 0 == _commit(_fileno(file));
+#else
+    return 0 == fsync(fileno(file));
+#endif // ifdef _WIN32
+}
+
+} // namespace
+
+BackupFileWriter::BackupFileWriter(
+        const std::string& changes_file_name,
+        const std::string& snapshot_file_name,
+        std::chrono::milliseconds flush_period,
+        const fastdds::rtps::ThreadSettings& thread_settings,
+        uint32_t thread_id)
+    : changes_file_name_(changes_file_name)
+    , snapshot_file_name_(snapshot_file_name)
+    , flush_period_(flush_period)
+{
+    // It opens the file in append mode because the info in it has not been yet included on a snapshot
+    open_changes_file(false);
+
+    thread_ = create_thread([this]()
+                    {
+                        run();
+                    }, thread_settings, "dds.ds_bkp.%u", thread_id);
+}
+
+BackupFileWriter::~BackupFileWriter()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+
+    if (nullptr != changes_file_)
+    {
+        fclose(changes_file_);
+    }
+}
+
+void BackupFileWriter::append_change(
+        std::vector<octet>&& record)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back({false, std::move(record)});
+    }
+    cv_.notify_all();
+}
+
+void BackupFileWriter::store_snapshot(
+        std::vector<octet>&& snapshot)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        pending_.push_back({true, std::move(snapshot)});
+    }
+    cv_.notify_all();
+}
+
+void BackupFileWriter::run()
+{
+    std::vector<Operation> operations;
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_ || !pending_.empty())
+    {
+        cv_.wait(lock, [this]()
+                {
+                    return stop_ || !pending_.empty();
+                });
+
+        // Let the changes arriving during the flush period join the batch
+        if (!stop_)
+        {
+            cv_.wait_for(lock, flush_period_, [this]()
+                    {
+                        return stop_;
+                    });
+        }
+
+        operations.swap(pending_);
+        lock.unlock();
+        write_operations(operations);
+        operations.clear();
+        lock.lock();
+    }
+}
+
+void BackupFileWriter::write_operations(
+        std::vector<Operation>& operations)
+{
+    bool pending_sync = false;
+    for (Operation& operation : operations)
+    {
+        if (operation.is_snapshot)
+        {
+            // The changes recorded until now are included on the snapshot
+            if (write_snapshot_file(operation.data))
+            {
+                open_changes_file(true);
+                pending_sync = false;
+            }
+        }
+        else if (nullptr != changes_file_)
+        {
+            uint32_t record_size = static_cast<uint32_t>(operation.data.size());
+            if (1u != fwrite(&record_size, sizeof(record_size), 1u, changes_file_) ||
+                    operation.data.size() != fwrite(operation.data.data(), 1u, operation.data.size(), changes_file_))
+            {
+                EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Error writing on backup file " << changes_file_name_);
+            }
+            pending_sync = true;
+        }
+    }
+
+    if (pending_sync)
+    {
+        sync_changes_file();
+    }
+}
+
+bool BackupFileWriter::open_changes_file(
+        bool truncate)
+{
+    if (nullptr != changes_file_)
+    {
+        fclose(changes_file_);
+    }
+
+    changes_file_ = fopen(changes_file_name_.c_str(), truncate ? "wb" : "ab");
+    if (nullptr == changes_file_)
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Error opening backup file " << changes_file_name_);
+        return false;
+    }
+
+    // A new file starts with the header
+    fseek(changes_file_, 0, SEEK_END);
+    if (0 == ftell(changes_file_))
+    {
+        std::vector<octet> header;
+        write_backup_header(header, BackupFileKind::CHANGES);
+        fwrite(header.data(), 1u, header.size(), changes_file_);
+        sync_changes_file();
+    }
+    return true;
+}
+
+void BackupFileWriter::sync_changes_file()
+{
+    if (nullptr != changes_file_ && !sync_file(changes_file_))
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Error syncing backup file " << changes_file_name_);
+    }
+}
+
+bool BackupFileWriter::write_snapshot_file(
+        const std::vector<octet>& snapshot)
+{
+    // The snapshot is written aside and then renamed, so a crash never leaves a partial snapshot
+    std::string tmp_file_name = snapshot_file_name_ + ".tmp";
+    FILE* file = fopen(tmp_file_name.c_str(), "wb");
+    if (nullptr == file)
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Error opening backup file " << tmp_file_name);
+        return false;
+    }
+
+    bool ret = snapshot.size() == fwrite(snapshot.data(), 1u, snapshot.size(), file) && sync_file(file);
+    ret = (0 == fclose(file)) && ret;
+
+#ifdef _WIN32
+    // rename does not replace existing files on Windows
+    if (ret)
+    {
+        std::remove(snapshot_file_name_.c_str());
+    }
+#endif // ifdef _WIN32
+    ret = ret && (0 == std::rename(tmp_file_name.c_str(), snapshot_file_name_.c_str()));
+
+    if (!ret)
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "Error writing backup file " << snapshot_file_name_);
+        std::remove(tmp_file_name.c_str());
+    }
+    return ret;
+}
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
@@ -0,0 +1,131 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BackupFileWriter.hpp
+ *
+ */
+
+#ifndef _FASTDDS_RTPS_DISCOVERY_BACKUP_FILE_WRITER_H_
+#define _FASTDDS_RTPS_DISCOVERY_BACKUP_FILE_WRITER_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/common/Types.h>
+
+#include <utils/thread.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+/**
+ * Writes the binary backup files of the DiscoveryDataBase from a dedicated thread.
+ *
+ * Change records are appended to the changes file in batches, and the file is synced to disk at most once per
+ * flush period, instead of once per change. Snapshots replace the snapshot file atomically, and then truncate the
+ * changes file, as all the changes recorded before the snapshot are included on it.
+ * Operations are performed in the same order they are requested.
+ *@ingroup DISCOVERY_MODULE
+ */
+class BackupFileWriter
+{
+public:
+
+    /**
+     * Constructor. Starts the writing thread.
+     * @param changes_file_name  Name of the file where the change records are appended.
+     * @param snapshot_file_name Name of the file holding the last snapshot.
+     * @param flush_period       Maximum time a change record waits before being synced to disk.
+     * @param thread_settings    Settings of the writing thread.
+     * @param thread_id          Identifier used to name the writing thread.
+     */
+    BackupFileWriter(
+            const std::string& changes_file_name,
+            const std::string& snapshot_file_name,
+            std::chrono::milliseconds flush_period,
+            const fastdds::rtps::ThreadSettings& thread_settings,
+            uint32_t thread_id);
+
+    //! Destructor. Writes the pending operations and stops the writing thread.
+    ~BackupFileWriter();
+
+    BackupFileWriter(
+            const BackupFileWriter&) = delete;
+    BackupFileWriter& operator =(
+            const BackupFileWriter&) = delete;
+
+    /**
+     * Append a change record to the changes file.
+     * @param record Serialized change, without the size prefix.
+     */
+    void append_change(
+            std::vector<fastrtps::rtps::octet>&& record);
+
+    /**
+     * Replace the snapshot file, and discard the change records appended before.
+     * @param snapshot Whole contents of the snapshot file, header included.
+     */
+    void store_snapshot(
+            std::vector<fastrtps::rtps::octet>&& snapshot);
+
+private:
+
+    struct Operation
+    {
+        bool is_snapshot;
+        std::vector<fastrtps::rtps::octet> data;
+    };
+
+    void run();
+
+    void write_operations(
+            std::vector<Operation>& operations);
+
+    bool open_changes_file(
+            bool truncate);
+
+    void sync_changes_file();
+
+    bool write_snapshot_file(
+            const std::vector<fastrtps::rtps::octet>& snapshot);
+
+    std::string changes_file_name_;
+    std::string snapshot_file_name_;
+    std::chrono::milliseconds flush_period_;
+
+    //! Only accessed from the writing thread once it has started
+    FILE* changes_file_ = nullptr;
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<Operation> pending_;
+    bool stop_ = false;
+    eprosima::thread thread_;
+};
+
+} /* namespace ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _FASTDDS_RTPS_DISCOVERY_BACKUP_FILE_WRITER_H_ */
@@ -0,0 +1,473 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryBackupFunctions.cpp
+ *
+ */
+
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
+
+#include <fstream>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // ifndef _WIN32
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+using fastrtps::rtps::octet;
+
+namespace {
+
+constexpr octet backup_magic[4] = {'F', 'D', 'D', 'B'};
+constexpr uint8_t backup_version = 1u;
+constexpr uint16_t backup_byte_order = 0x0102u;
+
+void append_sequence_number(
+        std::vector<octet>& buffer,
+        const fastrtps::rtps::SequenceNumber_t& sequence_number)
+{
+    binary_append(buffer, sequence_number.high);
+    binary_append(buffer, sequence_number.low);
+}
+
+void append_time(
+        std::vector<octet>& buffer,
+        const fastrtps::rtps::Time_t& time)
+{
+    binary_append(buffer, time.seconds());
+    binary_append(buffer, time.fraction());
+}
+
+void append_sample_identity(
+        std::vector<octet>& buffer,
+        const fastrtps::rtps::SampleIdentity& sample_identity)
+{
+    binary_append(buffer, sample_identity.writer_guid());
+    append_sequence_number(buffer, sample_identity.sequence_number());
+}
+
+bool read_guid_prefix(
+        BinaryBackupReader& reader,
+        fastrtps::rtps::GuidPrefix_t& prefix)
+{
+    const octet* bytes = reader.view(fastrtps::rtps::GuidPrefix_t::size);
+    if (nullptr == bytes)
+    {
+        return false;
+    }
+    memcpy(prefix.value, bytes, fastrtps::rtps::GuidPrefix_t::size);
+    return true;
+}
+
+bool read_guid(
+        BinaryBackupReader& reader,
+        fastrtps::rtps::GUID_t& guid)
+{
+    if (!read_guid_prefix(reader, guid.guidPrefix))
+    {
+        return false;
+    }
+    const octet* bytes = reader.view(fastrtps::rtps::EntityId_t::size);
+    if (nullptr == bytes)
+    {
+        return false;
+    }
+    memcpy(guid.entityId.value, bytes, fastrtps::rtps::EntityId_t::size);
+    return true;
+}
+
+bool read_sequence_number(
+        BinaryBackupReader& reader,
+        fastrtps::rtps::SequenceNumber_t& sequence_number)
+{
+    return reader.read(sequence_number.high) && reader.read(sequence_number.low);
+}
+
+bool read_time(
+        BinaryBackupReader& reader,
+        fastrtps::rtps::Time_t& time)
+{
+    int32_t seconds = 0;
+    uint32_t fraction = 0;
+    if (!reader.read(seconds) || !reader.read(fraction))
+    {
+        return false;
+    }
+    time.seconds(seconds);
+    time.fraction(fraction);
+    return true;
+}
+
+bool read_sample_identity(
+        BinaryBackupReader& reader,
+        fastrtps::rtps::SampleIdentity& sample_identity)
+{
+    return read_guid(reader, sample_identity.writer_guid()) &&
+           read_sequence_number(reader, sample_identity.sequence_number());
+}
+
+} // namespace
+
+void write_backup_header(
+        std::vector<octet>& buffer,
+        BackupFileKind kind)
+{
+    buffer.insert(buffer.end(), backup_magic, backup_magic + sizeof(backup_magic));
+    binary_append(buffer, backup_version);
+    binary_append(buffer, static_cast<uint8_t>(kind));
+    binary_append(buffer, backup_byte_order);
+}
+
+void binary_append(
+        std::vector<octet>& buffer,
+        const fastrtps::rtps::GuidPrefix_t& prefix)
+{
+    buffer.insert(buffer.end(), prefix.value, prefix.value + fastrtps::rtps::GuidPrefix_t::size);
+}
+
+void binary_append(
+        std::vector<octet>& buffer,
+        const fastrtps::rtps::GUID_t& guid)
+{
+    binary_append(buffer, guid.guidPrefix);
+    buffer.insert(buffer.end(), guid.entityId.value, guid.entityId.value + fastrtps::rtps::EntityId_t::size);
+}
+
+void binary_append(
+        std::vector<octet>& buffer,
+        const std::string& value)
+{
+    binary_append(buffer, static_cast<uint32_t>(value.size()));
+    buffer.insert(buffer.end(), value.begin(), value.end());
+}
+
+void binary_append(
+        std::vector<octet>& buffer,
+        const fastrtps::ResourceLimitedVector<fastrtps::rtps::Locator_t>& value)
+{
+    binary_append(buffer, static_cast<uint32_t>(value.size()));
+    for (const fastrtps::rtps::Locator_t& locator : value)
+    {
+        binary_append(buffer, locator.kind);
+        binary_append(buffer, locator.port);
+        buffer.insert(buffer.end(), locator.address, locator.address + sizeof(locator.address));
+    }
+}
+
+bool BinaryBackupReader::read(
+        std::string& value)
+{
+    uint32_t size = 0;
+    if (!read(size))
+    {
+        return false;
+    }
+    const octet* bytes = view(size);
+    if (nullptr == bytes)
+    {
+        return false;
+    }
+    value.assign(reinterpret_cast<const char*>(bytes), size);
+    return true;
+}
+
+bool BinaryBackupReader::read(
+        fastrtps::rtps::RemoteLocatorList& locators)
+{
+    constexpr size_t locator_size = sizeof(int32_t) + sizeof(uint32_t) + 16u;
+
+    uint32_t unicast_count = 0;
+    if (!read(unicast_count) || remaining() < unicast_count * locator_size)
+    {
+        return false;
+    }
+    const octet* unicast = view(unicast_count * locator_size);
+
+    uint32_t multicast_count = 0;
+    if (!read(multicast_count) || remaining() < multicast_count * locator_size)
+    {
+        return false;
+    }
+    const octet* multicast = view(multicast_count * locator_size);
+
+    auto read_locator = [](const octet* bytes) -> fastrtps::rtps::Locator_t
+            {
+                fastrtps::rtps::Locator_t locator;
+                memcpy(&locator.kind, bytes, sizeof(int32_t));
+                memcpy(&locator.port, bytes + sizeof(int32_t), sizeof(uint32_t));
+                memcpy(locator.address, bytes + sizeof(int32_t) + sizeof(uint32_t), sizeof(locator.address));
+                return locator;
+            };
+
+    locators = fastrtps::rtps::RemoteLocatorList(unicast_count, multicast_count);
+    for (uint32_t i = 0; i < unicast_count; ++i)
+    {
+        locators.add_unicast_locator(read_locator(unicast + i * locator_size));
+    }
+    for (uint32_t i = 0; i < multicast_count; ++i)
+    {
+        locators.add_multicast_locator(read_locator(multicast + i * locator_size));
+    }
+    return true;
+}
+
+bool BackupChangeRecord::to_change(
+        fastrtps::rtps::CacheChange_t& change) const
+{
+    if (change.serializedPayload.max_size < length)
+    {
+        return false;
+    }
+
+    change.kind = kind;
+    change.writerGUID = writer_guid;
+    change.instanceHandle = instance_handle;
+    change.sequenceNumber = sequence_number;
+    change.isRead = is_read;
+    change.sourceTimestamp = source_timestamp;
+    change.reader_info.receptionTimestamp = reception_timestamp;
+    change.write_params.sample_identity(sample_identity);
+    change.write_params.related_sample_identity(related_sample_identity);
+
+    change.serializedPayload.encapsulation = encapsulation;
+    change.serializedPayload.length = length;
+    if (length > 0)
+    {
+        memcpy(change.serializedPayload.data, data, length);
+    }
+    return true;
+}
+
+void to_binary(
+        std::vector<octet>& buffer,
+        const eprosima::fastrtps::rtps::CacheChange_t& change)
+{
+    binary_append(buffer, static_cast<uint8_t>(change.kind));
+    binary_append(buffer, change.writerGUID);
+    binary_append(buffer, static_cast<uint8_t>(change.instanceHandle.isDefined() ? 1u : 0u));
+    const octet* instance_handle = change.instanceHandle.value;
+    buffer.insert(buffer.end(), instance_handle, instance_handle + 16u);
+    append_sequence_number(buffer, change.sequenceNumber);
+    binary_append(buffer, static_cast<uint8_t>(change.isRead ? 1u : 0u));
+    append_time(buffer, change.sourceTimestamp);
+    append_time(buffer, change.reader_info.receptionTimestamp);
+    append_sample_identity(buffer, change.write_params.sample_identity());
+    append_sample_identity(buffer, change.write_params.related_sample_identity());
+
+    // serialize payload
+    binary_append(buffer, change.serializedPayload.encapsulation);
+    binary_append(buffer, change.serializedPayload.length);
+    buffer.insert(buffer.end(), change.serializedPayload.data,
+            change.serializedPayload.data + change.serializedPayload.length);
+}
+
+bool from_binary(
+        BinaryBackupReader& reader,
+        BackupChangeRecord& record)
+{
+    uint8_t kind = 0;
+    uint8_t has_instance_handle = 0;
+    uint8_t is_read = 0;
+    const octet* instance_handle = nullptr;
+
+    bool ret = reader.read(kind) &&
+            read_guid(reader, record.writer_guid) &&
+            reader.read(has_instance_handle) &&
+            nullptr != (instance_handle = reader.view(16u)) &&
+            read_sequence_number(reader, record.sequence_number) &&
+            reader.read(is_read) &&
+            read_time(reader, record.source_timestamp) &&
+            read_time(reader, record.reception_timestamp) &&
+            read_sample_identity(reader, record.sample_identity) &&
+            read_sample_identity(reader, record.related_sample_identity) &&
+            reader.read(record.encapsulation) &&
+            reader.read(record.length) &&
+            nullptr != (record.data = reader.view(record.length));
+
+    if (ret)
+    {
+        record.kind = static_cast<fastrtps::rtps::ChangeKind_t>(kind);
+        record.is_read = (0u != is_read);
+        record.instance_handle = fastrtps::rtps::InstanceHandle_t();
+        if (0u != has_instance_handle)
+        {
+            for (size_t i = 0; i < 16u; ++i)
+            {
+                record.instance_handle.value[i] = instance_handle[i];
+            }
+        }
+    }
+    return ret;
+}
+
+bool from_binary(
+        BinaryBackupReader& reader,
+        BackupEntityRecord& record)
+{
+    uint8_t kind = 0;
+    uint32_t ack_count = 0;
+    if (!reader.read(kind) || !read_guid(reader, record.guid) || !from_binary(reader, record.change) ||
+            !reader.read(ack_count))
+    {
+        return false;
+    }
+
+    record.kind = static_cast<BackupEntityKind>(kind);
+    record.ack_status.clear();
+    for (uint32_t i = 0; i < ack_count; ++i)
+    {
+        fastrtps::rtps::GuidPrefix_t prefix;
+        uint8_t status = 0;
+        if (!read_guid_prefix(reader, prefix) || !reader.read(status))
+        {
+            return false;
+        }
+        record.ack_status.emplace_back(prefix, 0u != status);
+    }
+
+    switch (record.kind)
+    {
+        case BackupEntityKind::PARTICIPANT:
+        {
+            uint8_t is_client = 0;
+            uint8_t is_local = 0;
+            if (!reader.read(is_client) || !reader.read(is_local) || !reader.read(record.metatraffic_locators))
+            {
+                return false;
+            }
+            record.is_client = (0u != is_client);
+            record.is_local = (0u != is_local);
+            return true;
+        }
+        case BackupEntityKind::WRITER:
+        case BackupEntityKind::READER:
+            return reader.read(record.topic);
+        default:
+            return false;
+    }
+}
+
+bool read_backup_snapshot(
+        const octet* data,
+        size_t size,
+        std::vector<BackupEntityRecord>& records)
+{
+    BinaryBackupReader reader(data, size);
+
+    const octet* magic = reader.view(sizeof(backup_magic));
+    uint8_t version = 0;
+    uint8_t kind = 0;
+    uint16_t byte_order = 0;
+    if (nullptr == magic || 0 != memcmp(magic, backup_magic, sizeof(backup_magic)) ||
+            !reader.read(version) || backup_version != version ||
+            !reader.read(kind) || static_cast<uint8_t>(BackupFileKind::SNAPSHOT) != kind ||
+            !reader.read(byte_order) || backup_byte_order != byte_order)
+    {
+        return false;
+    }
+
+    while (reader.remaining() > 0)
+    {
+        uint32_t record_size = 0;
+        const octet* record_data = nullptr;
+        if (!reader.read(record_size) || nullptr == (record_data = reader.view(record_size)))
+        {
+            return false;
+        }
+
+        BinaryBackupReader record_reader(record_data, record_size);
+        BackupEntityRecord record;
+        if (!from_binary(record_reader, record))
+        {
+            return false;
+        }
+        records.push_back(std::move(record));
+    }
+
+    return true;
+}
+
+BackupFileView::~BackupFileView()
+{
+#ifndef _WIN32
+    if (mapped_)
+    {
+        munmap(const_cast<octet*>(data_), size_);
+    }
+#endif // ifndef _WIN32
+}
+
+bool BackupFileView::open(
+        const std::string& file_name)
+{
+#ifndef _WIN32
+    int fd = ::open(file_name.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        return false;
+    }
+
+    struct stat file_stat;
+    bool ret = (0 == fstat(fd, &file_stat));
+    if (ret && file_stat.st_size > 0)
+    {
+        size_t size = static_cast<size_t>(file_stat.st_size);
+        void* address = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (MAP_FAILED != address)
+        {
+            // The file is traversed once from the beginning
+            madvise(address, size, MADV_SEQUENTIAL);
+            data_ = static_cast<const octet*>(address);
+            size_ = size;
+            mapped_ = true;
+        }
+        else
+        {
+            ret = false;
+        }
+    }
+    ::close(fd);
+    return ret;
+#else
+    std::ifstream file(file_name, std::ios::binary | std::ios::ate);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    std::streamoff size = file.tellg();
+    contents_.resize(static_cast<size_t>(size));
+    file.seekg(0);
+    if (size > 0 && !file.read(reinterpret_cast<char*>(contents_.data()), size))
+    {
+        return false;
+    }
+    data_ = contents_.data();
+    size_ = contents_.size();
+    return true;
+#endif // ifndef _WIN32
+}
+
+} /* ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
@@ -0,0 +1,296 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BinaryBackupFunctions.hpp
+ *
+ */
+
+#ifndef _BINARY_BACKUP_FUNCTIONS_H_
+#define _BINARY_BACKUP_FUNCTIONS_H_
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/GuidPrefix_t.hpp>
+#include <fastdds/rtps/common/RemoteLocators.hpp>
+#include <fastdds/rtps/common/SampleIdentity.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+namespace ddb {
+
+// BINARY BACKUP FORMAT
+/*
+   Both backup files start with a header:
+    magic       "FDDB"
+    version     uint8
+    file kind   uint8   (1 = snapshot, 2 = changes)
+    byte order  uint16  (0x0102 written in host byte order. Files are not portable between architectures)
+
+   The header is followed by records, each of them prefixed with its size as an uint32:
+    snapshot    one entity record per participant, writer and reader, participants first
+    changes     one change record per change received, in the order they were received
+
+   Change record:
+    kind, writer GUID, instance handle, sequence number, isRead, source timestamp, reception timestamp,
+    sample identity, related sample identity, encapsulation, payload length, payload
+
+   Entity record:
+    entity kind (uint8), entity GUID (the GUID prefix for participants), change record, ack status
+    [count, (GUID prefix, bool)...], and then
+      participants: is_client, is_local, metatraffic unicast and multicast locators [count, locator...]
+      endpoints:    topic name [size, characters]
+ */
+
+//! Kind of file a binary backup header belongs to
+enum class BackupFileKind : uint8_t
+{
+    SNAPSHOT = 1,
+    CHANGES = 2
+};
+
+//! Kind of entity stored on a snapshot record
+enum class BackupEntityKind : uint8_t
+{
+    PARTICIPANT = 1,
+    WRITER = 2,
+    READER = 3
+};
+
+//! Size of the header at the beginning of every binary backup file
+constexpr size_t binary_backup_header_size = 8u;
+
+//! Appends the binary backup header to a buffer
+void write_backup_header(
+        std::vector<fastrtps::rtps::octet>& buffer,
+        BackupFileKind kind);
+
+// Append a plain value to a buffer, in host byte order
+template <typename T>
+void binary_append(
+        std::vector<fastrtps::rtps::octet>& buffer,
+        const T& value)
+{
+    static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be appended");
+    const fastrtps::rtps::octet* bytes = reinterpret_cast<const fastrtps::rtps::octet*>(&value);
+    buffer.insert(buffer.end(), bytes, bytes + sizeof(T));
+}
+
+// Append a GUID prefix to a buffer
+void binary_append(
+        std::vector<fastrtps::rtps::octet>& buffer,
+        const fastrtps::rtps::GuidPrefix_t& prefix);
+
+// Append a GUID to a buffer
+void binary_append(
+        std::vector<fastrtps::rtps::octet>& buffer,
+        const fastrtps::rtps::GUID_t& guid);
+
+// Append a string to a buffer, prefixed with its size
+void binary_append(
+        std::vector<fastrtps::rtps::octet>& buffer,
+        const std::string& value);
+
+// Append a locator list to a buffer, prefixed with its size
+void binary_append(
+        std::vector<fastrtps::rtps::octet>& buffer,
+        const fastrtps::ResourceLimitedVector<fastrtps::rtps::Locator_t>& value);
+
+/**
+ * Sequential reader over a memory region holding binary backup data.
+ * Reads fail when there are not enough bytes left.
+ */
+class BinaryBackupReader
+{
+public:
+
+    BinaryBackupReader(
+            const fastrtps::rtps::octet* data,
+            size_t size)
+        : pos_(data)
+        , end_(data + size)
+    {
+    }
+
+    template <typename T>
+    bool read(
+            T& value)
+    {
+        static_assert(std::is_trivially_copyable<T>::value, "Only trivially copyable values can be read");
+        if (remaining() < sizeof(T))
+        {
+            return false;
+        }
+        memcpy(&value, pos_, sizeof(T));
+        pos_ += sizeof(T);
+        return true;
+    }
+
+    bool read(
+            std::string& value);
+
+    bool read(
+            fastrtps::rtps::RemoteLocatorList& locators);
+
+    /**
+     * Take a view of the next bytes, without copying them.
+     * @return pointer to the first byte, or nullptr if there are not enough bytes left.
+     */
+    const fastrtps::rtps::octet* view(
+            size_t size)
+    {
+        if (remaining() < size)
+        {
+            return nullptr;
+        }
+        const fastrtps::rtps::octet* ret = pos_;
+        pos_ += size;
+        return ret;
+    }
+
+    size_t remaining() const
+    {
+        return static_cast<size_t>(end_ - pos_);
+    }
+
+private:
+
+    const fastrtps::rtps::octet* pos_;
+    const fastrtps::rtps::octet* end_;
+};
+
+/**
+ * Contents of a change record.
+ * The payload is not copied, and points to the memory the record was read from.
+ */
+struct BackupChangeRecord
+{
+    fastrtps::rtps::ChangeKind_t kind = fastrtps::rtps::ALIVE;
+    fastrtps::rtps::GUID_t writer_guid;
+    fastrtps::rtps::InstanceHandle_t instance_handle;
+    fastrtps::rtps::SequenceNumber_t sequence_number;
+    bool is_read = false;
+    fastrtps::rtps::Time_t source_timestamp;
+    fastrtps::rtps::Time_t reception_timestamp;
+    fastrtps::rtps::SampleIdentity sample_identity;
+    fastrtps::rtps::SampleIdentity related_sample_identity;
+    uint16_t encapsulation = 0;
+    uint32_t length = 0;
+    const fastrtps::rtps::octet* data = nullptr;
+
+    /**
+     * Copy the record into a change.
+     * @return false if the payload of the change has not room enough for the payload of the record.
+     */
+    bool to_change(
+            fastrtps::rtps::CacheChange_t& change) const;
+};
+
+//! Contents of an entity record of a snapshot
+struct BackupEntityRecord
+{
+    BackupEntityKind kind = BackupEntityKind::PARTICIPANT;
+    fastrtps::rtps::GUID_t guid;
+    BackupChangeRecord change;
+    std::vector<std::pair<fastrtps::rtps::GuidPrefix_t, bool>> ack_status;
+
+    // Participant information
+    bool is_client = false;
+    bool is_local = false;
+    fastrtps::rtps::RemoteLocatorList metatraffic_locators;
+
+    // Endpoint information
+    std::string topic;
+};
+
+// Append the info from a change to a buffer
+void to_binary(
+        std::vector<fastrtps::rtps::octet>& buffer,
+        const eprosima::fastrtps::rtps::CacheChange_t& change);
+
+// Read a change record
+bool from_binary(
+        BinaryBackupReader& reader,
+        BackupChangeRecord& record);
+
+// Read an entity record
+bool from_binary(
+        BinaryBackupReader& reader,
+        BackupEntityRecord& record);
+
+/**
+ * Read all the entity records of a snapshot file.
+ * @param data   Contents of the file.
+ * @param size   Size of the file.
+ * @param records Vector where the records are added. Their payloads point to @c data.
+ * @return false if the file is not a snapshot or is corrupted.
+ */
+bool read_backup_snapshot(
+        const fastrtps::rtps::octet* data,
+        size_t size,
+        std::vector<BackupEntityRecord>& records);
+
+/**
+ * Read-only view of a whole file.
+ * The file is memory mapped when the platform allows it, and read into memory otherwise.
+ */
+class BackupFileView
+{
+public:
+
+    BackupFileView() = default;
+
+    ~BackupFileView();
+
+    BackupFileView(
+            const BackupFileView&) = delete;
+    BackupFileView& operator =(
+            const BackupFileView&) = delete;
+
+    //! @return false if the file does not exist or could not be read.
+    bool open(
+            const std::string& file_name);
+
+    const fastrtps::rtps::octet* data() const
+    {
+        return data_;
+    }
+
+    size_t size() const
+    {
+        return size_;
+    }
+
+private:
+
+    const fastrtps::rtps::octet* data_ = nullptr;
+    size_t size_ = 0;
+    bool mapped_ = false;
+    std::vector<fastrtps::rtps::octet> contents_;
+};
+
+} /* ddb */
+} /* namespace rtps */
+} /* namespace fastdds */
+} /* namespace eprosima */
+
+#endif /* _BINARY_BACKUP_FUNCTIONS_H_ */
@@ -150,6 +150,12 @@ bool EDP::newLocalReaderProxyData(
                 }
                 rpd->m_qos.setQos(rqos, true);
                 rpd->userDefinedId(ratt.getUserDefinedID());
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+                // Readers map the payloads referenced by the writers on their shared memory segments unless told not to
+                const std::string* shm_payload_descriptors = PropertyPolicyHelper::find_property(ratt.properties,
+                                fastdds::dds::parameter_shm_payload_descriptors);
+                rpd->shm_payload_descriptors(nullptr == shm_payload_descriptors || "false" != *shm_payload_descriptors);
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
                 if (nullptr != content_filter)
                 {
                     // Check content of ContentFilterProperty.
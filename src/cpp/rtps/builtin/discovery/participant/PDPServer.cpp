@@ -24,6 +24,7 @@
 
 #include <fastrtps/utils/TimedMutex.hpp>
 
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/builtin/BuiltinProtocols.h>
 #include <fastdds/rtps/builtin/liveliness/WLP.h>
 
@@ -36,6 +37,7 @@
 #include <fastdds/rtps/history/History.h>
 
 #include <fastrtps/utils/TimeConversion.h>
+#include <fastdds/dds/core/policy/ParameterTypes.hpp>
 #include <fastdds/dds/core/policy/QosPolicies.hpp>
 #include <fastdds/dds/log/Log.hpp>
 
@@ -124,13 +126,62 @@ bool PDPServer::init(
         return false;
     }
 
+    const RTPSParticipantAttributes& attr = getRTPSParticipant()->getRTPSParticipantAttributes();
+    const std::string* processing_threads = PropertyPolicyHelper::find_property(
+        attr.properties, fastdds::dds::parameter_discovery_processing_threads);
+    if (nullptr != processing_threads)
+    {
+        try
+        {
+            discovery_db_.enable_parallel_processing(static_cast<uint32_t>(std::stoul(*processing_threads)),
+                    attr.discovery_server_thread, static_cast<uint32_t>(attr.participantID));
+        }
+        catch (const std::exception&)
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Invalid value for property "
+                    << fastdds::dds::parameter_discovery_processing_threads << ": " << *processing_threads);
+        }
+    }
+
     std::vector<nlohmann::json> backup_queue;
     if (durability_ == TRANSIENT)
     {
+        binary_backup_ = DiscoveryBackupFormat::BINARY == attr.builtin.discovery_config.backup_format;
+        const std::string* flush_period = PropertyPolicyHelper::find_property(
+            attr.properties, fastdds::dds::parameter_discovery_backup_flush_period);
+        if (nullptr != flush_period)
+        {
+            try
+            {
+                backup_flush_period_ = std::chrono::milliseconds(std::stoul(*flush_period));
+            }
+            catch (const std::exception&)
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Invalid value for property "
+                        << fastdds::dds::parameter_discovery_backup_flush_period << ": " << *flush_period);
+            }
+        }
+
         nlohmann::json backup_json;
+        ddb::BackupFileView binary_backup;
+        std::vector<ddb::BackupEntityRecord> binary_records;
         // If the DS is BACKUP, try to restore DDB from file
+        // A json backup is restored when there is no binary one, so servers can be upgraded keeping their backups
         discovery_db().backup_in_progress(true);
-        if (read_backup(backup_json, backup_queue))
+        if (binary_backup_ && binary_backup.open(get_ddb_binary_persistence_file_name()))
+        {
+            if (ddb::read_backup_snapshot(binary_backup.data(), binary_backup.size(), binary_records) &&
+                    process_backup_discovery_database_restore(binary_records))
+            {
+                EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, "DiscoveryDataBase restored correctly");
+            }
+            else
+            {
+                EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER,
+                        "Error reading binary backup file. Corrupted file, restarting from scratch");
+            }
+        }
+        else if (read_backup(backup_json, backup_queue))
         {
             if (process_backup_discovery_database_restore(backup_json))
             {
@@ -145,7 +196,16 @@ bool PDPServer::init(
 
         discovery_db().backup_in_progress(false);
 
-        discovery_db_.persistence_enable(get_ddb_queue_persistence_file_name());
+        if (binary_backup_)
+        {
+            discovery_db_.persistence_enable(get_ddb_binary_queue_persistence_file_name(),
+                    get_ddb_binary_persistence_file_name(), backup_flush_period_, attr.discovery_server_thread,
+                    static_cast<uint32_t>(attr.participantID));
+        }
+        else
+        {
+            discovery_db_.persistence_enable(get_ddb_queue_persistence_file_name());
+        }
     }
     else
     {
@@ -806,6 +866,20 @@ std::string PDPServer::get_ddb_queue_persistence_file_name() const
     return filename.str();
 }
 
+std::string PDPServer::get_ddb_binary_persistence_file_name() const
+{
+    std::ostringstream filename = get_persistence_file_name_();
+    filename << ".ddb";
+    return filename.str();
+}
+
+std::string PDPServer::get_ddb_binary_queue_persistence_file_name() const
+{
+    std::ostringstream filename = get_persistence_file_name_();
+    filename << "_queue.ddb";
+    return filename.str();
+}
+
 void PDPServer::announceParticipantState(
         bool new_change,
         bool dispose /* = false */,
@@ -1865,6 +1939,137 @@ bool PDPServer::process_backup_discovery_database_restore(
     return true;
 }
 
+bool PDPServer::process_backup_discovery_database_restore(
+        const std::vector<ddb::BackupEntityRecord>& records)
+{
+    EPROSIMA_LOG_INFO(RTPS_PDP_SERVER, "Restoring DiscoveryDataBase from binary backup");
+
+    // We need every listener to resend the changes of every entity (ALIVE) in the DDB, so the PaticipantProxy
+    // is restored
+    EDPServer* edp = static_cast<EDPServer*>(mp_EDP);
+    EDPServerPUBListener* edp_pub_listener = static_cast<EDPServerPUBListener*>(edp->publications_listener_);
+    EDPServerSUBListener* edp_sub_listener = static_cast<EDPServerSUBListener*>(edp->subscriptions_listener_);
+
+    // These mutexes are necessary to send messages to the listeners
+    auto endpoints = static_cast<fastdds::rtps::DiscoveryServerPDPEndpoints*>(builtin_endpoints_.get());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock(endpoints->reader.reader_->getMutex());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edpp(edp->publications_reader_.first->getMutex());
+    std::unique_lock<fastrtps::RecursiveTimedMutex> lock_edps(edp->subscriptions_reader_.first->getMutex());
+
+    std::map<eprosima::fastrtps::rtps::InstanceHandle_t, fastrtps::rtps::CacheChange_t*> changes_map;
+
+    // Every reserved change is kept with the reader it comes from, or nullptr for the virtual ones, so all of them
+    // can be released if the backup turns out to be corrupted
+    std::vector<std::pair<RTPSReader*, fastrtps::rtps::CacheChange_t*>> reserved_changes;
+    reserved_changes.reserve(records.size());
+    auto release_changes = [&reserved_changes]()
+            {
+                for (auto& reserved : reserved_changes)
+                {
+                    if (nullptr == reserved.first)
+                    {
+                        delete reserved.second;
+                    }
+                    else
+                    {
+                        reserved.first->releaseCache(reserved.second);
+                    }
+                }
+                reserved_changes.clear();
+            };
+
+    // Create every change before passing any of them to the listeners
+    for (const ddb::BackupEntityRecord& record : records)
+    {
+        fastrtps::rtps::CacheChange_t* change_aux = nullptr;
+        bool is_virtual = ddb::BackupEntityKind::PARTICIPANT != record.kind &&
+                record.topic == discovery_db().virtual_topic();
+
+        // If it is external creates it from Reader. There will not be changes from own server
+        RTPSReader* reader = endpoints->reader.reader_;
+        if (ddb::BackupEntityKind::WRITER == record.kind)
+        {
+            reader = edp->publications_reader_.first;
+        }
+        else if (ddb::BackupEntityKind::READER == record.kind)
+        {
+            reader = edp->subscriptions_reader_.first;
+        }
+
+        if (is_virtual)
+        {
+            change_aux = new fastrtps::rtps::CacheChange_t(record.change.length);
+            reserved_changes.emplace_back(nullptr, change_aux);
+        }
+        else if (reader->reserveCache(&change_aux, record.change.length))
+        {
+            reserved_changes.emplace_back(reader, change_aux);
+        }
+        else
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PDP_SERVER, "Error creating CacheChange");
+            release_changes();
+            return false;
+        }
+
+        // Insert into the map so the DDB can store it
+        if (!record.change.to_change(*change_aux) ||
+                !changes_map.insert(std::make_pair(change_aux->instanceHandle, change_aux)).second)
+        {
+            EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "BACKUP CORRUPTED");
+            release_changes();
+            return false;
+        }
+    }
+
+    // Records are sorted so participants come before their endpoints
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const ddb::BackupEntityRecord& record = records[i];
+        fastrtps::rtps::CacheChange_t* change_aux = reserved_changes[i].second;
+        bool is_virtual = nullptr == reserved_changes[i].first;
+
+        // Call listener to create proxy info for other entities different than server
+        if (change_aux->write_params.sample_identity().writer_guid().guidPrefix ==
+                endpoints->writer.writer_->getGuid().guidPrefix ||
+                change_aux->kind != fastrtps::rtps::ALIVE || is_virtual)
+        {
+            continue;
+        }
+
+        switch (record.kind)
+        {
+            case ddb::BackupEntityKind::PARTICIPANT:
+                // If the change was read as is_local we must pass it to listener with his own writer_guid
+                if (record.is_local)
+                {
+                    change_aux->writerGUID = change_aux->write_params.sample_identity().writer_guid();
+                    change_aux->sequenceNumber = change_aux->write_params.sample_identity().sequence_number();
+                    builtin_endpoints_->main_listener()->onNewCacheChangeAdded(endpoints->reader.reader_,
+                            change_aux);
+                }
+                break;
+            case ddb::BackupEntityKind::WRITER:
+                edp_pub_listener->onNewCacheChangeAdded(edp->publications_reader_.first, change_aux);
+                break;
+            case ddb::BackupEntityKind::READER:
+                edp_sub_listener->onNewCacheChangeAdded(edp->subscriptions_reader_.first, change_aux);
+                break;
+        }
+    }
+
+    // load database
+    // The listeners do not take the changes while the backup is in progress, and the database only takes them when
+    // the whole backup is consistent, so they are still owned here when it fails
+    if (!discovery_db_.from_binary(records, changes_map))
+    {
+        EPROSIMA_LOG_ERROR(DISCOVERY_DATABASE, "BACKUP CORRUPTED");
+        release_changes();
+        return false;
+    }
+    return true;
+}
+
 bool PDPServer::process_backup_restore_queue(
         std::vector<nlohmann::json>& /* new_changes */)
 {
@@ -1998,6 +2203,13 @@ bool PDPServer::process_backup_restore_queue(
 
 void PDPServer::process_backup_store()
 {
+    if (binary_backup_)
+    {
+        // The snapshot replaces the changes stored until now
+        discovery_db_.store_binary_backup();
+        return;
+    }
+
     EPROSIMA_LOG_INFO(DISCOVERY_DATABASE, "Dump DDB in json backup");
 
     // This will erase the last backup stored
@@ -23,6 +23,7 @@
 
 #include <fastdds/rtps/builtin/discovery/participant/PDP.h>
 
+#include <chrono>
 #include <set>
 #include <sstream>
 #include <string>
@@ -33,6 +34,7 @@
 #include <fastdds/rtps/resources/ResourceEvent.h>
 #include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
 #include <rtps/builtin/discovery/database/DiscoveryDataFilter.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
 #include <rtps/builtin/discovery/participant/timedevent/DServerEvent.hpp>
 #include <rtps/builtin/discovery/participant/DS/DiscoveryServerPDPEndpointsSecure.hpp>
 
@@ -165,6 +167,12 @@ public:
     //! Get filename for discovery database file
     std::string get_ddb_queue_persistence_file_name() const;
 
+    //! Get filename for binary discovery database file
+    std::string get_ddb_binary_persistence_file_name() const;
+
+    //! Get filename for binary discovery database queue file
+    std::string get_ddb_binary_queue_persistence_file_name() const;
+
     /*
      * Wakes up the DServerRoutineEvent for new matching or trimming
      * By default the server execute the routine instantly
@@ -266,6 +274,11 @@ protected:
     bool process_backup_discovery_database_restore(
             nlohmann::json& ddb_json);
 
+    // Method to restore de DiscoveryDataBase from the records of a binary snapshot
+    // Same as the json counterpart. The payloads of the records are copied into the reserved changes
+    bool process_backup_discovery_database_restore(
+            const std::vector<ddb::BackupEntityRecord>& records);
+
     // Restore the backup file with the changes that were added to the DDB queues (and so acked)
     // It reserves memory for the changes depending the pool, and send them by the listener to the DDB
     // This method must be called with the DDB variable backup_in_progress as false
@@ -384,6 +397,12 @@ private:
     //! TRANSIENT or TRANSIENT_LOCAL durability;
     fastrtps::rtps::DurabilityKind_t durability_;
 
+    //! Whether the TRANSIENT backup uses the binary format instead of json
+    bool binary_backup_ = true;
+
+    //! Maximum time the changes of a binary backup wait before being synced to disk
+    std::chrono::milliseconds backup_flush_period_{50};
+
 };
 
 } // namespace rtps
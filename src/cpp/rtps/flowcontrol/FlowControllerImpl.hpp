@@ -17,6 +17,7 @@
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <utils/thread.hpp>
 #include <utils/threading.hpp>
+#include <utils/tracing/Tracepoints.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -1186,6 +1187,8 @@ private:
             {
                 fastrtps::rtps::RTPSMessageGroup group(participant_, writer, &locator_selector, max_blocking_time);
                 ret_value = true;
+                FASTDDS_TRACEPOINT_SCOPE(tracepoint, "FlowController::deliver", change->writerGUID,
+                        change->sequenceNumber);
                 if (fastrtps::rtps::DeliveryRetCode::DELIVERED !=
                         writer->deliver_sample_nts(change, group, locator_selector, max_blocking_time))
                 {
@@ -1417,6 +1420,8 @@ private:
                 change_to_process->writer_info.next = nullptr;
                 change_to_process->writer_info.is_linked.store(false);
 
+                FASTDDS_TRACEPOINT_SCOPE(tracepoint, "FlowController::deliver", change_to_process->writerGUID,
+                        change_to_process->sequenceNumber);
                 fastrtps::rtps::DeliveryRetCode ret_delivery = current_writer->deliver_sample_nts(
                     change_to_process, async_mode.group, locator_selector,
                     std::chrono::steady_clock::now() + std::chrono::hours(24));
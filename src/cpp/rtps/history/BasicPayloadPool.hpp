@@ -19,6 +19,7 @@
 #ifndef RTPS_HISTORY_BASICPAYLOADPOOL_HPP
 #define RTPS_HISTORY_BASICPAYLOADPOOL_HPP
 
+#include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/common/CacheChange.h>
 #include <fastdds/rtps/history/IPayloadPool.h>
 
@@ -84,6 +85,12 @@ private:
             return nullptr;
         }
 
+        if (!(PayloadPoolsAllocationAttributes() == config.placement))
+        {
+            EPROSIMA_LOG_WARNING(RTPS_HISTORY,
+                    "Payload pools placement is only applied to topic payload pools, it is ignored");
+        }
+
         switch (config.memory_policy)
         {
             case PREALLOCATED_MEMORY_MODE:
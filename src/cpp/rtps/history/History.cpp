@@ -208,10 +208,19 @@ bool History::get_change(
     }
 
     std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
-    get_change_nts(seq, guid, change, m_changes.cbegin());
+    *change = lookup_change_nts(seq, guid);
     return *change != nullptr;
 }
 
+CacheChange_t* History::lookup_change_nts(
+        const SequenceNumber_t& seq,
+        const GUID_t& guid) const
+{
+    CacheChange_t* change = nullptr;
+    get_change_nts(seq, guid, &change, m_changes.cbegin());
+    return change;
+}
+
 History::const_iterator History::get_change_nts(
         const SequenceNumber_t& seq,
         const GUID_t& guid,
@@ -20,6 +20,7 @@
 #define RTPS_HISTORY_POOLCONFIG_H_
 
 #include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAllocationAttributes.hpp>
 #include <fastdds/rtps/resources/ResourceManagement.h>
 
 namespace eprosima {
@@ -33,6 +34,13 @@ struct BasicPoolConfig
 
     //! Payload size when preallocating data.
     uint32_t payload_initial_size;
+
+    /**
+     * Placement of the memory backing preallocated payloads.
+     * Only applied by topic payload pools with preallocated memory policies. With PREALLOCATED_WITH_REALLOC, payloads
+     * that grow over the initial size move to the heap. Other pools ignore it, logging a warning.
+     */
+    PayloadPoolsAllocationAttributes placement;
 };
 
 struct PoolConfig : public BasicPoolConfig
@@ -44,7 +52,7 @@ struct PoolConfig : public BasicPoolConfig
             uint32_t payload_size,
             uint32_t ini_size,
             uint32_t max_size) noexcept
-        : BasicPoolConfig {policy, payload_size}
+        : BasicPoolConfig {policy, payload_size, {}}
         , initial_size(ini_size)
         , maximum_size(max_size)
     {
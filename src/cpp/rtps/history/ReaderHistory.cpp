@@ -27,6 +27,7 @@
 #include <rtps/common/ChangeComparison.hpp>
 #include <utils/collections/sorted_vector_insert.hpp>
 
+#include <algorithm>
 #include <mutex>
 
 namespace eprosima {
@@ -106,6 +107,19 @@ bool ReaderHistory::add_change(
     }
 
     eprosima::utilities::collections::sorted_vector_insert(m_changes, a_change, fastdds::rtps::history_order_cmp);
+
+    // Changes completed since the last addition are not looked for by fragment anymore
+    fragmented_changes_.erase(
+        std::remove_if(fragmented_changes_.begin(), fragmented_changes_.end(),
+        [](CacheChange_t* change)
+        {
+            return change->is_fully_assembled();
+        }), fragmented_changes_.end());
+    if (!a_change->is_fully_assembled())
+    {
+        fragmented_changes_.push_back(a_change);
+    }
+
     EPROSIMA_LOG_INFO(RTPS_READER_HISTORY,
             "Change " << a_change->sequenceNumber << " added with " << a_change->serializedPayload.length << " bytes");
 
@@ -127,6 +141,21 @@ bool ReaderHistory::matches_change(
            inner_change->writerGUID == outer_change->writerGUID;
 }
 
+CacheChange_t* ReaderHistory::lookup_change_nts(
+        const SequenceNumber_t& seq,
+        const GUID_t& guid) const
+{
+    for (CacheChange_t* change : fragmented_changes_)
+    {
+        if (change->sequenceNumber == seq && change->writerGUID == guid)
+        {
+            return change;
+        }
+    }
+
+    return History::lookup_change_nts(seq, guid);
+}
+
 History::iterator ReaderHistory::remove_change_nts(
         const_iterator removal,
         bool release)
@@ -148,6 +177,12 @@ History::iterator ReaderHistory::remove_change_nts(
     auto ret_val = m_changes.erase(removal);
     m_isHistoryFull = false;
 
+    auto fragmented_it = std::find(fragmented_changes_.begin(), fragmented_changes_.end(), change);
+    if (fragmented_changes_.end() != fragmented_it)
+    {
+        fragmented_changes_.erase(fragmented_it);
+    }
+
     mp_reader->change_removed_by_history(change);
     if (release)
     {
@@ -206,27 +241,20 @@ bool ReaderHistory::remove_fragmented_changes_until(
     }
 
     std::lock_guard<RecursiveTimedMutex> guard(*mp_mutex);
-    std::vector<CacheChange_t*>::iterator chit = m_changes.begin();
-    while (chit != m_changes.end())
+
+    // Only the changes being reassembled are candidates
+    size_t pos = 0;
+    while (pos < fragmented_changes_.size())
     {
-        CacheChange_t* item = *chit;
-        if (item->writerGUID == writer_guid)
+        CacheChange_t* item = fragmented_changes_[pos];
+        if (item->writerGUID == writer_guid && item->sequenceNumber < seq_num && item->is_fully_assembled() == false)
         {
-            if (item->sequenceNumber < seq_num)
-            {
-                if (item->is_fully_assembled() == false)
-                {
-                    EPROSIMA_LOG_INFO(RTPS_READER_HISTORY, "Removing change " << item->sequenceNumber);
-                    chit = remove_change_nts(chit);
-                    continue;
-                }
-            }
-            else
-            {
-                break;
-            }
+            EPROSIMA_LOG_INFO(RTPS_READER_HISTORY, "Removing change " << item->sequenceNumber);
+            // Removing the change also removes it from fragmented_changes_, so pos is not advanced
+            remove_change_nts(std::find(m_changes.cbegin(), m_changes.cend(), item));
+            continue;
         }
-        ++chit;
+        ++pos;
     }
 
     return true;
@@ -0,0 +1,224 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReceiveBufferPool.hpp
+ */
+
+#ifndef RTPS_HISTORY_RECEIVEBUFFERPOOL_HPP
+#define RTPS_HISTORY_RECEIVEBUFFERPOOL_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/history/IPayloadPool.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * Fixed set of reference counted buffers where a transport receives its messages.
+ *
+ * The payload of a sample carried on a received message can be assigned to a cache change without copying it, by
+ * calling @c get_payload with this pool as the owner of the data. The buffer holding the message is then kept alive
+ * until all the cache changes referencing it are released, and only then it is reused for a new reception.
+ *
+ * The transport holds a reference on the buffer it is receiving into. When all the buffers are referenced the
+ * transport should keep receiving on its own buffer, so the memory used by the pool is bounded.
+ *
+ * Instances must be managed by a @c std::shared_ptr, as the pool keeps itself alive while any of its buffers is
+ * referenced from a cache change, which may outlive the transport.
+ */
+class ReceiveBufferPool : public IPayloadPool, public std::enable_shared_from_this<ReceiveBufferPool>
+{
+
+public:
+
+    /**
+     * @param buffer_size Size of each buffer, which should be the maximum size of a received message.
+     * @param buffer_count Number of buffers on the pool.
+     */
+    ReceiveBufferPool(
+            uint32_t buffer_size,
+            uint32_t buffer_count)
+        : buffer_size_(buffer_size)
+        , buffer_count_(buffer_count)
+        , storage_(new octet[static_cast<size_t>(buffer_size) * buffer_count])
+        , references_(new std::atomic<uint32_t>[buffer_count])
+    {
+        free_buffers_.reserve(buffer_count);
+        for (uint32_t i = buffer_count; i > 0; --i)
+        {
+            references_[i - 1].store(0u, std::memory_order_relaxed);
+            free_buffers_.push_back(i - 1);
+        }
+    }
+
+    uint32_t buffer_size() const
+    {
+        return buffer_size_;
+    }
+
+    /**
+     * Takes a free buffer, which will be referenced by the caller.
+     * @return Pointer to the buffer, or nullptr if all of them are in use.
+     */
+    octet* get_buffer()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (free_buffers_.empty())
+        {
+            return nullptr;
+        }
+
+        if (free_buffers_.size() == buffer_count_)
+        {
+            keep_alive_ = shared_from_this();
+        }
+
+        uint32_t index = free_buffers_.back();
+        free_buffers_.pop_back();
+        references_[index].store(1u, std::memory_order_relaxed);
+        return &storage_[static_cast<size_t>(index) * buffer_size_];
+    }
+
+    /**
+     * Gets a buffer for the next reception, reusing the current one when nothing else references it.
+     * @param buffer Buffer referenced by the caller, or nullptr.
+     * @return Pointer to the buffer, or nullptr if all of them are in use.
+     */
+    octet* renew_buffer(
+            octet* buffer)
+    {
+        if (nullptr != buffer)
+        {
+            if (1u == references_[index_of(buffer)].load(std::memory_order_acquire))
+            {
+                return buffer;
+            }
+            release_buffer(buffer);
+        }
+        return get_buffer();
+    }
+
+    /**
+     * Releases the reference taken by @c get_buffer or @c renew_buffer.
+     * @param buffer Buffer to release.
+     *
+     * @warning The pool may be destroyed by this call, if it was the last reference on it.
+     */
+    void release_buffer(
+            const octet* buffer)
+    {
+        dereference(index_of(buffer));
+    }
+
+    bool get_payload(
+            uint32_t /*size*/,
+            CacheChange_t& /*cache_change*/) override
+    {
+        // Buffers are only filled by the transport
+        return false;
+    }
+
+    bool get_payload(
+            SerializedPayload_t& data,
+            IPayloadPool*& data_owner,
+            CacheChange_t& cache_change) override
+    {
+        // Only payloads already on one of the buffers can be referenced
+        if (data_owner != this || !contains(data.data))
+        {
+            return false;
+        }
+
+        references_[index_of(data.data)].fetch_add(1u, std::memory_order_relaxed);
+
+        cache_change.serializedPayload.data = data.data;
+        cache_change.serializedPayload.length = data.length;
+        cache_change.serializedPayload.max_size = data.length;
+        cache_change.payload_owner(this);
+        return true;
+    }
+
+    bool release_payload(
+            CacheChange_t& cache_change) override
+    {
+        assert(cache_change.payload_owner() == this);
+
+        octet* data = cache_change.serializedPayload.data;
+        cache_change.serializedPayload.length = 0;
+        cache_change.serializedPayload.pos = 0;
+        cache_change.serializedPayload.max_size = 0;
+        cache_change.serializedPayload.data = nullptr;
+        cache_change.payload_owner(nullptr);
+
+        dereference(index_of(data));
+        return true;
+    }
+
+private:
+
+    bool contains(
+            const octet* data) const
+    {
+        return data >= storage_.get() && data < storage_.get() + static_cast<size_t>(buffer_size_) * buffer_count_;
+    }
+
+    uint32_t index_of(
+            const octet* data) const
+    {
+        assert(contains(data));
+        return static_cast<uint32_t>(static_cast<size_t>(data - storage_.get()) / buffer_size_);
+    }
+
+    void dereference(
+            uint32_t index)
+    {
+        if (1u != references_[index].fetch_sub(1u, std::memory_order_acq_rel))
+        {
+            return;
+        }
+
+        // Declared before the lock, so the pool is destroyed after unlocking it
+        std::shared_ptr<ReceiveBufferPool> last_reference;
+        std::lock_guard<std::mutex> lock(mutex_);
+        free_buffers_.push_back(index);
+        if (free_buffers_.size() == buffer_count_)
+        {
+            last_reference.swap(keep_alive_);
+        }
+    }
+
+    uint32_t buffer_size_;
+    uint32_t buffer_count_;
+    std::unique_ptr<octet[]> storage_;
+    std::unique_ptr<std::atomic<uint32_t>[]> references_;
+
+    std::mutex mutex_;
+    std::vector<uint32_t> free_buffers_;
+    std::shared_ptr<ReceiveBufferPool> keep_alive_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif  // RTPS_HISTORY_RECEIVEBUFFERPOOL_HPP
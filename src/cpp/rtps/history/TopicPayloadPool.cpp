@@ -189,7 +189,10 @@ TopicPayloadPool::PayloadNode* TopicPayloadPool::allocate(
 TopicPayloadPool::PayloadNode* TopicPayloadPool::do_allocate(
         uint32_t size)
 {
-    PayloadNode* payload = new (std::nothrow) PayloadNode(size);
+    // Only payloads fitting on the blocks of the arena are placed on it
+    utilities::memory::FixedSizeBlockArena* arena =
+            (arena_ && PayloadNode::block_size(size) <= arena_->block_size()) ? arena_.get() : nullptr;
+    PayloadNode* payload = new (std::nothrow) PayloadNode(size, arena);
 
     if (payload != nullptr)
     {
@@ -248,6 +251,12 @@ void TopicPayloadPool::reserve (
 {
     assert (min_num_payloads <= max_pool_size_);
 
+    if (arena_ && min_num_payloads > all_payloads_.size())
+    {
+        // Map all the new buffers in a single region
+        arena_->reserve(min_num_payloads - all_payloads_.size());
+    }
+
     for (size_t i = all_payloads_.size(); i < min_num_payloads; ++i)
     {
         PayloadNode* payload = do_allocate(size);
@@ -279,6 +288,23 @@ bool TopicPayloadPool::shrink (
     return true;
 }
 
+void TopicPayloadPool::set_placement(
+        uint32_t payload_size,
+        const PayloadPoolsAllocationAttributes& placement)
+{
+    assert(all_payloads_.empty());
+
+    utilities::memory::MemoryPlacement memory_placement;
+    memory_placement.use_huge_pages = placement.use_huge_pages;
+    memory_placement.prefault = placement.prefault;
+    memory_placement.numa_node = placement.numa_node;
+    if (!memory_placement.is_default())
+    {
+        arena_.reset(new utilities::memory::FixedSizeBlockArena(
+                    PayloadNode::block_size(payload_size), memory_placement));
+    }
+}
+
 std::unique_ptr<ITopicPayloadPool> TopicPayloadPool::get(
         const BasicPoolConfig& config)
 {
@@ -289,13 +315,21 @@ std::unique_ptr<ITopicPayloadPool> TopicPayloadPool::get(
 
     ITopicPayloadPool* ret_val = nullptr;
 
+    if ((DYNAMIC_RESERVE_MEMORY_MODE == config.memory_policy ||
+            DYNAMIC_REUSABLE_MEMORY_MODE == config.memory_policy) &&
+            !(PayloadPoolsAllocationAttributes() == config.placement))
+    {
+        EPROSIMA_LOG_WARNING(RTPS_HISTORY,
+                "Payload pools placement is only applied with preallocated memory policies, it is ignored");
+    }
+
     switch (config.memory_policy)
     {
         case PREALLOCATED_MEMORY_MODE:
-            ret_val = new PreallocatedTopicPayloadPool(config.payload_initial_size);
+            ret_val = new PreallocatedTopicPayloadPool(config.payload_initial_size, config.placement);
             break;
         case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
-            ret_val = new PreallocatedReallocTopicPayloadPool(config.payload_initial_size);
+            ret_val = new PreallocatedReallocTopicPayloadPool(config.payload_initial_size, config.placement);
             break;
         case DYNAMIC_RESERVE_MEMORY_MODE:
             ret_val = new DynamicTopicPayloadPool();
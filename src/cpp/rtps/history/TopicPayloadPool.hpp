@@ -25,9 +25,11 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <rtps/history/PoolConfig.h>
 #include <rtps/history/ITopicPayloadPool.h>
+#include <utils/memory/FixedSizeBlockArena.hpp>
 
 #include <atomic>
 #include <cstddef>
+#include <cstring>
 #include <memory>
 #include <mutex>
 #include <vector>
@@ -137,9 +139,16 @@ protected:
     public:
 
         explicit PayloadNode(
-                uint32_t size)
+                uint32_t size,
+                utilities::memory::FixedSizeBlockArena* arena = nullptr)
+            : arena_(arena)
         {
-            if (!size)
+            if (arena_)
+            {
+                assert(arena_->block_size() >= block_size(size));
+                buffer = static_cast<octet*>(arena_->allocate());
+            }
+            else if (!size)
             {
                 //! At least, we need this to allocate space for a NodeInfo.
                 //! In order to be able to place-construct later
@@ -163,7 +172,14 @@ protected:
         ~PayloadNode()
         {
             info().~NodeInfo();
-            free(buffer);
+            if (arena_)
+            {
+                arena_->deallocate(buffer);
+            }
+            else
+            {
+                free(buffer);
+            }
         }
 
         bool resize (
@@ -171,6 +187,29 @@ protected:
         {
             assert(size > data_size());
 
+            if (arena_)
+            {
+                // Arena blocks have a fixed size, so the node moves to a heap buffer
+                octet* new_buffer = (octet*)calloc(size + data_offset, sizeof(octet));
+                if (!new_buffer)
+                {
+                    return false;
+                }
+
+                NodeInfo* new_info = new (new_buffer) NodeInfo();
+                new_info->ref_counter.store(info().ref_counter.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+                new_info->data_index = data_index();
+                memcpy(new_info->data, data(), data_size());
+
+                info().~NodeInfo();
+                arena_->deallocate(buffer);
+                arena_ = nullptr;
+                buffer = new_buffer;
+                data_size(size);
+                return true;
+            }
+
             octet* old_buffer = buffer;
             buffer = (octet*)realloc(buffer, size + data_offset);
             if (!buffer)
@@ -244,6 +283,16 @@ protected:
             return (info(data).ref_counter.fetch_sub(1, std::memory_order_acq_rel) == 1);
         }
 
+        /**
+         * @param size Payload data size
+         * @return Size of the buffer needed for a node with @c size bytes of payload data
+         */
+        static size_t block_size(
+                uint32_t size)
+        {
+            return size + sizeof(NodeInfo) - 1;
+        }
+
     private:
 
         struct NodeInfo
@@ -256,6 +305,9 @@ protected:
 
         octet* buffer = nullptr;
 
+        //! Arena holding the buffer, nullptr when the buffer is heap allocated
+        utilities::memory::FixedSizeBlockArena* arena_ = nullptr;
+
         // Payload data comes after the metadata
         static constexpr size_t data_offset = offsetof(NodeInfo, data);
 
@@ -288,6 +340,19 @@ protected:
     PayloadNode* do_allocate(
             uint32_t size);
 
+    /**
+     * Makes the buffers of the payloads of @c payload_size bytes be carved from memory with the given placement.
+     * Payloads allocated or resized to a bigger size are kept on the heap.
+     *
+     * @param [IN] payload_size Size of the payload data of the nodes placed on the arena
+     * @param [IN] placement    Placement requirements of the memory of the payloads
+     *
+     * @pre No payload has been allocated yet
+     */
+    void set_placement(
+            uint32_t payload_size,
+            const PayloadPoolsAllocationAttributes& placement);
+
     virtual void update_maximum_size(
             const PoolConfig& config,
             bool is_reserve);
@@ -355,6 +420,9 @@ protected:
     uint32_t infinite_histories_count_  = 0;  //< Number of infinite histories reserved
     uint32_t finite_max_pool_size_      = 0;  //< Maximum size of the pool if no infinite histories were reserved
 
+    //< Arena for the payload buffers, when they need a specific memory placement. Must outlive the payloads.
+    std::unique_ptr<utilities::memory::FixedSizeBlockArena> arena_;
+
     std::vector<PayloadNode*> free_payloads_; //< Payloads that are free
     std::vector<PayloadNode*> all_payloads_;  //< All payloads
 
@@ -30,11 +30,15 @@ class PreallocatedTopicPayloadPool : public TopicPayloadPool
 public:
 
     explicit PreallocatedTopicPayloadPool(
-            uint32_t payload_size)
+            uint32_t payload_size,
+            const PayloadPoolsAllocationAttributes& placement = PayloadPoolsAllocationAttributes())
         : payload_size_(payload_size)
         , minimum_pool_size_(0)
     {
         assert(payload_size_ > 0);
+
+        // All payloads have the same size, so they can be carved from regions with the requested placement
+        set_placement(payload_size_, placement);
     }
 
     bool get_payload(
@@ -30,11 +30,15 @@ class PreallocatedReallocTopicPayloadPool : public TopicPayloadPool
 public:
 
     explicit PreallocatedReallocTopicPayloadPool(
-            uint32_t payload_size)
+            uint32_t payload_size,
+            const PayloadPoolsAllocationAttributes& placement = PayloadPoolsAllocationAttributes())
         : min_payload_size_(payload_size)
         , minimum_pool_size_(0)
     {
         assert(min_payload_size_ > 0);
+
+        // Only the preallocated payloads have a fixed size. They move to the heap when they need to grow.
+        set_placement(min_payload_size_, placement);
     }
 
     bool get_payload(
@@ -23,6 +23,7 @@
 #include <fastdds/rtps/common/WriteParams.h>
 #include <fastdds/core/policy//ParameterSerializer.hpp>
 
+#include <algorithm>
 #include <mutex>
 
 namespace eprosima {
@@ -168,6 +169,54 @@ bool WriterHistory::matches_change(
     return inner_change->sequenceNumber == outer_change->sequenceNumber;
 }
 
+History::const_iterator WriterHistory::find_change_nts(
+        CacheChange_t* ch)
+{
+    if (nullptr == mp_mutex)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_HISTORY, "You need to create a RTPS Entity with this History before using it");
+        return const_iterator();
+    }
+
+    if (nullptr == ch)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_WRITER_HISTORY, "Pointer is not valid");
+        return changesEnd();
+    }
+
+    // Changes are added with increasing sequence numbers, so the history is always sorted by them
+    const_iterator it = std::lower_bound(m_changes.cbegin(), m_changes.cend(), ch->sequenceNumber,
+                    [](const CacheChange_t* change, const SequenceNumber_t& seq)
+                    {
+                        return change->sequenceNumber < seq;
+                    });
+
+    if (it != m_changes.cend() && matches_change(*it, ch))
+    {
+        return it;
+    }
+
+    return changesEnd();
+}
+
+CacheChange_t* WriterHistory::lookup_change_nts(
+        const SequenceNumber_t& seq,
+        const GUID_t& guid) const
+{
+    if (nullptr == mp_writer || guid != mp_writer->getGuid())
+    {
+        return nullptr;
+    }
+
+    const_iterator it = std::lower_bound(m_changes.cbegin(), m_changes.cend(), seq,
+                    [](const CacheChange_t* change, const SequenceNumber_t& sequence_number)
+                    {
+                        return change->sequenceNumber < sequence_number;
+                    });
+
+    return (it != m_changes.cend() && (*it)->sequenceNumber == seq) ? *it : nullptr;
+}
+
 History::iterator WriterHistory::remove_change_nts(
         const_iterator removal,
         bool release)
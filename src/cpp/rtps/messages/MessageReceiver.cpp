@@ -17,8 +17,12 @@
  *
  */
 
+#include <algorithm>
+#include <atomic>
 #include <cassert>
+#include <memory>
 #include <limits>
+#include <mutex>
 #include <thread>
 
 #include <fastdds/rtps/common/EntityId_t.hpp>
@@ -29,11 +33,14 @@
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/rtps/writer/RTPSWriter.h>
-#include <fastrtps/utils/shared_mutex.hpp>
 
 #include <rtps/participant/RTPSParticipantImpl.h>
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+#include <rtps/transport/shared_mem/SharedMemPayloadPool.hpp>
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
 #include <statistics/rtps/StatisticsBase.hpp>
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
+#include <utils/tracing/Tracepoints.hpp>
 
 #define INFO_SRC_SUBMSG_LENGTH 20
 
@@ -48,7 +55,8 @@ namespace rtps {
 MessageReceiver::MessageReceiver(
         RTPSParticipantImpl* participant,
         uint32_t rec_buffer_size)
-    : participant_(participant)
+    : endpoints_(std::make_shared<AssociatedEndpoints>())
+    , participant_(participant)
     , source_version_(c_ProtocolVersion)
     , source_vendor_id_(c_VendorId_Unknown)
     , source_guid_prefix_(c_GuidPrefix_Unknown)
@@ -109,11 +117,19 @@ MessageReceiver::MessageReceiver(
 #endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 }
 
+MessageReceiver::MessageReceiver(
+        const MessageReceiver& endpoints_owner,
+        uint32_t rec_buffer_size)
+    : MessageReceiver(endpoints_owner.participant_, rec_buffer_size)
+{
+    endpoints_ = endpoints_owner.endpoints_;
+}
+
 MessageReceiver::~MessageReceiver()
 {
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, "");
-    assert(associated_writers_.empty());
-    assert(associated_readers_.empty());
+    assert(1 < endpoints_.use_count() || std::atomic_load(&endpoints_->table)->writers.empty());
+    assert(1 < endpoints_.use_count() || std::atomic_load(&endpoints_->table)->readers.empty());
 }
 
  #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
@@ -242,11 +258,13 @@ void MessageReceiver::process_data_fragment_message_without_security(
 void MessageReceiver::associateEndpoint(
         Endpoint* to_add)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
+    std::lock_guard<std::mutex> guard(endpoints_->mtx);
+    std::shared_ptr<const EndpointTable> previous = std::atomic_load(&endpoints_->table);
+
     if (to_add->getAttributes().endpointKind == WRITER)
     {
         const auto writer = dynamic_cast<RTPSWriter*>(to_add);
-        for (const auto& it : associated_writers_)
+        for (const auto& it : previous->writers)
         {
             if (it == writer)
             {
@@ -254,21 +272,17 @@ void MessageReceiver::associateEndpoint(
             }
         }
 
-        associated_writers_.push_back(writer);
+        auto table = std::make_shared<EndpointTable>(*previous);
+        table->writers.push_back(writer);
+        replace_endpoints(std::move(previous), std::move(table), false);
     }
     else
     {
         const auto reader = dynamic_cast<RTPSReader*>(to_add);
         const auto entityId = reader->getGuid().entityId;
         // search for set of readers by entity ID
-        const auto readers = associated_readers_.find(entityId);
-        if (readers == associated_readers_.end())
-        {
-            auto vec = std::vector<RTPSReader*>();
-            vec.push_back(reader);
-            associated_readers_.emplace(entityId, vec);
-        }
-        else
+        const auto readers = previous->readers.find(entityId);
+        if (readers != previous->readers.end())
         {
             for (const auto& it : readers->second)
             {
@@ -277,51 +291,73 @@ void MessageReceiver::associateEndpoint(
                     return;
                 }
             }
-
-            readers->second.push_back(reader);
         }
+
+        auto table = std::make_shared<EndpointTable>(*previous);
+        table->readers[entityId].push_back(reader);
+        replace_endpoints(std::move(previous), std::move(table), false);
     }
 }
 
 void MessageReceiver::removeEndpoint(
         Endpoint* to_remove)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
+    std::lock_guard<std::mutex> guard(endpoints_->mtx);
+    std::shared_ptr<const EndpointTable> previous = std::atomic_load(&endpoints_->table);
 
     if (to_remove->getAttributes().endpointKind == WRITER)
     {
         auto* var = dynamic_cast<RTPSWriter*>(to_remove);
-        for (auto it = associated_writers_.begin(); it != associated_writers_.end(); ++it)
+        if (previous->writers.end() != std::find(previous->writers.begin(), previous->writers.end(), var))
         {
-            if (*it == var)
-            {
-                associated_writers_.erase(it);
-                break;
-            }
+            auto table = std::make_shared<EndpointTable>(*previous);
+            table->writers.erase(std::find(table->writers.begin(), table->writers.end(), var));
+            replace_endpoints(std::move(previous), std::move(table), true);
         }
     }
     else
     {
-        auto readers = associated_readers_.find(to_remove->getGuid().entityId);
-        if (readers != associated_readers_.end())
+        auto* var = dynamic_cast<RTPSReader*>(to_remove);
+        auto readers = previous->readers.find(var->getGuid().entityId);
+        if (readers != previous->readers.end())
         {
-            auto* var = dynamic_cast<RTPSReader*>(to_remove);
-            for (auto it = readers->second.begin(); it != readers->second.end(); ++it)
+            if (readers->second.end() != std::find(readers->second.begin(), readers->second.end(), var))
             {
-                if (*it == var)
+                auto table = std::make_shared<EndpointTable>(*previous);
+                auto& vec = table->readers[readers->first];
+                vec.erase(std::find(vec.begin(), vec.end(), var));
+                if (vec.empty())
                 {
-                    readers->second.erase(it);
-                    if (readers->second.empty())
-                    {
-                        associated_readers_.erase(readers);
-                    }
-                    break;
+                    table->readers.erase(readers->first);
                 }
+                replace_endpoints(std::move(previous), std::move(table), true);
             }
         }
     }
 }
 
+void MessageReceiver::replace_endpoints(
+        std::shared_ptr<const EndpointTable>&& previous,
+        std::shared_ptr<const EndpointTable>&& table,
+        bool wait_previous)
+{
+    std::atomic_store(&endpoints_->table, table);
+    previous.reset();
+
+    if (wait_previous)
+    {
+        // Messages already being processed may hold any table older than the new one, so they may still be delivered
+        // to the removed endpoint. They are counted on the parity of the current epoch. New messages are counted on
+        // the other one after flipping it, and take the new table, so waiting for the old counter to drain is enough.
+        uint32_t epoch = endpoints_->epoch.fetch_add(1);
+        std::atomic<uint32_t>& old_in_flight = endpoints_->in_flight[epoch & 1u];
+        while (0u != old_in_flight.load())
+        {
+            std::this_thread::yield();
+        }
+    }
+}
+
 void MessageReceiver::reset()
 {
     source_version_ = c_ProtocolVersion;
@@ -330,12 +366,44 @@ void MessageReceiver::reset()
     dest_guid_prefix_ = c_GuidPrefix_Unknown;
     have_timestamp_ = false;
     timestamp_ = c_TimeInvalid;
+    buffer_owner_ = nullptr;
+    received_buffer_ = nullptr;
+    shm_reception_ = false;
 }
 
 void MessageReceiver::processCDRMsg(
         const Locator_t& source_locator,
         const Locator_t& reception_locator,
-        CDRMessage_t* msg)
+        CDRMessage_t* msg,
+        IPayloadPool* buffer_owner)
+{
+    // The endpoints are taken once per message, without locking, and kept until it has been processed.
+    // The message is counted on the current epoch before taking them, so removals wait for it.
+    for (;;)
+    {
+        uint32_t epoch = endpoints_->epoch.load();
+        current_in_flight_ = &endpoints_->in_flight[epoch & 1u];
+        current_in_flight_->fetch_add(1u);
+        if (epoch == endpoints_->epoch.load())
+        {
+            break;
+        }
+        // An endpoint was removed meanwhile, which may not be waiting for this counter
+        current_in_flight_->fetch_sub(1u);
+    }
+
+    current_endpoints_ = std::atomic_load(&endpoints_->table);
+    process_message(source_locator, reception_locator, msg, buffer_owner);
+    current_endpoints_.reset();
+    current_in_flight_->fetch_sub(1u);
+    current_in_flight_ = nullptr;
+}
+
+void MessageReceiver::process_message(
+        const Locator_t& source_locator,
+        const Locator_t& reception_locator,
+        CDRMessage_t* msg,
+        IPayloadPool* buffer_owner)
 {
     if (msg->length < RTPSMESSAGE_HEADER_SIZE)
     {
@@ -357,51 +425,56 @@ void MessageReceiver::processCDRMsg(
 
     bool ignore_submessages = false;
 
-    {
-        std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
-        reset();
+    reset();
 
-        dest_guid_prefix_ = participantGuidPrefix;
+    dest_guid_prefix_ = participantGuidPrefix;
+    buffer_owner_ = buffer_owner;
+    received_buffer_ = msg->buffer;
+    shm_reception_ = LOCATOR_KIND_SHM == reception_locator.kind;
+#if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
+    if (participant_->is_secure())
+    {
+        // Payloads may be decoded differently for each reader, so they are always copied
+        buffer_owner_ = nullptr;
+    }
+#endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
-        msg->pos = 0; //Start reading at 0
+    msg->pos = 0; //Start reading at 0
 
-        //Once everything is set, the reading begins:
-        if (!checkRTPSHeader(msg))
-        {
-            return;
-        }
+    //Once everything is set, the reading begins:
+    if (!checkRTPSHeader(msg))
+    {
+        return;
+    }
 
 #if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
-        ignore_submessages = participant_->is_participant_ignored(source_guid_prefix_);
+    ignore_submessages = participant_->is_participant_ignored(source_guid_prefix_);
 #endif  // if !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
-        if (!ignore_submessages)
-        {
-            notify_network_statistics(source_locator, reception_locator, msg);
-        }
+    if (!ignore_submessages)
+    {
+        notify_network_statistics(source_locator, reception_locator, msg);
+    }
 
 #if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
-        decode_ret = security.decode_rtps_message(*msg, *auxiliary_buffer, source_guid_prefix_);
+    decode_ret = security.decode_rtps_message(*msg, *auxiliary_buffer, source_guid_prefix_);
 
-        if (decode_ret < 0)
-        {
-            return;
-        }
+    if (decode_ret < 0)
+    {
+        return;
+    }
 
-        if (decode_ret == 0)
-        {
-            // The original CDRMessage buffer (msg) now points to the proprietary temporary buffer crypto_msg_.
-            // The auxiliary buffer now points to the propietary temporary buffer crypto_submsg_.
-            // This way each decoded sub-message will be processed using the crypto_submsg_ buffer.
-            msg = auxiliary_buffer;
-            auxiliary_buffer = &crypto_submsg_;
-        }
-#endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
+    if (decode_ret == 0)
+    {
+        // The original CDRMessage buffer (msg) now points to the proprietary temporary buffer crypto_msg_.
+        // The auxiliary buffer now points to the propietary temporary buffer crypto_submsg_.
+        // This way each decoded sub-message will be processed using the crypto_submsg_ buffer.
+        msg = auxiliary_buffer;
+        auxiliary_buffer = &crypto_submsg_;
     }
+#endif // if HAVE_SECURITY && !defined(FUZZING_BUILD_MODE_UNSAFE_FOR_PRODUCTION)
 
     // Loop until there are no more submessages
-    // Each submessage processing method choses the lock kind required
     bool valid;
     SubmessageHeader_t submsgh; //Current submessage header
 
@@ -671,7 +744,7 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
         RTPSReader*& first_reader) const
 {
     first_reader = nullptr;
-    if (associated_readers_.empty())
+    if (current_endpoints_->readers.empty())
     {
         EPROSIMA_LOG_WARNING(RTPS_MSG_IN, IDSTRING "Data received when NO readers are listening");
         return false;
@@ -679,8 +752,8 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
 
     if (readerID != c_EntityId_Unknown)
     {
-        const auto readers = associated_readers_.find(readerID);
-        if (readers != associated_readers_.end())
+        const auto readers = current_endpoints_->readers.find(readerID);
+        if (readers != current_endpoints_->readers.end())
         {
             first_reader = readers->second.front();
             return true;
@@ -688,7 +761,7 @@ bool MessageReceiver::willAReaderAcceptMsgDirectedTo(
     }
     else
     {
-        for (const auto& readers : associated_readers_)
+        for (const auto& readers : current_endpoints_->readers)
         {
             for (const auto& it : readers.second)
             {
@@ -712,8 +785,8 @@ void MessageReceiver::findAllReaders(
 {
     if (readerID != c_EntityId_Unknown)
     {
-        const auto readers = associated_readers_.find(readerID);
-        if (readers != associated_readers_.end())
+        const auto readers = current_endpoints_->readers.find(readerID);
+        if (readers != current_endpoints_->readers.end())
         {
             for (const auto& it : readers->second)
             {
@@ -723,7 +796,7 @@ void MessageReceiver::findAllReaders(
     }
     else
     {
-        for (const auto& readers : associated_readers_)
+        for (const auto& readers : current_endpoints_->readers)
         {
             for (const auto& it : readers.second)
             {
@@ -742,8 +815,8 @@ bool MessageReceiver::proc_Submsg_Data(
         EntityId_t& writerID,
         bool was_decoded) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
-
+    FASTDDS_TRACEPOINT_SCOPE(tracepoint, "MessageReceiver::proc_Submsg_Data", GUID_t::unknown(),
+            SequenceNumber_t::unknown());
     //READ and PROCESS
     if (smh->submessageLength < RTPSMESSAGE_DATA_MIN_LENGTH)
     {
@@ -812,6 +885,8 @@ bool MessageReceiver::proc_Submsg_Data(
         return false;
     }
 
+    FASTDDS_TRACEPOINT_SAMPLE(tracepoint, ch.writerGUID, ch.sequenceNumber);
+
     //Jump ahead if more parameters are before inlineQos (not in this version, maybe if further minor versions.)
     if (octetsToInlineQos > RTPSMESSAGE_OCTETSTOINLINEQOS_DATASUBMSG)
     {
@@ -855,6 +930,15 @@ bool MessageReceiver::proc_Submsg_Data(
                 ch.serializedPayload.length = payload_size;
                 ch.serializedPayload.max_size = payload_size;
                 msg->pos = next_pos;
+
+                // Payloads taking most of the message are referenced on the buffer where it was received, so the
+                // readers do not need to copy them. Smaller ones are copied, to avoid keeping a whole buffer alive
+                // for them. Decoded messages are not on the received buffer, so they are always copied.
+                if (nullptr != buffer_owner_ && received_buffer_ == msg->buffer && 2 * payload_size >= msg->length)
+                {
+                    IPayloadPool* buffer_owner = buffer_owner_;
+                    buffer_owner->get_payload(ch.serializedPayload, buffer_owner, ch);
+                }
             }
             else
             {
@@ -888,6 +972,37 @@ bool MessageReceiver::proc_Submsg_Data(
         }
     }
 
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+    // The payload may be referenced from a shared memory segment instead of being carried by the message.
+    // The reference prevents the writer from recycling it until the change has been processed.
+    // Descriptors are only sent to shared memory locators, so they are not trusted when received elsewhere.
+    std::shared_ptr<void> shm_payload;
+    fastdds::rtps::SharedMemPayloadDescriptor shm_descriptor;
+    if (inlineQosFlag && !dataFlag && !keyFlag && ALIVE == ch.kind &&
+            fastdds::rtps::SharedMemPayloadDescriptor::read_from_inline_qos(ch.inline_qos, shm_descriptor))
+    {
+        if (!shm_reception_)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_MSG_IN,
+                    IDSTRING "Shared memory payload descriptor of change " << ch.sequenceNumber <<
+                    " received on a non shared memory locator, ignoring");
+            ch.serializedPayload.data = nullptr;
+            ch.inline_qos.data = nullptr;
+            return false;
+        }
+
+        shm_payload = fastdds::rtps::SharedMemPayloadPool::map_payload(shm_descriptor, ch.serializedPayload);
+        if (!shm_payload)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_MSG_IN,
+                    IDSTRING "Shared memory payload of change " << ch.sequenceNumber << " not available, ignoring");
+            ch.serializedPayload.data = nullptr;
+            ch.inline_qos.data = nullptr;
+            return false;
+        }
+    }
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+
     // Set sourcetimestamp
     if (have_timestamp_)
     {
@@ -895,7 +1010,7 @@ bool MessageReceiver::proc_Submsg_Data(
     }
 
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "from Writer " << ch.writerGUID << "; possible RTPSReader entities: " <<
-            associated_readers_.size());
+            current_endpoints_->readers.size());
 
     //Look for the correct reader to add the change
     process_data_message_function_(readerID, ch, was_decoded);
@@ -919,8 +1034,8 @@ bool MessageReceiver::proc_Submsg_DataFrag(
         SubmessageHeader_t* smh,
         bool was_decoded) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
-
+    FASTDDS_TRACEPOINT_SCOPE(tracepoint, "MessageReceiver::proc_Submsg_DataFrag", GUID_t::unknown(),
+            SequenceNumber_t::unknown());
     //READ and PROCESS
     if (smh->submessageLength < RTPSMESSAGE_DATA_MIN_LENGTH)
     {
@@ -976,6 +1091,8 @@ bool MessageReceiver::proc_Submsg_DataFrag(
         return false;
     }
 
+    FASTDDS_TRACEPOINT_SAMPLE(tracepoint, ch.writerGUID, ch.sequenceNumber);
+
     // READ FRAGMENT NUMBER
     uint32_t fragmentStartingNum;
     valid &= CDRMessage::readUInt32(msg, &fragmentStartingNum);
@@ -1082,7 +1199,7 @@ bool MessageReceiver::proc_Submsg_DataFrag(
     }
 
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "from Writer " << ch.writerGUID << "; possible RTPSReader entities: " <<
-            associated_readers_.size());
+            current_endpoints_->readers.size());
     process_data_fragment_message_function_(readerID, ch, sampleSize, fragmentStartingNum, fragmentsInSubmessage,
             was_decoded);
     ch.serializedPayload.data = nullptr;
@@ -1098,8 +1215,6 @@ bool MessageReceiver::proc_Submsg_Heartbeat(
         SubmessageHeader_t* smh,
         bool was_decoded) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     bool finalFlag = (smh->flags & BIT(1)) != 0;
     bool livelinessFlag = (smh->flags & BIT(2)) != 0;
@@ -1168,8 +1283,6 @@ bool MessageReceiver::proc_Submsg_Acknack(
     // Only used when HAVE_SECURITY is defined
     static_cast<void>(was_decoded);
 
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     bool finalFlag = (smh->flags & BIT(1)) != 0;
     //Assign message endianness
@@ -1197,7 +1310,7 @@ bool MessageReceiver::proc_Submsg_Acknack(
     }
 
     //Look for the correct writer to use the acknack
-    for (RTPSWriter* it : associated_writers_)
+    for (RTPSWriter* it : current_endpoints_->writers)
     {
 #if HAVE_SECURITY
         if (was_decoded || !it->getAttributes().security_attributes().is_submessage_protected)
@@ -1215,7 +1328,7 @@ bool MessageReceiver::proc_Submsg_Acknack(
         }
     }
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack msg to UNKNOWN writer (I looked through "
-            << associated_writers_.size() << " writers in this ListenResource)");
+            << current_endpoints_->writers.size() << " writers in this ListenResource)");
     return false;
 }
 
@@ -1224,8 +1337,6 @@ bool MessageReceiver::proc_Submsg_Gap(
         SubmessageHeader_t* smh,
         bool was_decoded) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     //Assign message endianness
     if (endiannessFlag)
@@ -1271,8 +1382,6 @@ bool MessageReceiver::proc_Submsg_InfoTS(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     bool timeFlag = (smh->flags & BIT(1)) != 0;
     //Assign message endianness
@@ -1301,8 +1410,6 @@ bool MessageReceiver::proc_Submsg_InfoDST(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0u;
     //bool timeFlag = smh->flags & BIT(1) ? true : false;
     //Assign message endianness
@@ -1328,8 +1435,6 @@ bool MessageReceiver::proc_Submsg_InfoSRC(
         CDRMessage_t* msg,
         SubmessageHeader_t* smh)
 {
-    std::lock_guard<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     //bool timeFlag = smh->flags & BIT(1) ? true : false;
     //Assign message endianness
@@ -1363,8 +1468,6 @@ bool MessageReceiver::proc_Submsg_NackFrag(
     // Only used when HAVE_SECURITY is defined
     static_cast<void>(was_decoded);
 
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     //Assign message endianness
     if (endiannessFlag)
@@ -1397,7 +1500,7 @@ bool MessageReceiver::proc_Submsg_NackFrag(
     }
 
     //Look for the correct writer to use the acknack
-    for (RTPSWriter* it : associated_writers_)
+    for (RTPSWriter* it : current_endpoints_->writers)
     {
 #if HAVE_SECURITY
         if (was_decoded || !it->getAttributes().security_attributes().is_submessage_protected)
@@ -1415,7 +1518,7 @@ bool MessageReceiver::proc_Submsg_NackFrag(
         }
     }
     EPROSIMA_LOG_INFO(RTPS_MSG_IN, IDSTRING "Acknack msg to UNKNOWN writer (I looked through "
-            << associated_writers_.size() << " writers in this ListenResource)");
+            << current_endpoints_->writers.size() << " writers in this ListenResource)");
     return false;
 }
 
@@ -1424,8 +1527,6 @@ bool MessageReceiver::proc_Submsg_HeartbeatFrag(
         SubmessageHeader_t* smh,
         bool /*was_decoded*/) const
 {
-    eprosima::shared_lock<eprosima::shared_mutex> guard(mtx_);
-
     bool endiannessFlag = (smh->flags & BIT(0)) != 0;
     //Assign message endianness
     if (endiannessFlag)
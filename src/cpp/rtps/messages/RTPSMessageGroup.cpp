@@ -28,8 +28,12 @@
 #include <rtps/messages/RTPSGapBuilder.hpp>
 #include <rtps/messages/RTPSMessageGroup_t.hpp>
 #include <rtps/participant/RTPSParticipantImpl.h>
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+#include <rtps/transport/shared_mem/SharedMemPayloadPool.hpp>
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
 
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
+#include <utils/tracing/Tracepoints.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -58,6 +62,40 @@ public:
 
 };
 
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+/**
+ * An InlineQosWriter that puts the inline_qos of a CacheChange_t into a CDRMessage_t, followed by the descriptor of
+ * its payload on a shared memory segment.
+ */
+class SharedMemPayloadInlineQoSWriter final : public InlineQosWriter
+{
+    const CacheChange_t& change_;
+    const fastdds::rtps::SharedMemPayloadDescriptor& descriptor_;
+
+public:
+
+    SharedMemPayloadInlineQoSWriter(
+            const CacheChange_t& change,
+            const fastdds::rtps::SharedMemPayloadDescriptor& descriptor)
+        : change_(change)
+        , descriptor_(descriptor)
+    {
+    }
+
+    bool writeQosToCDRMessage(
+            CDRMessage_t* msg) final
+    {
+        bool ret = true;
+        if (change_.inline_qos.length > 0 && nullptr != change_.inline_qos.data)
+        {
+            ret = CDRMessage::addData(msg, change_.inline_qos.data, change_.inline_qos.length);
+        }
+        return ret && descriptor_.add_to_cdr_message(msg);
+    }
+
+};
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+
 static bool data_exceeds_limitation(
         uint32_t size_to_add,
         uint32_t limitation,
@@ -285,6 +323,8 @@ void RTPSMessageGroup::send()
 
         if (full_msg_->length > RTPSMESSAGE_HEADER_SIZE)
         {
+            FASTDDS_TRACEPOINT_SCOPE(tracepoint, "RTPSMessageGroup::send", endpoint_->getGuid(),
+                    SequenceNumber_t::unknown());
             std::lock_guard<RTPSMessageSenderInterface> lock(*sender_);
 
 #if HAVE_SECURITY
@@ -454,6 +494,8 @@ bool RTPSMessageGroup::add_data(
         throw limit_exceeded();
     }
 
+    FASTDDS_TRACEPOINT_INSTANT("RTPSMessageGroup::add_data", endpoint_->getGuid(), change.sequenceNumber);
+
     // Check preconditions. If fail flush and reset.
     check_and_maybe_flush();
     add_info_ts_in_buffer(change.sourceTimestamp);
@@ -473,6 +515,25 @@ bool RTPSMessageGroup::add_data(
     change_to_add.serializedPayload.length = change.serializedPayload.length;
     change_to_add.writerGUID = endpoint_->getGuid();
 
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+    // When all the destinations can map the payload from its shared memory segment, only its descriptor is sent
+    fastdds::rtps::SharedMemPayloadDescriptor shm_descriptor;
+    SharedMemPayloadInlineQoSWriter shm_qos_writer(change, shm_descriptor);
+    bool is_protected = false;
+#if HAVE_SECURITY
+    is_protected = endpoint_->getAttributes().security_attributes().is_payload_protected ||
+            endpoint_->getAttributes().security_attributes().is_submessage_protected ||
+            (participant_->security_attributes().is_rtps_protected && endpoint_->supports_rtps_protection());
+#endif // if HAVE_SECURITY
+    if (!is_protected && ALIVE == change.kind && sender_->destinations_accept_shm_payload_descriptors() &&
+            fastdds::rtps::SharedMemPayloadPool::get_descriptor(change, shm_descriptor))
+    {
+        inline_qos = &shm_qos_writer;
+        change_to_add.serializedPayload.data = nullptr;
+        change_to_add.serializedPayload.length = 0;
+    }
+#endif // ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+
 #if HAVE_SECURITY
     if (endpoint_->getAttributes().security_attributes().is_payload_protected)
     {
@@ -557,6 +618,8 @@ bool RTPSMessageGroup::add_data_frag(
         throw limit_exceeded();
     }
 
+    FASTDDS_TRACEPOINT_INSTANT("RTPSMessageGroup::add_data_frag", endpoint_->getGuid(), change.sequenceNumber);
+
     // Check preconditions. If fail flush and reset.
     check_and_maybe_flush();
     add_info_ts_in_buffer(change.sourceTimestamp);
@@ -19,10 +19,13 @@
 
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/transport/PortBasedTransportDescriptor.hpp>
 #include <fastdds/rtps/transport/TransportDescriptorInterface.h>
+#include <fastdds/rtps/transport/UDPTransportDescriptor.h>
 #include <fastrtps/utils/IPFinder.h>
 #include <fastrtps/utils/IPLocator.h>
 
+#include <rtps/network/SharedReceiverResources.hpp>
 #include <rtps/transport/UDPv4Transport.h>
 
 using namespace std;
@@ -39,6 +42,7 @@ NetworkFactory::NetworkFactory(
     : maxMessageSizeBetweenTransports_((std::numeric_limits<uint32_t>::max)())
     , minSendBufferSize_((std::numeric_limits<uint32_t>::max)())
     , network_configuration_(0)
+    , thread_layout_(PParam.thread_topology)
 {
     const std::string* enforce_metatraffic = nullptr;
     enforce_metatraffic = PropertyPolicyHelper::find_property(PParam.properties, "fastdds.shm.enforce_metatraffic");
@@ -93,12 +97,15 @@ bool NetworkFactory::BuildReceiverResources(
         {
             if (!transport->IsInputChannelOpen(local))
             {
+                uint32_t listening_threads = input_channel_threads(*transport, local);
+                place_reception_thread(*transport, local.port, listening_threads);
+
                 uint32_t max_recv_buffer_size = (std::min)(
                     transport->max_recv_buffer_size(),
                     receiver_max_message_size);
 
                 std::shared_ptr<ReceiverResource> newReceiverResource = std::shared_ptr<ReceiverResource>(
-                    new ReceiverResource(*transport, local, max_recv_buffer_size));
+                    new ReceiverResource(*transport, local, max_recv_buffer_size, 1 < listening_threads));
 
                 if (newReceiverResource->mValid)
                 {
@@ -115,6 +122,70 @@ bool NetworkFactory::BuildReceiverResources(
     return returnedValue;
 }
 
+bool NetworkFactory::BuildSharedReceiverResources(
+        Locator_t& local,
+        std::vector<std::shared_ptr<ReceiverResource>>& returned_resources_list,
+        uint32_t receiver_max_message_size)
+{
+    if (!IPLocator::isMulticast(local))
+    {
+        return BuildReceiverResources(local, returned_resources_list, receiver_max_message_size);
+    }
+
+    bool returnedValue = false;
+    for (auto& transport : mRegisteredTransports)
+    {
+        if (transport->IsLocatorSupported(local))
+        {
+            uint32_t max_recv_buffer_size = (std::min)(
+                transport->max_recv_buffer_size(),
+                receiver_max_message_size);
+            place_reception_thread(*transport, local.port, input_channel_threads(*transport, local));
+            const TransportDescriptorInterface* descriptor = transport->get_configuration();
+
+            auto create = [descriptor, &local, max_recv_buffer_size](
+                const TransportDescriptorInterface*& configuration) -> std::shared_ptr<ReceiverResource>
+                    {
+                        std::shared_ptr<TransportInterface> shared_transport(descriptor->create_transport());
+                        if (!shared_transport || !shared_transport->init())
+                        {
+                            return nullptr;
+                        }
+
+                        std::unique_ptr<ReceiverResource> resource(
+                            new ReceiverResource(*shared_transport, local, max_recv_buffer_size));
+                        if (!resource->mValid)
+                        {
+                            return nullptr;
+                        }
+                        resource->shared_ = true;
+                        configuration = shared_transport->get_configuration();
+
+                        // The channel is closed, and the transport destroyed, when the last participant releases it.
+                        // The transport is released explicitly, as the deleter is kept while the registry holds a
+                        // weak reference to the resource.
+                        return std::shared_ptr<ReceiverResource>(resource.release(),
+                                       [shared_transport](ReceiverResource* released) mutable
+                                       {
+                                           released->disable();
+                                           delete released;
+                                           shared_transport.reset();
+                                       });
+                    };
+
+            std::shared_ptr<ReceiverResource> resource =
+                    SharedReceiverResources::instance().get_or_create(local, max_recv_buffer_size, *descriptor,
+                    create);
+            if (resource)
+            {
+                returned_resources_list.push_back(resource);
+                returnedValue = true;
+            }
+        }
+    }
+    return returnedValue;
+}
+
 bool NetworkFactory::RegisterTransport(
         const TransportDescriptorInterface* descriptor,
         const fastrtps::rtps::PropertyPolicy* properties)
@@ -130,6 +201,7 @@ bool NetworkFactory::RegisterTransport(
         int32_t kind = transport->kind();
         bool is_localhost_allowed = transport->is_localhost_allowed();
 
+        apply_thread_layout(*transport);
         if (transport->init(properties))
         {
             minSendBufferSize = transport->get_configuration()->min_send_buffer_size();
@@ -159,6 +231,67 @@ bool NetworkFactory::RegisterTransport(
     return wasRegistered;
 }
 
+void NetworkFactory::apply_thread_layout(
+        TransportInterface& transport)
+{
+    if (thread_layout_.is_default())
+    {
+        return;
+    }
+
+    // The transport keeps its own copy of the descriptor, from where its threads take their settings
+    TransportDescriptorInterface* configuration = transport.get_configuration();
+
+    PortBasedTransportDescriptor* port_based = dynamic_cast<PortBasedTransportDescriptor*>(configuration);
+    if (nullptr != port_based && 0 == port_based->default_reception_threads().affinity)
+    {
+        ThreadSettings settings = port_based->default_reception_threads();
+        settings.affinity = thread_layout_.reception_mask();
+        port_based->default_reception_threads(settings);
+        placed_transports_.insert(&transport);
+    }
+
+    transport.update_general_threads([this](const ThreadSettings& settings)
+            {
+                return thread_layout_.general_thread(settings);
+            });
+}
+
+uint32_t NetworkFactory::input_channel_threads(
+        TransportInterface& transport,
+        const Locator_t& locator)
+{
+    const UDPTransportDescriptor* udp = dynamic_cast<const UDPTransportDescriptor*>(transport.get_configuration());
+    if (nullptr != udp && !IPLocator::isMulticast(locator))
+    {
+        return UDPTransportInterface::unicast_socket_group_size(*udp);
+    }
+    return 1u;
+}
+
+void NetworkFactory::place_reception_thread(
+        TransportInterface& transport,
+        uint32_t port,
+        uint32_t listening_threads)
+{
+    if (!thread_layout_.auto_spread() || placed_transports_.end() == placed_transports_.find(&transport))
+    {
+        return;
+    }
+
+    PortBasedTransportDescriptor* port_based =
+            dynamic_cast<PortBasedTransportDescriptor*>(transport.get_configuration());
+    if (nullptr != port_based &&
+            port_based->reception_threads().end() == port_based->reception_threads().find(port))
+    {
+        // The default settings of placed transports had no affinity before applying the layout
+        ThreadSettings settings = port_based->default_reception_threads();
+        settings.affinity = 0;
+        port_based->set_thread_config_for_port(port, thread_layout_.reception_thread(settings,
+                next_reception_thread_.fetch_add(listening_threads), listening_threads));
+    }
+}
+
 void NetworkFactory::NormalizeLocators(
         LocatorList_t& locators)
 {
@@ -229,6 +362,12 @@ bool NetworkFactory::is_locator_remote_or_allowed(
 void NetworkFactory::select_locators(
         LocatorSelector& selector) const
 {
+    // The selection only depends on the enabled entries and their locators
+    if (selector.restore_selection())
+    {
+        return;
+    }
+
     selector.selection_start();
 
     /* - for each transport:
@@ -240,6 +379,8 @@ void NetworkFactory::select_locators(
     {
         transport->select_locators(selector);
     }
+
+    selector.store_selection();
 }
 
 bool NetworkFactory::is_local_locator(
@@ -15,8 +15,10 @@
 #ifndef _RTPS_NETWORK_NETWORKFACTORY_H_
 #define _RTPS_NETWORK_NETWORKFACTORY_H_
 
-#include <vector>
+#include <atomic>
 #include <memory>
+#include <set>
+#include <vector>
 
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/LocatorSelector.hpp>
@@ -25,6 +27,7 @@
 #include <fastdds/rtps/transport/TransportInterface.h>
 
 #include <rtps/network/ReceiverResource.h>
+#include <utils/threading/ThreadLayout.hpp>
 
 namespace eprosima {
 namespace fastrtps {
@@ -55,6 +58,7 @@ public:
             const D& descriptor)
     {
         std::unique_ptr<T> transport(new T(descriptor));
+        apply_thread_layout(*transport);
         if (transport->init())
         {
             mRegisteredTransports.emplace_back(std::move(transport));
@@ -92,6 +96,21 @@ public:
             std::vector<std::shared_ptr<ReceiverResource>>& returned_resources_list,
             uint32_t receiver_max_message_size);
 
+    /**
+     * Same as BuildReceiverResources, but multicast locators are listened by resources shared by all the
+     * participants of the process that use this method.
+     * Shared resources are opened on a transport of their own, created with the configuration of the first
+     * participant opening them, so they are kept while any participant is using them. Participants whose transport
+     * is configured differently do not share them.
+     * @param local Locator from which to listen.
+     * @param returned_resources_list List that will be filled with the ReceiverResources.
+     * @param receiver_max_message_size Max message size allowed by the message receiver.
+     */
+    bool BuildSharedReceiverResources(
+            Locator_t& local,
+            std::vector<std::shared_ptr<ReceiverResource>>& returned_resources_list,
+            uint32_t receiver_max_message_size);
+
     void NormalizeLocators(
             LocatorList_t& locators);
 
@@ -139,8 +158,11 @@ public:
      * Perform the locator selection algorithm.
      *
      * It basically consists of the following steps
+     *   - when the selector has a cached selection for its current enabling state, it is restored and nothing else
+     *     is done
      *   - selector.selection_start is called
      *   - the transport selection algorithm is called for each registered transport
+     *   - the resulting selection is cached on the selector
      *
      * @param [in, out] selector Locator selector.
      */
@@ -236,6 +258,26 @@ public:
             const RTPSParticipantAttributes& m_att,
             bool is_multicast) const;
 
+    /**
+     * Layout of the threads of the participant, computed from its ThreadTopologyPolicy.
+     */
+    const fastdds::rtps::ThreadLayout& thread_layout() const
+    {
+        return thread_layout_;
+    }
+
+    /**
+     * Settings for a new reception thread of the participant not created by a transport (i.e. a data-sharing
+     * listener), placed according to the ThreadTopologyPolicy of the participant.
+     * @param settings Settings configured by the user.
+     * @return The settings with the affinity filled when they did not have one.
+     */
+    fastdds::rtps::ThreadSettings reception_thread_settings(
+            const fastdds::rtps::ThreadSettings& settings) const
+    {
+        return thread_layout_.reception_thread(settings, next_reception_thread_++);
+    }
+
     /**
      * Shutdown method to close the connections of the transports.
      */
@@ -263,6 +305,38 @@ private:
     // Mask using transport kinds to indicate whether the transports allows localhost
     NetworkConfigSet_t network_configuration_;
 
+    // Placement of the threads of the participant
+    fastdds::rtps::ThreadLayout thread_layout_;
+
+    // Index of the next reception thread, used to spread them on different CPUs
+    mutable std::atomic<size_t> next_reception_thread_{0};
+
+    // Transports whose reception threads are placed by the thread layout
+    std::set<const fastdds::rtps::TransportInterface*> placed_transports_;
+
+    /**
+     * Fill the affinity of the threads of a transport that is about to be initialized.
+     */
+    void apply_thread_layout(
+            fastdds::rtps::TransportInterface& transport);
+
+    /**
+     * Number of threads a transport listens with on the input channel of a locator.
+     */
+    static uint32_t input_channel_threads(
+            fastdds::rtps::TransportInterface& transport,
+            const Locator_t& locator);
+
+    /**
+     * Configure the reception threads for a port of a transport, before opening an input channel on it.
+     * @param listening_threads Number of threads listening on the port, each one placed on its own CPU when
+     * spreading them.
+     */
+    void place_reception_thread(
+            fastdds::rtps::TransportInterface& transport,
+            uint32_t port,
+            uint32_t listening_threads);
+
     /**
      * Calculate well-known ports.
      */
@@ -14,12 +14,15 @@
 
 #include <rtps/network/ReceiverResource.h>
 
+#include <algorithm>
 #include <cassert>
 #include <thread>
 
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/rtps/messages/MessageReceiver.h>
 
+#include <rtps/network/SharedReceiverResources.hpp>
+
 #define IDSTRING "(ID:" << std::this_thread::get_id() << ") " <<
 
 using namespace std;
@@ -32,15 +35,17 @@ namespace rtps {
 ReceiverResource::ReceiverResource(
         TransportInterface& transport,
         const Locator_t& locator,
-        uint32_t max_recv_buffer_size)
+        uint32_t max_recv_buffer_size,
+        bool concurrent_reception)
     : Cleanup(nullptr)
     , LocatorMapsToManagedChannel(nullptr)
     , mValid(false)
     , mtx()
     , cv_()
-    , receiver(nullptr)
     , max_message_size_(max_recv_buffer_size)
     , active_callbacks_(0)
+    , shared_(false)
+    , concurrent_reception_(concurrent_reception)
 {
     // Internal channel is opened and assigned to this resource.
     mValid = transport.OpenInputChannel(locator, this, max_message_size_);
@@ -67,13 +72,15 @@ ReceiverResource::ReceiverResource(
 
     Cleanup.swap(rValueResource.Cleanup);
     LocatorMapsToManagedChannel.swap(rValueResource.LocatorMapsToManagedChannel);
-    receiver = rValueResource.receiver;
-    rValueResource.receiver = nullptr;
+    receivers_.swap(rValueResource.receivers_);
     mValid = rValueResource.mValid;
     rValueResource.mValid = false;
     max_message_size_ = rValueResource.max_message_size_;
     active_callbacks_ = rValueResource.active_callbacks_;
     rValueResource.active_callbacks_ = 0;
+    shared_ = rValueResource.shared_;
+    concurrent_reception_ = rValueResource.concurrent_reception_;
+    lanes_.swap(rValueResource.lanes_);
 }
 
 bool ReceiverResource::SupportsLocator(
@@ -87,13 +94,24 @@ bool ReceiverResource::SupportsLocator(
 }
 
 void ReceiverResource::RegisterReceiver(
-        MessageReceiver* rcv)
+        MessageReceiver* rcv,
+        const GuidPrefix_t& participant_prefix)
 {
     std::lock_guard<std::mutex> _(mtx);
 
-    if (receiver == nullptr)
+    // Only shared resources may have more than one receiver
+    if (receivers_.empty() || (shared_ && receivers_.end() == std::find_if(receivers_.begin(), receivers_.end(),
+            [rcv](const std::pair<GuidPrefix_t, MessageReceiver*>& registered)
+            {
+                return registered.second == rcv;
+            })))
     {
-        receiver = rcv;
+        receivers_.emplace_back(participant_prefix, rcv);
+        clear_lanes();
+        if (concurrent_reception_ && 1 == receivers_.size())
+        {
+            lanes_.emplace_back(new Lane(rcv));
+        }
     }
 }
 
@@ -102,10 +120,48 @@ void ReceiverResource::UnregisterReceiver(
 {
     std::lock_guard<std::mutex> _(mtx);
 
-    if (receiver == rcv)
+    auto it = std::find_if(receivers_.begin(), receivers_.end(),
+                    [rcv](const std::pair<GuidPrefix_t, MessageReceiver*>& registered)
+                    {
+                        return registered.second == rcv;
+                    });
+    if (it != receivers_.end())
+    {
+        // The receiver is not in use when this returns
+        clear_lanes();
+        receivers_.erase(it);
+        if (concurrent_reception_ && 1 == receivers_.size())
+        {
+            lanes_.emplace_back(new Lane(receivers_.front().second));
+        }
+    }
+}
+
+ReceiverResource::Lane* ReceiverResource::take_lane()
+{
+    for (const std::unique_ptr<Lane>& lane : lanes_)
+    {
+        if (lane->mtx.try_lock())
+        {
+            return lane.get();
+        }
+    }
+
+    Lane* lane = new Lane(nullptr);
+    lane->owned_receiver.reset(new MessageReceiver(*receivers_.front().second, max_message_size_));
+    lane->receiver = lane->owned_receiver.get();
+    lane->mtx.lock();
+    lanes_.emplace_back(lane);
+    return lane;
+}
+
+void ReceiverResource::clear_lanes()
+{
+    for (const std::unique_ptr<Lane>& lane : lanes_)
     {
-        receiver = nullptr;
+        std::lock_guard<std::mutex> lane_guard(lane->mtx);
     }
+    lanes_.clear();
 }
 
 void ReceiverResource::OnDataReceived(
@@ -114,32 +170,65 @@ void ReceiverResource::OnDataReceived(
         const Locator_t& localLocator,
         const Locator_t& remoteLocator)
 {
-    (void)localLocator;
-
-    std::lock_guard<std::mutex> _(mtx);
+    OnDataReceived(data, size, localLocator, remoteLocator, nullptr);
+}
 
-    MessageReceiver* rcv = receiver;
+void ReceiverResource::OnDataReceived(
+        const octet* data,
+        const uint32_t size,
+        const Locator_t& localLocator,
+        const Locator_t& remoteLocator,
+        IPayloadPool* buffer_owner)
+{
+    std::unique_lock<std::mutex> lock(mtx);
 
-    if (rcv != nullptr && active_callbacks_ >= 0)
+    if (receivers_.empty() || active_callbacks_ < 0)
     {
-        ++active_callbacks_;
+        return;
+    }
 
-        CDRMessage_t msg(0);
-        msg.wraps = true;
-        msg.buffer = const_cast<octet*>(data);
-        msg.length = size;
-        msg.max_size = size;
-        msg.reserved_size = size;
+    ++active_callbacks_;
 
-        // TODO: Should we unlock in case UnregisterReceiver is called from callback ?
-        rcv->processCDRMsg(remoteLocator, localLocator, &msg);
+    CDRMessage_t msg(0);
+    msg.wraps = true;
+    msg.buffer = const_cast<octet*>(data);
+    msg.length = size;
+    msg.max_size = size;
+    msg.reserved_size = size;
 
-        // allow disabling
-        if (--active_callbacks_ == 0)
+    if (!lanes_.empty())
+    {
+        // The channel is listened by several threads, so the message is processed without holding the mutex
+        Lane* lane = take_lane();
+        lock.unlock();
+        lane->receiver->processCDRMsg(remoteLocator, localLocator, &msg, buffer_owner);
+        lane->mtx.unlock();
+        lock.lock();
+    }
+    else
+    {
+        // The destinations of the message are only looked for when it could be processed by several participants
+        bool to_all = receivers_.size() == 1 ||
+                !SharedReceiverResources::message_destinations(data, size, destinations_);
+
+        for (const std::pair<GuidPrefix_t, MessageReceiver*>& registered : receivers_)
         {
-            cv_.notify_one();
+            if (!to_all && c_GuidPrefix_Unknown != registered.first &&
+                    destinations_.end() == std::find(destinations_.begin(), destinations_.end(), registered.first))
+            {
+                continue;
+            }
+
+            msg.pos = 0;
+            registered.second->processCDRMsg(remoteLocator, localLocator, &msg, buffer_owner);
         }
     }
+
+    // allow disabling
+    if (--active_callbacks_ == 0)
+    {
+        cv_.notify_all();
+    }
 }
 
 void ReceiverResource::disable()
@@ -18,6 +18,7 @@
 #include <condition_variable>
 #include <functional>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <fastdds/rtps/messages/MessageReceiver.h>
@@ -56,6 +57,21 @@ public:
             const Locator_t& localLocator,
             const Locator_t& remoteLocator) override;
 
+    /**
+     * Method called by the transport when receiving data on a buffer managed by a payload pool.
+     * @param data Pointer to the received data.
+     * @param size Number of bytes received.
+     * @param localLocator Locator identifying the local endpoint.
+     * @param remoteLocator Locator identifying the remote endpoint.
+     * @param buffer_owner Payload pool owning the buffer where the data was received.
+     */
+    virtual void OnDataReceived(
+            const octet* data,
+            const uint32_t size,
+            const Locator_t& localLocator,
+            const Locator_t& remoteLocator,
+            IPayloadPool* buffer_owner) override;
+
     /**
      * Reports whether this resource supports the given local locator (i.e., said locator
      * maps to the transport channel managed by this resource).
@@ -65,10 +81,15 @@ public:
 
     /**
      * Register a MessageReceiver object to be called upon reception of data.
+     * Shared resources may have several receivers, each of them only called with the messages addressed to its
+     * participant.
      * @param receiver The message receiver to register.
+     * @param participant_prefix GUID prefix of the participant of the receiver. When unknown, the receiver is
+     * called with all the messages.
      */
     void RegisterReceiver(
-            MessageReceiver* receiver);
+            MessageReceiver* receiver,
+            const GuidPrefix_t& participant_prefix = c_GuidPrefix_Unknown);
 
     /**
      * Unregister a MessageReceiver object to be called upon reception of data.
@@ -87,6 +108,15 @@ public:
         return max_message_size_;
     }
 
+    /**
+     * Reports whether this resource is shared by several participants of the process.
+     * Shared resources are only closed when the last participant using them releases them.
+     */
+    inline bool is_shared() const
+    {
+        return shared_;
+    }
+
     /**
      * Resources can only be transfered through move semantics. Copy, assignment, and
      * construction outside of the factory are forbidden.
@@ -107,16 +137,49 @@ private:
     ReceiverResource(
             fastdds::rtps::TransportInterface&,
             const Locator_t&,
-            uint32_t);
+            uint32_t,
+            bool concurrent_reception = false);
+    /**
+     * Receiver processing the messages of one of the threads listening on the channel.
+     * The first lane uses the registered receiver, and new ones are created from it when all the existing lanes
+     * are in use, so their number is bounded by the number of threads listening on the channel.
+     */
+    struct Lane
+    {
+        explicit Lane(
+                MessageReceiver* rcv)
+            : receiver(rcv)
+        {
+        }
+
+        MessageReceiver* receiver;
+        std::unique_ptr<MessageReceiver> owned_receiver;
+        //! Held while processing a message
+        std::mutex mtx;
+    };
+
+    //! Takes a free lane, creating it if needed. Must be called with mtx locked.
+    Lane* take_lane();
+
+    //! Waits for the lanes to finish their messages and removes them. Must be called with mtx locked.
+    void clear_lanes();
+
     std::function<void()> Cleanup;
     std::function<bool(const Locator_t&)> LocatorMapsToManagedChannel;
     bool mValid; // Post-construction validity check for the NetworkFactory
 
     std::mutex mtx;
     std::condition_variable cv_;
-    MessageReceiver* receiver;
+    std::vector<std::pair<GuidPrefix_t, MessageReceiver*>> receivers_;
     uint32_t max_message_size_;
     int active_callbacks_;
+    bool shared_;
+    std::vector<GuidPrefix_t> destinations_;
+    //! Whether the channel is listened by several threads, whose messages can then be processed concurrently
+    bool concurrent_reception_;
+    //! Only used with concurrent reception and a single receiver, as resources with several ones are listened by a
+    //! single thread
+    std::vector<std::unique_ptr<Lane>> lanes_;
 };
 
 } // namespace rtps
@@ -0,0 +1,219 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedReceiverResources.hpp
+ */
+
+#ifndef _RTPS_NETWORK_SHAREDRECEIVERRESOURCES_HPP_
+#define _RTPS_NETWORK_SHAREDRECEIVERRESOURCES_HPP_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/messages/RTPS_messages.h>
+#include <fastdds/rtps/transport/TransportDescriptorInterface.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+class ReceiverResource;
+
+/**
+ * Process-wide registry of the receiver resources shared by several participants.
+ *
+ * Participants of the same process listening on the same multicast locator may use a single channel, instead of
+ * each of them opening its own socket and listening thread, and receiving and handling its own copy of every
+ * datagram. Resources are only kept while a participant holds them, the registry just allows finding them.
+ */
+class SharedReceiverResources
+{
+public:
+
+    static SharedReceiverResources& instance()
+    {
+        static SharedReceiverResources registry;
+        return registry;
+    }
+
+    /**
+     * Gets the resource listening on a locator, creating it if no participant is already using it.
+     * @param locator Locator from which to listen.
+     * @param max_message_size Max message size of the resource. Participants with different limits do not share it.
+     * @param descriptor Configuration of the transport of the participant. Participants only share resources listening
+     * on transports configured in an equivalent way.
+     * @param create Function creating the resource when it is not found. It may return nullptr on failure. Otherwise,
+     * it sets its argument to the configuration of the transport the resource listens on, which must be kept while the
+     * resource is alive.
+     * @return Resource listening on the locator, or nullptr if it could not be created.
+     */
+    std::shared_ptr<ReceiverResource> get_or_create(
+            const Locator_t& locator,
+            uint32_t max_message_size,
+            const fastdds::rtps::TransportDescriptorInterface& descriptor,
+            const std::function<std::shared_ptr<ReceiverResource>(
+                const fastdds::rtps::TransportDescriptorInterface*&)>& create)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+
+        Key key(locator, max_message_size);
+        auto range = resources_.equal_range(key);
+        for (auto it = range.first; it != range.second;)
+        {
+            std::shared_ptr<ReceiverResource> resource = it->second.resource.lock();
+            if (!resource)
+            {
+                it = resources_.erase(it);
+                continue;
+            }
+
+            // The configuration is kept alive by the resource
+            if (it->second.configuration->is_equivalent(descriptor))
+            {
+                return resource;
+            }
+            ++it;
+        }
+
+        const fastdds::rtps::TransportDescriptorInterface* configuration = nullptr;
+        std::shared_ptr<ReceiverResource> resource = create(configuration);
+        if (resource)
+        {
+            resources_.emplace(key, Entry{resource, configuration});
+        }
+        return resource;
+    }
+
+    /**
+     * Looks for the participants a received message is addressed to, without fully parsing it.
+     *
+     * A message is addressed to a participant when all its submessages follow an INFO_DST with its GUID prefix.
+     * Messages with submessages for any participant, or that cannot be checked (i.e. not well formed or protected),
+     * should be processed by all the participants.
+     *
+     * @param data Pointer to the received message.
+     * @param size Number of bytes received.
+     * @param destinations Filled with the GUID prefixes the message is addressed to.
+     * @return false when the message should be processed by all the participants.
+     */
+    static bool message_destinations(
+            const octet* data,
+            uint32_t size,
+            std::vector<GuidPrefix_t>& destinations)
+    {
+        constexpr uint32_t header_size = 20;
+        constexpr uint32_t submessage_header_size = 4;
+
+        destinations.clear();
+        if (size < header_size || 'R' != data[0] || 'T' != data[1] || 'P' != data[2] || 'S' != data[3])
+        {
+            return false;
+        }
+
+        bool has_destination = false;
+        uint32_t pos = header_size;
+        while (pos + submessage_header_size <= size)
+        {
+            octet id = data[pos];
+            bool little_endian = 0 != (data[pos + 1] & BIT(0));
+            uint32_t length = little_endian ?
+                    static_cast<uint32_t>(data[pos + 2]) | (static_cast<uint32_t>(data[pos + 3]) << 8) :
+                    (static_cast<uint32_t>(data[pos + 2]) << 8) | static_cast<uint32_t>(data[pos + 3]);
+            pos += submessage_header_size;
+            if (pos + length > size)
+            {
+                return false;
+            }
+
+            switch (id)
+            {
+                case INFO_DST:
+                {
+                    if (length < GuidPrefix_t::size)
+                    {
+                        return false;
+                    }
+                    GuidPrefix_t prefix;
+                    memcpy(prefix.value, &data[pos], GuidPrefix_t::size);
+                    if (c_GuidPrefix_Unknown == prefix)
+                    {
+                        return false;
+                    }
+                    if (destinations.end() == std::find(destinations.begin(), destinations.end(), prefix))
+                    {
+                        destinations.push_back(prefix);
+                    }
+                    has_destination = true;
+                    break;
+                }
+
+                case PAD:
+                case INFO_TS:
+                case INFO_SRC:
+                case INFO_REPLY:
+                case INFO_REPLY_IP4:
+                    break;
+
+                default:
+                    if (!has_destination)
+                    {
+                        return false;
+                    }
+                    break;
+            }
+
+            // Only PAD and INFO_TS may have zero length without being the last submessage
+            if (0 == length && PAD != id && INFO_TS != id)
+            {
+                break;
+            }
+            pos += length;
+        }
+
+        return has_destination;
+    }
+
+private:
+
+    SharedReceiverResources() = default;
+
+    using Key = std::pair<Locator_t, uint32_t>;
+
+    struct Entry
+    {
+        std::weak_ptr<ReceiverResource> resource;
+        //! Configuration of the transport of the resource, only valid while the resource is alive
+        const fastdds::rtps::TransportDescriptorInterface* configuration;
+    };
+
+    std::mutex mutex_;
+    //! Several resources may listen on the same locator, from transports with different configurations
+    std::multimap<Key, Entry> resources_;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _RTPS_NETWORK_SHAREDRECEIVERRESOURCES_HPP_
@@ -190,6 +190,7 @@ RTPSParticipantImpl::RTPSParticipantImpl(
 #endif // if FASTDDS_STATISTICS
     , has_shm_transport_(false)
     , match_local_endpoints_(should_match_local_endpoints(PParam))
+    , shared_multicast_receivers_(should_share_multicast_receivers(PParam))
 {
     if (c_GuidPrefix_Unknown != persistence_guid)
     {
@@ -262,6 +263,26 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     }
 
     mp_userParticipant->mp_impl = this;
+
+    // Place the threads of the participant without an explicit affinity
+    const fastdds::rtps::ThreadLayout& thread_layout = m_network_Factory.thread_layout();
+    if (m_att.thread_topology.numa_node >= 0 && thread_layout.is_default())
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PARTICIPANT,
+                "Could not get the CPUs of NUMA node " << m_att.thread_topology.numa_node <<
+                ". Threads of the participant will not be placed on it");
+    }
+    m_att.timed_events_thread = thread_layout.general_thread(m_att.timed_events_thread);
+    m_att.builtin_controllers_sender_thread = thread_layout.general_thread(m_att.builtin_controllers_sender_thread);
+    m_att.discovery_server_thread = thread_layout.general_thread(m_att.discovery_server_thread);
+#if HAVE_SECURITY
+    m_att.security_log_thread = thread_layout.general_thread(m_att.security_log_thread);
+#endif // if HAVE_SECURITY
+    if (m_att.allocation.payload_pools.numa_node < 0)
+    {
+        m_att.allocation.payload_pools.numa_node = m_att.thread_topology.numa_node;
+    }
+
     uint32_t id_for_thread = static_cast<uint32_t>(m_att.participantID);
     const fastdds::rtps::ThreadSettings& thr_config = m_att.timed_events_thread;
     mp_event_thr.init_thread(thr_config, "dds.ev.%u", id_for_thread);
@@ -423,13 +444,16 @@ RTPSParticipantImpl::RTPSParticipantImpl(
         old_descriptor.name = guid_str_.c_str();
         old_descriptor.max_bytes_per_period = m_att.throughputController.bytesPerPeriod;
         old_descriptor.period_ms = m_att.throughputController.periodMillisecs;
+        old_descriptor.sender_thread = m_network_Factory.thread_layout().general_thread(old_descriptor.sender_thread);
         flow_controller_factory_.register_flow_controller(old_descriptor);
     }
 
     // Register user's flow controllers.
     for (auto flow_controller_desc : m_att.flow_controllers)
     {
-        flow_controller_factory_.register_flow_controller(*flow_controller_desc.get());
+        fastdds::rtps::FlowControllerDescriptor descriptor = *flow_controller_desc.get();
+        descriptor.sender_thread = m_network_Factory.thread_layout().general_thread(descriptor.sender_thread);
+        flow_controller_factory_.register_flow_controller(descriptor);
     }
 
 #if HAVE_SECURITY
@@ -446,6 +470,10 @@ RTPSParticipantImpl::RTPSParticipantImpl(
     // NOTE: all transports already registered before
     m_att.builtin.network_configuration = m_network_Factory.network_configuration();
 
+#ifdef FASTDDS_STATISTICS
+    init_statistics_aggregator(m_att.properties, static_cast<uint32_t>(m_att.participantID));
+#endif // ifdef FASTDDS_STATISTICS
+
     mp_builtinProtocols = new BuiltinProtocols();
 
     // Initialize builtin protocols
@@ -487,7 +515,7 @@ void RTPSParticipantImpl::enable()
     //Start reception
     for (auto& receiver : m_receiverResourcelist)
     {
-        receiver.Receiver->RegisterReceiver(receiver.mp_receiver);
+        receiver.Receiver->RegisterReceiver(receiver.mp_receiver, m_guid.guidPrefix);
     }
 }
 
@@ -666,6 +694,8 @@ bool RTPSParticipantImpl::create_writer(
             old_descriptor.name = guid_str_.c_str();
             old_descriptor.max_bytes_per_period = param.throughputController.bytesPerPeriod;
             old_descriptor.period_ms = param.throughputController.periodMillisecs;
+            old_descriptor.sender_thread =
+                    m_network_Factory.thread_layout().general_thread(old_descriptor.sender_thread);
             flow_controller_factory_.register_flow_controller(old_descriptor);
             flow_controller =  flow_controller_factory_.retrieve_flow_controller(guid_str_.c_str(), param);
         }
@@ -823,6 +853,11 @@ bool RTPSParticipantImpl::create_writer(
                 });
 
         SWriter->set_enabled_statistics_writers_mask(StatisticsParticipantImpl::get_enabled_statistics_writers_mask());
+
+        if (statistics_aggregator_)
+        {
+            SWriter->set_statistics_aggregator_impl(statistics_aggregator_);
+        }
     }
 
 #endif // FASTDDS_STATISTICS
@@ -969,6 +1004,11 @@ bool RTPSParticipantImpl::create_reader(
                 });
 
         SReader->set_enabled_statistics_writers_mask(StatisticsParticipantImpl::get_enabled_statistics_writers_mask());
+
+        if (statistics_aggregator_)
+        {
+            SReader->set_statistics_aggregator_impl(statistics_aggregator_);
+        }
     }
 
 #endif // FASTDDS_STATISTICS
@@ -1725,9 +1765,17 @@ bool RTPSParticipantImpl::createReceiverResources(
     uint32_t max_receiver_buffer_size = (std::numeric_limits<uint32_t>::max)();
 #endif // if HAVE_SECURITY
 
+    auto build_receiver_resources = [this, &newItemsBuffer, max_receiver_buffer_size](Locator_t& locator) -> bool
+            {
+                return shared_multicast_receivers_ ?
+                       m_network_Factory.BuildSharedReceiverResources(locator, newItemsBuffer,
+                               max_receiver_buffer_size) :
+                       m_network_Factory.BuildReceiverResources(locator, newItemsBuffer, max_receiver_buffer_size);
+            };
+
     for (auto it_loc = Locator_list.begin(); it_loc != Locator_list.end(); ++it_loc)
     {
-        bool ret = m_network_Factory.BuildReceiverResources(*it_loc, newItemsBuffer, max_receiver_buffer_size);
+        bool ret = build_receiver_resources(*it_loc);
         if (!ret && ApplyMutation)
         {
             uint32_t tries = 0;
@@ -1735,7 +1783,7 @@ bool RTPSParticipantImpl::createReceiverResources(
             {
                 tries++;
                 applyLocatorAdaptRule(*it_loc);
-                ret = m_network_Factory.BuildReceiverResources(*it_loc, newItemsBuffer, max_receiver_buffer_size);
+                ret = build_receiver_resources(*it_loc);
             }
         }
 
@@ -1749,6 +1797,16 @@ bool RTPSParticipantImpl::createReceiverResources(
         for (auto it_buffer = newItemsBuffer.begin(); it_buffer != newItemsBuffer.end(); ++it_buffer)
         {
             std::lock_guard<std::mutex> lock(m_receiverResourcelistMutex);
+            // Shared resources are returned again when this participant is already listening on them
+            if ((*it_buffer)->is_shared() &&
+                    m_receiverResourcelist.end() != std::find_if(m_receiverResourcelist.begin(),
+                    m_receiverResourcelist.end(), [&it_buffer](const ReceiverControlBlock& block)
+                    {
+                        return block.Receiver == *it_buffer;
+                    }))
+            {
+                continue;
+            }
             //Push the new items into the ReceiverResource buffer
             m_receiverResourcelist.emplace_back(*it_buffer);
             //Create and init the MessageReceiver
@@ -1757,7 +1815,7 @@ bool RTPSParticipantImpl::createReceiverResources(
             //Start reception
             if (RegisterReceiver)
             {
-                m_receiverResourcelist.back().Receiver->RegisterReceiver(mr);
+                m_receiverResourcelist.back().Receiver->RegisterReceiver(mr, m_guid.guidPrefix);
             }
         }
         newItemsBuffer.clear();
@@ -2982,6 +3040,29 @@ bool RTPSParticipantImpl::should_match_local_endpoints(
     return should_match_local_endpoints;
 }
 
+bool RTPSParticipantImpl::should_share_multicast_receivers(
+        const RTPSParticipantAttributes& att)
+{
+    bool share_multicast_receivers = false;
+
+    const std::string* shared_receivers = PropertyPolicyHelper::find_property(att.properties,
+                    "fastdds.shared_multicast_receivers");
+    if (nullptr != shared_receivers)
+    {
+        if (0 == shared_receivers->compare("true"))
+        {
+            share_multicast_receivers = true;
+        }
+        else if (0 != shared_receivers->compare("false"))
+        {
+            EPROSIMA_LOG_ERROR(RTPS_PARTICIPANT,
+                    "Unknown value '" << *shared_receivers <<
+                    "' for property 'fastdds.shared_multicast_receivers'. Setting value to 'false'");
+        }
+    }
+    return share_multicast_receivers;
+}
+
 } /* namespace rtps */
 } /* namespace fastrtps */
 } /* namespace eprosima */
@@ -160,7 +160,8 @@ class RTPSParticipantImpl
 
         void disable()
         {
-            if (Receiver != nullptr)
+            // Shared resources are disabled when the last participant releases them
+            if (Receiver != nullptr && !Receiver->is_shared())
             {
                 Receiver->disable();
             }
@@ -781,6 +782,12 @@ private:
     bool should_match_local_endpoints(
             const RTPSParticipantAttributes& att);
 
+    //! Whether multicast locators are listened by receiver resources shared with other participants of the process
+    bool shared_multicast_receivers_ = false;
+
+    static bool should_share_multicast_receivers(
+            const RTPSParticipantAttributes& att);
+
 public:
 
     const RTPSParticipantAttributes& getRTPSParticipantAttributes() const
@@ -203,7 +203,7 @@ SQLite3PersistenceService::SQLite3PersistenceService(
 {
     // Prepare writer statements
     sqlite3_prepare_v3(db_, "SELECT seq_num, instance, payload, related_sample_guid, related_sample_seq_num, source_timestamp "
-            "FROM writers_histories WHERE guid=?;", -1,
+            "FROM writers_histories WHERE guid=? ORDER BY seq_num;", -1,
             SQLITE_PREPARE_PERSISTENT,
             &load_writer_stmt_,
             NULL);
@@ -322,7 +322,8 @@ bool SQLite3PersistenceService::load_writer_from_storage(
 
             set_fragments(history, change);
 
-            changes.insert(changes.begin(), change);
+            // Rows are sorted by sequence number, which is the order kept by WriterHistory
+            changes.push_back(change);
         }
 
         sqlite3_reset(load_writer_last_seq_num_stmt_);
@@ -32,6 +32,7 @@
 #include <rtps/participant/RTPSParticipantImpl.h>
 #include <rtps/DataSharing/DataSharingListener.hpp>
 #include <rtps/DataSharing/ReaderPool.hpp>
+#include <rtps/history/ReceiveBufferPool.hpp>
 
 #include "rtps/RTPSDomainImpl.hpp"
 
@@ -622,6 +623,13 @@ bool StatelessReader::processDataMsg(
 
                 datasharing_pool->get_payload(change->serializedPayload, payload_owner, *change_to_add);
             }
+            else if (!m_guid.is_builtin() && nullptr != dynamic_cast<ReceiveBufferPool*>(payload_owner) &&
+                    (0 == fixed_payload_size_ || change->serializedPayload.length <= fixed_payload_size_) &&
+                    payload_owner->get_payload(change->serializedPayload, payload_owner, *change_to_add))
+            {
+                // The payload is kept on the buffer where it was received, instead of being copied.
+                // Builtin readers always copy it, as they keep their changes for long.
+            }
             else if (payload_pool_->get_payload(change->serializedPayload, payload_owner, *change_to_add))
             {
                 change->payload_owner(payload_owner);
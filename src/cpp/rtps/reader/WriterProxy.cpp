@@ -208,6 +208,7 @@ void WriterProxy::loaded_from_storage(
     last_notified_ = seq_num;
     changes_from_writer_low_mark_ = seq_num;
     max_sequence_number_ = seq_num;
+    received_window_.reset(seq_num.to64long() + 1u);
 }
 
 void WriterProxy::missing_changes_update(
@@ -243,22 +244,17 @@ int32_t WriterProxy::lost_changes_update(
     if (seq_num > (changes_from_writer_low_mark_ + 1))
     {
         // Remove all received changes with a sequence lower than seq_num
-        ChangeIterator it = std::lower_bound(changes_received_.begin(), changes_received_.end(), seq_num);
-        if (!changes_received_.empty())
+        uint64_t tmp = seq_num.to64long() - (changes_from_writer_low_mark_.to64long() + 1);
+        tmp -= received_window_.advance_to(seq_num.to64long());
+        ChangeIterator it = changes_received_.begin();
+        while (it != changes_received_.end() && *it < seq_num)
         {
-            uint64_t tmp = (*changes_received_.begin()).to64long() - (changes_from_writer_low_mark_.to64long() + 1);
-            auto distance = std::distance(changes_received_.begin(), it);
-            tmp += seq_num.to64long() - (*changes_received_.begin()).to64long() - distance;
-            current_sample_lost = tmp > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) ?
-                    std::numeric_limits<int32_t>::max() : static_cast<int32_t>(tmp);
-        }
-        else
-        {
-            uint64_t tmp = seq_num.to64long() - (changes_from_writer_low_mark_.to64long() + 1);
-            current_sample_lost = tmp > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) ?
-                    std::numeric_limits<int32_t>::max() : static_cast<int32_t>(tmp);
+            ++it;
+            --tmp;
         }
         changes_received_.erase(changes_received_.begin(), it);
+        current_sample_lost = tmp > static_cast<uint64_t>(std::numeric_limits<int32_t>::max()) ?
+                std::numeric_limits<int32_t>::max() : static_cast<int32_t>(tmp);
 
         // Update low mark
         changes_from_writer_low_mark_ = seq_num - 1;
@@ -303,38 +299,35 @@ bool WriterProxy::received_change_set(
         return false;
     }
 
-    // If will be the last element, insert it at the end.
-    if (seq_num > max_sequence_number_)
+    if (received_window_.in_range(seq_num.to64long()))
     {
-        // If it is the next to be acknowledeg, not insert
-        if (seq_num == changes_from_writer_low_mark_ + 1)
-        {
-            changes_from_writer_low_mark_ = seq_num;
-        }
-        else
+        // Check if already received
+        if (!received_window_.set(seq_num.to64long()))
         {
-            changes_received_.insert(changes_received_.end(), seq_num);
+            return false;
         }
-        max_sequence_number_ = seq_num;
     }
     else
     {
-        // Check if it is next to the last acknowledged
-        if (changes_from_writer_low_mark_ + 1 == seq_num)
+        // Too far ahead of the low mark. Keep it aside until the window reaches it.
+        // If will be the last element, insert it at the end.
+        auto hint = seq_num > max_sequence_number_ ? changes_received_.end() : changes_received_.lower_bound(seq_num);
+        if (hint != changes_received_.end() && *hint == seq_num)
         {
-            changes_from_writer_low_mark_ = seq_num;
-            cleanup();
+            return false;
         }
-        else
-        {
-            // Check if already received
-            if (changes_received_.find(seq_num) != changes_received_.end())
-            {
-                return false;
-            }
+        changes_received_.insert(hint, seq_num);
+    }
 
-            changes_received_.insert(seq_num);
-        }
+    if (seq_num > max_sequence_number_)
+    {
+        max_sequence_number_ = seq_num;
+    }
+
+    // Check if it is next to the last acknowledged
+    if (changes_from_writer_low_mark_ + 1 == seq_num)
+    {
+        cleanup();
     }
 
     return true;
@@ -346,24 +339,20 @@ SequenceNumberSet_t WriterProxy::missing_changes() const
     assert(get_mutex_owner() == get_thread_id());
 #endif // SHOULD_DEBUG_LINUX
 
+    static_assert(received_window_size >= 256u, "Window should cover the whole range of an ACKNACK");
+
     SequenceNumber_t first_missing = changes_from_writer_low_mark_ + 1;
     SequenceNumber_t max_missing = std::min(first_missing + 256UL, max_sequence_number_ + 1);
     SequenceNumberSet_t sns(first_missing);
 
-    for (SequenceNumber_t seq : changes_received_)
-    {
-        seq = std::min(seq, max_missing);
-        sns.add_range(first_missing, seq);
-        first_missing = seq + 1;
-        if (first_missing >= max_missing)
-        {
-            break;
-        }
-    }
-
-    if (first_missing < max_missing)
+    // The window starts on first_missing, so all the range is inside it
+    uint64_t from = first_missing.to64long();
+    uint64_t limit = max_missing.to64long();
+    while (from < limit)
     {
-        sns.add_range(first_missing, max_missing);
+        uint64_t received = received_window_.find_next_set(from, limit);
+        sns.add_range(SequenceNumber_t(from), SequenceNumber_t(received));
+        from = received + 1;
     }
 
     return sns;
@@ -381,6 +370,11 @@ bool WriterProxy::change_was_received(
         return true;
     }
 
+    if (received_window_.in_range(seq_num.to64long()))
+    {
+        return received_window_.is_set(seq_num.to64long());
+    }
+
     ChangeIterator chit = changes_received_.find(seq_num);
     return chit != changes_received_.end();
 }
@@ -396,17 +390,27 @@ const SequenceNumber_t WriterProxy::available_changes_max() const
 
 void WriterProxy::cleanup()
 {
-    ChangeIterator chit = changes_received_.begin();
-
-    // Jump over all consecutive received changes starting on the next to low_mark
-    while (chit != changes_received_.end() && *chit == changes_from_writer_low_mark_ + 1)
+    for (;;)
     {
-        chit++;
-        changes_from_writer_low_mark_++;
-    }
+        // Jump over all consecutive received changes starting on the next to low_mark
+        changes_from_writer_low_mark_ = SequenceNumber_t(received_window_.advance_while_set() - 1u);
+
+        // Move into the window the changes it reaches now
+        ChangeIterator chit = changes_received_.begin();
+        while (chit != changes_received_.end() && received_window_.in_range(chit->to64long()))
+        {
+            received_window_.set(chit->to64long());
+            ++chit;
+        }
 
-    // Remove all those changes
-    changes_received_.erase(changes_received_.begin(), chit);
+        if (chit == changes_received_.begin())
+        {
+            break;
+        }
+
+        // Remove all those changes
+        changes_received_.erase(changes_received_.begin(), chit);
+    }
 }
 
 bool WriterProxy::are_there_missing_changes() const
@@ -427,30 +431,19 @@ size_t WriterProxy::unknown_missing_changes_up_to(
 
     uint32_t returnedValue = 0;
 
-    if (seq_num > changes_from_writer_low_mark_)
+    if (seq_num > changes_from_writer_low_mark_ + 1)
     {
-        SequenceNumber_t first_missing = changes_from_writer_low_mark_ + 1;
-        SequenceNumberSet_t sns(first_missing);
-        SequenceNumberDiff d_fun;
+        uint64_t first_missing = changes_from_writer_low_mark_.to64long() + 1u;
+        uint64_t limit = seq_num.to64long();
+        uint64_t missing = (limit - first_missing) - received_window_.count_set(first_missing, limit);
 
-        for (SequenceNumber_t seq : changes_received_)
+        for (ChangeIterator chit = changes_received_.begin();
+                chit != changes_received_.end() && *chit < seq_num; ++chit)
         {
-            seq = std::min(seq, seq_num);
-            if (first_missing < seq)
-            {
-                returnedValue += d_fun(seq, first_missing);
-            }
-            first_missing = seq + 1;
-            if (first_missing >= seq_num)
-            {
-                break;
-            }
+            --missing;
         }
 
-        if (first_missing < seq_num)
-        {
-            returnedValue += d_fun(seq_num, first_missing);
-        }
+        returnedValue = static_cast<uint32_t>(missing);
     }
 
     return returnedValue;
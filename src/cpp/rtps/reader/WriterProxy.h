@@ -33,6 +33,8 @@
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
 
+#include <utils/collections/BitmapRing.hpp>
+
 #include <set>
 
 // Testing purpose
@@ -387,9 +389,14 @@ private:
     using pool_allocator_t =
             foonathan::memory::memory_pool<foonathan::memory::node_pool, foonathan::memory::heap_allocator>;
 
+    //! Size of the window of sequence numbers tracked by received_window_.
+    static constexpr uint32_t received_window_size = 1024u;
+
+    //! Received sequence numbers in [changes_from_writer_low_mark_ + 1, changes_from_writer_low_mark_ + 1024).
+    utilities::collections::BitmapRing<received_window_size> received_window_;
     //! Memory pool allocator for changes_received_
     pool_allocator_t changes_pool_;
-    //! Vector containing the sequence number of the received ChangeFromWriter_t objects.
+    //! Received sequence numbers too far ahead of the low mark to fit in received_window_.
     foonathan::memory::set<SequenceNumber_t, pool_allocator_t> changes_received_;
     //! Sequence number of the highest available change
     SequenceNumber_t changes_from_writer_low_mark_;
@@ -105,6 +105,7 @@ void TCPChannelResourceBasic::disconnect()
 {
     if (eConnecting < change_status(eConnectionStatus::eDisconnected) && alive())
     {
+        close_send_queue();
         auto socket = socket_;
 
         std::error_code ec;
@@ -150,7 +151,15 @@ size_t TCPChannelResourceBasic::send(
 
     if (eConnecting < connection_status_)
     {
-        std::lock_guard<std::mutex> send_guard(send_mutex_);
+        std::unique_lock<std::mutex> send_guard(send_mutex_);
+        if (send_queue_)
+        {
+            // Only the queue is locked from now on, so a congested connection does not block the others
+            std::shared_ptr<TCPSendQueue> queue = send_queue_;
+            send_guard.unlock();
+            return queue->push(header, header_size, data, size, ec);
+        }
+
         if (header_size > 0)
         {
             std::array<asio::const_buffer, 2> buffers;
@@ -184,6 +193,40 @@ void TCPChannelResourceBasic::set_options(
     socket_->set_option(socket_base::receive_buffer_size(options->receiveBufferSize));
     socket_->set_option(socket_base::send_buffer_size(options->sendBufferSize));
     socket_->set_option(ip::tcp::no_delay(options->enable_tcp_nodelay));
+
+    if (options->async_send)
+    {
+        // Options are set for each new connection, so the queue is bound to the current socket
+        std::lock_guard<std::mutex> send_guard(send_mutex_);
+        if (send_queue_)
+        {
+            send_queue_->close();
+        }
+        send_queue_ = std::make_shared<TCPSendQueue>(socket_, options->send_queue_max_bytes,
+                        options->send_queue_full_policy,
+                        std::chrono::milliseconds(options->send_queue_block_timeout_ms));
+    }
+}
+
+bool TCPChannelResourceBasic::send_queue_statistics(
+        TCPSendQueue::Statistics& stats)
+{
+    std::lock_guard<std::mutex> send_guard(send_mutex_);
+    if (send_queue_)
+    {
+        stats = send_queue_->statistics();
+        return true;
+    }
+    return false;
+}
+
+void TCPChannelResourceBasic::close_send_queue()
+{
+    std::lock_guard<std::mutex> send_guard(send_mutex_);
+    if (send_queue_)
+    {
+        send_queue_->close();
+    }
 }
 
 void TCPChannelResourceBasic::cancel()
@@ -193,6 +236,7 @@ void TCPChannelResourceBasic::cancel()
 
 void TCPChannelResourceBasic::close()
 {
+    close_send_queue();
     socket_->close();
 }
 
@@ -18,6 +18,7 @@
 #include <mutex>
 #include <asio.hpp>
 #include <rtps/transport/TCPChannelResource.h>
+#include <rtps/transport/TCPSendQueue.hpp>
 
 namespace eprosima {
 namespace fastdds {
@@ -30,6 +31,9 @@ class TCPChannelResourceBasic : public TCPChannelResource
     std::mutex send_mutex_;
     std::shared_ptr<asio::ip::tcp::socket> socket_;
 
+    // Outbound queue of the current connection, only used in asynchronous send mode
+    std::shared_ptr<TCPSendQueue> send_queue_;
+
 public:
 
     // Constructor called when trying to connect to a remote server
@@ -81,8 +85,19 @@ public:
         return socket_;
     }
 
+    /**
+     * Get the counters of the outbound queue of the current connection.
+     * @param [out] stats Counters of the queue.
+     * @return false if the channel is not on asynchronous send mode.
+     */
+    bool send_queue_statistics(
+            TCPSendQueue::Statistics& stats);
+
 private:
 
+    //! Discard the messages waiting on the outbound queue, if any.
+    void close_send_queue();
+
     TCPChannelResourceBasic(
             const TCPChannelResourceBasic&) = delete;
     TCPChannelResourceBasic& operator =(
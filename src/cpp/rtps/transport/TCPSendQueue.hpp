@@ -0,0 +1,295 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_TCP_SEND_QUEUE_
+#define _FASTDDS_TCP_SEND_QUEUE_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <asio.hpp>
+
+#include <fastdds/rtps/common/Types.h>
+#include <fastdds/rtps/transport/TCPTransportDescriptor.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Bounded outbound queue of a TCP connection.
+ *
+ * Frames (TCP header plus RTPS message) are copied into the queue and written asynchronously on the socket, so
+ * the sending thread never waits for the peer. All the frames queued while a write is in progress are gathered
+ * on the next write, which is performed with a single writev.
+ * When the queue is full, the new frame is either dropped or the sender waits for room, depending on the policy.
+ */
+class TCPSendQueue : public std::enable_shared_from_this<TCPSendQueue>
+{
+public:
+
+    using octet = fastrtps::rtps::octet;
+    using FullPolicy = TCPTransportDescriptor::SendQueueFullPolicy;
+
+    //! Maximum number of frames gathered on a single write operation.
+    static constexpr size_t max_gathered_frames = 64u;
+
+    //! Queue depth and traffic counters.
+    struct Statistics
+    {
+        //! Bytes currently waiting to be written, including the frames being written.
+        uint64_t queued_bytes = 0;
+        //! Frames currently waiting to be written, including the frames being written.
+        uint64_t queued_frames = 0;
+        //! Highest number of bytes that were waiting to be written at the same time.
+        uint64_t max_queued_bytes = 0;
+        //! Frames written on the socket.
+        uint64_t sent_frames = 0;
+        //! Write operations performed on the socket. Each of them may carry several frames.
+        uint64_t write_operations = 0;
+        //! Frames discarded because the queue was full or the connection failed.
+        uint64_t dropped_frames = 0;
+    };
+
+    /**
+     * Constructor.
+     * @param socket        Connected socket where the frames will be written.
+     * @param max_bytes     Maximum number of bytes waiting to be written.
+     * @param policy        What to do with a frame that does not fit on the queue.
+     * @param block_timeout Maximum time to wait for room on the queue with the BLOCK policy.
+     */
+    TCPSendQueue(
+            std::shared_ptr<asio::ip::tcp::socket> socket,
+            size_t max_bytes,
+            FullPolicy policy,
+            std::chrono::milliseconds block_timeout)
+        : socket_(std::move(socket))
+        , max_bytes_(max_bytes)
+        , policy_(policy)
+        , block_timeout_(block_timeout)
+    {
+        gather_.reserve(max_gathered_frames);
+    }
+
+    /**
+     * Queue a frame to be written on the socket.
+     * @param header      Pointer to the frame header. May be nullptr if @c header_size is 0.
+     * @param header_size Size of the frame header.
+     * @param data        Pointer to the frame body.
+     * @param size        Size of the frame body.
+     * @param ec          Set to @c no_buffer_space when the frame is dropped, and to @c not_connected when the queue
+     *                    has been closed.
+     * @return the number of bytes queued, which is @c header_size + @c size on success and 0 otherwise.
+     */
+    size_t push(
+            const octet* header,
+            size_t header_size,
+            const octet* data,
+            size_t size,
+            asio::error_code& ec)
+    {
+        size_t frame_size = header_size + size;
+        std::unique_lock<std::mutex> lock(mutex_);
+
+        if (!closed_ && !fits_nts(frame_size) && FullPolicy::BLOCK == policy_)
+        {
+            cv_.wait_for(lock, block_timeout_, [this, frame_size]()
+                    {
+                        return closed_ || fits_nts(frame_size);
+                    });
+        }
+
+        if (closed_)
+        {
+            ec = asio::error::not_connected;
+            return 0;
+        }
+
+        if (!fits_nts(frame_size))
+        {
+            ++stats_.dropped_frames;
+            ec = asio::error::no_buffer_space;
+            return 0;
+        }
+
+        // Copy the frame on a recycled buffer when possible
+        std::vector<octet> frame;
+        if (!free_frames_.empty())
+        {
+            frame = std::move(free_frames_.back());
+            free_frames_.pop_back();
+        }
+        frame.resize(frame_size);
+        if (header_size > 0)
+        {
+            memcpy(frame.data(), header, header_size);
+        }
+        memcpy(frame.data() + header_size, data, size);
+        frames_.push_back(std::move(frame));
+
+        stats_.queued_bytes += frame_size;
+        ++stats_.queued_frames;
+        if (stats_.queued_bytes > stats_.max_queued_bytes)
+        {
+            stats_.max_queued_bytes = stats_.queued_bytes;
+        }
+
+        if (!writing_)
+        {
+            start_write_nts();
+        }
+
+        ec = asio::error_code();
+        return frame_size;
+    }
+
+    /**
+     * Discard the pending frames, wake up the blocked senders and reject any further frame.
+     * A write in progress is not cancelled, but its result is ignored.
+     */
+    void close()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        closed_ = true;
+        discard_pending_nts();
+        cv_.notify_all();
+    }
+
+    //! @return a copy of the queue counters.
+    Statistics statistics() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return stats_;
+    }
+
+private:
+
+    //! Frames kept for reuse, so the steady state does not allocate.
+    static constexpr size_t max_free_frames = 64u;
+
+    bool fits_nts(
+            size_t frame_size) const
+    {
+        // A frame bigger than the whole queue is accepted when the queue is empty, so it is eventually sent
+        return frames_.empty() || (stats_.queued_bytes + frame_size <= max_bytes_);
+    }
+
+    void start_write_nts()
+    {
+        gather_.clear();
+        for (auto it = frames_.begin(); it != frames_.end() && gather_.size() < max_gathered_frames; ++it)
+        {
+            gather_.push_back(asio::buffer(*it));
+        }
+
+        writing_ = true;
+        in_flight_frames_ = gather_.size();
+        ++stats_.write_operations;
+
+        // The queue, and so the frames being written, are kept alive until the operation completes
+        auto self = shared_from_this();
+        asio::async_write(*socket_, gather_,
+                [self](const asio::error_code& ec, size_t)
+                {
+                    self->on_write_completed(ec);
+                });
+    }
+
+    void on_write_completed(
+            const asio::error_code& ec)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        writing_ = false;
+
+        size_t written_frames = in_flight_frames_;
+        in_flight_frames_ = 0;
+        for (size_t i = 0; i < written_frames; ++i)
+        {
+            release_front_nts();
+        }
+
+        if (ec)
+        {
+            // The connection is broken. Its owner will notice it when reading.
+            closed_ = true;
+        }
+        else
+        {
+            stats_.sent_frames += written_frames;
+        }
+
+        if (closed_)
+        {
+            discard_pending_nts();
+        }
+        else if (!frames_.empty())
+        {
+            start_write_nts();
+        }
+
+        cv_.notify_all();
+    }
+
+    void release_front_nts()
+    {
+        std::vector<octet>& frame = frames_.front();
+        stats_.queued_bytes -= frame.size();
+        --stats_.queued_frames;
+        if (free_frames_.size() < max_free_frames)
+        {
+            free_frames_.push_back(std::move(frame));
+        }
+        frames_.pop_front();
+    }
+
+    void discard_pending_nts()
+    {
+        // Frames being written must outlive the write operation
+        size_t keep = writing_ ? in_flight_frames_ : 0u;
+        while (frames_.size() > keep)
+        {
+            stats_.queued_bytes -= frames_.back().size();
+            --stats_.queued_frames;
+            ++stats_.dropped_frames;
+            frames_.pop_back();
+        }
+    }
+
+    std::shared_ptr<asio::ip::tcp::socket> socket_;
+    size_t max_bytes_;
+    FullPolicy policy_;
+    std::chrono::milliseconds block_timeout_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::vector<octet>> frames_;
+    std::vector<std::vector<octet>> free_frames_;
+    std::vector<asio::const_buffer> gather_;
+    size_t in_flight_frames_ = 0;
+    bool writing_ = false;
+    bool closed_ = false;
+    Statistics stats_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_TCP_SEND_QUEUE_
@@ -52,6 +52,7 @@
 #include <fastrtps/utils/IPLocator.h>
 #include <fastrtps/utils/System.h>
 
+#include <rtps/history/ReceiveBufferPool.hpp>
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
 #include <utils/SystemInfo.hpp>
 #include <utils/thread.hpp>
@@ -81,6 +82,7 @@ using CDRMessage_t = fastrtps::rtps::CDRMessage_t;
 using LocatorSelector = fastrtps::rtps::LocatorSelector;
 using LocatorSelectorEntry = fastrtps::rtps::LocatorSelectorEntry;
 using PortParameters = fastrtps::rtps::PortParameters;
+using ReceiveBufferPool = fastrtps::rtps::ReceiveBufferPool;
 using Log = fastdds::dds::Log;
 
 static const int s_default_keep_alive_frequency = 5000; // 5 SECONDS
@@ -90,6 +92,8 @@ static const int s_default_keep_alive_timeout = 15000; // 15 SECONDS
 FASTDDS_TODO_BEFORE(3, 0,
         "Eliminate s_default_tcp_negotitation_timeout, variable used to initialize deprecate attribute.")
 static const int s_default_tcp_negotitation_timeout = 5000; // 5 Seconds
+static const uint32_t s_default_send_queue_max_bytes = 4 * 1024 * 1024; // 4 MB
+static const uint32_t s_default_send_queue_block_timeout = 100; // 100 MILLISECONDS
 
 TCPTransportDescriptor::TCPTransportDescriptor()
     : SocketTransportDescriptor(s_maximumMessageSize, s_maximumInitialPeersRange)
@@ -104,6 +108,10 @@ TCPTransportDescriptor::TCPTransportDescriptor()
     , calculate_crc(true)
     , check_crc(true)
     , apply_security(false)
+    , async_send(false)
+    , send_queue_max_bytes(s_default_send_queue_max_bytes)
+    , send_queue_full_policy(SendQueueFullPolicy::DROP)
+    , send_queue_block_timeout_ms(s_default_send_queue_block_timeout)
 {
 }
 
@@ -123,6 +131,10 @@ TCPTransportDescriptor::TCPTransportDescriptor(
     , check_crc(t.check_crc)
     , apply_security(t.apply_security)
     , tls_config(t.tls_config)
+    , async_send(t.async_send)
+    , send_queue_max_bytes(t.send_queue_max_bytes)
+    , send_queue_full_policy(t.send_queue_full_policy)
+    , send_queue_block_timeout_ms(t.send_queue_block_timeout_ms)
     , keep_alive_thread(t.keep_alive_thread)
     , accept_thread(t.accept_thread)
 {
@@ -150,6 +162,10 @@ TCPTransportDescriptor& TCPTransportDescriptor::operator =(
     check_crc = t.check_crc;
     apply_security = t.apply_security;
     tls_config = t.tls_config;
+    async_send = t.async_send;
+    send_queue_max_bytes = t.send_queue_max_bytes;
+    send_queue_full_policy = t.send_queue_full_policy;
+    send_queue_block_timeout_ms = t.send_queue_block_timeout_ms;
     keep_alive_thread = t.keep_alive_thread;
     accept_thread = t.accept_thread;
     return *this;
@@ -171,6 +187,10 @@ bool TCPTransportDescriptor::operator ==(
            this->check_crc == t.check_crc &&
            this->apply_security == t.apply_security &&
            this->tls_config == t.tls_config &&
+           this->async_send == t.async_send &&
+           this->send_queue_max_bytes == t.send_queue_max_bytes &&
+           this->send_queue_full_policy == t.send_queue_full_policy &&
+           this->send_queue_block_timeout_ms == t.send_queue_block_timeout_ms &&
            this->keep_alive_thread == t.keep_alive_thread &&
            this->accept_thread == t.accept_thread &&
            SocketTransportDescriptor::operator ==(t));
@@ -897,12 +917,30 @@ void TCPTransportInterface::perform_listen_operation(
         return;
     }
 
+    // Messages are received on pooled buffers when configured, so their payloads can be kept by the readers
+    std::shared_ptr<ReceiveBufferPool> buffer_pool;
+    octet* pooled_buffer = nullptr;
+    uint32_t pool_size = configuration()->receive_buffer_pool_size;
+    if (channel && 0 < pool_size)
+    {
+        buffer_pool = std::make_shared<ReceiveBufferPool>(channel->message_buffer().max_size, pool_size);
+    }
+
     while (channel && TCPChannelResource::eConnectionStatus::eConnecting < channel->connection_status())
     {
         // Blocking receive.
         CDRMessage_t& msg = channel->message_buffer();
         fastrtps::rtps::CDRMessage::initCDRMsg(&msg);
-        if (!Receive(rtcp_manager, channel, msg.buffer, msg.max_size, msg.length, msg.msg_endian, remote_locator))
+
+        // Fall back to the buffer of the channel when all the pooled ones are in use
+        octet* buffer = msg.buffer;
+        if (buffer_pool)
+        {
+            pooled_buffer = buffer_pool->renew_buffer(pooled_buffer);
+            buffer = (nullptr != pooled_buffer) ? pooled_buffer : msg.buffer;
+        }
+
+        if (!Receive(rtcp_manager, channel, buffer, msg.max_size, msg.length, msg.msg_endian, remote_locator))
         {
             continue;
         }
@@ -920,7 +958,15 @@ void TCPTransportInterface::perform_listen_operation(
                 ReceiverInUseCV* receiver_in_use = it->second.second;
                 receiver_in_use->in_use = true;
                 scopedLock.unlock();
-                receiver->OnDataReceived(msg.buffer, msg.length, channel->locator(), remote_locator);
+                if (nullptr != pooled_buffer)
+                {
+                    receiver->OnDataReceived(buffer, msg.length, channel->locator(), remote_locator,
+                            buffer_pool.get());
+                }
+                else
+                {
+                    receiver->OnDataReceived(buffer, msg.length, channel->locator(), remote_locator);
+                }
                 scopedLock.lock();
                 receiver_in_use->in_use = false;
                 receiver_in_use->cv.notify_one();
@@ -933,6 +979,11 @@ void TCPTransportInterface::perform_listen_operation(
         }
     }
 
+    if (nullptr != pooled_buffer)
+    {
+        buffer_pool->release_buffer(pooled_buffer);
+    }
+
     EPROSIMA_LOG_INFO(RTCP, "End PerformListenOperation " << channel->locator());
 }
 
@@ -1771,6 +1822,13 @@ bool TCPTransportInterface::is_localhost_allowed() const
     return is_locator_allowed(local_locator);
 }
 
+void TCPTransportInterface::update_general_threads(
+        const std::function<ThreadSettings(const ThreadSettings&)>& update)
+{
+    configuration()->accept_thread = update(configuration()->accept_thread);
+    configuration()->keep_alive_thread = update(configuration()->keep_alive_thread);
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
@@ -440,6 +440,9 @@ public:
     void update_network_interfaces() override;
 
     bool is_localhost_allowed() const override;
+
+    void update_general_threads(
+            const std::function<ThreadSettings(const ThreadSettings&)>& update) override;
 };
 
 } // namespace rtps
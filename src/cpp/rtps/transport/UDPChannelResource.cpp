@@ -19,6 +19,7 @@
 #include <fastdds/rtps/attributes/ThreadSettings.hpp>
 #include <fastdds/rtps/messages/MessageReceiver.h>
 
+#include <rtps/history/ReceiveBufferPool.hpp>
 #include <rtps/transport/UDPTransportInterface.h>
 #include <utils/threading.hpp>
 
@@ -27,6 +28,7 @@ namespace fastdds {
 namespace rtps {
 
 using octet = fastrtps::rtps::octet;
+using ReceiveBufferPool = fastrtps::rtps::ReceiveBufferPool;
 using Log = fastdds::dds::Log;
 
 UDPChannelResource::UDPChannelResource(
@@ -64,11 +66,28 @@ void UDPChannelResource::perform_listen_operation(
 {
     Locator remote_locator;
 
+    // Messages are received on pooled buffers when configured, so their payloads can be kept by the readers
+    std::shared_ptr<ReceiveBufferPool> buffer_pool;
+    octet* pooled_buffer = nullptr;
+    uint32_t pool_size = transport_->configuration()->receive_buffer_pool_size;
+    if (0 < pool_size)
+    {
+        buffer_pool = std::make_shared<ReceiveBufferPool>(message_buffer().max_size, pool_size);
+    }
+
     while (alive())
     {
-        // Blocking receive.
+        // Fall back to the buffer of the channel when all the pooled ones are in use
         auto& msg = message_buffer();
-        if (!Receive(msg.buffer, msg.max_size, msg.length, remote_locator))
+        octet* buffer = msg.buffer;
+        if (buffer_pool)
+        {
+            pooled_buffer = buffer_pool->renew_buffer(pooled_buffer);
+            buffer = (nullptr != pooled_buffer) ? pooled_buffer : msg.buffer;
+        }
+
+        // Blocking receive.
+        if (!Receive(buffer, msg.max_size, msg.length, remote_locator))
         {
             continue;
         }
@@ -76,7 +95,15 @@ void UDPChannelResource::perform_listen_operation(
         // Processes the data through the CDR Message interface.
         if (message_receiver() != nullptr)
         {
-            message_receiver()->OnDataReceived(msg.buffer, msg.length, input_locator, remote_locator);
+            if (nullptr != pooled_buffer)
+            {
+                message_receiver()->OnDataReceived(buffer, msg.length, input_locator, remote_locator,
+                        buffer_pool.get());
+            }
+            else
+            {
+                message_receiver()->OnDataReceived(buffer, msg.length, input_locator, remote_locator);
+            }
         }
         else if (alive())
         {
@@ -84,6 +111,11 @@ void UDPChannelResource::perform_listen_operation(
         }
     }
 
+    if (nullptr != pooled_buffer)
+    {
+        buffer_pool->release_buffer(pooled_buffer);
+    }
+
     message_receiver(nullptr);
 }
 
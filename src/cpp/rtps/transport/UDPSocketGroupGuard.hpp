@@ -0,0 +1,118 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_UDP_SOCKET_GROUP_GUARD_H_
+#define _FASTDDS_UDP_SOCKET_GROUP_GUARD_H_
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Exclusive ownership of a UDP port listened by a group of SO_REUSEPORT sockets.
+ *
+ * The kernel lets any other group of the same user bind a port with SO_REUSEPORT, and would then split the
+ * datagrams of the port between both groups. A group takes this guard before binding its sockets, so only one group
+ * can listen on each port.
+ *
+ * The guard is an abstract unix socket named after the transport kind and the port. Like the UDP port, its name is
+ * scoped to the network namespace, and it is released by the kernel when the process holding it dies.
+ */
+class UDPSocketGroupGuard
+{
+public:
+
+    /**
+     * Takes the ownership of a port.
+     * @param transport_kind Kind of the UDP transport opening the port.
+     * @param port Port to own.
+     * @return The guard, or nullptr when the port is owned by another group.
+     */
+    static std::unique_ptr<UDPSocketGroupGuard> acquire(
+            int32_t transport_kind,
+            uint16_t port)
+    {
+        std::unique_ptr<UDPSocketGroupGuard> guard;
+#if defined(__linux__)
+        std::string name = "fastdds_udp_group_" + std::to_string(transport_kind) + "_" + std::to_string(port);
+
+        sockaddr_un address;
+        std::memset(&address, 0, sizeof(address));
+        address.sun_family = AF_UNIX;
+        // The leading null character makes the name abstract
+        std::memcpy(address.sun_path + 1, name.c_str(), name.size());
+        socklen_t address_size = static_cast<socklen_t>(offsetof(sockaddr_un, sun_path) + 1 + name.size());
+
+        int fd = socket(AF_UNIX, SOCK_DGRAM | SOCK_CLOEXEC, 0);
+        if (-1 != fd)
+        {
+            if (0 == bind(fd, reinterpret_cast<sockaddr*>(&address), address_size))
+            {
+                guard.reset(new UDPSocketGroupGuard(fd));
+            }
+            else
+            {
+                close(fd);
+            }
+        }
+#else
+        static_cast<void>(transport_kind);
+        static_cast<void>(port);
+#endif // if defined(__linux__)
+        return guard;
+    }
+
+#if defined(__linux__)
+    ~UDPSocketGroupGuard()
+    {
+        close(fd_);
+    }
+#endif // if defined(__linux__)
+
+    UDPSocketGroupGuard(
+            const UDPSocketGroupGuard&) = delete;
+
+    UDPSocketGroupGuard& operator =(
+            const UDPSocketGroupGuard&) = delete;
+
+private:
+
+#if defined(__linux__)
+    explicit UDPSocketGroupGuard(
+            int fd)
+        : fd_(fd)
+    {
+    }
+
+    int fd_;
+#endif // if defined(__linux__)
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_UDP_SOCKET_GROUP_GUARD_H_
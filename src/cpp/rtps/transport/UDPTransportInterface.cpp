@@ -53,6 +53,7 @@ bool UDPTransportDescriptor::operator ==(
 {
     return (this->m_output_udp_socket == t.m_output_udp_socket &&
            this->non_blocking_send == t.non_blocking_send &&
+           this->unicast_sockets_per_port == t.unicast_sockets_per_port &&
            SocketTransportDescriptor::operator ==(t));
 }
 
@@ -78,6 +79,7 @@ bool UDPTransportInterface::CloseInputChannel(
         const Locator& locator)
 {
     std::vector<UDPChannelResource*> channel_resources;
+    std::unique_ptr<UDPSocketGroupGuard> group_guard;
     {
         std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
         if (!IsInputChannelOpen(locator))
@@ -88,6 +90,12 @@ bool UDPTransportInterface::CloseInputChannel(
         channel_resources = std::move(mInputSockets.at(IPLocator::getPhysicalPort(locator)));
         mInputSockets.erase(IPLocator::getPhysicalPort(locator));
 
+        auto guard_it = mInputGroupGuards.find(IPLocator::getPhysicalPort(locator));
+        if (guard_it != mInputGroupGuards.end())
+        {
+            group_guard = std::move(guard_it->second);
+            mInputGroupGuards.erase(guard_it);
+        }
     }
 
     // We now disable and release the channels
@@ -99,6 +107,9 @@ bool UDPTransportInterface::CloseInputChannel(
         delete channel;
     }
 
+    // The port is given up once none of the sockets of the group is bound
+    group_guard.reset();
+
     return true;
 }
 
@@ -152,6 +163,13 @@ bool UDPTransportInterface::init(
         }
     }
 
+#if !defined(__linux__)
+    if (1 < configuration()->unicast_sockets_per_port)
+    {
+        EPROSIMA_LOG_WARNING(RTPS_MSG_OUT, "unicast_sockets_per_port is only supported on Linux. Using one socket.");
+    }
+#endif // if !defined(__linux__)
+
     if (configuration()->maxMessageSize > s_maximumMessageSize)
     {
         EPROSIMA_LOG_ERROR(RTPS_MSG_OUT, "maxMessageSize cannot be greater than 65000");
@@ -198,14 +216,57 @@ bool UDPTransportInterface::OpenAndBindInputSockets(
 {
     std::unique_lock<std::recursive_mutex> scopedLock(mInputMapMutex);
 
+    std::vector<UDPChannelResource*> created_channels;
     try
     {
+        uint32_t group_size = is_multicast ? 1u : unicast_socket_group_size(*configuration());
+        if (1 < group_size)
+        {
+            // SO_REUSEPORT would let the group of another participant share the port, so it is owned first
+            std::unique_ptr<UDPSocketGroupGuard> group_guard =
+                    UDPSocketGroupGuard::acquire(transport_kind_, IPLocator::getPhysicalPort(locator));
+            if (!group_guard)
+            {
+                EPROSIMA_LOG_INFO(RTPS_MSG_OUT, "UDPTransport Error binding at port: (" <<
+                        IPLocator::getPhysicalPort(locator) << ") with msg: port owned by another socket group");
+                return false;
+            }
+            mInputGroupGuards[IPLocator::getPhysicalPort(locator)] = std::move(group_guard);
+        }
+
         std::vector<std::string> vInterfaces = get_binding_interfaces_list();
         for (std::string sInterface : vInterfaces)
         {
             UDPChannelResource* p_channel_resource;
-            p_channel_resource = CreateInputChannelResource(sInterface, locator, is_multicast, maxMsgSize, receiver);
-            mInputSockets[IPLocator::getPhysicalPort(locator)].push_back(p_channel_resource);
+            if (1 < group_size)
+            {
+                // Every socket of the group is bound before listening on any of them, so a failure to bind one of
+                // them closes the ones already bound and leaves no thread behind
+                std::vector<eProsimaUDPSocket> group;
+                for (uint32_t group_index = 0; group_index < group_size; ++group_index)
+                {
+                    group.push_back(OpenAndBindInputSocket(sInterface, IPLocator::getPhysicalPort(locator), false,
+                            true));
+                }
+
+                ThreadSettings thread_config = configuration()->get_thread_config_for_port(locator.port);
+                for (uint32_t group_index = 0; group_index < group_size; ++group_index)
+                {
+                    ThreadSettings member_config = thread_config;
+                    member_config.affinity = group_member_affinity(thread_config.affinity, group_index);
+                    p_channel_resource = new UDPChannelResource(this, group[group_index], maxMsgSize, locator,
+                                    sInterface, receiver, member_config);
+                    created_channels.push_back(p_channel_resource);
+                    mInputSockets[IPLocator::getPhysicalPort(locator)].push_back(p_channel_resource);
+                }
+            }
+            else
+            {
+                p_channel_resource = CreateInputChannelResource(sInterface, locator, is_multicast, maxMsgSize,
+                                receiver);
+                created_channels.push_back(p_channel_resource);
+                mInputSockets[IPLocator::getPhysicalPort(locator)].push_back(p_channel_resource);
+            }
         }
     }
     catch (asio::system_error const& e)
@@ -215,6 +276,23 @@ bool UDPTransportInterface::OpenAndBindInputSockets(
                     locator) << ")"
                                                                                 << " with msg: " << e.what());
         mInputSockets.erase(IPLocator::getPhysicalPort(locator));
+        std::unique_ptr<UDPSocketGroupGuard> group_guard;
+        auto guard_it = mInputGroupGuards.find(IPLocator::getPhysicalPort(locator));
+        if (guard_it != mInputGroupGuards.end())
+        {
+            group_guard = std::move(guard_it->second);
+            mInputGroupGuards.erase(guard_it);
+        }
+        scopedLock.unlock();
+
+        // Channels opened on other interfaces are not listening anymore
+        for (UDPChannelResource* channel : created_channels)
+        {
+            channel->disable();
+            channel->release();
+            channel->clear();
+            delete channel;
+        }
         return false;
     }
 
@@ -229,12 +307,36 @@ UDPChannelResource* UDPTransportInterface::CreateInputChannelResource(
         TransportReceiverInterface* receiver)
 {
     eProsimaUDPSocket unicastSocket = OpenAndBindInputSocket(sInterface,
-                    IPLocator::getPhysicalPort(locator), is_multicast);
+                    IPLocator::getPhysicalPort(locator), is_multicast, false);
     UDPChannelResource* p_channel_resource = new UDPChannelResource(this, unicastSocket, maxMsgSize, locator,
                     sInterface, receiver, configuration()->get_thread_config_for_port(locator.port));
     return p_channel_resource;
 }
 
+uint64_t UDPTransportInterface::group_member_affinity(
+        uint64_t affinity,
+        uint32_t group_index)
+{
+    uint32_t cpu_count = 0;
+    for (uint64_t mask = affinity; 0 != mask; mask &= mask - 1)
+    {
+        ++cpu_count;
+    }
+
+    if (cpu_count < 2)
+    {
+        return affinity;
+    }
+
+    // Keep the (group_index % cpu_count)-th CPU of the mask
+    uint64_t mask = affinity;
+    for (uint32_t i = group_index % cpu_count; i > 0; --i)
+    {
+        mask &= mask - 1;
+    }
+    return mask & (~mask + 1);
+}
+
 eProsimaUDPSocket UDPTransportInterface::OpenAndBindUnicastOutputSocket(
         const ip::udp::endpoint& endpoint,
         uint16_t& port)
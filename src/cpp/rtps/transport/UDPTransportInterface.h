@@ -27,6 +27,7 @@
 #include <fastrtps/utils/IPFinder.h>
 
 #include <rtps/transport/UDPChannelResource.h>
+#include <rtps/transport/UDPSocketGroupGuard.hpp>
 #include <statistics/rtps/messages/OutputTrafficManager.hpp>
 
 namespace eprosima {
@@ -58,6 +59,21 @@ public:
 
     virtual const UDPTransportDescriptor* configuration() const = 0;
 
+    /**
+     * Number of sockets opened by a UDP transport on each unicast input port, each one listened by its own thread.
+     * @param descriptor Configuration of the transport.
+     */
+    static uint32_t unicast_socket_group_size(
+            const UDPTransportDescriptor& descriptor)
+    {
+#if defined(__linux__)
+        return 1u < descriptor.unicast_sockets_per_port ? descriptor.unicast_sockets_per_port : 1u;
+#else
+        static_cast<void>(descriptor);
+        return 1u;
+#endif // if defined(__linux__)
+    }
+
     bool init(
             const fastrtps::rtps::PropertyPolicy* properties = nullptr) override;
 
@@ -182,6 +198,8 @@ protected:
 
     mutable std::recursive_mutex mInputMapMutex;
     std::map<uint16_t, std::vector<UDPChannelResource*>> mInputSockets;
+    //! Ownership of the input ports listened by groups of sockets
+    std::map<uint16_t, std::unique_ptr<UDPSocketGroupGuard>> mInputGroupGuards;
 
     uint32_t mSendBufferSize;
     uint32_t mReceiveBufferSize;
@@ -252,7 +270,13 @@ protected:
     virtual eProsimaUDPSocket OpenAndBindInputSocket(
             const std::string& sIp,
             uint16_t port,
-            bool is_multicast) = 0;
+            bool is_multicast,
+            bool reuse_port) = 0;
+
+    //! Affinity of the thread listening on a member of a group of sockets, spreading the group on the given CPUs
+    static uint64_t group_member_affinity(
+            uint64_t affinity,
+            uint32_t group_index);
     eProsimaUDPSocket OpenAndBindUnicastOutputSocket(
             const asio::ip::udp::endpoint& endpoint,
             uint16_t& port);
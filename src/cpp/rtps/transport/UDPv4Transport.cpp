@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <typeinfo>
 #include <utility>
 
 #include <fastdds/dds/log/Log.hpp>
@@ -152,6 +153,13 @@ bool UDPv4TransportDescriptor::operator ==(
     return (UDPTransportDescriptor::operator ==(t));
 }
 
+bool UDPv4TransportDescriptor::is_equivalent(
+        const TransportDescriptorInterface& t) const
+{
+    // Derived descriptors may configure their transports with fields of their own
+    return typeid(*this) == typeid(t) && *this == static_cast<const UDPv4TransportDescriptor&>(t);
+}
+
 bool UDPv4Transport::getDefaultMetatrafficMulticastLocators(
         LocatorList& locators,
         uint32_t metatraffic_multicast_port) const
@@ -291,7 +299,8 @@ const std::string& UDPv4Transport::localhost_name()
 eProsimaUDPSocket UDPv4Transport::OpenAndBindInputSocket(
         const std::string& sIp,
         uint16_t port,
-        bool is_multicast)
+        bool is_multicast,
+        bool reuse_port)
 {
     eProsimaUDPSocket socket = createUDPSocket(io_service_);
     getSocketPtr(socket)->open(generate_protocol());
@@ -314,7 +323,17 @@ eProsimaUDPSocket UDPv4Transport::OpenAndBindInputSocket(
         getSocketPtr(socket)->set_option(asio::detail::socket_option::integer<
                     ASIO_OS_DEF(SOL_SOCKET), SO_EXCLUSIVEADDRUSE>(1));
 #endif // if defined(_WIN32)
+#if defined(__linux__)
+        if (reuse_port)
+        {
+            getSocketPtr(socket)->set_option(asio::detail::socket_option::boolean<
+                        ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT>(true));
+        }
+#endif // if defined(__linux__)
     }
+#if !defined(__linux__)
+    static_cast<void>(reuse_port);
+#endif // if !defined(__linux__)
 
     getSocketPtr(socket)->bind(generate_endpoint(sIp, port));
     return socket;
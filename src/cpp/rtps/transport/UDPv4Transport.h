@@ -130,7 +130,8 @@ protected:
     eProsimaUDPSocket OpenAndBindInputSocket(
             const std::string& sIp,
             uint16_t port,
-            bool is_multicast) override;
+            bool is_multicast,
+            bool reuse_port) override;
 
     //! Checks if the given interface is allowed by the white list.
     bool is_interface_allowed(
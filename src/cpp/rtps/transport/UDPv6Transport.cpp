@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <typeinfo>
 #include <utility>
 
 #include <fastdds/dds/log/Log.hpp>
@@ -156,6 +157,13 @@ bool UDPv6TransportDescriptor::operator ==(
     return (UDPTransportDescriptor::operator ==(t));
 }
 
+bool UDPv6TransportDescriptor::is_equivalent(
+        const TransportDescriptorInterface& t) const
+{
+    // Derived descriptors may configure their transports with fields of their own
+    return typeid(*this) == typeid(t) && *this == static_cast<const UDPv6TransportDescriptor&>(t);
+}
+
 bool UDPv6Transport::getDefaultMetatrafficMulticastLocators(
         LocatorList& locators,
         uint32_t metatraffic_multicast_port) const
@@ -295,7 +303,8 @@ const std::string& UDPv6Transport::localhost_name()
 eProsimaUDPSocket UDPv6Transport::OpenAndBindInputSocket(
         const std::string& sIp,
         uint16_t port,
-        bool is_multicast)
+        bool is_multicast,
+        bool reuse_port)
 {
     eProsimaUDPSocket socket = createUDPSocket(io_service_);
     getSocketPtr(socket)->open(generate_protocol());
@@ -318,7 +327,17 @@ eProsimaUDPSocket UDPv6Transport::OpenAndBindInputSocket(
         getSocketPtr(socket)->set_option(asio::detail::socket_option::integer<
                     ASIO_OS_DEF(SOL_SOCKET), SO_EXCLUSIVEADDRUSE>(1));
 #endif // if defined(_WIN32)
+#if defined(__linux__)
+        if (reuse_port)
+        {
+            getSocketPtr(socket)->set_option(asio::detail::socket_option::boolean<
+                        ASIO_OS_DEF(SOL_SOCKET), SO_REUSEPORT>(true));
+        }
+#endif // if defined(__linux__)
     }
+#if !defined(__linux__)
+    static_cast<void>(reuse_port);
+#endif // if !defined(__linux__)
 
     getSocketPtr(socket)->bind(generate_endpoint(sIp, port));
 
@@ -127,7 +127,8 @@ protected:
     eProsimaUDPSocket OpenAndBindInputSocket(
             const std::string& sIp,
             uint16_t port,
-            bool is_multicast) override;
+            bool is_multicast,
+            bool reuse_port) override;
 
     //! Checks for whether locator is allowed.
     bool is_locator_allowed(
@@ -0,0 +1,607 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef _FASTDDS_SHAREDMEM_LOCKFREE_SEGMENT_ALLOCATOR_
+#define _FASTDDS_SHAREDMEM_LOCKFREE_SEGMENT_ALLOCATOR_
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Lock-free allocator of payload buffers inside a shared-memory segment.
+ *
+ * The payload area of the segment is carved, on demand, into regions whose capacity is taken from a fixed
+ * set of size classes (four classes per power of two, starting at MIN_CLASS_CAPACITY bytes).
+ * Once carved, a region stays bound to its buffer node, and the node is recycled through the free list of
+ * its size class.
+ *
+ * When an allocation cannot be served otherwise, the unreferenced regions are defragmented: adjacent ones are
+ * merged into a single region, and the ones at the end of the carved area are returned to it. Only this slow
+ * path takes a lock, so small regions left by previous allocations do not prevent bigger ones forever.
+ *
+ * Every allocated node is pushed to a reclaim queue in allocation order. Nodes are not explicitly freed:
+ * as with the default allocator, a node becomes reusable when its reference counts (enqueued and processing)
+ * drop to zero. The allocator checks the oldest allocations first, so recycling a node is O(1) and an
+ * allocation visits, at most, twice the number of nodes in the segment.
+ *
+ * @tparam Node Buffer node type. It must provide the @c data_offset and @c data_size fields, and the
+ * @c is_not_referenced(), @c invalidate_buffer() and @c invalidate_if_not_processing() methods.
+ */
+template <class Node>
+class LockFreeSegmentAllocator
+{
+public:
+
+    //! Capacity of the smallest size class.
+    static constexpr uint32_t MIN_CLASS_CAPACITY = 64u;
+
+    //! Number of size classes per power of two.
+    static constexpr uint32_t CLASSES_PER_POWER = 4u;
+
+    /**
+     * Computes the size of the payload area needed to guarantee that an allocation of any size up to
+     * @c max_size can be served, taking into account the rounding up to the size class capacity.
+     * @param max_size Maximum size of a single allocation.
+     * @return Size of the payload area, in bytes.
+     */
+    static uint64_t area_size_for(
+            uint32_t max_size)
+    {
+        return static_cast<uint64_t>(max_size) + (max_size / CLASSES_PER_POWER) + MIN_CLASS_CAPACITY;
+    }
+
+    /**
+     * Constructor.
+     * @param nodes Pointer to the array of buffer nodes.
+     * @param max_allocations Number of nodes in the array.
+     * @param area_offset Offset, inside the segment, of the first byte of the payload area.
+     * @param area_size Size, in bytes, of the payload area.
+     */
+    LockFreeSegmentAllocator(
+            Node* nodes,
+            uint32_t max_allocations,
+            uint32_t area_offset,
+            uint64_t area_size)
+        : nodes_(nodes)
+        , max_allocations_(max_allocations)
+        , area_offset_(area_offset)
+        , area_size_(area_size)
+        , carved_bytes_(0)
+        , next_(new std::atomic<uint32_t>[max_allocations])
+        , node_class_(new uint8_t[max_allocations])
+        , node_extent_(new uint64_t[max_allocations])
+        , unbound_head_(INVALID_INDEX)
+        , reclaim_queue_(max_allocations)
+        , overflows_count_(0)
+    {
+        uint64_t capacity = MIN_CLASS_CAPACITY;
+        while (class_capacities_.size() < MAX_CLASSES)
+        {
+            class_capacities_.push_back(capacity);
+            if (capacity >= area_size_)
+            {
+                break;
+            }
+            uint64_t step = std::max<uint64_t>(prev_power_of_two(capacity) / CLASSES_PER_POWER, 16u);
+            capacity += step;
+        }
+
+        for (auto& head : free_heads_)
+        {
+            head.store(INVALID_INDEX, std::memory_order_relaxed);
+        }
+
+        for (uint32_t i = max_allocations_; i > 0; --i)
+        {
+            node_class_[i - 1] = INVALID_CLASS;
+            push(unbound_head_, i - 1);
+        }
+    }
+
+    /**
+     * Allocates a buffer of, at least, @c size bytes.
+     * On success, the node's @c data_offset and @c data_size fields are set.
+     * The node must be passed to publish() once its reference counts have been set, or to deallocate() if
+     * it is not going to be used.
+     * @param size Requested size, in bytes.
+     * @return Pointer to the allocated node, nullptr when there is no memory available.
+     */
+    Node* allocate(
+            uint32_t size)
+    {
+        uint8_t size_class = class_for(size);
+        if (INVALID_CLASS == size_class)
+        {
+            overflows_count_.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        uint32_t index = pop(free_heads_[size_class]);
+
+        if (INVALID_INDEX == index)
+        {
+            index = carve(size_class);
+        }
+
+        // Any bigger free region will do
+        for (size_t c = size_class + 1u; INVALID_INDEX == index && c < class_capacities_.size(); ++c)
+        {
+            index = pop(free_heads_[c]);
+        }
+
+        if (INVALID_INDEX == index)
+        {
+            index = reclaim(size);
+        }
+
+        if (INVALID_INDEX == index)
+        {
+            index = defragment(size_class);
+        }
+
+        if (INVALID_INDEX == index)
+        {
+            overflows_count_.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+
+        Node* node = &nodes_[index];
+        node->data_size = size;
+        return node;
+    }
+
+    /**
+     * Registers an allocated node in the reclaim queue, so it can be recycled when it is no longer referenced.
+     * @param node Pointer to a node returned by allocate().
+     */
+    void publish(
+            Node* node)
+    {
+        reclaim_queue_.push(static_cast<uint32_t>(node - nodes_));
+    }
+
+    /**
+     * Returns a node, that has not been published, to the free list of its size class.
+     * @param node Pointer to a node returned by allocate().
+     */
+    void deallocate(
+            Node* node)
+    {
+        uint32_t index = static_cast<uint32_t>(node - nodes_);
+        push(free_heads_[node_class_[index]], index);
+    }
+
+    //! @return Number of allocations that could not be served.
+    uint64_t overflows_count() const
+    {
+        return overflows_count_.load(std::memory_order_relaxed);
+    }
+
+    //! @return Number of bytes of the payload area already bound to buffer nodes.
+    uint64_t carved_bytes() const
+    {
+        return carved_bytes_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @param size Requested size, in bytes.
+     * @return Capacity of the region that would serve an allocation of @c size bytes, 0 when too big.
+     */
+    uint64_t capacity_for(
+            uint32_t size) const
+    {
+        uint8_t size_class = class_for(size);
+        return INVALID_CLASS == size_class ? 0u : class_capacities_[size_class];
+    }
+
+private:
+
+    static constexpr uint32_t INVALID_INDEX = 0xFFFFFFFFu;
+    static constexpr uint8_t INVALID_CLASS = 0xFFu;
+    static constexpr size_t MAX_CLASSES = 160u;
+
+    /**
+     * Bounded multi-producer / multi-consumer queue of node indexes, used to keep the allocation order.
+     * Based on the sequence-tagged cells algorithm by Dmitry Vyukov.
+     */
+    class ReclaimQueue
+    {
+    public:
+
+        explicit ReclaimQueue(
+                uint32_t min_capacity)
+        {
+            uint32_t capacity = 2u;
+            while (capacity < min_capacity)
+            {
+                capacity <<= 1;
+            }
+
+            mask_ = capacity - 1;
+            cells_.reset(new Cell[capacity]);
+            for (uint32_t i = 0; i < capacity; ++i)
+            {
+                cells_[i].sequence.store(i, std::memory_order_relaxed);
+                cells_[i].index = INVALID_INDEX;
+            }
+            enqueue_pos_.store(0, std::memory_order_relaxed);
+            dequeue_pos_.store(0, std::memory_order_relaxed);
+        }
+
+        bool push(
+                uint32_t index)
+        {
+            Cell* cell;
+            uint64_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &cells_[pos & mask_];
+                uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+                int64_t dif = static_cast<int64_t>(seq) - static_cast<int64_t>(pos);
+                if (dif == 0)
+                {
+                    if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (dif < 0)
+                {
+                    return false;
+                }
+                else
+                {
+                    pos = enqueue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            cell->index = index;
+            cell->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        uint32_t pop()
+        {
+            Cell* cell;
+            uint64_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                cell = &cells_[pos & mask_];
+                uint64_t seq = cell->sequence.load(std::memory_order_acquire);
+                int64_t dif = static_cast<int64_t>(seq) - static_cast<int64_t>(pos + 1);
+                if (dif == 0)
+                {
+                    if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                    {
+                        break;
+                    }
+                }
+                else if (dif < 0)
+                {
+                    return INVALID_INDEX;
+                }
+                else
+                {
+                    pos = dequeue_pos_.load(std::memory_order_relaxed);
+                }
+            }
+
+            uint32_t index = cell->index;
+            cell->sequence.store(pos + mask_ + 1, std::memory_order_release);
+            return index;
+        }
+
+        uint32_t capacity() const
+        {
+            return static_cast<uint32_t>(mask_ + 1);
+        }
+
+    private:
+
+        struct Cell
+        {
+            std::atomic<uint64_t> sequence;
+            uint32_t index;
+        };
+
+        std::unique_ptr<Cell[]> cells_;
+        uint64_t mask_;
+        alignas(64) std::atomic<uint64_t> enqueue_pos_;
+        alignas(64) std::atomic<uint64_t> dequeue_pos_;
+    };
+
+    static uint64_t prev_power_of_two(
+            uint64_t value)
+    {
+        uint64_t power = 1u;
+        while ((power << 1) <= value)
+        {
+            power <<= 1;
+        }
+        return power;
+    }
+
+    uint8_t class_for(
+            uint32_t size) const
+    {
+        auto it = std::lower_bound(class_capacities_.begin(), class_capacities_.end(), static_cast<uint64_t>(size));
+        if (it == class_capacities_.end() || *it > area_size_)
+        {
+            return INVALID_CLASS;
+        }
+        return static_cast<uint8_t>(it - class_capacities_.begin());
+    }
+
+    //! @return Biggest size class whose capacity fits in a region of @c extent bytes.
+    uint8_t class_fitting(
+            uint64_t extent) const
+    {
+        auto it = std::upper_bound(class_capacities_.begin(), class_capacities_.end(), extent);
+        return static_cast<uint8_t>((it - class_capacities_.begin()) - 1);
+    }
+
+    /**
+     * Treiber stack push. The head holds the index of the top node in the low 32 bits, and an
+     * ABA tag, incremented on every update, in the high 32 bits.
+     */
+    void push(
+            std::atomic<uint64_t>& head,
+            uint32_t index)
+    {
+        uint64_t old_head = head.load(std::memory_order_relaxed);
+        uint64_t new_head;
+        do
+        {
+            next_[index].store(static_cast<uint32_t>(old_head), std::memory_order_relaxed);
+            new_head = ((old_head & 0xFFFFFFFF00000000ull) + 0x100000000ull) | index;
+        } while (!head.compare_exchange_weak(old_head, new_head, std::memory_order_release,
+                std::memory_order_relaxed));
+    }
+
+    uint32_t pop(
+            std::atomic<uint64_t>& head)
+    {
+        uint64_t old_head = head.load(std::memory_order_acquire);
+        uint64_t new_head;
+        uint32_t index;
+        do
+        {
+            index = static_cast<uint32_t>(old_head);
+            if (INVALID_INDEX == index)
+            {
+                return INVALID_INDEX;
+            }
+            new_head = ((old_head & 0xFFFFFFFF00000000ull) + 0x100000000ull) |
+                    next_[index].load(std::memory_order_relaxed);
+        } while (!head.compare_exchange_weak(old_head, new_head, std::memory_order_acquire,
+                std::memory_order_acquire));
+
+        return index;
+    }
+
+    /**
+     * Binds a new region of the payload area to an unused node.
+     * @return Index of the node, INVALID_INDEX when there are no unused nodes or no room in the payload area.
+     */
+    uint32_t carve(
+            uint8_t size_class)
+    {
+        uint32_t index = pop(unbound_head_);
+        if (INVALID_INDEX == index)
+        {
+            return INVALID_INDEX;
+        }
+
+        uint64_t capacity = class_capacities_[size_class];
+        uint64_t offset = carved_bytes_.load(std::memory_order_relaxed);
+        do
+        {
+            if (offset + capacity > area_size_)
+            {
+                push(unbound_head_, index);
+                return INVALID_INDEX;
+            }
+        } while (!carved_bytes_.compare_exchange_weak(offset, offset + capacity, std::memory_order_relaxed));
+
+        node_class_[index] = size_class;
+        node_extent_[index] = capacity;
+        nodes_[index].data_offset = static_cast<uint32_t>(area_offset_ + offset);
+        return index;
+    }
+
+    /**
+     * Recycles unreferenced nodes, oldest first, until one big enough for @c size is found.
+     * Unreferenced nodes which are too small are returned to their free lists.
+     * If none is found, a second pass recovers nodes that are enqueued, but not being processed.
+     * @return Index of the recycled node, INVALID_INDEX when none could be recycled.
+     */
+    uint32_t reclaim(
+            uint32_t size)
+    {
+        for (int pass = 0; pass < 2; ++pass)
+        {
+            uint32_t pending = reclaim_queue_.capacity();
+            while (pending-- > 0)
+            {
+                uint32_t index = reclaim_queue_.pop();
+                if (INVALID_INDEX == index)
+                {
+                    break;
+                }
+
+                Node& node = nodes_[index];
+                bool recycled = false;
+                if (0 == pass)
+                {
+                    if (node.is_not_referenced())
+                    {
+                        node.invalidate_buffer();
+                        recycled = true;
+                    }
+                }
+                else
+                {
+                    recycled = node.invalidate_if_not_processing();
+                }
+
+                if (!recycled)
+                {
+                    reclaim_queue_.push(index);
+                }
+                else if (class_capacities_[node_class_[index]] >= size)
+                {
+                    return index;
+                }
+                else
+                {
+                    push(free_heads_[node_class_[index]], index);
+                }
+            }
+        }
+
+        return INVALID_INDEX;
+    }
+
+    /**
+     * Takes all the free and unreferenced nodes, merges their adjacent regions and returns the regions at the end
+     * of the carved area to it. Only one thread defragments at a time, while the others keep allocating from the
+     * regions not taken.
+     * @return Index of a node for @c size_class, INVALID_INDEX when there is still no room for it.
+     */
+    uint32_t defragment(
+            uint8_t size_class)
+    {
+        std::lock_guard<std::mutex> guard(defragment_mutex_);
+
+        std::vector<uint32_t> owned;
+        for (size_t c = 0; c < class_capacities_.size(); ++c)
+        {
+            for (uint32_t index = pop(free_heads_[c]); INVALID_INDEX != index; index = pop(free_heads_[c]))
+            {
+                owned.push_back(index);
+            }
+        }
+
+        uint32_t pending = reclaim_queue_.capacity();
+        while (pending-- > 0)
+        {
+            uint32_t index = reclaim_queue_.pop();
+            if (INVALID_INDEX == index)
+            {
+                break;
+            }
+
+            if (nodes_[index].is_not_referenced())
+            {
+                nodes_[index].invalidate_buffer();
+                owned.push_back(index);
+            }
+            else
+            {
+                reclaim_queue_.push(index);
+            }
+        }
+
+        std::sort(owned.begin(), owned.end(), [this](uint32_t a, uint32_t b)
+                {
+                    return nodes_[a].data_offset < nodes_[b].data_offset;
+                });
+
+        // Each run of adjacent regions is given to its first node, or returned to the carved area when last
+        size_t first = 0;
+        while (first < owned.size())
+        {
+            uint32_t head = owned[first];
+            uint64_t start = nodes_[head].data_offset - area_offset_;
+            uint64_t end = start + node_extent_[head];
+            size_t last = first + 1;
+            while (last < owned.size() && nodes_[owned[last]].data_offset - area_offset_ == end)
+            {
+                end += node_extent_[owned[last]];
+                ++last;
+            }
+
+            uint64_t carved_end = end;
+            if (carved_bytes_.compare_exchange_strong(carved_end, start, std::memory_order_relaxed))
+            {
+                for (size_t i = first; i < last; ++i)
+                {
+                    node_class_[owned[i]] = INVALID_CLASS;
+                    push(unbound_head_, owned[i]);
+                }
+            }
+            else
+            {
+                node_extent_[head] = end - start;
+                node_class_[head] = class_fitting(end - start);
+                push(free_heads_[node_class_[head]], head);
+                for (size_t i = first + 1; i < last; ++i)
+                {
+                    node_class_[owned[i]] = INVALID_CLASS;
+                    push(unbound_head_, owned[i]);
+                }
+            }
+
+            first = last;
+        }
+
+        uint32_t index = INVALID_INDEX;
+        for (size_t c = size_class; INVALID_INDEX == index && c < class_capacities_.size(); ++c)
+        {
+            index = pop(free_heads_[c]);
+        }
+
+        if (INVALID_INDEX == index)
+        {
+            index = carve(size_class);
+        }
+
+        return index;
+    }
+
+    Node* nodes_;
+    uint32_t max_allocations_;
+    uint32_t area_offset_;
+    uint64_t area_size_;
+    std::vector<uint64_t> class_capacities_;
+
+    alignas(64) std::atomic<uint64_t> carved_bytes_;
+
+    std::unique_ptr<std::atomic<uint32_t>[]> next_;
+    std::unique_ptr<uint8_t[]> node_class_;
+    //! Bytes of the payload area bound to each node, which may be more than the capacity of its class.
+    std::unique_ptr<uint64_t[]> node_extent_;
+
+    alignas(64) std::atomic<uint64_t> unbound_head_;
+    alignas(64) std::atomic<uint64_t> free_heads_[MAX_CLASSES];
+
+    ReclaimQueue reclaim_queue_;
+    std::atomic<uint64_t> overflows_count_;
+
+    std::mutex defragment_mutex_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _FASTDDS_SHAREDMEM_LOCKFREE_SEGMENT_ALLOCATOR_
@@ -54,7 +54,8 @@ public:
 
         uint32_t ref_counter() const
         {
-            return ref_counter_.load(std::memory_order_relaxed);
+            // Acquire pairs with the release store in push(), so the cell's data is visible once it is counted
+            return ref_counter_.load(std::memory_order_acquire);
         }
 
         friend class MultiProducerConsumerRingBuffer<T>;
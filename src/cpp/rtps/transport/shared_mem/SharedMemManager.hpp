@@ -16,6 +16,8 @@
 #define _FASTDDS_SHAREDMEM_MANAGER_H_
 
 #include <atomic>
+#include <chrono>
+#include <cstring>
 #include <list>
 #include <thread>
 #include <unordered_map>
@@ -23,8 +25,11 @@
 #include <foonathan/memory/container.hpp>
 #include <foonathan/memory/memory_pool.hpp>
 
+#include "rtps/transport/shared_mem/LockFreeSegmentAllocator.hpp"
 #include "rtps/transport/shared_mem/SharedMemGlobal.hpp"
 #include "utils/collections/node_size_helpers.hpp"
+#include "utils/cpu_relax.hpp"
+#include "utils/memory/MemoryPlacement.hpp"
 #include "utils/shared_memory/RobustSharedLock.hpp"
 #include "utils/shared_memory/SharedMemWatchdog.hpp"
 
@@ -369,7 +374,8 @@ public:
                 uint32_t size,
                 uint32_t payload_size,
                 uint32_t max_allocations,
-                const std::string& domain_name)
+                const std::string& domain_name,
+                bool lock_free_allocation = false)
             : buffer_node_list_allocator_(
                 buffer_node_list_helper::node_size,
                 buffer_node_list_helper::min_pool_size<pool_allocator_t>(max_allocations))
@@ -396,23 +402,45 @@ public:
             }
 
             free_bytes_ = payload_size;
+            payload_size_ = payload_size;
 
             // Alloc the buffer nodes
             auto buffers_nodes = segment_->get().construct<BufferNode>
                         (boost::interprocess::anonymous_instance)[max_allocations]();
 
-            // All buffer nodes are free
             for (uint32_t i = 0; i < max_allocations; i++)
             {
                 buffers_nodes[i].status.exchange({0, 0, 0});
                 buffers_nodes[i].data_size = 0;
                 buffers_nodes[i].data_offset = 0;
-                free_buffers_.push_back(&buffers_nodes[i]);
+            }
+
+            if (lock_free_allocation)
+            {
+                // The whole payload area is reserved at once, and split by the lock-free allocator
+                uint64_t area_size = lock_free_allocator_t::area_size_for(payload_size);
+                payload_area_ = segment_->get().allocate(static_cast<size_t>(area_size));
+                lock_free_allocator_.reset(new lock_free_allocator_t(buffers_nodes, max_allocations,
+                        segment_->get_offset_from_address(payload_area_), area_size));
+            }
+            else
+            {
+                // All buffer nodes are free
+                for (uint32_t i = 0; i < max_allocations; i++)
+                {
+                    free_buffers_.push_back(&buffers_nodes[i]);
+                }
             }
         }
 
         ~Segment()
         {
+            if (lock_free_allocator_)
+            {
+                overflows_count_ += lock_free_allocator_->overflows_count();
+                lock_free_allocator_.reset();
+            }
+
             segment_.reset();
 
             // After remove(), remote processes with the segment open will still have the memory block mapped,
@@ -441,6 +469,11 @@ public:
         {
             (void)max_blocking_time_point;
 
+            if (lock_free_allocator_)
+            {
+                return alloc_buffer_lock_free(size);
+            }
+
             std::lock_guard<std::mutex> lock(alloc_mutex_);
 
             if (!recover_buffers(size))
@@ -504,8 +537,43 @@ public:
             return segment_->mem_size();
         }
 
+        /**
+         * Applies placement requirements (huge pages, NUMA binding) to the memory mapping of the segment.
+         * Should be called before the pages are touched, so they are faulted in with the requested placement.
+         *
+         * @param placement Placement requirements
+         * @return false if any of the requirements could not be applied.
+         */
+        bool apply_placement(
+                const utilities::memory::MemoryPlacement& placement)
+        {
+            return utilities::memory::apply_memory_placement(segment_->get().get_address(),
+                           segment_->get().get_size(), placement);
+        }
+
+        /**
+         * Writes zeros to the whole payload area of the segment, in order to force the physical
+         * mapping of its pages.
+         */
+        void prefault()
+        {
+            if (lock_free_allocator_)
+            {
+                memset(payload_area_, 0,
+                        static_cast<size_t>(lock_free_allocator_t::area_size_for(payload_size_)));
+            }
+            else
+            {
+                auto buffer = alloc_buffer(payload_size_,
+                                (std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
+                memset(buffer->data(), 0, payload_size_);
+            }
+        }
+
     private:
 
+        using lock_free_allocator_t = LockFreeSegmentAllocator<BufferNode>;
+
         std::string segment_name_;
 
         std::unique_ptr<RobustExclusiveLock> segment_name_lock_;
@@ -526,6 +594,40 @@ public:
         uint64_t overflows_count_;
 
         uint32_t free_bytes_;
+        uint32_t payload_size_;
+
+        std::unique_ptr<lock_free_allocator_t> lock_free_allocator_;
+        void* payload_area_ = nullptr;
+
+        std::shared_ptr<Buffer> alloc_buffer_lock_free(
+                uint32_t size)
+        {
+            BufferNode* buffer_node = lock_free_allocator_->allocate(size);
+            if (nullptr == buffer_node)
+            {
+                throw std::runtime_error("allocation overflow");
+            }
+
+            auto validity_id =
+                    static_cast<uint32_t>(buffer_node->status.load(std::memory_order_relaxed).validity_id);
+            std::shared_ptr<SharedMemBuffer> new_buffer;
+
+            try
+            {
+                new_buffer = std::make_shared<SharedMemBuffer>(segment_, segment_id_, buffer_node, validity_id);
+            }
+            catch (const std::exception&)
+            {
+                lock_free_allocator_->deallocate(buffer_node);
+                throw;
+            }
+
+            // The buffer must be referenced before it is visible to the reclaim queue
+            buffer_node->inc_processing_count(validity_id);
+            lock_free_allocator_->publish(buffer_node);
+
+            return new_buffer;
+        }
 
         void generate_segment_id_and_name(
                 const std::string& domain_name)
@@ -657,12 +759,19 @@ public:
     {
     public:
 
+        /**
+         * @param shared_mem_manager Manager the port belongs to.
+         * @param port Port to listen to.
+         * @param spin_budget_us Time pop() busy-polls the port before blocking on it (us). 0 means always block.
+         */
         Listener(
                 SharedMemManager* shared_mem_manager,
-                std::shared_ptr<SharedMemGlobal::Port> port)
+                std::shared_ptr<SharedMemGlobal::Port> port,
+                uint32_t spin_budget_us = 0)
             : global_port_(port)
             , shared_mem_manager_(shared_mem_manager)
             , is_closed_(false)
+            , spin_budget_(spin_budget_us)
         {
             global_listener_ = global_port_->create_listener(&listener_index_);
         }
@@ -691,6 +800,7 @@ public:
             other.global_port_.reset();
             shared_mem_manager_ = other.shared_mem_manager_;
             is_closed_.exchange(other.is_closed_);
+            spin_budget_ = other.spin_budget_;
 
             return *this;
         }
@@ -719,6 +829,13 @@ public:
 
                     while ( !is_closed_.load() && nullptr == (head_cell = global_listener_->head()))
                     {
+                        // A spinning listener is not accounted as waiting on the port, so the writers
+                        // do not notify the port's condition variable while it spins.
+                        if (0 < spin_budget_.count() && nullptr != (head_cell = spin_head()))
+                        {
+                            break;
+                        }
+
                         // Wait until there's data to pop
                         global_port_->wait_pop(*global_listener_, is_closed_, listener_index_);
                     }
@@ -805,7 +922,8 @@ public:
         {
             auto new_port = global_port_;
             shared_mem_manager_->regenerate_port(new_port, new_port->open_mode());
-            auto new_listener = std::make_shared<Listener>(shared_mem_manager_, new_port);
+            auto new_listener = std::make_shared<Listener>(shared_mem_manager_, new_port,
+                            static_cast<uint32_t>(spin_budget_.count()));
             *this = std::move(*new_listener);
         }
 
@@ -821,6 +939,36 @@ public:
 
     private:
 
+        /**
+         * Busy-poll the port until a descriptor is enqueued, the listener is closed, or the spin budget expires.
+         * @return The head cell, or nullptr if the port is still empty.
+         */
+        SharedMemGlobal::PortCell* spin_head()
+        {
+            // Reading the clock costs more than polling the port, so it is only checked every few polls
+            constexpr uint32_t polls_per_clock_check = 64;
+
+            auto deadline = std::chrono::steady_clock::now() + spin_budget_;
+            uint32_t polls = 0;
+            while (!is_closed_.load(std::memory_order_relaxed))
+            {
+                SharedMemGlobal::PortCell* head_cell = global_listener_->head();
+                if (nullptr != head_cell)
+                {
+                    return head_cell;
+                }
+
+                cpu_relax();
+
+                if (0 == (++polls % polls_per_clock_check) && std::chrono::steady_clock::now() >= deadline)
+                {
+                    break;
+                }
+            }
+
+            return nullptr;
+        }
+
         std::shared_ptr<SharedMemGlobal::Port> global_port_;
 
         std::unique_ptr<SharedMemGlobal::Listener> global_listener_;
@@ -830,6 +978,8 @@ public:
 
         std::atomic<bool> is_closed_;
 
+        std::chrono::microseconds spin_budget_;
+
     }; // Listener
 
     /**
@@ -953,9 +1103,15 @@ public:
             }
         }
 
-        std::shared_ptr<Listener> create_listener()
+        /**
+         * Create a listener of the port.
+         * @param spin_budget_us Time the listener busy-polls the port before blocking on it (us).
+         * 0 means always block.
+         */
+        std::shared_ptr<Listener> create_listener(
+                uint32_t spin_budget_us = 0)
         {
-            return std::make_shared<Listener>(shared_mem_manager_, global_port_);
+            return std::make_shared<Listener>(shared_mem_manager_, global_port_, spin_budget_us);
         }
 
     private:
@@ -978,14 +1134,19 @@ public:
      * Creates a shared-memory segment
      * @param size size of the segment
      * @param max_buffers maximum, at a time, allocated buffers
+     * @param lock_free_allocation whether buffers are allocated with the lock-free size-class allocator
      * @return A shared_ptr to the segment
      */
     std::shared_ptr<Segment> create_segment(
             uint32_t size,
-            uint32_t max_allocations)
+            uint32_t max_allocations,
+            bool lock_free_allocation = false)
     {
-        return std::make_shared<Segment>(size + segment_allocation_extra_size(max_allocations), size, max_allocations,
-                       global_segment_.domain_name());
+        uint32_t payload_area_size = lock_free_allocation ?
+                static_cast<uint32_t>(LockFreeSegmentAllocator<BufferNode>::area_size_for(size)) : size;
+
+        return std::make_shared<Segment>(payload_area_size + segment_allocation_extra_size(max_allocations), size,
+                       max_allocations, global_segment_.domain_name(), lock_free_allocation);
     }
 
     /**
@@ -1045,6 +1206,35 @@ public:
         return segments_mem_;
     }
 
+    /**
+     * Open a buffer allocated on a segment of this domain, possibly by a different process.
+     * The buffer is accounted as being processed while the returned reference is alive, so it is not
+     * recycled by its owner unless it runs out of memory.
+     * @param segment_id Id of the segment the buffer was allocated on.
+     * @param buffer_node_offset Offset of the buffer node inside the segment.
+     * @param validity_id Validity of the buffer node when the buffer was referenced.
+     * @return A reference to the buffer, or nullptr if the segment does not exist or the buffer was recycled.
+     */
+    std::shared_ptr<Buffer> open_buffer(
+            const SharedMemSegment::Id& segment_id,
+            SharedMemSegment::Offset buffer_node_offset,
+            uint32_t validity_id)
+    {
+        std::shared_ptr<SharedMemSegment> segment = find_segment(segment_id);
+        if (!segment || buffer_node_offset > segment->mem_size() - sizeof(BufferNode))
+        {
+            return nullptr;
+        }
+
+        auto buffer_node = static_cast<BufferNode*>(segment->get_address_from_offset(buffer_node_offset));
+        if (!buffer_node->inc_processing_count(validity_id))
+        {
+            return nullptr;
+        }
+
+        return std::make_shared<SharedMemBuffer>(segment, segment_id, buffer_node, validity_id);
+    }
+
 private:
 
     void regenerate_port(
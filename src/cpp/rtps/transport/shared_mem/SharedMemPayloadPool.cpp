@@ -0,0 +1,323 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedMemPayloadPool.cpp
+ */
+
+#include <rtps/transport/shared_mem/SharedMemPayloadPool.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+#include <fastdds/dds/core/policy/ParameterTypes.hpp>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/messages/CDRMessage.h>
+
+#include <fastdds/core/policy/ParameterList.hpp>
+#include <rtps/transport/shared_mem/SharedMemManager.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+using fastrtps::rtps::CacheChange_t;
+using fastrtps::rtps::CDRMessage;
+using fastrtps::rtps::CDRMessage_t;
+using fastrtps::rtps::octet;
+using fastrtps::rtps::PoolConfig;
+using fastrtps::rtps::SerializedPayload_t;
+
+namespace {
+
+// Payloads are allocated on the same domain the SHM transport uses
+constexpr const char* payload_pool_domain = "fastrtps";
+
+//! Manager used to open the segments of the payloads received
+std::shared_ptr<SharedMemManager> receiver_manager()
+{
+    static std::shared_ptr<SharedMemManager> manager = SharedMemManager::create(payload_pool_domain);
+    return manager;
+}
+
+class WriterSharedMemPayloadPool : public SharedMemPayloadPool
+{
+public:
+
+    WriterSharedMemPayloadPool(
+            const std::shared_ptr<SharedMemManager>& manager,
+            const std::shared_ptr<SharedMemManager::Segment>& segment)
+        : manager_(manager)
+        , segment_(segment)
+    {
+    }
+
+    bool get_payload(
+            uint32_t size,
+            CacheChange_t& cache_change) override
+    {
+        std::shared_ptr<SharedMemManager::Buffer> buffer;
+        try
+        {
+            buffer = segment_->alloc_buffer(size, std::chrono::steady_clock::now());
+        }
+        catch (const std::exception& e)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_TRANSPORT_SHM, "Failed to allocate payload of size " << size << ": " << e.what());
+        }
+
+        if (!buffer)
+        {
+            cache_change.serializedPayload.data = nullptr;
+            cache_change.serializedPayload.max_size = 0;
+            cache_change.payload_owner(nullptr);
+            return false;
+        }
+
+        octet* data = static_cast<octet*>(buffer->data());
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            payloads_[data] = PayloadEntry{std::static_pointer_cast<SharedMemManager::SharedMemBuffer>(buffer), 1u};
+        }
+
+        cache_change.serializedPayload.data = data;
+        cache_change.serializedPayload.max_size = size;
+        cache_change.payload_owner(this);
+        return true;
+    }
+
+    bool get_payload(
+            SerializedPayload_t& data,
+            IPayloadPool*& data_owner,
+            CacheChange_t& cache_change) override
+    {
+        if (data_owner == this)
+        {
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ++payloads_.at(data.data).references;
+            }
+
+            cache_change.serializedPayload.data = data.data;
+            cache_change.serializedPayload.length = data.length;
+            cache_change.serializedPayload.max_size = data.length;
+            cache_change.payload_owner(this);
+            return true;
+        }
+
+        if (get_payload(data.length, cache_change))
+        {
+            if (!cache_change.serializedPayload.copy(&data, true))
+            {
+                release_payload(cache_change);
+                return false;
+            }
+
+            if (data_owner == nullptr)
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                ++payloads_.at(cache_change.serializedPayload.data).references;
+                data_owner = this;
+                data.data = cache_change.serializedPayload.data;
+            }
+
+            return true;
+        }
+
+        return false;
+    }
+
+    bool release_payload(
+            CacheChange_t& cache_change) override
+    {
+        assert(cache_change.payload_owner() == this);
+
+        std::shared_ptr<SharedMemManager::SharedMemBuffer> buffer;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = payloads_.find(cache_change.serializedPayload.data);
+            if (it != payloads_.end() && 0u == --it->second.references)
+            {
+                // The buffer is recycled by the segment when no process is using it
+                buffer = std::move(it->second.buffer);
+                payloads_.erase(it);
+            }
+        }
+
+        cache_change.serializedPayload.length = 0;
+        cache_change.serializedPayload.pos = 0;
+        cache_change.serializedPayload.max_size = 0;
+        cache_change.serializedPayload.data = nullptr;
+        cache_change.payload_owner(nullptr);
+        return true;
+    }
+
+protected:
+
+    bool fill_descriptor(
+            const octet* data,
+            SharedMemPayloadDescriptor& descriptor) const override
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = payloads_.find(data);
+        if (it == payloads_.end())
+        {
+            return false;
+        }
+
+        const auto& buffer = it->second.buffer;
+        SharedMemSegment::Id::type segment_id = buffer->segment_id().get();
+        memcpy(descriptor.segment_id, segment_id.get(), sizeof(descriptor.segment_id));
+        descriptor.buffer_node_offset = buffer->node_offset();
+        descriptor.validity_id = buffer->validity_id();
+        return true;
+    }
+
+private:
+
+    struct PayloadEntry
+    {
+        std::shared_ptr<SharedMemManager::SharedMemBuffer> buffer;
+        uint32_t references;
+    };
+
+    std::shared_ptr<SharedMemManager> manager_;
+    std::shared_ptr<SharedMemManager::Segment> segment_;
+
+    mutable std::mutex mutex_;
+    std::unordered_map<const octet*, PayloadEntry> payloads_;
+};
+
+} // namespace
+
+bool SharedMemPayloadDescriptor::add_to_cdr_message(
+        CDRMessage_t* msg) const
+{
+    bool ret = CDRMessage::addUInt16(msg, dds::PID_SHM_PAYLOAD_DESCRIPTOR);
+    ret &= CDRMessage::addUInt16(msg, parameter_length);
+    ret &= CDRMessage::addData(msg, segment_id, sizeof(segment_id));
+    ret &= CDRMessage::addUInt32(msg, buffer_node_offset);
+    ret &= CDRMessage::addUInt32(msg, validity_id);
+    ret &= CDRMessage::addUInt32(msg, length);
+    return ret;
+}
+
+bool SharedMemPayloadDescriptor::read_from_inline_qos(
+        const SerializedPayload_t& inline_qos,
+        SharedMemPayloadDescriptor& descriptor)
+{
+    if (nullptr == inline_qos.data)
+    {
+        return false;
+    }
+
+    bool found = false;
+    auto parameter_process = [&](
+        CDRMessage_t* msg,
+        const dds::ParameterId_t pid,
+        uint16_t plength)
+            {
+                if (dds::PID_SHM_PAYLOAD_DESCRIPTOR == pid && parameter_length <= plength)
+                {
+                    found = CDRMessage::readData(msg, descriptor.segment_id, sizeof(descriptor.segment_id)) &&
+                            CDRMessage::readUInt32(msg, &descriptor.buffer_node_offset) &&
+                            CDRMessage::readUInt32(msg, &descriptor.validity_id) &&
+                            CDRMessage::readUInt32(msg, &descriptor.length);
+                }
+                return true;
+            };
+
+    CDRMessage_t msg(inline_qos);
+    uint32_t qos_size = 0;
+    return dds::ParameterList::readParameterListfromCDRMsg(msg, parameter_process, false, qos_size) && found;
+}
+
+std::shared_ptr<SharedMemPayloadPool> SharedMemPayloadPool::create(
+        uint32_t segment_size,
+        const PoolConfig& config)
+{
+    std::shared_ptr<SharedMemManager> manager = SharedMemManager::create(payload_pool_domain);
+    if (!manager)
+    {
+        return nullptr;
+    }
+
+    // One more payload than the history can hold, as a new payload is allocated before the oldest one is removed
+    uint32_t max_allocations = config.maximum_size + 1u;
+    if (0u == config.maximum_size)
+    {
+        max_allocations = segment_size / std::max(config.payload_initial_size, 1024u) + 1u;
+    }
+
+    try
+    {
+        return std::make_shared<WriterSharedMemPayloadPool>(manager,
+                       manager->create_segment(segment_size, max_allocations));
+    }
+    catch (const std::exception& e)
+    {
+        EPROSIMA_LOG_ERROR(RTPS_TRANSPORT_SHM, "Failed to create payload segment of size " << segment_size << ": "
+                                                                                          << e.what());
+    }
+
+    return nullptr;
+}
+
+bool SharedMemPayloadPool::get_descriptor(
+        const CacheChange_t& change,
+        SharedMemPayloadDescriptor& descriptor)
+{
+    const SharedMemPayloadPool* pool = dynamic_cast<const SharedMemPayloadPool*>(change.payload_owner());
+    if (nullptr == pool || !pool->fill_descriptor(change.serializedPayload.data, descriptor))
+    {
+        return false;
+    }
+
+    descriptor.length = change.serializedPayload.length;
+    return true;
+}
+
+std::shared_ptr<void> SharedMemPayloadPool::map_payload(
+        const SharedMemPayloadDescriptor& descriptor,
+        SerializedPayload_t& payload)
+{
+    std::shared_ptr<SharedMemManager> manager = receiver_manager();
+    if (!manager)
+    {
+        return nullptr;
+    }
+
+    SharedMemSegment::Id::type segment_id;
+    memcpy(segment_id.get(), descriptor.segment_id, sizeof(descriptor.segment_id));
+    std::shared_ptr<SharedMemManager::Buffer> buffer =
+            manager->open_buffer(segment_id, descriptor.buffer_node_offset, descriptor.validity_id);
+    if (!buffer || buffer->size() < descriptor.length)
+    {
+        return nullptr;
+    }
+
+    payload.data = static_cast<octet*>(buffer->data());
+    payload.length = descriptor.length;
+    payload.max_size = descriptor.length;
+    payload.pos = 0;
+    return buffer;
+}
+
+}  // namespace rtps
+}  // namespace fastdds
+}  // namespace eprosima
@@ -0,0 +1,138 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedMemPayloadPool.hpp
+ */
+
+#ifndef _FASTDDS_SHAREDMEM_PAYLOAD_POOL_H_
+#define _FASTDDS_SHAREDMEM_PAYLOAD_POOL_H_
+
+#include <cstdint>
+#include <memory>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastdds/rtps/history/IPayloadPool.h>
+
+#include <rtps/history/PoolConfig.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Location of a payload allocated on a SharedMemPayloadPool.
+ * It is sent as an inline QoS parameter (PID_SHM_PAYLOAD_DESCRIPTOR) of a DATA submessage without payload, and lets
+ * any process on the same host map the payload.
+ */
+struct SharedMemPayloadDescriptor
+{
+    //! Length of the parameter holding the descriptor
+    static constexpr uint16_t parameter_length = 20u;
+
+    //! Id of the segment holding the payload
+    uint8_t segment_id[8];
+    //! Offset of the buffer node inside the segment
+    uint32_t buffer_node_offset;
+    //! Validity of the buffer node when the descriptor was taken
+    uint32_t validity_id;
+    //! Length of the serialized payload
+    uint32_t length;
+
+    /**
+     * Add the descriptor as a parameter to an inline QoS being serialized.
+     * @param msg Message where the parameter is added.
+     * @return true if the parameter fitted on the message.
+     */
+    bool add_to_cdr_message(
+            fastrtps::rtps::CDRMessage_t* msg) const;
+
+    /**
+     * Look for a descriptor on the inline QoS of a received change.
+     * @param inline_qos Inline QoS of the change.
+     * @param [out] descriptor Descriptor found.
+     * @return true if the inline QoS holds a descriptor.
+     */
+    static bool read_from_inline_qos(
+            const fastrtps::rtps::SerializedPayload_t& inline_qos,
+            SharedMemPayloadDescriptor& descriptor);
+};
+
+/**
+ * Payload pool that allocates the payloads of a writer on a shared memory segment, the same kind of segment the SHM
+ * transport uses for its buffers.
+ *
+ * When all the destinations of a DATA submessage are shared memory locators, the writer sends a
+ * SharedMemPayloadDescriptor instead of the payload. The receiving process maps the payload from the segment, so
+ * the payload is copied neither into the RTPS message nor into a transport buffer.
+ */
+class SharedMemPayloadPool : public fastrtps::rtps::IPayloadPool
+{
+public:
+
+    virtual ~SharedMemPayloadPool() = default;
+
+    /**
+     * Create a pool for the history of a writer.
+     * @param segment_size Size (octets) of the payload area of the segment.
+     * @param config Configuration of the history.
+     * @return The pool, or nullptr if the segment could not be created.
+     */
+    static std::shared_ptr<SharedMemPayloadPool> create(
+            uint32_t segment_size,
+            const fastrtps::rtps::PoolConfig& config);
+
+    /**
+     * Get the descriptor of the payload of a change.
+     * @param change Change whose payload is described.
+     * @param [out] descriptor Descriptor of the payload.
+     * @return false if the payload of the change was not allocated on a SharedMemPayloadPool.
+     */
+    static bool get_descriptor(
+            const fastrtps::rtps::CacheChange_t& change,
+            SharedMemPayloadDescriptor& descriptor);
+
+    /**
+     * Map the payload referenced by a descriptor.
+     * The payload is not recycled by its owner, unless it runs out of memory, while the returned reference is alive.
+     * @param descriptor Descriptor of the payload.
+     * @param [out] payload Points to the mapped payload on success. Its data should not be freed.
+     * @return A reference to the mapped payload, or nullptr if it is no longer available.
+     */
+    static std::shared_ptr<void> map_payload(
+            const SharedMemPayloadDescriptor& descriptor,
+            fastrtps::rtps::SerializedPayload_t& payload);
+
+protected:
+
+    SharedMemPayloadPool() = default;
+
+    /**
+     * Fill the location of a payload allocated on this pool.
+     * @param data Data of the payload.
+     * @param [out] descriptor Descriptor where the location is written.
+     * @return false if the payload was not allocated on this pool.
+     */
+    virtual bool fill_descriptor(
+            const fastrtps::rtps::octet* data,
+            SharedMemPayloadDescriptor& descriptor) const = 0;
+};
+
+}  // namespace rtps
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif  // _FASTDDS_SHAREDMEM_PAYLOAD_POOL_H_
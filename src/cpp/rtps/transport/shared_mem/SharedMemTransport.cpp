@@ -182,6 +182,12 @@ bool SharedMemTransport::is_localhost_allowed() const
     return true;
 }
 
+void SharedMemTransport::update_general_threads(
+        const std::function<ThreadSettings(const ThreadSettings&)>& update)
+{
+    configuration_.dump_thread(update(configuration_.dump_thread()));
+}
+
 void SharedMemTransport::delete_input_channel(
         SharedMemChannelResource* channel)
 {
@@ -278,13 +284,18 @@ bool SharedMemTransport::init(
             return false;
         }
         shared_mem_segment_ = shared_mem_manager_->create_segment(configuration_.segment_size(),
-                        configuration_.port_queue_capacity());
+                        configuration_.port_queue_capacity(), configuration_.lock_free_segment_allocation());
+
+        utilities::memory::MemoryPlacement placement;
+        placement.use_huge_pages = configuration_.segment_huge_pages();
+        placement.numa_node = configuration_.segment_numa_node();
+        if (!placement.is_default() && !shared_mem_segment_->apply_placement(placement))
+        {
+            EPROSIMA_LOG_WARNING(RTPS_TRANSPORT_SHM, "Could not apply the requested memory placement to the segment");
+        }
 
         // Memset the whole segment to zero in order to force physical map of the buffer
-        auto buffer = shared_mem_segment_->alloc_buffer(configuration_.segment_size(),
-                        (std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
-        memset(buffer->data(), 0, configuration_.segment_size());
-        buffer.reset();
+        shared_mem_segment_->prefault();
 
         if (!configuration_.rtps_dump_file().empty())
         {
@@ -339,7 +350,7 @@ SharedMemChannelResource* SharedMemTransport::CreateInputChannelResource(
             locator.port,
             configuration_.port_queue_capacity(),
             configuration_.healthy_check_timeout_ms(),
-            open_mode)->create_listener(),
+            open_mode)->create_listener(configuration_.listener_spin_budget_us()),
         locator,
         receiver,
         configuration_.rtps_dump_file(),
@@ -121,6 +121,9 @@ public:
 
     bool is_localhost_allowed() const override;
 
+    void update_general_threads(
+            const std::function<ThreadSettings(const ThreadSettings&)>& update) override;
+
     TransportDescriptorInterface* get_configuration() override
     {
         return &configuration_;
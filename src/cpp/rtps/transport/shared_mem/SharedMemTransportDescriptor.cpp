@@ -42,6 +42,10 @@ SharedMemTransportDescriptor::SharedMemTransportDescriptor()
     , port_queue_capacity_(shm_default_port_queue_capacity)
     , healthy_check_timeout_ms_(shm_default_healthy_check_timeout_ms)
     , rtps_dump_file_("")
+    , segment_numa_node_(-1)
+    , segment_huge_pages_(false)
+    , lock_free_segment_allocation_(false)
+    , listener_spin_budget_us_(0)
 {
     maxMessageSize = s_maximumMessageSize;
 }
@@ -53,6 +57,10 @@ bool SharedMemTransportDescriptor::operator ==(
            this->port_queue_capacity_ == t.port_queue_capacity() &&
            this->healthy_check_timeout_ms_ == t.healthy_check_timeout_ms() &&
            this->rtps_dump_file_ == t.rtps_dump_file() &&
+           this->segment_numa_node_ == t.segment_numa_node() &&
+           this->segment_huge_pages_ == t.segment_huge_pages() &&
+           this->lock_free_segment_allocation_ == t.lock_free_segment_allocation() &&
+           this->listener_spin_budget_us_ == t.listener_spin_budget_us() &&
            this->dump_thread_ == t.dump_thread() &&
            PortBasedTransportDescriptor::operator ==(t));
 }
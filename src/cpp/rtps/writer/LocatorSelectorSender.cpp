@@ -12,6 +12,19 @@ bool LocatorSelectorSender::send(
     return writer_.send_nts(message, *this, max_blocking_time_point);
 }
 
+bool LocatorSelectorSender::destinations_accept_shm_payload_descriptors() const
+{
+    bool all_shm = 0 < locator_selector.selected_size();
+    locator_selector.for_each([&all_shm](const Locator_t& locator)
+            {
+                all_shm &= LOCATOR_KIND_SHM == locator.kind;
+            });
+    return all_shm && locator_selector.all_selected_entries([](const LocatorSelectorEntry& entry)
+                   {
+                       return entry.shm_payload_descriptors;
+                   });
+}
+
 } // namespace rtps
 } // namespace fastrtps
 } // namespace eprosima
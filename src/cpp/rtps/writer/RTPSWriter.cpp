@@ -17,6 +17,7 @@
  *
  */
 
+#include <algorithm>
 #include <mutex>
 
 #include <rtps/history/BasicPayloadPool.hpp>
@@ -145,6 +146,85 @@ RTPSWriter::~RTPSWriter()
     mp_history->mp_mutex = nullptr;
 }
 
+void RTPSWriter::begin_batch()
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    batching_ = !is_async_;
+}
+
+void RTPSWriter::end_batch(
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    batching_ = false;
+    if (batched_changes_.empty())
+    {
+        return;
+    }
+
+    // Same as the synchronous delivery of the flow controller, but sharing the message group among the changes
+    size_t delivered = 0;
+    LocatorSelectorSender& locator_selector = get_general_locator_selector();
+#if HAVE_STRICT_REALTIME
+    std::unique_lock<LocatorSelectorSender> lock(locator_selector, std::defer_lock);
+    if (lock.try_lock_until(max_blocking_time))
+#else
+    std::unique_lock<LocatorSelectorSender> lock(locator_selector);
+#endif // if HAVE_STRICT_REALTIME
+    {
+        try
+        {
+            RTPSMessageGroup group(mp_RTPSParticipant, this, &locator_selector, max_blocking_time);
+            for (; delivered < batched_changes_.size(); ++delivered)
+            {
+                CacheChange_t* change = batched_changes_[delivered];
+                if (nullptr != change &&
+                        DeliveryRetCode::DELIVERED !=
+                        deliver_sample_nts(change, group, locator_selector, max_blocking_time))
+                {
+                    break;
+                }
+            }
+        }
+        catch (const RTPSMessageGroup::timeout&)
+        {
+            EPROSIMA_LOG_WARNING(RTPS_WRITER, "Max blocking time reached sending a batch of changes");
+        }
+        lock.unlock();
+    }
+
+    // Let the flow controller handle the remaining ones, as if they had just been added
+    for (; delivered < batched_changes_.size(); ++delivered)
+    {
+        CacheChange_t* change = batched_changes_[delivered];
+        if (nullptr != change)
+        {
+            flow_controller_->add_new_sample(this, change, max_blocking_time);
+        }
+    }
+    batched_changes_.clear();
+}
+
+void RTPSWriter::add_new_sample_nts(
+        CacheChange_t* change,
+        const std::chrono::time_point<std::chrono::steady_clock>& max_blocking_time)
+{
+    if (batching_)
+    {
+        batched_changes_.push_back(change);
+    }
+    else
+    {
+        flow_controller_->add_new_sample(this, change, max_blocking_time);
+    }
+}
+
+void RTPSWriter::remove_batched_change_nts(
+        CacheChange_t* change)
+{
+    std::replace(batched_changes_.begin(), batched_changes_.end(), change, static_cast<CacheChange_t*>(nullptr));
+}
+
 void RTPSWriter::deinit()
 {
     // First, unregister changes from FlowController. This action must be protected.
@@ -374,6 +454,8 @@ void RTPSWriter::compute_selected_guids(
 void RTPSWriter::update_cached_info_nts(
         LocatorSelectorSender& locator_selector)
 {
+    // Locators of the matched readers may have changed
+    locator_selector.locator_selector.clear_cached_selections();
     locator_selector.locator_selector.reset(true);
     mp_RTPSParticipant->network_factory().select_locators(locator_selector.locator_selector);
 }
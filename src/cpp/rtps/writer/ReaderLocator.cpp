@@ -170,6 +170,7 @@ void ReaderLocator::stop()
     async_locator_info_.multicast.clear();
     async_locator_info_.unicast.clear();
     async_locator_info_.remote_guid = c_Guid_Unknown;
+    shm_payload_descriptors(false);
     guid_as_vector_.at(0) = c_Guid_Unknown;
     guid_prefix_as_vector_.at(0) = c_GuidPrefix_Unknown;
     expects_inline_qos_ = false;
@@ -202,6 +203,38 @@ bool ReaderLocator::send(
     return true;
 }
 
+void ReaderLocator::shm_payload_descriptors(
+        bool accepted)
+{
+    general_locator_info_.shm_payload_descriptors = accepted;
+    async_locator_info_.shm_payload_descriptors = accepted;
+}
+
+bool ReaderLocator::destinations_accept_shm_payload_descriptors() const
+{
+    if (general_locator_info_.remote_guid == c_Guid_Unknown || is_local_reader_ ||
+            !general_locator_info_.shm_payload_descriptors)
+    {
+        return false;
+    }
+
+    // Same locators send() would use
+    const ResourceLimitedVector<Locator_t>& locators = general_locator_info_.unicast.size() > 0 ?
+            general_locator_info_.unicast : general_locator_info_.multicast;
+    if (locators.empty())
+    {
+        return false;
+    }
+    for (const Locator_t& locator : locators)
+    {
+        if (LOCATOR_KIND_SHM != locator.kind)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 RTPSReader* ReaderLocator::local_reader()
 {
     if (!local_reader_)
@@ -117,6 +117,7 @@ void ReaderProxy::start(
         reader_attributes.remote_locators().multicast,
         reader_attributes.m_expectsInlineQos,
         is_datasharing);
+    locator_info_.shm_payload_descriptors(reader_attributes.shm_payload_descriptors());
 
     is_active_ = true;
     durability_kind_ = reader_attributes.m_qos.m_durability.durabilityKind();
@@ -155,6 +156,7 @@ bool ReaderProxy::update(
         reader_attributes.remote_locators().unicast,
         reader_attributes.remote_locators().multicast,
         reader_attributes.m_expectsInlineQos);
+    locator_info_.shm_payload_descriptors(reader_attributes.shm_payload_descriptors());
 
     return true;
 }
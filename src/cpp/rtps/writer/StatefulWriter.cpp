@@ -450,7 +450,7 @@ void StatefulWriter::unsent_change_added_to_history(
         // internally before exiting the call. For example if the writer matched with a best-effort reader.
         if (should_be_sent)
         {
-            flow_controller_->add_new_sample(this, change, max_blocking_time);
+            add_new_sample_nts(change, max_blocking_time);
         }
         else
         {
@@ -541,6 +541,7 @@ bool StatefulWriter::change_removed_by_history(
 
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
     EPROSIMA_LOG_INFO(RTPS_WRITER, "Change " << sequence_number << " to be removed.");
+    remove_batched_change_nts(a_change);
 
     if (flow_controller_->remove_change(a_change, max_blocking_time))
     {
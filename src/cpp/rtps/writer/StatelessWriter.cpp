@@ -325,7 +325,7 @@ void StatelessWriter::unsent_change_added_to_history(
     // Now for the rest of readers
     if (!fixed_locators_.empty() || getMatchedReadersSize() > 0)
     {
-        flow_controller_->add_new_sample(this, change, max_blocking_time);
+        add_new_sample_nts(change, max_blocking_time);
     }
     else
     {
@@ -365,6 +365,7 @@ bool StatelessWriter::change_removed_by_history(
 {
     bool ret_value = false;
     std::lock_guard<RecursiveTimedMutex> guard(mp_mutex);
+    remove_batched_change_nts(change);
 
     if (flow_controller_->remove_change(change, max_blocking_time))
     {
@@ -474,6 +475,7 @@ bool StatelessWriter::matched_reader_add(
                 if (reader.remote_guid() == data.guid())
                 {
                     EPROSIMA_LOG_WARNING(RTPS_WRITER, "Attempting to add existing reader, updating information.");
+                    reader.shm_payload_descriptors(data.shm_payload_descriptors());
                     if (reader.update(data.remote_locators().unicast,
                     data.remote_locators().multicast,
                     data.m_expectsInlineQos))
@@ -541,6 +543,7 @@ bool StatelessWriter::matched_reader_add(
             data.remote_locators().multicast,
             data.m_expectsInlineQos,
             is_datasharing_compatible_with(data));
+    new_reader->shm_payload_descriptors(data.shm_payload_descriptors());
     filter_remote_locators(*new_reader->general_locator_selector_entry(),
             m_att.external_unicast_locators, m_att.ignore_non_matching_locators);
 
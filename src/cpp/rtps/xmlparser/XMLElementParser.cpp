@@ -198,6 +198,7 @@ XMLP_ret XMLParser::getXMLParticipantAllocationAttributes(
                 <xs:element name="max_properties" type="uint32Type" minOccurs="0"/>
                 <xs:element name="max_user_data" type="uint32Type" minOccurs="0"/>
                 <xs:element name="max_partitions" type="uint32Type" minOccurs="0"/>
+                <xs:element name="payload_pools" type="payloadPoolsAllocationConfigType" minOccurs="0"/>
             </xs:all>
         </xs:complexType>
      */
@@ -275,6 +276,14 @@ XMLP_ret XMLParser::getXMLParticipantAllocationAttributes(
             }
             allocation.data_limits.max_partitions = tmp;
         }
+        else if (strcmp(name, PAYLOAD_POOLS) == 0)
+        {
+            // payload_pools - payloadPoolsAllocationConfigType
+            if (XMLP_ret::XML_OK != getXMLPayloadPoolsAllocationAttributes(p_aux0, allocation.payload_pools, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             EPROSIMA_LOG_ERROR(XMLPARSER,
@@ -385,6 +394,120 @@ XMLP_ret XMLParser::getXMLSendBuffersAllocationAttributes(
     return XMLP_ret::XML_OK;
 }
 
+XMLP_ret XMLParser::getXMLPayloadPoolsAllocationAttributes(
+        tinyxml2::XMLElement* elem,
+        rtps::PayloadPoolsAllocationAttributes& allocation,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="payloadPoolsAllocationConfigType">
+            <xs:all minOccurs="0">
+                <xs:element name="use_huge_pages" type="boolType" minOccurs="0"/>
+                <xs:element name="prefault" type="boolType" minOccurs="0"/>
+                <xs:element name="numa_node" type="int32Type" minOccurs="0"/>
+            </xs:all>
+        </xs:complexType>
+     */
+
+    tinyxml2::XMLElement* p_aux0 = nullptr;
+    const char* name = nullptr;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, USE_HUGE_PAGES) == 0)
+        {
+            // use_huge_pages - boolType
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &allocation.use_huge_pages, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, PREFAULT) == 0)
+        {
+            // prefault - boolType
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &allocation.prefault, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, NUMA_NODE) == 0)
+        {
+            // numa_node - int32Type
+            int tmp = 0;
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &tmp, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            allocation.numa_node = tmp;
+        }
+        else
+        {
+            EPROSIMA_LOG_ERROR(XMLPARSER,
+                    "Invalid element found into 'payloadPoolsAllocationConfigType'. Name: " << name);
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
+XMLP_ret XMLParser::getXMLThreadTopologyPolicy(
+        tinyxml2::XMLElement* elem,
+        fastdds::rtps::ThreadTopologyPolicy& policy,
+        uint8_t ident)
+{
+    /*
+        <xs:complexType name="threadTopologyPolicyType">
+            <xs:all minOccurs="0">
+                <xs:element name="numa_node" type="int32Type" minOccurs="0"/>
+                <xs:element name="isolate_receive_cores" type="boolType" minOccurs="0"/>
+                <xs:element name="auto_spread" type="boolType" minOccurs="0"/>
+            </xs:all>
+        </xs:complexType>
+     */
+
+    tinyxml2::XMLElement* p_aux0 = nullptr;
+    const char* name = nullptr;
+    for (p_aux0 = elem->FirstChildElement(); p_aux0 != NULL; p_aux0 = p_aux0->NextSiblingElement())
+    {
+        name = p_aux0->Name();
+        if (strcmp(name, NUMA_NODE) == 0)
+        {
+            // numa_node - int32Type
+            int tmp = 0;
+            if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &tmp, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            policy.numa_node = tmp;
+        }
+        else if (strcmp(name, ISOLATE_RECEIVE_CORES) == 0)
+        {
+            // isolate_receive_cores - boolType
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &policy.isolate_receive_cores, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else if (strcmp(name, AUTO_SPREAD) == 0)
+        {
+            // auto_spread - boolType
+            if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &policy.auto_spread, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
+        else
+        {
+            EPROSIMA_LOG_ERROR(XMLPARSER,
+                    "Invalid element found into 'threadTopologyPolicyType'. Name: " << name);
+            return XMLP_ret::XML_ERROR;
+        }
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
 XMLP_ret XMLParser::getXMLDiscoverySettings(
         tinyxml2::XMLElement* elem,
         rtps::DiscoverySettings& settings,
@@ -403,6 +526,7 @@ XMLP_ret XMLParser::getXMLDiscoverySettings(
             <xs:element name="discoveryServersList" type="DiscoveryServerList" minOccurs="0"/>
             <xs:element name="staticEndpointXMLFilename" type="stringType" minOccurs="0"/>
             <xs:element name="static_edp_xml_config" type="stringType" minOccurs="0"/>
+            <xs:element name="backupFormat" type="DiscoveryBackupFormat" minOccurs="0"/>
         </xs:all>
        </xs:complexType>
      */
@@ -555,6 +679,14 @@ XMLP_ret XMLParser::getXMLDiscoverySettings(
             }
             settings.static_edp_xml_config(s.c_str());
         }
+        else if (strcmp(name, BACKUP_FORMAT) == 0)
+        {
+            // backupFormat - DiscoveryBackupFormat
+            if (XMLP_ret::XML_OK != getXMLEnum(p_aux0, &settings.backup_format, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             EPROSIMA_LOG_ERROR(XMLPARSER, "Invalid element found into 'discoverySettingsType'. Name: " << name);
@@ -3968,6 +4100,44 @@ XMLP_ret XMLParser::getXMLEnum(
     return XMLP_ret::XML_OK;
 }
 
+XMLP_ret XMLParser::getXMLEnum(
+        tinyxml2::XMLElement* elem,
+        DiscoveryBackupFormat* e,
+        uint8_t /*ident*/)
+{
+    /*
+        <xs:simpleType name="DiscoveryBackupFormat">
+            <xs:restriction base="xs:string">
+                <xs:enumeration value="BINARY"/>
+                <xs:enumeration value="JSON"/>
+            </xs:restriction>
+        </xs:simpleType>
+     */
+
+    if (nullptr == elem || nullptr == e)
+    {
+        EPROSIMA_LOG_ERROR(XMLPARSER, "nullptr when getXMLEnum XML_ERROR!");
+        return XMLP_ret::XML_ERROR;
+    }
+
+    std::string text = get_element_text(elem);
+    if (text.empty())
+    {
+        EPROSIMA_LOG_ERROR(XMLPARSER, "<" << elem->Value() << "> getXMLEnum XML_ERROR!");
+        return XMLP_ret::XML_ERROR;
+    }
+
+    if (!get_element_enum_value(text.c_str(), *e,
+            BINARY, DiscoveryBackupFormat::BINARY,
+            JSON, DiscoveryBackupFormat::JSON))
+    {
+        EPROSIMA_LOG_ERROR(XMLPARSER, "Node '" << BACKUP_FORMAT << "' with bad content");
+        return XMLP_ret::XML_ERROR;
+    }
+
+    return XMLP_ret::XML_OK;
+}
+
 XMLP_ret XMLParser::getXMLRemoteServer(
         tinyxml2::XMLElement* elem,
         eprosima::fastdds::rtps::RemoteServerAttributes& server,
@@ -234,6 +234,7 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="receiveBufferSize" type="int32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="TTL" type="uint8Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="non_blocking_send" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="unicast_sockets_per_port" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxMessageSize" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="maxInitialPeersRange" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="interfaceWhiteList" type="stringListType" minOccurs="0" maxOccurs="1"/>
@@ -249,6 +250,10 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 <xs:element name="calculate_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="check_crc" type="boolType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="enable_tcp_nodelay" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="async_send" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="send_queue_max_bytes" type="uint32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="send_queue_full_policy" type="string" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="send_queue_block_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="tls" type="tlsConfigType" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
@@ -321,6 +326,14 @@ XMLP_ret XMLParser::parseXMLTransportData(
                 return XMLP_ret::XML_ERROR;
             }
         }
+        // Unicast sockets per port
+        if (nullptr != (p_aux0 = p_root->FirstChildElement(UNICAST_SOCKETS_PER_PORT)))
+        {
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pUDPDesc->unicast_sockets_per_port, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
     }
     else if (sType == TCPv4)
     {
@@ -416,7 +429,9 @@ XMLP_ret XMLParser::validateXMLTransportElements(
                 strcmp(name, MAX_INITIAL_PEERS_RANGE) == 0 ||
                 strcmp(name, WHITE_LIST) == 0 ||
                 strcmp(name, TTL) == 0 ||
+                strcmp(name, RECEIVE_BUFFER_POOL_SIZE) == 0 ||
                 strcmp(name, NON_BLOCKING_SEND) == 0 ||
+                strcmp(name, UNICAST_SOCKETS_PER_PORT) == 0 ||
                 strcmp(name, UDP_OUTPUT_PORT) == 0 ||
                 strcmp(name, TCP_WAN_ADDR) == 0 ||
                 strcmp(name, KEEP_ALIVE_FREQUENCY) == 0 ||
@@ -430,6 +445,10 @@ XMLP_ret XMLParser::validateXMLTransportElements(
                 strcmp(name, KEEP_ALIVE_THREAD) == 0 ||
                 strcmp(name, ACCEPT_THREAD) == 0 ||
                 strcmp(name, ENABLE_TCP_NODELAY) == 0 ||
+                strcmp(name, ASYNC_SEND) == 0 ||
+                strcmp(name, SEND_QUEUE_MAX_BYTES) == 0 ||
+                strcmp(name, SEND_QUEUE_FULL_POLICY) == 0 ||
+                strcmp(name, SEND_QUEUE_BLOCK_TIMEOUT_MS) == 0 ||
                 strcmp(name, TLS) == 0 ||
                 strcmp(name, SEGMENT_SIZE) == 0 ||
                 strcmp(name, PORT_QUEUE_CAPACITY) == 0 ||
@@ -438,6 +457,10 @@ XMLP_ret XMLParser::validateXMLTransportElements(
                 strcmp(name, DEFAULT_RECEPTION_THREADS) == 0 ||
                 strcmp(name, RECEPTION_THREADS) == 0 ||
                 strcmp(name, DUMP_THREAD) == 0 ||
+                strcmp(name, LOCK_FREE_SEGMENT_ALLOCATION) == 0 ||
+                strcmp(name, SEGMENT_HUGE_PAGES) == 0 ||
+                strcmp(name, SEGMENT_NUMA_NODE) == 0 ||
+                strcmp(name, LISTENER_SPIN_BUDGET_US) == 0 ||
                 strcmp(name, PORT_OVERFLOW_POLICY) == 0 ||
                 strcmp(name, SEGMENT_OVERFLOW_POLICY) == 0))
         {
@@ -550,6 +573,7 @@ XMLP_ret XMLParser::parseXMLSocketTransportData(
                 <xs:element name="receiveBufferSize" type="int32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="TTL" type="uint8Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="interfaceWhiteList" type="addressListType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="receive_buffer_pool_size" type="uint32Type" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
      */
@@ -588,6 +612,16 @@ XMLP_ret XMLParser::parseXMLSocketTransportData(
             }
             p_transport->TTL = static_cast<uint8_t>(iTTL);
         }
+        else if (strcmp(name, RECEIVE_BUFFER_POOL_SIZE) == 0)
+        {
+            // receive_buffer_pool_size - uint32Type
+            uint32_t iSize = 0;
+            if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &iSize, 0))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+            p_transport->receive_buffer_pool_size = iSize;
+        }
         else if (strcmp(name, WHITE_LIST) == 0)
         {
             // InterfaceWhiteList addressListType
@@ -710,6 +744,49 @@ XMLP_ret XMLParser::parseXMLCommonTCPTransportData(
                     return XMLP_ret::XML_ERROR;
                 }
             }
+            // async_send - boolType
+            else if (strcmp(name, ASYNC_SEND) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &pTCPDesc->async_send, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            // send_queue_max_bytes - uint32Type
+            else if (strcmp(name, SEND_QUEUE_MAX_BYTES) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pTCPDesc->send_queue_max_bytes, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            // send_queue_full_policy - string
+            else if (strcmp(name, SEND_QUEUE_FULL_POLICY) == 0)
+            {
+                std::string text = get_element_text(p_aux0);
+                if (strcmp(text.c_str(), DROP) == 0)
+                {
+                    pTCPDesc->send_queue_full_policy = rtps::TCPTransportDescriptor::SendQueueFullPolicy::DROP;
+                }
+                else if (strcmp(text.c_str(), BLOCK) == 0)
+                {
+                    pTCPDesc->send_queue_full_policy = rtps::TCPTransportDescriptor::SendQueueFullPolicy::BLOCK;
+                }
+                else
+                {
+                    EPROSIMA_LOG_ERROR(XMLPARSER, "Invalid value found into '" << SEND_QUEUE_FULL_POLICY << "': "
+                                                                               << text);
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
+            // send_queue_block_timeout_ms - uint32Type
+            else if (strcmp(name, SEND_QUEUE_BLOCK_TIMEOUT_MS) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &pTCPDesc->send_queue_block_timeout_ms, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+            }
             else if (strcmp(name, LISTENING_PORTS) == 0)
             {
                 // listening_ports uint16ListType
@@ -788,6 +865,10 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 <xs:element name="healthy_check_timeout_ms" type="uint32Type" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="rtps_dump_file" type="stringType" minOccurs="0" maxOccurs="1"/>
                 <xs:element name="dump_thread" type="threadSettingsType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="lock_free_segment_allocation" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="segment_huge_pages" type="boolType" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="segment_numa_node" type="int32Type" minOccurs="0" maxOccurs="1"/>
+                <xs:element name="listener_spin_budget_us" type="uint32Type" minOccurs="0" maxOccurs="1"/>
             </xs:all>
         </xs:complexType>
      */
@@ -846,6 +927,41 @@ XMLP_ret XMLParser::parseXMLCommonSharedMemTransportData(
                 }
                 transport_descriptor->dump_thread(thread_settings);
             }
+            else if (strcmp(name, LOCK_FREE_SEGMENT_ALLOCATION) == 0)
+            {
+                bool value = false;
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &value, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->lock_free_segment_allocation(value);
+            }
+            else if (strcmp(name, SEGMENT_HUGE_PAGES) == 0)
+            {
+                bool value = false;
+                if (XMLP_ret::XML_OK != getXMLBool(p_aux0, &value, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->segment_huge_pages(value);
+            }
+            else if (strcmp(name, SEGMENT_NUMA_NODE) == 0)
+            {
+                int value = 0;
+                if (XMLP_ret::XML_OK != getXMLInt(p_aux0, &value, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->segment_numa_node(static_cast<int32_t>(value));
+            }
+            else if (strcmp(name, LISTENER_SPIN_BUDGET_US) == 0)
+            {
+                if (XMLP_ret::XML_OK != getXMLUint(p_aux0, &aux, 0))
+                {
+                    return XMLP_ret::XML_ERROR;
+                }
+                transport_descriptor->listener_spin_budget_us(aux);
+            }
             // Do not parse nor fail on unkown tags; these may be parsed elsewhere
         }
     }
@@ -2254,6 +2370,14 @@ XMLP_ret XMLParser::fillDataNode(
             EPROSIMA_LOG_WARNING(XMLPARSER, "Ignoring '" << SECURITY_LOG_THREAD << "' since security is disabled");
 #endif // if HAVE_SECURITY
         }
+        else if (strcmp(name, THREAD_TOPOLOGY) == 0)
+        {
+            if (XMLP_ret::XML_OK !=
+                    getXMLThreadTopologyPolicy(p_aux0, participant_node.get()->rtps.thread_topology, ident))
+            {
+                return XMLP_ret::XML_ERROR;
+            }
+        }
         else
         {
             EPROSIMA_LOG_ERROR(XMLPARSER, "Invalid element found into 'rtpsParticipantAttributesType'. Name: " << name);
@@ -46,7 +46,9 @@ const char* TCP_WAN_ADDR = "wan_addr";
 const char* RECEIVE_BUFFER_SIZE = "receiveBufferSize";
 const char* SEND_BUFFER_SIZE = "sendBufferSize";
 const char* TTL = "TTL";
+const char* RECEIVE_BUFFER_POOL_SIZE = "receive_buffer_pool_size";
 const char* NON_BLOCKING_SEND = "non_blocking_send";
+const char* UNICAST_SOCKETS_PER_PORT = "unicast_sockets_per_port";
 const char* WHITE_LIST = "interfaceWhiteList";
 const char* INTERFACE = "interface";
 const char* MAX_MESSAGE_SIZE = "maxMessageSize";
@@ -57,6 +59,12 @@ const char* MAX_LOGICAL_PORT = "max_logical_port";
 const char* LOGICAL_PORT_RANGE = "logical_port_range";
 const char* LOGICAL_PORT_INCREMENT = "logical_port_increment";
 const char* ENABLE_TCP_NODELAY = "enable_tcp_nodelay";
+const char* ASYNC_SEND = "async_send";
+const char* SEND_QUEUE_MAX_BYTES = "send_queue_max_bytes";
+const char* SEND_QUEUE_FULL_POLICY = "send_queue_full_policy";
+const char* SEND_QUEUE_BLOCK_TIMEOUT_MS = "send_queue_block_timeout_ms";
+const char* DROP = "DROP";
+const char* BLOCK = "BLOCK";
 const char* METADATA_LOGICAL_PORT = "metadata_logical_port";
 const char* LISTENING_PORTS = "listening_ports";
 const char* CALCULATE_CRC = "calculate_crc";
@@ -75,6 +83,10 @@ const char* DEFAULT_RECEPTION_THREADS = "default_reception_threads";
 const char* RECEPTION_THREADS = "reception_threads";
 const char* RECEPTION_THREAD = "reception_thread";
 const char* DUMP_THREAD = "dump_thread";
+const char* LOCK_FREE_SEGMENT_ALLOCATION = "lock_free_segment_allocation";
+const char* SEGMENT_HUGE_PAGES = "segment_huge_pages";
+const char* SEGMENT_NUMA_NODE = "segment_numa_node";
+const char* LISTENER_SPIN_BUDGET_US = "listener_spin_budget_us";
 const char* ON = "ON";
 const char* AUTO = "AUTO";
 const char* THREAD_SETTINGS = "thread_settings";
@@ -136,11 +148,18 @@ const char* DYNAMIC_LC = "dynamic";
 const char* MAX_PROPERTIES = "max_properties";
 const char* MAX_USER_DATA = "max_user_data";
 const char* MAX_PARTITIONS = "max_partitions";
+const char* PAYLOAD_POOLS = "payload_pools";
+const char* USE_HUGE_PAGES = "use_huge_pages";
+const char* PREFAULT = "prefault";
+const char* NUMA_NODE = "numa_node";
 const char* TIMED_EVENTS_THREAD = "timed_events_thread";
 const char* DISCOVERY_SERVER_THREAD = "discovery_server_thread";
 const char* SECURITY_LOG_THREAD = "security_log_thread";
 const char* BUILTIN_TRANSPORTS_RECEPTION_THREADS = "builtin_transports_reception_threads";
 const char* BUILTIN_CONTROLLERS_SENDER_THREAD = "builtin_controllers_sender_thread";
+const char* THREAD_TOPOLOGY = "thread_topology";
+const char* ISOLATE_RECEIVE_CORES = "isolate_receive_cores";
+const char* AUTO_SPREAD = "auto_spread";
 
 /// Publisher-subscriber attributes
 const char* TOPIC = "topic";
@@ -291,6 +310,9 @@ const char* IGNORE_PARTICIPANT_FLAGS = "ignoreParticipantFlags";
 const char* FILTER_DIFFERENT_HOST = "FILTER_DIFFERENT_HOST";
 const char* FILTER_DIFFERENT_PROCESS = "FILTER_DIFFERENT_PROCESS";
 const char* FILTER_SAME_PROCESS = "FILTER_SAME_PROCESS";
+const char* BACKUP_FORMAT = "backupFormat";
+const char* BINARY = "BINARY";
+const char* JSON = "JSON";
 const char* TYPELOOKUP_CONFIG = "typelookup_config";
 const char* TYPELOOKUP_USE_SERVER = "use_server";
 const char* TYPELOOKUP_USE_CLIENT = "use_client";
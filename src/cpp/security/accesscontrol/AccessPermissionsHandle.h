@@ -20,6 +20,7 @@
 
 #include <fastdds/rtps/security/common/Handle.h>
 #include <fastdds/rtps/common/Token.h>
+#include <security/accesscontrol/PermissionsMatcher.h>
 #include <security/accesscontrol/PermissionsTypes.h>
 #include <fastdds/rtps/security/accesscontrol/ParticipantSecurityAttributes.h>
 #include <fastdds/rtps/security/accesscontrol/EndpointSecurityAttributes.h>
@@ -62,6 +63,10 @@ public:
     ParticipantSecurityAttributes governance_rule_;
     std::vector<std::pair<std::string, EndpointSecurityAttributes>> governance_topic_rules_;
     Grant grant;
+    //! Rules of the grant, prepared to check the endpoints
+    std::vector<CompiledRule> compiled_rules_;
+    //! Decisions already taken for the endpoints checked against this handle
+    mutable AccessDecisionCache decisions_;
 };
 
 class Permissions;
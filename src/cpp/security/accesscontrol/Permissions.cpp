@@ -106,55 +106,11 @@ static const EndpointSecurityAttributes* is_topic_in_sec_attributes(
     return returned_value;
 }
 
-static bool is_topic_in_criterias(
-        const char* topic_name,
-        const std::vector<Criteria>& criterias)
-{
-    bool returned_value = false;
-
-    for (auto criteria_it = criterias.begin(); !returned_value &&
-            criteria_it != criterias.end(); ++criteria_it)
-    {
-        for (auto topic : (*criteria_it).topics)
-        {
-            if (StringMatching::matchPattern(topic.c_str(), topic_name))
-            {
-                returned_value = true;
-                break;
-            }
-        }
-    }
-
-    return returned_value;
-}
-
-static bool is_partition_in_criterias(
-        const std::string& partition,
-        const std::vector<Criteria>& criterias)
-{
-    bool returned_value = false;
-
-    for (auto criteria_it = criterias.begin(); !returned_value &&
-            criteria_it != criterias.end(); ++criteria_it)
-    {
-        for (auto part : (*criteria_it).partitions)
-        {
-            if (StringMatching::matchPattern(part.c_str(), partition.c_str()))
-            {
-                returned_value = true;
-                break;
-            }
-        }
-    }
-
-    return returned_value;
-}
-
 static bool check_rule(
-        const char* topic_name,
-        const Rule& rule,
+        const std::string& topic_name,
+        const CompiledRule& rule,
         const std::vector<std::string>& partitions,
-        const std::vector<Criteria>& criterias,
+        const CompiledCriterias& criterias,
         SecurityException& exception)
 {
     bool returned_value = false;
@@ -165,7 +121,7 @@ static bool check_rule(
 
         if (partitions.empty())
         {
-            if (!is_partition_in_criterias(std::string(), criterias))
+            if (!criterias.partitions.matches(std::string()))
             {
                 returned_value = false;
                 exception = _SecurityException_(std::string("<empty> partition not found in rule."));
@@ -177,7 +133,7 @@ static bool check_rule(
             for (auto partition_it = partitions.begin(); returned_value && partition_it != partitions.end();
                     ++partition_it)
             {
-                if (!is_partition_in_criterias(*partition_it, criterias))
+                if (!criterias.partitions.matches(*partition_it))
                 {
                     returned_value = false;
                     exception = _SecurityException_(*partition_it + std::string(" partition not found in rule."));
@@ -193,6 +149,99 @@ static bool check_rule(
     return returned_value;
 }
 
+static bool check_endpoint_rules(
+        const AccessPermissions& permissions,
+        AccessDecisionCache::Check check,
+        const uint32_t domain_id,
+        const std::string& topic_name,
+        const std::vector<std::string>& partitions,
+        bool& relay_only,
+        SecurityException& exception)
+{
+    bool is_writer = AccessDecisionCache::Check::CREATE_DATAWRITER == check ||
+            AccessDecisionCache::Check::REMOTE_DATAWRITER == check;
+    bool is_remote = AccessDecisionCache::Check::REMOTE_DATAWRITER == check ||
+            AccessDecisionCache::Check::REMOTE_DATAREADER == check;
+
+    relay_only = false;
+
+    const EndpointSecurityAttributes* attributes = nullptr;
+
+    if ((attributes = is_topic_in_sec_attributes(topic_name.c_str(), permissions.governance_topic_rules_)) != nullptr)
+    {
+        if (is_writer ? !attributes->is_write_protected : !attributes->is_read_protected)
+        {
+            return true;
+        }
+    }
+    else
+    {
+        exception = _SecurityException_("Not found topic access rule for topic " + topic_name);
+        return false;
+    }
+
+    // The first rule with the topic decides
+    for (const CompiledRule& rule : permissions.compiled_rules_)
+    {
+        if (is_remote && !is_domain_in_set(domain_id, rule.domains))
+        {
+            continue;
+        }
+
+        const CompiledCriterias& criterias = is_writer ? rule.publishes : rule.subscribes;
+        if (criterias.topics.matches(topic_name))
+        {
+            return check_rule(topic_name, rule, partitions, criterias, exception);
+        }
+
+        if (AccessDecisionCache::Check::REMOTE_DATAREADER == check && rule.relays.topics.matches(topic_name))
+        {
+            relay_only = check_rule(topic_name, rule, partitions, rule.relays, exception);
+            return relay_only;
+        }
+    }
+
+    exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
+    return false;
+}
+
+/**
+ * Checks an endpoint against a permissions handle, reusing the decision taken for a previous endpoint on the same
+ * topic and partitions.
+ */
+static bool check_endpoint(
+        const AccessPermissions& permissions,
+        AccessDecisionCache::Check check,
+        const uint32_t domain_id,
+        const std::string& topic_name,
+        const std::vector<std::string>& partitions,
+        bool& relay_only,
+        SecurityException& exception)
+{
+    AccessDecisionCache::Decision decision;
+
+    if (permissions.decisions_.find(check, domain_id, topic_name, partitions, decision))
+    {
+        if (!decision.allowed)
+        {
+            exception = SecurityException(decision.error);
+        }
+    }
+    else
+    {
+        decision.allowed = check_endpoint_rules(permissions, check, domain_id, topic_name, partitions,
+                        decision.relay_only, exception);
+        if (!decision.allowed)
+        {
+            decision.error = exception.what();
+        }
+        permissions.decisions_.insert(check, domain_id, topic_name, partitions, decision);
+    }
+
+    relay_only = decision.relay_only;
+    return decision.allowed;
+}
+
 static bool is_validation_in_time(
         const Validity& validity)
 {
@@ -570,6 +619,7 @@ static bool check_subject_name(
                 if (rfc2253_string_compare(grant.subject_name, lih->cert_sn_rfc2253_))
                 {
                     ah->grant = std::move(grant);
+                    ah->compiled_rules_ = compile_rules(ah->grant.rules);
                     returned_value = true;
 
                     // Remove rules not apply to my domain
@@ -988,6 +1038,7 @@ PermissionsHandle* Permissions::validate_remote_permissions(
 
     AccessPermissionsHandle* handle = &AccessPermissionsHandle::narrow(*get_permissions_handle(exception));
     (*handle)->grant = std::move(remote_grant);
+    (*handle)->compiled_rules_ = compile_rules((*handle)->grant.rules);
     (*handle)->governance_rule_ = lph->governance_rule_;
     (*handle)->governance_topic_rules_ = lph->governance_topic_rules_;
 
@@ -1011,7 +1062,7 @@ bool Permissions::check_create_participant(
     }
 
     //Search an allow rule with my domain
-    for (auto rule : lah->grant.rules)
+    for (const CompiledRule& rule : lah->compiled_rules_)
     {
         if (rule.allow)
         {
@@ -1051,7 +1102,7 @@ bool Permissions::check_remote_participant(
     }
 
     //Search an allow rule with my domain
-    for (auto rule : rah->grant.rules)
+    for (const CompiledRule& rule : rah->compiled_rules_)
     {
         if (rule.allow)
         {
@@ -1079,7 +1130,6 @@ bool Permissions::check_create_datawriter(
         const std::vector<std::string>& partitions,
         SecurityException& exception)
 {
-    bool returned_value = false;
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(local_handle);
 
     if (lah.nil())
@@ -1089,38 +1139,12 @@ bool Permissions::check_create_datawriter(
         return false;
     }
 
-    const EndpointSecurityAttributes* attributes = nullptr;
-
-    if ((attributes = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_topic_rules_)) != nullptr)
-    {
-        if (!attributes->is_write_protected)
-        {
-            return true;
-        }
-    }
-    else
-    {
-        exception = _SecurityException_("Not found topic access rule for topic " + topic_name);
-        EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
-        return false;
-    }
-
-    // Search topic
-    for (auto rule : lah->grant.rules)
-    {
-        if (is_topic_in_criterias(topic_name.c_str(), rule.publishes))
-        {
-            returned_value = check_rule(topic_name.c_str(), rule, partitions, rule.publishes, exception);
-            break;
-        }
-    }
+    bool relay_only = false;
+    bool returned_value = check_endpoint(**lah, AccessDecisionCache::Check::CREATE_DATAWRITER, 0, topic_name,
+                    partitions, relay_only, exception);
 
     if (!returned_value)
     {
-        if (strlen(exception.what()) == 0)
-        {
-            exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
-        }
         EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
     }
 
@@ -1134,7 +1158,6 @@ bool Permissions::check_create_datareader(
         const std::vector<std::string>& partitions,
         SecurityException& exception)
 {
-    bool returned_value = false;
     const AccessPermissionsHandle& lah = AccessPermissionsHandle::narrow(local_handle);
 
     if (lah.nil())
@@ -1144,37 +1167,12 @@ bool Permissions::check_create_datareader(
         return false;
     }
 
-    const EndpointSecurityAttributes* attributes = nullptr;
-
-    if ((attributes = is_topic_in_sec_attributes(topic_name.c_str(), lah->governance_topic_rules_)) != nullptr)
-    {
-        if (!attributes->is_read_protected)
-        {
-            return true;
-        }
-    }
-    else
-    {
-        exception = _SecurityException_("Not found topic access rule for topic " + topic_name);
-        EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
-        return false;
-    }
-
-    for (auto rule : lah->grant.rules)
-    {
-        if (is_topic_in_criterias(topic_name.c_str(), rule.subscribes))
-        {
-            returned_value = check_rule(topic_name.c_str(), rule, partitions, rule.subscribes, exception);
-            break;
-        }
-    }
+    bool relay_only = false;
+    bool returned_value = check_endpoint(**lah, AccessDecisionCache::Check::CREATE_DATAREADER, 0, topic_name,
+                    partitions, relay_only, exception);
 
     if (!returned_value)
     {
-        if (strlen(exception.what()) == 0)
-        {
-            exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
-        }
         EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
     }
 
@@ -1187,9 +1185,7 @@ bool Permissions::check_remote_datawriter(
         const WriterProxyData& publication_data,
         SecurityException& exception)
 {
-    bool returned_value = false;
     const AccessPermissionsHandle& rah = AccessPermissionsHandle::narrow(remote_handle);
-    const char* topic_name = publication_data.topicName().c_str();
 
     if (rah.nil())
     {
@@ -1198,43 +1194,13 @@ bool Permissions::check_remote_datawriter(
         return false;
     }
 
-    const EndpointSecurityAttributes* attributes = nullptr;
-
-    if ((attributes = is_topic_in_sec_attributes(topic_name, rah->governance_topic_rules_))
-            != nullptr)
-    {
-        if (!attributes->is_write_protected)
-        {
-            return true;
-        }
-    }
-    else
-    {
-        exception = _SecurityException_(
-            "Not found topic access rule for topic " + publication_data.topicName().to_string());
-        EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
-        return false;
-    }
-
-    for (auto rule : rah->grant.rules)
-    {
-        if (is_domain_in_set(domain_id, rule.domains))
-        {
-            if (is_topic_in_criterias(topic_name, rule.publishes))
-            {
-                returned_value = check_rule(topic_name, rule, publication_data.m_qos.m_partition.getNames(),
-                                rule.publishes, exception);
-                break;
-            }
-        }
-    }
+    bool relay_only = false;
+    bool returned_value = check_endpoint(**rah, AccessDecisionCache::Check::REMOTE_DATAWRITER, domain_id,
+                    publication_data.topicName().to_string(), publication_data.m_qos.m_partition.getNames(),
+                    relay_only, exception);
 
     if (!returned_value)
     {
-        if (strlen(exception.what()) == 0)
-        {
-            exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
-        }
         EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
     }
 
@@ -1248,9 +1214,7 @@ bool Permissions::check_remote_datareader(
         bool& relay_only,
         SecurityException& exception)
 {
-    bool returned_value = false;
     const AccessPermissionsHandle& rah = AccessPermissionsHandle::narrow(remote_handle);
-    const char* topic_name = subscription_data.topicName().c_str();
 
     relay_only = false;
 
@@ -1261,54 +1225,12 @@ bool Permissions::check_remote_datareader(
         return false;
     }
 
-    const EndpointSecurityAttributes* attributes = nullptr;
-
-    if ((attributes = is_topic_in_sec_attributes(topic_name, rah->governance_topic_rules_))
-            != nullptr)
-    {
-        if (!attributes->is_read_protected)
-        {
-            return true;
-        }
-    }
-    else
-    {
-        exception = _SecurityException_(
-            "Not found topic access rule for topic " + subscription_data.topicName().to_string());
-        EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
-        return false;
-    }
-
-    for (auto rule : rah->grant.rules)
-    {
-        if (is_domain_in_set(domain_id, rule.domains))
-        {
-            const std::vector<std::string>& partitions = subscription_data.m_qos.m_partition.getNames();
-            if (is_topic_in_criterias(topic_name, rule.subscribes))
-            {
-                returned_value = check_rule(topic_name, rule, partitions, rule.subscribes, exception);
-                break;
-            }
-
-            if (is_topic_in_criterias(topic_name, rule.relays))
-            {
-                returned_value = check_rule(topic_name, rule, partitions, rule.relays, exception);
-                if (returned_value)
-                {
-                    relay_only = true;
-                }
-
-                break;
-            }
-        }
-    }
+    bool returned_value = check_endpoint(**rah, AccessDecisionCache::Check::REMOTE_DATAREADER, domain_id,
+                    subscription_data.topicName().to_string(), subscription_data.m_qos.m_partition.getNames(),
+                    relay_only, exception);
 
     if (!returned_value)
     {
-        if (strlen(exception.what()) == 0)
-        {
-            exception = _SecurityException_(topic_name + std::string(" topic not found in allow rule."));
-        }
         EMERGENCY_SECURITY_LOGGING("Permissions", exception.what());
     }
 
@@ -0,0 +1,235 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*!
+ * @file PermissionsMatcher.h
+ */
+#ifndef __SECURITY_ACCESSCONTROL_PERMISSIONSMATCHER_H__
+#define __SECURITY_ACCESSCONTROL_PERMISSIONSMATCHER_H__
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <unordered_set>
+#include <vector>
+
+#include <fastrtps/utils/StringMatching.h>
+#include <security/accesscontrol/PermissionsTypes.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+namespace security {
+
+/**
+ * Set of topic or partition name expressions of a permissions document.
+ *
+ * Expressions without wildcards are kept on a hash set, so only the ones with wildcards have to be matched one by one.
+ */
+class NameMatcher
+{
+public:
+
+    void add(
+            const std::string& expression)
+    {
+        if (is_literal(expression))
+        {
+            literals_.insert(expression);
+        }
+        else
+        {
+            patterns_.push_back(expression);
+        }
+    }
+
+    bool matches(
+            const std::string& name) const
+    {
+        if (literals_.count(name) > 0)
+        {
+            return true;
+        }
+
+        for (const std::string& pattern : patterns_)
+        {
+            if (StringMatching::matchPattern(pattern.c_str(), name.c_str()))
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+private:
+
+    static bool is_literal(
+            const std::string& expression)
+    {
+#if defined(_WIN32)
+        // Matching is case insensitive on Windows
+        static_cast<void>(expression);
+        return false;
+#else
+        return std::string::npos == expression.find_first_of("*?[");
+#endif // if defined(_WIN32)
+    }
+
+    std::unordered_set<std::string> literals_;
+    std::vector<std::string> patterns_;
+};
+
+/**
+ * Topics and partitions allowed by a list of criterias of a rule.
+ */
+struct CompiledCriterias
+{
+    void compile(
+            const std::vector<Criteria>& criterias)
+    {
+        for (const Criteria& criteria : criterias)
+        {
+            for (const std::string& topic : criteria.topics)
+            {
+                topics.add(topic);
+            }
+            for (const std::string& partition : criteria.partitions)
+            {
+                partitions.add(partition);
+            }
+        }
+    }
+
+    NameMatcher topics;
+    NameMatcher partitions;
+};
+
+/**
+ * Rule of a grant, prepared to check the endpoints against it.
+ */
+struct CompiledRule
+{
+    explicit CompiledRule(
+            const Rule& rule)
+        : allow(rule.allow)
+        , domains(rule.domains)
+    {
+        publishes.compile(rule.publishes);
+        subscribes.compile(rule.subscribes);
+        relays.compile(rule.relays);
+    }
+
+    bool allow;
+    Domains domains;
+    CompiledCriterias publishes;
+    CompiledCriterias subscribes;
+    CompiledCriterias relays;
+};
+
+inline std::vector<CompiledRule> compile_rules(
+        const std::vector<Rule>& rules)
+{
+    std::vector<CompiledRule> compiled;
+    compiled.reserve(rules.size());
+    for (const Rule& rule : rules)
+    {
+        compiled.emplace_back(rule);
+    }
+    return compiled;
+}
+
+/**
+ * Decisions taken for the endpoints of a permissions handle.
+ *
+ * As the grant of a handle never changes, its decisions only depend on the topic and partitions of the endpoint.
+ * New permissions are always validated into a new handle, which starts with an empty cache.
+ */
+class AccessDecisionCache
+{
+public:
+
+    enum class Check : uint8_t
+    {
+        CREATE_DATAWRITER,
+        CREATE_DATAREADER,
+        REMOTE_DATAWRITER,
+        REMOTE_DATAREADER
+    };
+
+    struct Decision
+    {
+        bool allowed = false;
+        bool relay_only = false;
+        //! Reason of the denial
+        std::string error;
+    };
+
+    bool find(
+            Check check,
+            uint32_t domain_id,
+            const std::string& topic_name,
+            const std::vector<std::string>& partitions,
+            Decision& decision) const
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        auto it = decisions_.find(std::make_tuple(check, domain_id, topic_name, partitions));
+        if (it == decisions_.end())
+        {
+            return false;
+        }
+        decision = it->second;
+        return true;
+    }
+
+    void insert(
+            Check check,
+            uint32_t domain_id,
+            const std::string& topic_name,
+            const std::vector<std::string>& partitions,
+            const Decision& decision)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        // Bound the memory used with endpoints on lots of different topics or partitions
+        if (decisions_.size() >= max_decisions)
+        {
+            decisions_.clear();
+        }
+        decisions_[std::make_tuple(check, domain_id, topic_name, partitions)] = decision;
+    }
+
+    void clear()
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        decisions_.clear();
+    }
+
+private:
+
+    static constexpr size_t max_decisions = 4096;
+
+    using Key = std::tuple<Check, uint32_t, std::string, std::vector<std::string>>;
+
+    mutable std::mutex mutex_;
+    std::map<Key, Decision> decisions_;
+};
+
+} //namespace security
+} //namespace rtps
+} //namespace fastrtps
+} //namespace eprosima
+
+#endif // __SECURITY_ACCESSCONTROL_PERMISSIONSMATCHER_H__
@@ -0,0 +1,91 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ShardedCounter.hpp
+ */
+
+#ifndef _STATISTICS_RTPS_SHARDEDCOUNTER_HPP_
+#define _STATISTICS_RTPS_SHARDEDCOUNTER_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Monotonic counter split in cache-line sized shards.
+ * Each thread always increments the same shard, so concurrent increments from different threads do not
+ * contend on the same cache line. Increments and reads are wait-free.
+ */
+class ShardedCounter
+{
+public:
+
+    //! Number of shards. Threads are assigned to shards round-robin.
+    static constexpr size_t num_shards = 16u;
+
+    /**
+     * Increment the counter.
+     * @param value Amount to add.
+     */
+    void add(
+            uint64_t value) noexcept
+    {
+        shards_[shard_index()].value.fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @return the current value of the counter.
+     * It is the sum of all the shards, so increments happening concurrently may or may not be included.
+     */
+    uint64_t load() const noexcept
+    {
+        uint64_t ret = 0u;
+        for (const Shard& shard : shards_)
+        {
+            ret += shard.value.load(std::memory_order_relaxed);
+        }
+        return ret;
+    }
+
+private:
+
+    static constexpr size_t cache_line_size = 64u;
+
+    struct Shard
+    {
+        std::atomic<uint64_t> value{0u};
+        char padding[cache_line_size - sizeof(std::atomic<uint64_t>)];
+    };
+
+    static size_t shard_index() noexcept
+    {
+        static std::atomic<size_t> next_index{0u};
+        static thread_local size_t index = next_index.fetch_add(1u, std::memory_order_relaxed) % num_shards;
+        return index;
+    }
+
+    std::array<Shard, num_shards> shards_;
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _STATISTICS_RTPS_SHARDEDCOUNTER_HPP_
@@ -0,0 +1,185 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsAggregator.hpp
+ */
+
+#ifndef _STATISTICS_RTPS_STATISTICSAGGREGATOR_HPP_
+#define _STATISTICS_RTPS_STATISTICSAGGREGATOR_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/statistics/IListeners.hpp>
+
+#include <statistics/types/types.h>
+#include <utils/thread.hpp>
+#include <utils/threading.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace statistics {
+
+/**
+ * Thread periodically asking a set of sources to publish the statistics they have aggregated.
+ * Sources only record events on the hot path, and the listeners are called from this thread.
+ */
+class StatisticsAggregator
+{
+public:
+
+    using ListenerCollection = std::set<std::shared_ptr<IListener>>;
+
+    //! Statistics data to be given to a set of listeners.
+    struct Notification
+    {
+        std::shared_ptr<const ListenerCollection> listeners;
+        Data data;
+    };
+
+    //! Interface of the objects aggregating statistics events.
+    class Source
+    {
+    public:
+
+        virtual ~Source() = default;
+
+        /**
+         * Called periodically from the aggregator thread to collect the events recorded since the previous call.
+         * The aggregator is locked meanwhile, so it should not call the listeners, but add the data they should be
+         * notified with.
+         * @param notifications Vector where the notifications are added.
+         */
+        virtual void collect_aggregated(
+                std::vector<Notification>& notifications) = 0;
+    };
+
+    /**
+     * Constructor. Starts the aggregator thread.
+     * @param period         Time between two consecutive publications.
+     * @param participant_id Identifier of the participant, used to name the thread.
+     */
+    StatisticsAggregator(
+            std::chrono::milliseconds period,
+            uint32_t participant_id)
+        : period_(period)
+    {
+        thread_ = create_thread([this]()
+                        {
+                            run();
+                        }, fastdds::rtps::ThreadSettings{}, "dds.stats.%u", participant_id);
+    }
+
+    //! Destructor. Publishes pending events and stops the aggregator thread.
+    ~StatisticsAggregator()
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stop_ = true;
+        }
+        cv_.notify_all();
+        if (thread_.joinable())
+        {
+            thread_.join();
+        }
+    }
+
+    StatisticsAggregator(
+            const StatisticsAggregator&) = delete;
+    StatisticsAggregator& operator =(
+            const StatisticsAggregator&) = delete;
+
+    /**
+     * Add a source to be published periodically.
+     * @param source Source to add. Should be unregistered before being destroyed.
+     */
+    void register_source(
+            Source* source)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sources_.push_back(source);
+    }
+
+    /**
+     * Remove a source. When this method returns, the source is not being collected and will not be anymore.
+     * Its listeners may still be notified of the data collected before.
+     * @param source Source to remove.
+     */
+    void unregister_source(
+            Source* source)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sources_.erase(std::remove(sources_.begin(), sources_.end(), source), sources_.end());
+    }
+
+    //! @return the time between two consecutive publications.
+    std::chrono::milliseconds period() const
+    {
+        return period_;
+    }
+
+private:
+
+    void run()
+    {
+        std::vector<Notification> notifications;
+        std::unique_lock<std::mutex> lock(mutex_);
+        bool stopping = false;
+        while (!stopping)
+        {
+            stopping = cv_.wait_for(lock, period_, [this]()
+                            {
+                                return stop_;
+                            });
+
+            for (Source* source : sources_)
+            {
+                source->collect_aggregated(notifications);
+            }
+
+            // Listeners are called unlocked, so they do not delay the registration of sources
+            lock.unlock();
+            for (const Notification& notification : notifications)
+            {
+                for (const std::shared_ptr<IListener>& listener : *notification.listeners)
+                {
+                    listener->on_statistics_data(notification.data);
+                }
+            }
+            notifications.clear();
+            lock.lock();
+        }
+    }
+
+    std::chrono::milliseconds period_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_ = false;
+    std::vector<Source*> sources_;
+    eprosima::thread thread_;
+};
+
+} // namespace statistics
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // _STATISTICS_RTPS_STATISTICSAGGREGATOR_HPP_
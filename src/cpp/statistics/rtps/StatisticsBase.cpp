@@ -21,6 +21,7 @@
 #include <cmath>
 
 #include <algorithm>
+#include <cstdlib>
 #include <string>
 
 #include <fastdds/dds/log/Log.hpp>
@@ -115,8 +116,16 @@ bool StatisticsListenersImpl::add_statistics_listener_impl(
 
     std::lock_guard<fastrtps::RecursiveTimedMutex> lock(get_statistics_mutex());
 
-    // add the new listener
-    return members_->listeners.insert(listener).second;
+    // add the new listener on a copy, which replaces the collection being traversed
+    auto listeners = std::make_shared<StatisticsAncillary::ListenerCollection>(*members_->listeners);
+    if (!listeners->insert(listener).second)
+    {
+        return false;
+    }
+
+    std::shared_ptr<const StatisticsAncillary::ListenerCollection> snapshot = std::move(listeners);
+    std::atomic_store(&members_->listeners, snapshot);
+    return true;
 }
 
 bool StatisticsListenersImpl::remove_statistics_listener_impl(
@@ -130,13 +139,21 @@ bool StatisticsListenersImpl::remove_statistics_listener_impl(
         return false;
     }
 
-    return 1 == members_->listeners.erase(listener);
+    // remove the listener on a copy, which replaces the collection being traversed
+    auto listeners = std::make_shared<StatisticsAncillary::ListenerCollection>(*members_->listeners);
+    if (1 != listeners->erase(listener))
+    {
+        return false;
+    }
+
+    std::shared_ptr<const StatisticsAncillary::ListenerCollection> snapshot = std::move(listeners);
+    std::atomic_store(&members_->listeners, snapshot);
+    return true;
 }
 
 void StatisticsListenersImpl::set_enabled_statistics_writers_mask_impl(
         uint32_t enabled_writers)
 {
-    std::unique_lock<fastrtps::RecursiveTimedMutex> lock(get_statistics_mutex());
     if (members_)
     {
         members_->enabled_writers_mask.store(enabled_writers);
@@ -146,16 +163,36 @@ void StatisticsListenersImpl::set_enabled_statistics_writers_mask_impl(
 bool StatisticsListenersImpl::are_statistics_writers_enabled(
         uint32_t checked_enabled_writers)
 {
-    // Check if the corresponding writer is enabled
-    std::unique_lock<fastrtps::RecursiveTimedMutex> lock(get_statistics_mutex());
+    // Check if the corresponding writer is enabled. The auxiliary members live as long as the endpoint.
     if (members_)
     {
         // Casting a number other than 1 to bool is not guaranteed to yield true
-        return (0 != (members_->enabled_writers_mask & checked_enabled_writers));
+        return (0 != (members_->enabled_writers_mask.load(std::memory_order_relaxed) & checked_enabled_writers));
     }
     return false;
 }
 
+void StatisticsListenersImpl::set_statistics_aggregator_impl(
+        std::shared_ptr<StatisticsAggregator> aggregator)
+{
+    std::lock_guard<fastrtps::RecursiveTimedMutex> lock(get_statistics_mutex());
+
+    if (!members_ || !aggregator || members_->aggregator)
+    {
+        return;
+    }
+
+    members_->guid = get_guid();
+    members_->aggregator = aggregator;
+    members_->aggregated.store(true);
+    aggregator->register_source(members_.get());
+}
+
+bool StatisticsListenersImpl::is_statistics_aggregated() const
+{
+    return members_ && members_->aggregated.load(std::memory_order_relaxed);
+}
+
 const eprosima::fastrtps::rtps::GUID_t& StatisticsParticipantImpl::get_guid() const
 {
     using eprosima::fastrtps::rtps::RTPSParticipantImpl;
@@ -363,6 +400,30 @@ bool StatisticsParticipantImpl::remove_statistics_listener(
            && ((old_mask & mask) == mask); // return false if there were unregistered entities
 }
 
+void StatisticsParticipantImpl::init_statistics_aggregator(
+        const fastrtps::rtps::PropertyPolicy& properties,
+        uint32_t participant_id)
+{
+    const std::string* period_property = fastrtps::rtps::PropertyPolicyHelper::find_property(
+        properties, dds::parameter_statistics_aggregation_period);
+    if (nullptr == period_property)
+    {
+        return;
+    }
+
+    long period_ms = std::strtol(period_property->c_str(), nullptr, 10);
+    if (0 < period_ms)
+    {
+        statistics_aggregator_ = std::make_shared<StatisticsAggregator>(
+            std::chrono::milliseconds(period_ms), participant_id);
+    }
+    else
+    {
+        EPROSIMA_LOG_WARNING(RTPS_PARTICIPANT, "Ignoring invalid statistics aggregation period '"
+                << *period_property << "'");
+    }
+}
+
 void StatisticsParticipantImpl::set_enabled_statistics_writers_mask(
         uint32_t enabled_writers)
 {
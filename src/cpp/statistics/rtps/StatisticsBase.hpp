@@ -20,12 +20,16 @@
 #define _STATISTICS_RTPS_STATISTICSBASE_HPP_
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <vector>
 
 #include <fastrtps/config.h>
 
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
 #include <fastdds/rtps/common/Guid.h>
 #include <fastdds/rtps/common/Locator.h>
 #include <fastdds/rtps/common/SampleIdentity.h>
@@ -33,6 +37,8 @@
 #include <fastrtps/qos/ParameterTypes.h>
 #include <statistics/rtps/GuidUtils.hpp>
 #include <statistics/rtps/messages/RTPSStatisticsMessages.hpp>
+#include <statistics/rtps/ShardedCounter.hpp>
+#include <statistics/rtps/StatisticsAggregator.hpp>
 #include <statistics/types/types.h>
 
 
@@ -53,24 +59,85 @@ namespace statistics {
 
 // RTPSWriter and RTPSReader statistics members
 struct StatisticsAncillary
+    : public StatisticsAggregator::Source
 {
-    std::set<std::shared_ptr<IListener>> listeners;
+    using ListenerCollection = StatisticsAggregator::ListenerCollection;
+    using Notification = StatisticsAggregator::Notification;
+
+    // Snapshot of the registered listeners. It is never modified, but replaced by a new one (copy on write), so
+    // the events can traverse it without taking the endpoint mutex.
+    std::shared_ptr<const ListenerCollection> listeners = std::make_shared<const ListenerCollection>();
     std::atomic<uint32_t> enabled_writers_mask{0};
+
+    // Aggregated mode: the events are only recorded, and published periodically by the aggregator
+    std::shared_ptr<StatisticsAggregator> aggregator;
+    std::atomic<bool> aggregated{false};
+    std::atomic<uint32_t> pending_events{0};
+    fastrtps::rtps::GUID_t guid;
+
+    void collect_aggregated(
+            std::vector<Notification>&) override
+    {
+    }
+
+    /**
+     * Stop being published by the aggregator.
+     * Should be called from the destructor of the derived structures, before the data used by
+     * collect_aggregated() is destroyed.
+     */
+    void stop_aggregation()
+    {
+        if (aggregator)
+        {
+            aggregator->unregister_source(this);
+            aggregator.reset();
+        }
+    }
+
 };
 
 struct StatisticsWriterAncillary
     : public StatisticsAncillary
 {
-    unsigned long long data_counter = {};
-    unsigned long long gap_counter = {};
-    unsigned long long resent_counter = {};
+    ShardedCounter data_counter;
+    std::atomic<uint64_t> gap_counter{0};
+    std::atomic<uint64_t> resent_counter{0};
     std::chrono::time_point<std::chrono::steady_clock> last_history_change_ = std::chrono::steady_clock::now();
+
+    // Aggregated mode members
+    std::atomic<uint32_t> heartbeat_count{0};
+    ShardedCounter published_bytes;
+    uint64_t last_published_bytes = 0;
+    std::chrono::time_point<std::chrono::steady_clock> last_publication = std::chrono::steady_clock::now();
+
+    ~StatisticsWriterAncillary()
+    {
+        stop_aggregation();
+    }
+
+    void collect_aggregated(
+            std::vector<Notification>& notifications) override;
 };
 
 struct StatisticsReaderAncillary
     : public StatisticsAncillary
 {
     std::chrono::time_point<std::chrono::steady_clock> last_history_change_ = std::chrono::steady_clock::now();
+
+    // Aggregated mode members
+    std::atomic<int32_t> acknack_count{0};
+    std::atomic<int32_t> nackfrag_count{0};
+    ShardedCounter received_bytes;
+    uint64_t last_received_bytes = 0;
+    std::chrono::time_point<std::chrono::steady_clock> last_publication = std::chrono::steady_clock::now();
+
+    ~StatisticsReaderAncillary()
+    {
+        stop_aggregation();
+    }
+
+    void collect_aggregated(
+            std::vector<Notification>& notifications) override;
 };
 
 // lambda function to traverse the listener collection
@@ -78,14 +145,13 @@ template<class Function>
 Function StatisticsListenersImpl::for_each_listener(
         Function f)
 {
-    // Use a collection copy to prevent locking on traversal
-    std::unique_lock<fastrtps::RecursiveTimedMutex> lock(get_statistics_mutex());
+    // Traverse the current snapshot, which is replaced instead of modified, to prevent locking on traversal
     if (members_)
     {
-        auto listeners = members_->listeners;
-        lock.unlock();
+        std::shared_ptr<const StatisticsAncillary::ListenerCollection> listeners =
+                std::atomic_load(&members_->listeners);
 
-        for (auto& listener : listeners)
+        for (auto& listener : *listeners)
         {
             f(listener);
         }
@@ -195,6 +261,18 @@ protected:
     using ProxyCollection = std::set<Key, CompareProxies>;
     ProxyCollection listeners_;
 
+    // Publishes the aggregated events of the endpoints. Only created when aggregation is configured.
+    std::shared_ptr<StatisticsAggregator> statistics_aggregator_;
+
+    /**
+     * Create the statistics aggregator when the aggregation period property is set to a positive value.
+     * @param properties     Participant properties.
+     * @param participant_id Identifier of the participant, used to name the aggregator thread.
+     */
+    void init_statistics_aggregator(
+            const fastrtps::rtps::PropertyPolicy& properties,
+            uint32_t participant_id);
+
     // retrieve the participant mutex
     std::recursive_mutex& get_statistics_mutex();
 
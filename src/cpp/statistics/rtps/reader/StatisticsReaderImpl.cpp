@@ -101,6 +101,14 @@ void StatisticsReaderImpl::on_acknack(
         return;
     }
 
+    if (is_statistics_aggregated())
+    {
+        auto members = get_members();
+        members->acknack_count.store(count, std::memory_order_relaxed);
+        members->pending_events.fetch_or(EventKindBits::ACKNACK_COUNT, std::memory_order_relaxed);
+        return;
+    }
+
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
     notification.count(count);
@@ -125,6 +133,14 @@ void StatisticsReaderImpl::on_nackfrag(
         return;
     }
 
+    if (is_statistics_aggregated())
+    {
+        auto members = get_members();
+        members->nackfrag_count.store(count, std::memory_order_relaxed);
+        members->pending_events.fetch_or(EventKindBits::NACKFRAG_COUNT, std::memory_order_relaxed);
+        return;
+    }
+
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
     notification.count(count);
@@ -153,6 +169,15 @@ void StatisticsReaderImpl::on_subscribe_throughput(
         {
             return;
         }
+
+        if (is_statistics_aggregated())
+        {
+            auto members = get_members();
+            members->received_bytes.add(payload);
+            members->pending_events.fetch_or(EventKindBits::SUBSCRIPTION_THROUGHPUT, std::memory_order_relaxed);
+            return;
+        }
+
         // update state
         time_point<steady_clock> former_timepoint;
         auto& current_timepoint = get_members()->last_history_change_;
@@ -179,6 +204,64 @@ void StatisticsReaderImpl::on_subscribe_throughput(
     }
 }
 
+void StatisticsReaderAncillary::collect_aggregated(
+        std::vector<Notification>& notifications)
+{
+    using namespace std::chrono;
+
+    uint32_t pending = pending_events.exchange(0) & enabled_writers_mask.load();
+    if (0 == pending)
+    {
+        return;
+    }
+
+    // The listeners are called by the aggregator once it is unlocked
+    std::shared_ptr<const ListenerCollection> snapshot = std::atomic_load(&listeners);
+    auto notify = [&notifications, &snapshot](Data&& data)
+            {
+                notifications.push_back({snapshot, std::move(data)});
+            };
+
+    auto notify_count = [this, &notify](EventKind kind, int32_t count)
+            {
+                EntityCount notification;
+                notification.guid(to_statistics_type(guid));
+                notification.count(count);
+
+                Data data;
+                data.entity_count(std::move(notification));
+                data._d(kind);
+                notify(std::move(data));
+            };
+
+    if (0 != (pending & EventKindBits::ACKNACK_COUNT))
+    {
+        notify_count(EventKindBits::ACKNACK_COUNT, acknack_count.load());
+    }
+    if (0 != (pending & EventKindBits::NACKFRAG_COUNT))
+    {
+        notify_count(EventKindBits::NACKFRAG_COUNT, nackfrag_count.load());
+    }
+    if (0 != (pending & EventKindBits::SUBSCRIPTION_THROUGHPUT))
+    {
+        // Throughput over the bytes received since the previous report
+        auto now = steady_clock::now();
+        uint64_t bytes = received_bytes.load();
+
+        EntityData notification;
+        notification.guid(to_statistics_type(guid));
+        notification.data((bytes - last_received_bytes) / duration_cast<duration<float>>(
+                    now - last_publication).count());
+        last_received_bytes = bytes;
+        last_publication = now;
+
+        Data data;
+        data.entity_data(std::move(notification));
+        data._d(EventKindBits::SUBSCRIPTION_THROUGHPUT);
+        notify(std::move(data));
+    }
+}
+
 }  // namespace statistics
 }  // namespace fastdds
 }  // namespace eprosima
@@ -90,9 +90,7 @@ void StatisticsWriterImpl::on_sample_datas(
 void StatisticsWriterImpl::on_data_generated(
         size_t num_destinations)
 {
-    std::lock_guard<fastrtps::RecursiveTimedMutex> lock(get_statistics_mutex());
-    auto members = get_members();
-    members->data_counter += static_cast<uint64_t>(num_destinations);
+    get_members()->data_counter.add(static_cast<uint64_t>(num_destinations));
 }
 
 void StatisticsWriterImpl::on_data_sent()
@@ -102,15 +100,17 @@ void StatisticsWriterImpl::on_data_sent()
         return;
     }
 
-    EntityCount notification;
-    notification.guid(to_statistics_type(get_guid()));
-
+    auto members = get_members();
+    if (is_statistics_aggregated())
     {
-        std::lock_guard<fastrtps::RecursiveTimedMutex> lock(get_statistics_mutex());
-        auto members = get_members();
-        notification.count(members->data_counter);
+        members->pending_events.fetch_or(EventKindBits::DATA_COUNT, std::memory_order_relaxed);
+        return;
     }
 
+    EntityCount notification;
+    notification.guid(to_statistics_type(get_guid()));
+    notification.count(members->data_counter.load());
+
     // Perform the callbacks
     Data data;
     // note that the setter sets RESENT_DATAS by default
@@ -131,6 +131,14 @@ void StatisticsWriterImpl::on_heartbeat(
         return;
     }
 
+    if (is_statistics_aggregated())
+    {
+        auto members = get_members();
+        members->heartbeat_count.store(count, std::memory_order_relaxed);
+        members->pending_events.fetch_or(EventKindBits::HEARTBEAT_COUNT, std::memory_order_relaxed);
+        return;
+    }
+
     EntityCount notification;
     notification.guid(to_statistics_type(get_guid()));
     notification.count(count);
@@ -154,14 +162,18 @@ void StatisticsWriterImpl::on_gap()
         return;
     }
 
-    EntityCount notification;
-    notification.guid(to_statistics_type(get_guid()));
-
+    auto members = get_members();
+    uint64_t count = ++members->gap_counter;
+    if (is_statistics_aggregated())
     {
-        std::lock_guard<fastrtps::RecursiveTimedMutex> lock(get_statistics_mutex());
-        notification.count(++get_members()->gap_counter);
+        members->pending_events.fetch_or(EventKindBits::GAP_COUNT, std::memory_order_relaxed);
+        return;
     }
 
+    EntityCount notification;
+    notification.guid(to_statistics_type(get_guid()));
+    notification.count(count);
+
     // Perform the callbacks
     Data data;
     // note that the setter sets RESENT_DATAS by default
@@ -187,14 +199,18 @@ void StatisticsWriterImpl::on_resent_data(
         return;
     }
 
-    EntityCount notification;
-    notification.guid(to_statistics_type(get_guid()));
-
+    auto members = get_members();
+    uint64_t count = members->resent_counter += to_send;
+    if (is_statistics_aggregated())
     {
-        std::lock_guard<fastrtps::RecursiveTimedMutex> lock(get_statistics_mutex());
-        notification.count(get_members()->resent_counter += to_send);
+        members->pending_events.fetch_or(EventKindBits::RESENT_DATAS, std::memory_order_relaxed);
+        return;
     }
 
+    EntityCount notification;
+    notification.guid(to_statistics_type(get_guid()));
+    notification.count(count);
+
     // Perform the callbacks
     Data data;
     // note that the setter sets RESENT_DATAS by default
@@ -219,6 +235,14 @@ void StatisticsWriterImpl::on_publish_throughput(
             return;
         }
 
+        if (is_statistics_aggregated())
+        {
+            auto members = get_members();
+            members->published_bytes.add(payload);
+            members->pending_events.fetch_or(EventKindBits::PUBLICATION_THROUGHPUT, std::memory_order_relaxed);
+            return;
+        }
+
         // update state
         time_point<steady_clock> former_timepoint;
         auto& current_timepoint = get_members()->last_history_change_;
@@ -244,6 +268,72 @@ void StatisticsWriterImpl::on_publish_throughput(
     }
 }
 
+void StatisticsWriterAncillary::collect_aggregated(
+        std::vector<Notification>& notifications)
+{
+    using namespace std::chrono;
+
+    uint32_t pending = pending_events.exchange(0) & enabled_writers_mask.load();
+    if (0 == pending)
+    {
+        return;
+    }
+
+    // The listeners are called by the aggregator once it is unlocked
+    std::shared_ptr<const ListenerCollection> snapshot = std::atomic_load(&listeners);
+    auto notify = [&notifications, &snapshot](Data&& data)
+            {
+                notifications.push_back({snapshot, std::move(data)});
+            };
+
+    auto notify_count = [this, &notify](EventKind kind, uint64_t count)
+            {
+                EntityCount notification;
+                notification.guid(to_statistics_type(guid));
+                notification.count(count);
+
+                Data data;
+                data.entity_count(std::move(notification));
+                data._d(kind);
+                notify(std::move(data));
+            };
+
+    if (0 != (pending & EventKindBits::DATA_COUNT))
+    {
+        notify_count(EventKindBits::DATA_COUNT, data_counter.load());
+    }
+    if (0 != (pending & EventKindBits::HEARTBEAT_COUNT))
+    {
+        notify_count(EventKindBits::HEARTBEAT_COUNT, heartbeat_count.load());
+    }
+    if (0 != (pending & EventKindBits::GAP_COUNT))
+    {
+        notify_count(EventKindBits::GAP_COUNT, gap_counter.load());
+    }
+    if (0 != (pending & EventKindBits::RESENT_DATAS))
+    {
+        notify_count(EventKindBits::RESENT_DATAS, resent_counter.load());
+    }
+    if (0 != (pending & EventKindBits::PUBLICATION_THROUGHPUT))
+    {
+        // Throughput over the bytes published since the previous report
+        auto now = steady_clock::now();
+        uint64_t bytes = published_bytes.load();
+
+        EntityData notification;
+        notification.guid(to_statistics_type(guid));
+        notification.data((bytes - last_published_bytes) / duration_cast<duration<float>>(
+                    now - last_publication).count());
+        last_published_bytes = bytes;
+        last_publication = now;
+
+        Data data;
+        // note that the setter sets PUBLICATION_THROUGHPUT by default
+        data.entity_data(std::move(notification));
+        notify(std::move(data));
+    }
+}
+
 }  // namespace statistics
 }  // namespace fastdds
 }  // namespace eprosima
@@ -0,0 +1,303 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BitmapRing.hpp
+ */
+
+#ifndef FASTDDS_UTILS_COLLECTIONS__BITMAPRING_HPP
+#define FASTDDS_UTILS_COLLECTIONS__BITMAPRING_HPP
+
+#include <array>
+#include <cstdint>
+
+#if _MSC_VER
+#include <intrin.h>
+#endif // if _MSC_VER
+
+namespace eprosima {
+namespace utilities {
+namespace collections {
+
+/**
+ * Fixed-size bitmap tracking which positions of a sliding window [base, base + NBITS) are set.
+ *
+ * Positions are mapped to bits modulo NBITS, so moving the window forward only needs to clear the bits
+ * of the positions leaving it, and no shifting of the bitmap is ever performed.
+ * No memory is allocated after construction.
+ *
+ * @tparam NBITS Size of the window. Should be a power of two, and a multiple of 32.
+ */
+template<uint32_t NBITS>
+class BitmapRing
+{
+    static_assert(NBITS >= 32u && (NBITS & (NBITS - 1u)) == 0u, "NBITS should be a power of two >= 32");
+
+public:
+
+    //! Number of positions tracked by the window.
+    static constexpr uint32_t capacity = NBITS;
+
+    /**
+     * Clears the bitmap and moves the window to start on a position.
+     * @param base First position of the window.
+     */
+    void reset(
+            uint64_t base) noexcept
+    {
+        bitmap_.fill(0u);
+        base_ = base;
+    }
+
+    //! @return the first position of the window.
+    uint64_t base() const noexcept
+    {
+        return base_;
+    }
+
+    //! @return whether a position falls inside the window.
+    bool in_range(
+            uint64_t pos) const noexcept
+    {
+        return pos >= base_ && (pos - base_) < NBITS;
+    }
+
+    /**
+     * Sets the bit of a position inside the window.
+     * @param pos Position to set. Should be in range.
+     * @return false if the position was already set.
+     */
+    bool set(
+            uint64_t pos) noexcept
+    {
+        uint32_t& word = bitmap_[word_index(pos)];
+        uint32_t mask = bit_mask(pos);
+        if (0u != (word & mask))
+        {
+            return false;
+        }
+        word |= mask;
+        return true;
+    }
+
+    //! @return whether a position is inside the window and set.
+    bool is_set(
+            uint64_t pos) const noexcept
+    {
+        return in_range(pos) && (0u != (bitmap_[word_index(pos)] & bit_mask(pos)));
+    }
+
+    /**
+     * Moves the window forward while its first position is set, clearing the positions skipped.
+     * @return the new base of the window.
+     */
+    uint64_t advance_while_set() noexcept
+    {
+        for (;;)
+        {
+            uint32_t offset = bit_offset(base_);
+            uint32_t& word = bitmap_[word_index(base_)];
+            uint32_t ones = count_trailing_zeros(~(word >> offset));
+            if (0u == ones)
+            {
+                break;
+            }
+
+            // Only the bits of the current word are consumed on each iteration
+            if (ones > 32u - offset)
+            {
+                ones = 32u - offset;
+            }
+            word &= ~(range_mask(ones) << offset);
+            base_ += ones;
+        }
+        return base_;
+    }
+
+    /**
+     * Moves the window forward so it starts on a given position, clearing the positions left behind.
+     * @param new_base New first position of the window. Nothing is done if it is not greater than the current base.
+     * @return the number of set positions that were left behind.
+     */
+    uint64_t advance_to(
+            uint64_t new_base) noexcept
+    {
+        uint64_t n_set = 0u;
+        if (new_base <= base_)
+        {
+            return n_set;
+        }
+
+        if (new_base - base_ >= NBITS)
+        {
+            for (uint32_t& word : bitmap_)
+            {
+                n_set += count_ones(word);
+                word = 0u;
+            }
+            base_ = new_base;
+            return n_set;
+        }
+
+        while (base_ < new_base)
+        {
+            uint32_t offset = bit_offset(base_);
+            uint64_t n_bits = new_base - base_;
+            if (n_bits > 32u - offset)
+            {
+                n_bits = 32u - offset;
+            }
+            uint32_t mask = range_mask(static_cast<uint32_t>(n_bits)) << offset;
+            uint32_t& word = bitmap_[word_index(base_)];
+            n_set += count_ones(word & mask);
+            word &= ~mask;
+            base_ += n_bits;
+        }
+        return n_set;
+    }
+
+    /**
+     * Looks for the first set position in a range.
+     * @param from  First position to check.
+     * @param limit Position after the last one to check. Positions beyond the window are never set.
+     * @return the first set position in [from, limit), or @c limit when there is none.
+     */
+    uint64_t find_next_set(
+            uint64_t from,
+            uint64_t limit) const noexcept
+    {
+        uint64_t end = base_ + NBITS;
+        if (limit < end)
+        {
+            end = limit;
+        }
+        if (from < base_)
+        {
+            from = base_;
+        }
+
+        while (from < end)
+        {
+            uint32_t offset = bit_offset(from);
+            uint32_t bits = bitmap_[word_index(from)] >> offset;
+            if (0u != bits)
+            {
+                uint64_t pos = from + count_trailing_zeros(bits);
+                return pos < end ? pos : limit;
+            }
+            from += 32u - offset;
+        }
+        return limit;
+    }
+
+    /**
+     * Counts the set positions in a range.
+     * @param from  First position to check.
+     * @param limit Position after the last one to check. Positions beyond the window are never set.
+     * @return the number of set positions in [from, limit).
+     */
+    uint64_t count_set(
+            uint64_t from,
+            uint64_t limit) const noexcept
+    {
+        uint64_t end = base_ + NBITS;
+        if (limit < end)
+        {
+            end = limit;
+        }
+        if (from < base_)
+        {
+            from = base_;
+        }
+
+        uint64_t n_set = 0u;
+        while (from < end)
+        {
+            uint32_t offset = bit_offset(from);
+            uint64_t n_bits = end - from;
+            if (n_bits > 32u - offset)
+            {
+                n_bits = 32u - offset;
+            }
+            uint32_t mask = range_mask(static_cast<uint32_t>(n_bits)) << offset;
+            n_set += count_ones(bitmap_[word_index(from)] & mask);
+            from += n_bits;
+        }
+        return n_set;
+    }
+
+private:
+
+    static uint32_t word_index(
+            uint64_t pos) noexcept
+    {
+        return static_cast<uint32_t>(pos & (NBITS - 1u)) >> 5u;
+    }
+
+    static uint32_t bit_offset(
+            uint64_t pos) noexcept
+    {
+        return static_cast<uint32_t>(pos & 31u);
+    }
+
+    static uint32_t bit_mask(
+            uint64_t pos) noexcept
+    {
+        return 1u << bit_offset(pos);
+    }
+
+    //! @return a mask with the n_bits lower bits set.
+    static uint32_t range_mask(
+            uint32_t n_bits) noexcept
+    {
+        return n_bits >= 32u ? ~0u : ((1u << n_bits) - 1u);
+    }
+
+    //! @return the number of trailing zeros of a word, 32 for a zero word.
+    static uint32_t count_trailing_zeros(
+            uint32_t bits) noexcept
+    {
+        if (0u == bits)
+        {
+            return 32u;
+        }
+#if _MSC_VER
+        unsigned long bit;
+        _BitScanForward(&bit, bits);
+        return static_cast<uint32_t>(bit);
+#else
+        return static_cast<uint32_t>(__builtin_ctz(bits));
+#endif // if _MSC_VER
+    }
+
+    static uint32_t count_ones(
+            uint32_t bits) noexcept
+    {
+        uint32_t n = 0u;
+        for (; 0u != bits; bits &= bits - 1u)
+        {
+            ++n;
+        }
+        return n;
+    }
+
+    std::array<uint32_t, NBITS / 32u> bitmap_ {};
+    uint64_t base_ = 0u;
+};
+
+} // namespace collections
+} // namespace utilities
+} // namespace eprosima
+
+#endif // FASTDDS_UTILS_COLLECTIONS__BITMAPRING_HPP
@@ -0,0 +1,47 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef UTILS__CPU_RELAX_HPP_
+#define UTILS__CPU_RELAX_HPP_
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#elif defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#else
+#include <thread>
+#endif // Architecture selection
+
+namespace eprosima {
+
+/**
+ * @brief Hint the processor that the calling thread is inside a busy-wait loop.
+ *
+ * Lowers the power consumption of the loop and the penalty paid when leaving it, and lets the sibling
+ * hardware thread make progress. On architectures without a pause instruction, the thread yields.
+ */
+inline void cpu_relax()
+{
+#if defined(_M_X64) || defined(_M_IX86) || defined(__x86_64__) || defined(__i386__)
+    _mm_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    __asm__ __volatile__ ("yield");
+#else
+    std::this_thread::yield();
+#endif // Architecture selection
+}
+
+} // eprosima
+
+#endif  // UTILS__CPU_RELAX_HPP_
@@ -0,0 +1,160 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file FixedSizeBlockArena.hpp
+ */
+
+#ifndef FASTDDS_UTILS_MEMORY__FIXEDSIZEBLOCKARENA_HPP
+#define FASTDDS_UTILS_MEMORY__FIXEDSIZEBLOCKARENA_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <vector>
+
+#include <utils/memory/MemoryPlacement.hpp>
+
+namespace eprosima {
+namespace utilities {
+namespace memory {
+
+/**
+ * Hands out blocks of a fixed size, carved from big memory regions mapped with the requested placement.
+ * Memory is only returned to the system when the arena is destroyed.
+ * Blocks are zero-filled when handed out.
+ *
+ * This class is not thread-safe.
+ */
+class FixedSizeBlockArena
+{
+public:
+
+    /**
+     * Constructor.
+     * @param block_size Size of each block, in bytes. It will be rounded up to keep blocks aligned.
+     * @param placement  Placement requirements of the mapped regions.
+     */
+    FixedSizeBlockArena(
+            size_t block_size,
+            const MemoryPlacement& placement)
+        : block_size_((block_size + alignof(std::max_align_t) - 1) & ~(alignof(std::max_align_t) - 1))
+        , placement_(placement)
+    {
+    }
+
+    ~FixedSizeBlockArena()
+    {
+        for (const Region& region : regions_)
+        {
+            unmap_placed_memory(region.address, region.size);
+        }
+    }
+
+    FixedSizeBlockArena(
+            const FixedSizeBlockArena&) = delete;
+    FixedSizeBlockArena& operator =(
+            const FixedSizeBlockArena&) = delete;
+
+    /**
+     * Ensures at least @c num_blocks blocks can be allocated without mapping more memory.
+     * Blocks for the whole request are mapped in a single region.
+     * @return false if the memory could not be mapped.
+     */
+    bool reserve(
+            size_t num_blocks)
+    {
+        size_t available = fresh_blocks_.size() + free_blocks_.size();
+        if (available >= num_blocks)
+        {
+            return true;
+        }
+
+        size_t size = (num_blocks - available) * block_size_;
+        void* address = map_placed_memory(size, placement_);
+        if (nullptr == address)
+        {
+            return false;
+        }
+
+        regions_.push_back({address, size});
+        unsigned char* block = static_cast<unsigned char*>(address);
+        // Blocks are handed out from the back, so push them in reverse order to use the region sequentially
+        for (size_t i = size / block_size_; i > 0; --i)
+        {
+            fresh_blocks_.push_back(block + (i - 1) * block_size_);
+        }
+        return true;
+    }
+
+    /**
+     * Allocates a zero-filled block.
+     * @return Pointer to the block, nullptr if no memory could be mapped.
+     */
+    void* allocate()
+    {
+        if (!free_blocks_.empty())
+        {
+            void* block = free_blocks_.back();
+            free_blocks_.pop_back();
+            memset(block, 0, block_size_);
+            return block;
+        }
+
+        if (fresh_blocks_.empty() && !reserve(1u))
+        {
+            return nullptr;
+        }
+
+        // Fresh blocks come zero-filled from the system
+        void* block = fresh_blocks_.back();
+        fresh_blocks_.pop_back();
+        return block;
+    }
+
+    /**
+     * Returns a block to the arena.
+     * @param block Pointer returned by allocate().
+     */
+    void deallocate(
+            void* block)
+    {
+        free_blocks_.push_back(block);
+    }
+
+    //! @return the size of the blocks, after rounding.
+    size_t block_size() const
+    {
+        return block_size_;
+    }
+
+private:
+
+    struct Region
+    {
+        void* address;
+        size_t size;
+    };
+
+    size_t block_size_;
+    MemoryPlacement placement_;
+    std::vector<Region> regions_;
+    std::vector<void*> fresh_blocks_;
+    std::vector<void*> free_blocks_;
+};
+
+} // namespace memory
+} // namespace utilities
+} // namespace eprosima
+
+#endif // FASTDDS_UTILS_MEMORY__FIXEDSIZEBLOCKARENA_HPP
@@ -0,0 +1,254 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MemoryPlacement.hpp
+ */
+
+#ifndef FASTDDS_UTILS_MEMORY__MEMORYPLACEMENT_HPP
+#define FASTDDS_UTILS_MEMORY__MEMORYPLACEMENT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
+namespace eprosima {
+namespace utilities {
+namespace memory {
+
+/**
+ * Placement requirements for a memory region.
+ */
+struct MemoryPlacement
+{
+    //! Back the region with huge pages.
+    bool use_huge_pages = false;
+    //! Touch every page of the region when it is mapped.
+    bool prefault = false;
+    //! NUMA node to bind the region to. Negative means no binding.
+    int32_t numa_node = -1;
+
+    //! @return whether any placement requirement is set.
+    bool is_default() const
+    {
+        return !use_huge_pages && !prefault && numa_node < 0;
+    }
+
+};
+
+//! @return the size of the regular pages of the system.
+inline size_t page_size()
+{
+#if defined(__linux__)
+    long size = sysconf(_SC_PAGESIZE);
+    return size > 0 ? static_cast<size_t>(size) : 4096u;
+#else
+    return 4096u;
+#endif // if defined(__linux__)
+}
+
+//! @return the size of the default huge pages of the system, or 0 when they are not supported.
+inline size_t huge_page_size()
+{
+#if defined(__linux__)
+    static const size_t size = []() -> size_t
+            {
+                std::ifstream meminfo("/proc/meminfo");
+                std::string key;
+                while (meminfo >> key)
+                {
+                    if (key == "Hugepagesize:")
+                    {
+                        size_t kb = 0;
+                        meminfo >> kb;
+                        return kb * 1024u;
+                    }
+                    meminfo.ignore(256, '\n');
+                }
+                return 0u;
+            }();
+    return size;
+#else
+    return 0u;
+#endif // if defined(__linux__)
+}
+
+/**
+ * Applies the placement requirements to an already mapped memory region.
+ * Huge pages are requested with transparent huge page advice, as the region is already mapped.
+ * Only the pages fully contained in the region are affected.
+ *
+ * @param address  Start of the region.
+ * @param size     Size of the region, in bytes.
+ * @param placement Placement requirements.
+ *
+ * @return false if any of the requirements could not be applied.
+ */
+inline bool apply_memory_placement(
+        void* address,
+        size_t size,
+        const MemoryPlacement& placement)
+{
+    bool ret = true;
+
+#if defined(__linux__)
+    const uintptr_t page = page_size();
+    uintptr_t begin = (reinterpret_cast<uintptr_t>(address) + page - 1) & ~(page - 1);
+    uintptr_t end = (reinterpret_cast<uintptr_t>(address) + size) & ~(page - 1);
+
+    if (begin < end)
+    {
+#if defined(MADV_HUGEPAGE)
+        if (placement.use_huge_pages &&
+                0 != madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE))
+        {
+            ret = false;
+        }
+#endif // if defined(MADV_HUGEPAGE)
+
+#if defined(SYS_mbind)
+        if (placement.numa_node >= 0)
+        {
+            // MPOL_BIND = 2, MPOL_MF_MOVE = 2. Used directly to avoid depending on libnuma.
+            constexpr int mpol_bind = 2;
+            constexpr unsigned mpol_mf_move = 2u;
+            constexpr size_t bits_per_mask = sizeof(unsigned long) * 8u;
+            unsigned long node_mask[16] = {};
+            size_t node = static_cast<size_t>(placement.numa_node);
+            if (node < sizeof(node_mask) * 8u)
+            {
+                node_mask[node / bits_per_mask] = 1ul << (node % bits_per_mask);
+                if (0 != syscall(SYS_mbind, begin, end - begin, mpol_bind, node_mask,
+                        sizeof(node_mask) * 8u, mpol_mf_move))
+                {
+                    ret = false;
+                }
+            }
+            else
+            {
+                ret = false;
+            }
+        }
+#else
+        if (placement.numa_node >= 0)
+        {
+            ret = false;
+        }
+#endif // if defined(SYS_mbind)
+    }
+#else
+    ret = !placement.use_huge_pages && placement.numa_node < 0;
+#endif // if defined(__linux__)
+
+    if (placement.prefault)
+    {
+        // Writing a byte per page is enough to force the physical mapping of the whole region
+        volatile uint8_t* bytes = static_cast<volatile uint8_t*>(address);
+        const size_t page = page_size();
+        for (size_t offset = 0; offset < size; offset += page)
+        {
+            bytes[offset] = bytes[offset];
+        }
+    }
+
+    return ret;
+}
+
+/**
+ * Maps a zero-filled private memory region satisfying the placement requirements.
+ * When huge pages are requested, explicit huge pages are tried first, falling back to regular pages
+ * with transparent huge page advice when none are available.
+ *
+ * @param [in,out] size      Requested size. On return, the size actually mapped, which must be passed to
+ *                           unmap_placed_memory.
+ * @param [in]     placement Placement requirements.
+ *
+ * @return Start of the region, or nullptr on failure.
+ */
+inline void* map_placed_memory(
+        size_t& size,
+        const MemoryPlacement& placement)
+{
+#if defined(__linux__)
+    void* address = MAP_FAILED;
+
+#if defined(MAP_HUGETLB)
+    size_t huge_page = huge_page_size();
+    if (placement.use_huge_pages && 0u != huge_page)
+    {
+        size_t huge_size = (size + huge_page - 1) / huge_page * huge_page;
+        address = mmap(nullptr, huge_size, PROT_READ | PROT_WRITE,
+                        MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (MAP_FAILED != address)
+        {
+            size = huge_size;
+        }
+    }
+#endif // if defined(MAP_HUGETLB)
+
+    if (MAP_FAILED == address)
+    {
+        size_t page = page_size();
+        size = (size + page - 1) / page * page;
+        address = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if (MAP_FAILED == address)
+        {
+            return nullptr;
+        }
+    }
+
+    apply_memory_placement(address, size, placement);
+    return address;
+#else
+    void* address = calloc(size, 1u);
+    if (nullptr != address)
+    {
+        apply_memory_placement(address, size, placement);
+    }
+    return address;
+#endif // if defined(__linux__)
+}
+
+/**
+ * Unmaps a region returned by map_placed_memory.
+ *
+ * @param address Start of the region.
+ * @param size    Size returned by map_placed_memory.
+ */
+inline void unmap_placed_memory(
+        void* address,
+        size_t size)
+{
+#if defined(__linux__)
+    munmap(address, size);
+#else
+    static_cast<void>(size);
+    free(address);
+#endif // if defined(__linux__)
+}
+
+} // namespace memory
+} // namespace utilities
+} // namespace eprosima
+
+#endif // FASTDDS_UTILS_MEMORY__MEMORYPLACEMENT_HPP
@@ -0,0 +1,274 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ThreadLayout.hpp
+ */
+
+#ifndef FASTDDS_UTILS_THREADING__THREADLAYOUT_HPP
+#define FASTDDS_UTILS_THREADING__THREADLAYOUT_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/attributes/ThreadTopologyPolicy.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+/**
+ * Computes the affinity of the internal threads of a participant from its ThreadTopologyPolicy.
+ *
+ * The CPUs available to the participant are split between general threads (events, flow controllers, discovery
+ * server, etc.) and reception threads. Settings with an explicit affinity are never modified.
+ */
+class ThreadLayout
+{
+public:
+
+    //! Maximum number of CPUs that can be expressed on the affinity of a ThreadSettings.
+    static constexpr uint32_t max_cpus = 64u;
+
+    /**
+     * Builds the layout with the CPUs of the system, or of the NUMA node selected by the policy.
+     * @param policy Thread topology policy of the participant.
+     */
+    explicit ThreadLayout(
+            const ThreadTopologyPolicy& policy)
+        : ThreadLayout(policy, policy.is_default() ? std::vector<uint32_t>() : system_cpus(policy.numa_node))
+    {
+    }
+
+    /**
+     * Builds the layout with a given list of CPUs.
+     * @param policy Thread topology policy of the participant.
+     * @param cpus CPUs available to the participant.
+     */
+    ThreadLayout(
+            const ThreadTopologyPolicy& policy,
+            const std::vector<uint32_t>& cpus)
+        : policy_(policy)
+    {
+        std::vector<uint32_t> usable;
+        for (uint32_t cpu : cpus)
+        {
+            if (cpu < max_cpus)
+            {
+                usable.push_back(cpu);
+            }
+        }
+
+        if (policy_.isolate_receive_cores && usable.size() >= 2u)
+        {
+            size_t half = usable.size() / 2u;
+            general_cpus_.assign(usable.begin(), usable.begin() + half);
+            reception_cpus_.assign(usable.begin() + half, usable.end());
+        }
+        else
+        {
+            general_cpus_ = usable;
+            reception_cpus_ = usable;
+        }
+    }
+
+    //! @return whether the layout leaves the placement of the threads to the system.
+    bool is_default() const
+    {
+        return policy_.is_default() || general_cpus_.empty();
+    }
+
+    //! @return NUMA node selected by the policy, negative when none.
+    int32_t numa_node() const
+    {
+        return policy_.numa_node;
+    }
+
+    //! @return whether reception threads are pinned to a single CPU each.
+    bool auto_spread() const
+    {
+        return policy_.auto_spread && !reception_cpus_.empty();
+    }
+
+    //! @return affinity mask with the CPUs of general threads.
+    uint64_t general_mask() const
+    {
+        return cpu_mask(general_cpus_);
+    }
+
+    //! @return affinity mask with the CPUs of reception threads.
+    uint64_t reception_mask() const
+    {
+        return cpu_mask(reception_cpus_);
+    }
+
+    /**
+     * Settings for a general thread of the participant.
+     * @param settings Settings configured by the user.
+     * @return The settings with the affinity filled when they did not have one.
+     */
+    ThreadSettings general_thread(
+            const ThreadSettings& settings) const
+    {
+        ThreadSettings ret = settings;
+        if (!is_default() && 0 == ret.affinity)
+        {
+            ret.affinity = general_mask();
+        }
+        return ret;
+    }
+
+    /**
+     * Settings for the reception threads of the participant listening on the same port.
+     * @param settings Settings configured by the user.
+     * @param index Index of the first reception thread, used to select its CPU when spreading them.
+     * @param count Number of threads listening on the port. When spreading them, the settings get one CPU for each
+     * of them, so the transport can pin every thread to a different CPU.
+     * @return The settings with the affinity filled when they did not have one.
+     */
+    ThreadSettings reception_thread(
+            const ThreadSettings& settings,
+            size_t index,
+            size_t count = 1u) const
+    {
+        ThreadSettings ret = settings;
+        if (!is_default() && 0 == ret.affinity)
+        {
+            if (auto_spread())
+            {
+                for (size_t i = 0; i < count && i < reception_cpus_.size(); ++i)
+                {
+                    ret.affinity |= uint64_t(1) << reception_cpus_[(index + i) % reception_cpus_.size()];
+                }
+            }
+            else
+            {
+                ret.affinity = reception_mask();
+            }
+        }
+        return ret;
+    }
+
+    /**
+     * Parses a list of CPUs in the format used by the kernel (i.e. "0-3,8,10-11").
+     * @param list String to parse.
+     * @return The CPUs on the list. Malformed elements are ignored.
+     */
+    static std::vector<uint32_t> parse_cpu_list(
+            const std::string& list)
+    {
+        std::vector<uint32_t> cpus;
+        size_t pos = 0;
+        while (pos < list.size())
+        {
+            size_t end = list.find(',', pos);
+            if (std::string::npos == end)
+            {
+                end = list.size();
+            }
+
+            std::string item = list.substr(pos, end - pos);
+            size_t dash = item.find('-');
+            char* last = nullptr;
+            unsigned long first_cpu = std::strtoul(item.c_str(), &last, 10);
+            unsigned long last_cpu = first_cpu;
+            if (std::string::npos != dash)
+            {
+                last_cpu = std::strtoul(item.c_str() + dash + 1, &last, 10);
+            }
+            if (last != item.c_str() && first_cpu <= last_cpu)
+            {
+                for (unsigned long cpu = first_cpu; cpu <= last_cpu && cpu < max_cpus; ++cpu)
+                {
+                    cpus.push_back(static_cast<uint32_t>(cpu));
+                }
+            }
+
+            pos = end + 1;
+        }
+        return cpus;
+    }
+
+    /**
+     * CPUs of the system, or of a NUMA node.
+     * @param numa_node NUMA node whose CPUs are returned. Negative for all the online CPUs.
+     * @return List of CPUs, empty when they cannot be obtained.
+     */
+    static std::vector<uint32_t> system_cpus(
+            int32_t numa_node)
+    {
+#if defined(__APPLE__)
+        // Affinities are tags on MacOS, not CPU masks
+        static_cast<void>(numa_node);
+        return {};
+#else
+        std::string list;
+#if defined(__linux__)
+        std::ifstream file(numa_node < 0 ?
+                std::string("/sys/devices/system/cpu/online") :
+                "/sys/devices/system/node/node" + std::to_string(numa_node) + "/cpulist");
+        std::getline(file, list);
+        if (numa_node >= 0)
+        {
+            return parse_cpu_list(list);
+        }
+#else
+        if (numa_node >= 0)
+        {
+            return {};
+        }
+#endif // if defined(__linux__)
+
+        std::vector<uint32_t> cpus = parse_cpu_list(list);
+        if (cpus.empty())
+        {
+            uint32_t count = std::thread::hardware_concurrency();
+            for (uint32_t cpu = 0; cpu < count && cpu < max_cpus; ++cpu)
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        return cpus;
+#endif // if defined(__APPLE__)
+    }
+
+private:
+
+    static uint64_t cpu_mask(
+            const std::vector<uint32_t>& cpus)
+    {
+        uint64_t mask = 0;
+        for (uint32_t cpu : cpus)
+        {
+            mask |= uint64_t(1) << cpu;
+        }
+        return mask;
+    }
+
+    ThreadTopologyPolicy policy_;
+    std::vector<uint32_t> general_cpus_;
+    std::vector<uint32_t> reception_cpus_;
+};
+
+} // namespace rtps
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_UTILS_THREADING__THREADLAYOUT_HPP
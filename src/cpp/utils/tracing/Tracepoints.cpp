@@ -0,0 +1,319 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Tracepoints.cpp
+ */
+
+#include <utils/tracing/Tracepoints.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__) || defined(__APPLE__)
+#include <pthread.h>
+#endif // if defined(__linux__) || defined(__APPLE__)
+
+#include <utils/SystemInfo.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace tracing {
+
+using fastrtps::rtps::GUID_t;
+using fastrtps::rtps::SequenceNumber_t;
+
+namespace {
+
+//! Environment variable with the name of the file where the trace is dumped when the process exits
+constexpr const char* const trace_file_env_var = "FASTDDS_TRACE_FILE";
+
+//! Events kept by each thread. Must be a power of 2.
+constexpr uint64_t events_per_thread = 16384u;
+
+struct TraceEvent
+{
+    const char* name = nullptr;
+    int64_t begin_ns = 0;
+    int64_t duration_ns = 0;
+    GUID_t writer_guid;
+    SequenceNumber_t sequence_number;
+};
+
+/**
+ * Events recorded by a single thread.
+ * Only the owning thread writes on it, publishing each event by advancing the head.
+ */
+class TraceRing
+{
+public:
+
+    TraceRing(
+            uint32_t tid,
+            const std::string& thread_name)
+        : tid_(tid)
+        , thread_name_(thread_name)
+        , events_(events_per_thread)
+    {
+    }
+
+    void push(
+            const TraceEvent& event)
+    {
+        uint64_t head = head_.load(std::memory_order_relaxed);
+        events_[head & (events_per_thread - 1)] = event;
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    //! Copies the events still on the ring, from the oldest one
+    void snapshot(
+            std::vector<TraceEvent>& events) const
+    {
+        uint64_t head = head_.load(std::memory_order_acquire);
+        uint64_t first = head > events_per_thread ? head - events_per_thread : 0;
+        for (uint64_t i = first; i < head; ++i)
+        {
+            events.push_back(events_[i & (events_per_thread - 1)]);
+        }
+    }
+
+    uint32_t tid() const
+    {
+        return tid_;
+    }
+
+    const std::string& thread_name() const
+    {
+        return thread_name_;
+    }
+
+private:
+
+    uint32_t tid_;
+    std::string thread_name_;
+    std::vector<TraceEvent> events_;
+    std::atomic<uint64_t> head_{0};
+};
+
+std::string current_thread_name(
+        uint32_t tid)
+{
+    char name[32] = {0};
+#if defined(__linux__) || defined(__APPLE__)
+    pthread_getname_np(pthread_self(), name, sizeof(name));
+#endif // if defined(__linux__) || defined(__APPLE__)
+    if (0 == name[0])
+    {
+        std::snprintf(name, sizeof(name), "thread %u", tid);
+    }
+    return name;
+}
+
+//! Registry of the rings of all the threads that have recorded events
+class Tracer
+{
+public:
+
+    /**
+     * The tracer is never destroyed, so threads still running while the process exits may keep recording events.
+     * The trace file is written by a handler registered with std::atexit.
+     */
+    static Tracer& instance()
+    {
+        static Tracer* tracer = create();
+        return *tracer;
+    }
+
+    TraceRing& local_ring()
+    {
+        // Rings are shared with the registry, so the events of a thread are kept after it finishes
+        static thread_local std::shared_ptr<TraceRing> ring;
+        if (!ring)
+        {
+            std::lock_guard<std::mutex> guard(mutex_);
+            uint32_t tid = static_cast<uint32_t>(rings_.size()) + 1;
+            ring = std::make_shared<TraceRing>(tid, current_thread_name(tid));
+            rings_.push_back(ring);
+        }
+        return *ring;
+    }
+
+    bool dump(
+            const std::string& file_name);
+
+private:
+
+    Tracer() = default;
+
+    static Tracer* create()
+    {
+        Tracer* tracer = new Tracer();
+        // Singletons used by the dump are created first, so they are destroyed after it runs
+        SystemInfo::instance();
+        std::atexit(dump_on_exit);
+        return tracer;
+    }
+
+    static void dump_on_exit()
+    {
+        std::string file_name;
+        if (ReturnCode_t::RETCODE_OK == SystemInfo::get_env(trace_file_env_var, file_name) && !file_name.empty())
+        {
+            instance().dump(file_name);
+        }
+    }
+
+    std::mutex mutex_;
+    std::vector<std::shared_ptr<TraceRing>> rings_;
+};
+
+void write_escaped(
+        std::ostream& out,
+        const std::string& text)
+{
+    for (char c : text)
+    {
+        if ('"' == c || '\\' == c)
+        {
+            out << '\\';
+        }
+        out << c;
+    }
+}
+
+bool Tracer::dump(
+        const std::string& file_name)
+{
+    std::ofstream out(file_name);
+    if (!out)
+    {
+        return false;
+    }
+
+    int pid = SystemInfo::instance().process_id();
+
+    std::vector<std::pair<uint32_t, TraceEvent>> events;
+    out << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        bool first = true;
+        for (const std::shared_ptr<TraceRing>& ring : rings_)
+        {
+            out << (first ? "" : ",\n") << "{\"ph\":\"M\",\"name\":\"thread_name\",\"pid\":" << pid << ",\"tid\":" <<
+                ring->tid() << ",\"args\":{\"name\":\"";
+            write_escaped(out, ring->thread_name());
+            out << "\"}}";
+            first = false;
+
+            std::vector<TraceEvent> ring_events;
+            ring->snapshot(ring_events);
+            for (const TraceEvent& event : ring_events)
+            {
+                events.emplace_back(ring->tid(), event);
+            }
+        }
+    }
+
+    // Timestamps on microseconds, as required by the format
+    char ts[32];
+    auto format_us = [&ts](int64_t ns) -> const char*
+            {
+                std::snprintf(ts, sizeof(ts), "%.3f", static_cast<double>(ns) / 1000.0);
+                return ts;
+            };
+
+    // Instant events are written as slices with no duration, so flow arrows can be bound to them
+    std::map<std::pair<GUID_t, SequenceNumber_t>, std::vector<size_t>> samples;
+    for (size_t i = 0; i < events.size(); ++i)
+    {
+        const TraceEvent& event = events[i].second;
+        std::ostringstream guid;
+        guid << event.writer_guid;
+
+        out << ",\n{\"ph\":\"X\",\"cat\":\"fastdds\",\"name\":\"" << event.name << "\",\"pid\":" << pid <<
+            ",\"tid\":" << events[i].first << ",\"ts\":" << format_us(event.begin_ns);
+        out << ",\"dur\":" << format_us(event.duration_ns) << ",\"args\":{\"writer_guid\":\"" << guid.str() <<
+            "\",\"sequence_number\":" << event.sequence_number.to64long() << "}}";
+
+        if (SequenceNumber_t::unknown() != event.sequence_number)
+        {
+            samples[std::make_pair(event.writer_guid, event.sequence_number)].push_back(i);
+        }
+    }
+
+    // A flow joins all the stages of each sample, in the order they happened
+    uint64_t flow_id = 0;
+    for (auto& sample : samples)
+    {
+        std::vector<size_t>& stages = sample.second;
+        if (stages.size() < 2)
+        {
+            continue;
+        }
+
+        std::stable_sort(stages.begin(), stages.end(), [&events](size_t a, size_t b)
+                {
+                    return events[a].second.begin_ns < events[b].second.begin_ns;
+                });
+
+        ++flow_id;
+        for (size_t i = 0; i < stages.size(); ++i)
+        {
+            const char* phase = (0 == i) ? "s" : ((stages.size() - 1 == i) ? "f" : "t");
+            out << ",\n{\"ph\":\"" << phase << "\",\"cat\":\"fastdds\",\"name\":\"sample\",\"id\":" << flow_id <<
+                ",\"pid\":" << pid << ",\"tid\":" << events[stages[i]].first << ",\"ts\":" <<
+                format_us(events[stages[i]].second.begin_ns) << ((0 == i) ? "}" : ",\"bp\":\"e\"}");
+        }
+    }
+
+    out << "\n]}\n";
+    return static_cast<bool>(out);
+}
+
+} // namespace
+
+void record_event(
+        const char* name,
+        int64_t begin_ns,
+        int64_t duration_ns,
+        const GUID_t& writer_guid,
+        const SequenceNumber_t& sequence_number)
+{
+    TraceEvent event;
+    event.name = name;
+    event.begin_ns = begin_ns;
+    event.duration_ns = duration_ns;
+    event.writer_guid = writer_guid;
+    event.sequence_number = sequence_number;
+    Tracer::instance().local_ring().push(event);
+}
+
+bool dump_trace(
+        const std::string& file_name)
+{
+    return Tracer::instance().dump(file_name);
+}
+
+} // namespace tracing
+} // namespace fastdds
+} // namespace eprosima
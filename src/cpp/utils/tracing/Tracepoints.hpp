@@ -0,0 +1,154 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Tracepoints.hpp
+ *
+ * Tracepoints on the path of a sample, from the DataWriter to the DataReader.
+ *
+ * They are only compiled when the library is built with the FASTDDS_TRACING CMake option. Otherwise all the macros in
+ * this file expand to nothing and their arguments are not evaluated.
+ */
+
+#ifndef _FASTDDS_UTILS_TRACING_TRACEPOINTS_HPP_
+#define _FASTDDS_UTILS_TRACING_TRACEPOINTS_HPP_
+
+#include <fastrtps/config.h>
+
+#ifdef FASTDDS_TRACING
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace tracing {
+
+/**
+ * Records an event on the trace buffer of the calling thread.
+ *
+ * Each thread writes on its own ring buffer, without locking, and the oldest events are overwritten when it is full.
+ *
+ * @param name Name of the stage. It should be a string literal, as only the pointer is stored.
+ * @param begin_ns Time the stage started, in nanoseconds of the steady clock.
+ * @param duration_ns Duration of the stage, 0 for instant events.
+ * @param writer_guid GUID of the writer of the sample being processed.
+ * @param sequence_number Sequence number of the sample being processed, unknown if the stage is not related to one.
+ */
+void record_event(
+        const char* name,
+        int64_t begin_ns,
+        int64_t duration_ns,
+        const fastrtps::rtps::GUID_t& writer_guid,
+        const fastrtps::rtps::SequenceNumber_t& sequence_number);
+
+/**
+ * Writes the events recorded by all threads on a file with the Chrome trace event format, which can be opened with
+ * the Perfetto UI or chrome://tracing.
+ *
+ * Events of the same sample are joined with flow arrows, and carry the writer GUID and sequence number as arguments
+ * so they can be correlated with the traces of other processes.
+ * The events should not be recorded while dumping, as the ones being overwritten could be written inconsistently.
+ *
+ * @param file_name Name of the file to write.
+ * @return true if the file was written.
+ */
+bool dump_trace(
+        const std::string& file_name);
+
+//! Current time of the steady clock, in nanoseconds
+inline int64_t trace_now()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * Records an event with the duration of the scope where it is declared.
+ */
+class ScopedTracepoint
+{
+public:
+
+    ScopedTracepoint(
+            const char* name,
+            const fastrtps::rtps::GUID_t& writer_guid,
+            const fastrtps::rtps::SequenceNumber_t& sequence_number)
+        : name_(name)
+        , writer_guid_(writer_guid)
+        , sequence_number_(sequence_number)
+        , begin_ns_(trace_now())
+    {
+    }
+
+    ~ScopedTracepoint()
+    {
+        record_event(name_, begin_ns_, trace_now() - begin_ns_, writer_guid_, sequence_number_);
+    }
+
+    /**
+     * Sets the sample processed on the scope, for stages where it is only known after having started.
+     */
+    void sample(
+            const fastrtps::rtps::GUID_t& writer_guid,
+            const fastrtps::rtps::SequenceNumber_t& sequence_number)
+    {
+        writer_guid_ = writer_guid;
+        sequence_number_ = sequence_number;
+    }
+
+private:
+
+    ScopedTracepoint(
+            const ScopedTracepoint&) = delete;
+
+    ScopedTracepoint& operator =(
+            const ScopedTracepoint&) = delete;
+
+    const char* name_;
+    fastrtps::rtps::GUID_t writer_guid_;
+    fastrtps::rtps::SequenceNumber_t sequence_number_;
+    int64_t begin_ns_;
+};
+
+} // namespace tracing
+} // namespace fastdds
+} // namespace eprosima
+
+//! Declares a tracepoint named @c var measuring the rest of the scope
+#define FASTDDS_TRACEPOINT_SCOPE(var, name, writer_guid, sequence_number) \
+    eprosima::fastdds::tracing::ScopedTracepoint var(name, writer_guid, sequence_number)
+
+//! Sets the sample processed by the scope tracepoint @c var
+#define FASTDDS_TRACEPOINT_SAMPLE(var, writer_guid, sequence_number) \
+    var.sample(writer_guid, sequence_number)
+
+//! Records an instant event
+#define FASTDDS_TRACEPOINT_INSTANT(name, writer_guid, sequence_number) \
+    eprosima::fastdds::tracing::record_event(name, eprosima::fastdds::tracing::trace_now(), 0, \
+            writer_guid, sequence_number)
+
+#else
+
+#define FASTDDS_TRACEPOINT_SCOPE(var, name, writer_guid, sequence_number)
+#define FASTDDS_TRACEPOINT_SAMPLE(var, writer_guid, sequence_number) do {} while (0)
+#define FASTDDS_TRACEPOINT_INSTANT(name, writer_guid, sequence_number) do {} while (0)
+
+#endif // ifdef FASTDDS_TRACING
+
+#endif // _FASTDDS_UTILS_TRACING_TRACEPOINTS_HPP_
@@ -412,6 +412,43 @@ TEST(DDSDataWriter, HeartbeatWhileDestruction)
     }
 }
 
+/**
+ * Test that checks DataWriter::write_batch on a keyed KEEP_ALL writer whose instance reaches max_samples_per_instance
+ * while writing the batch. The samples of the batch being waited on for acknowledgement must have been sent.
+ */
+TEST_P(DDSDataWriter, WriteBatchKeepAllMaxSamplesPerInstance)
+{
+    PubSubWriter<KeyedHelloWorldPubSubType> writer(TEST_TOPIC_NAME);
+    PubSubReader<KeyedHelloWorldPubSubType> reader(TEST_TOPIC_NAME);
+
+    reader.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS).init();
+    ASSERT_TRUE(reader.isInitialized());
+
+    writer.reliability(RELIABLE_RELIABILITY_QOS).history_kind(KEEP_ALL_HISTORY_QOS)
+            .resource_limits_max_samples_per_instance(2).init();
+    ASSERT_TRUE(writer.isInitialized());
+
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    // All the samples belong to the same instance
+    auto data = default_keyedhelloworld_data_generator(10);
+    for (auto& sample : data)
+    {
+        sample.key(1);
+    }
+    reader.startReception(data);
+
+    std::vector<void*> samples;
+    for (auto& sample : data)
+    {
+        samples.push_back(&sample);
+    }
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, writer.get_native_writer().write_batch(samples));
+
+    reader.block_for_all();
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z, w) INSTANTIATE_TEST_SUITE_P(x, y, z, w)
 #else
@@ -0,0 +1,128 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef FASTDDS_SHM_TRANSPORT_DISABLED
+
+#include "BlackboxTests.hpp"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/dds/core/policy/ParameterTypes.hpp>
+#include <fastdds/rtps/attributes/PropertyPolicy.h>
+
+#include "../api/dds-pim/PubSubReader.hpp"
+#include "../api/dds-pim/PubSubWriter.hpp"
+#include <rtps/transport/shared_mem/test_SharedMemTransportDescriptor.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using test_SharedMemTransportDescriptor = eprosima::fastdds::rtps::test_SharedMemTransportDescriptor;
+
+/**
+ * A writer allocating its payloads on a shared memory segment sends a sample to a reader over SHM.
+ * The payload is only left out of the DATA submessage when the reader announced it accepts payload descriptors.
+ *
+ * @param reader_accepts_descriptors Whether the reader accepts payload descriptors.
+ */
+static void shm_payload_descriptors_test(
+        bool reader_accepts_descriptors)
+{
+    PubSubReader<Data1mbPubSubType> reader(TEST_TOPIC_NAME);
+    PubSubWriter<Data1mbPubSubType> writer(TEST_TOPIC_NAME);
+
+    auto data = default_data300kb_data_generator(1);
+    auto data_size = data.front().data().size();
+
+    auto shm_transport = std::make_shared<test_SharedMemTransportDescriptor>();
+    const uint32_t segment_size = 1024 * 1024;
+    shm_transport->segment_size(segment_size);
+    shm_transport->max_message_size(segment_size);
+
+    // Messages carrying the payload are counted as big buffers
+    uint32_t big_buffers_send_count = 0;
+    uint32_t big_buffers_recv_count = 0;
+    shm_transport->big_buffer_size_ = static_cast<uint32_t>(data_size);
+    shm_transport->big_buffer_size_send_count_ = &big_buffers_send_count;
+    shm_transport->big_buffer_size_recv_count_ = &big_buffers_recv_count;
+
+    PropertyPolicy writer_properties;
+    writer_properties.properties().emplace_back(eprosima::fastdds::dds::parameter_shm_payload_segment_size,
+            std::to_string(4 * segment_size));
+
+    PropertyPolicy reader_properties;
+    if (!reader_accepts_descriptors)
+    {
+        reader_properties.properties().emplace_back(eprosima::fastdds::dds::parameter_shm_payload_descriptors,
+                "false");
+    }
+
+    writer
+            .asynchronously(eprosima::fastrtps::SYNCHRONOUS_PUBLISH_MODE)
+            .reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS)
+            .datasharing_off()
+            .entity_property_policy(writer_properties)
+            .disable_builtin_transport()
+            .add_user_transport_to_pparams(shm_transport)
+            .init();
+
+    reader
+            .reliability(eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS)
+            .datasharing_off()
+            .entity_property_policy(reader_properties)
+            .disable_builtin_transport()
+            .add_user_transport_to_pparams(shm_transport)
+            .init();
+
+    ASSERT_TRUE(reader.isInitialized());
+    ASSERT_TRUE(writer.isInitialized());
+
+    // Wait for discovery.
+    writer.wait_discovery();
+    reader.wait_discovery();
+
+    reader.startReception(data);
+    // Send data with some interval, to let async writer thread send samples
+    writer.send(data, 300);
+
+    // In this test all data should be sent.
+    ASSERT_TRUE(data.empty());
+    // Block reader until reception finished or timeout.
+    reader.block_for_all();
+
+    uint32_t expected_big_buffers = reader_accepts_descriptors ? 0u : 1u;
+    EXPECT_EQ(big_buffers_send_count, expected_big_buffers);
+    EXPECT_EQ(big_buffers_recv_count, expected_big_buffers);
+
+    // Destroy the writer participant.
+    writer.destroy();
+
+    // Check that reader receives the unmatched.
+    reader.wait_participant_undiscovery();
+}
+
+TEST(SHMPayloadDescriptors, ReaderAcceptsDescriptors)
+{
+    shm_payload_descriptors_test(true);
+}
+
+TEST(SHMPayloadDescriptors, ReaderRejectsDescriptors)
+{
+    shm_payload_descriptors_test(false);
+}
+
+#endif // FASTDDS_SHM_TRANSPORT_DISABLED
@@ -0,0 +1,103 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BenchmarkParticipant.hpp
+ */
+
+#ifndef FASTDDS_MICROBENCHMARKS__BENCHMARKPARTICIPANT_HPP
+#define FASTDDS_MICROBENCHMARKS__BENCHMARKPARTICIPANT_HPP
+
+#include <memory>
+
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/participant/RTPSParticipant.h>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+
+#include <rtps/participant/RTPSParticipantImpl.h>
+#include <rtps/RTPSDomainImpl.hpp>
+
+namespace eprosima {
+namespace fastdds {
+namespace microbenchmarks {
+
+/**
+ * RTPS participant used as the context of the benchmarks that need one.
+ *
+ * Discovery is disabled and the only transport is UDPv4 bound to the loopback interface, so the measurements are not
+ * disturbed by discovery traffic nor depend on the network configuration of the host.
+ */
+class BenchmarkParticipant
+{
+public:
+
+    BenchmarkParticipant()
+    {
+        fastrtps::rtps::RTPSParticipantAttributes attr;
+        attr.builtin.discovery_config.discoveryProtocol = fastrtps::rtps::DiscoveryProtocol_t::NONE;
+        attr.builtin.use_WriterLivelinessProtocol = false;
+        attr.useBuiltinTransports = false;
+        auto udp = std::make_shared<fastdds::rtps::UDPv4TransportDescriptor>();
+        udp->interfaceWhiteList.emplace_back("127.0.0.1");
+        attr.userTransports.push_back(udp);
+
+        participant_ = fastrtps::rtps::RTPSDomain::createParticipant(0, attr);
+        if (nullptr != participant_)
+        {
+            impl_ = fastrtps::rtps::RTPSDomainImpl::find_local_participant(participant_->getGuid());
+        }
+    }
+
+    ~BenchmarkParticipant()
+    {
+        if (nullptr != participant_)
+        {
+            fastrtps::rtps::RTPSDomain::removeRTPSParticipant(participant_);
+        }
+    }
+
+    BenchmarkParticipant(
+            const BenchmarkParticipant&) = delete;
+
+    BenchmarkParticipant& operator =(
+            const BenchmarkParticipant&) = delete;
+
+    //! Whether the participant could be created
+    bool is_valid() const
+    {
+        return nullptr != impl_;
+    }
+
+    fastrtps::rtps::RTPSParticipant* participant() const
+    {
+        return participant_;
+    }
+
+    fastrtps::rtps::RTPSParticipantImpl* impl() const
+    {
+        return impl_;
+    }
+
+private:
+
+    fastrtps::rtps::RTPSParticipant* participant_ = nullptr;
+    fastrtps::rtps::RTPSParticipantImpl* impl_ = nullptr;
+};
+
+} // namespace microbenchmarks
+} // namespace fastdds
+} // namespace eprosima
+
+#endif // FASTDDS_MICROBENCHMARKS__BENCHMARKPARTICIPANT_HPP
@@ -0,0 +1,190 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file DDSFilterExpressionBenchmarks.cpp
+ *
+ * Evaluation of DDS-SQL filter expressions over serialized samples of the type:
+ *
+ *     struct FilterType { long index; double value; string name; };
+ */
+
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <fastdds/dds/core/StackAllocatedSequence.hpp>
+#include <fastdds/dds/topic/ContentFilteredTopic.hpp>
+#include <fastdds/dds/topic/IContentFilter.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/TypeObject.h>
+
+#include <fastdds/topic/DDSSQLFilter/DDSFilterFactory.hpp>
+
+using namespace eprosima::fastrtps::types;
+using eprosima::fastdds::dds::IContentFilter;
+using eprosima::fastdds::dds::StackAllocatedSequence;
+using eprosima::fastdds::dds::DDSSQLFilter::DDSFilterFactory;
+using eprosima::fastrtps::rtps::GUID_t;
+using eprosima::fastrtps::rtps::SerializedPayload_t;
+
+namespace {
+
+constexpr size_t num_samples = 256;
+
+//! Filter expressions measured, with their parameters
+struct FilterCase
+{
+    const char* expression;
+    std::vector<const char*> parameters;
+};
+
+const FilterCase filter_cases[] = {
+    {"index > 100", {}},
+    {"index BETWEEN %0 AND %1 AND value < 0.5", {"64", "192"}},
+    {"name LIKE 'sensor_1%'", {}},
+    {"name MATCH 'sensor_[0-9]*7'", {}},
+    {"(index < 32 OR index > 224) AND NOT (value > 0.9 OR name = 'sensor_0')", {}},
+};
+
+/**
+ * Type registered on the TypeObjectFactory, as the filter factory looks it up there, and a fixed set of serialized
+ * samples generated with a constant seed.
+ */
+class FilterFixture
+{
+public:
+
+    FilterFixture()
+    {
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+        DynamicTypeBuilder* builder = factory->create_struct_builder();
+        builder->set_name("microbenchmarks::FilterType");
+        builder->add_member(0, "index", factory->create_int32_type());
+        builder->add_member(1, "value", factory->create_float64_type());
+        builder->add_member(2, "name", factory->create_string_type());
+        DynamicType_ptr type = builder->build();
+
+        TypeObject type_object;
+        factory->build_type_object(type, type_object, true);
+        factory->build_type_object(type, type_object, false);
+        type_support_.reset(new DynamicPubSubType(type));
+
+        std::mt19937 generator(1234u);
+        std::uniform_int_distribution<int32_t> index_distribution(0, 255);
+        std::uniform_real_distribution<double> value_distribution(0.0, 1.0);
+
+        DynamicData* data = DynamicDataFactory::get_instance()->create_data(type);
+        payloads_.reserve(num_samples);
+        for (size_t i = 0; i < num_samples; ++i)
+        {
+            int32_t index = index_distribution(generator);
+            data->set_int32_value(index, 0);
+            data->set_float64_value(value_distribution(generator), 1);
+            data->set_string_value("sensor_" + std::to_string(index), 2);
+
+            uint32_t size = type_support_->getSerializedSizeProvider(data)();
+            payloads_.emplace_back(new SerializedPayload_t(size));
+            type_support_->serialize(data, payloads_.back().get());
+        }
+        DynamicDataFactory::get_instance()->delete_data(data);
+    }
+
+    ~FilterFixture()
+    {
+        if (nullptr != filter_)
+        {
+            factory_.delete_content_filter(FASTDDS_SQLFILTER_NAME, filter_);
+        }
+    }
+
+    bool create_filter(
+            const FilterCase& filter_case)
+    {
+        using ParameterSeq = StackAllocatedSequence<const char*, 4>;
+
+        ParameterSeq parameters;
+        parameters.length(static_cast<ParameterSeq::size_type>(filter_case.parameters.size()));
+        for (size_t i = 0; i < filter_case.parameters.size(); ++i)
+        {
+            parameters[static_cast<ParameterSeq::size_type>(i)] = filter_case.parameters[i];
+        }
+
+        return ReturnCode_t::RETCODE_OK == factory_.create_content_filter(FASTDDS_SQLFILTER_NAME,
+                       type_support_->getName(), type_support_.get(), filter_case.expression, parameters, filter_);
+    }
+
+    const IContentFilter& filter() const
+    {
+        return *filter_;
+    }
+
+    const SerializedPayload_t& payload(
+            size_t index) const
+    {
+        return *payloads_[index % num_samples];
+    }
+
+private:
+
+    DDSFilterFactory factory_;
+    std::unique_ptr<DynamicPubSubType> type_support_;
+    std::vector<std::unique_ptr<SerializedPayload_t>> payloads_;
+    IContentFilter* filter_ = nullptr;
+};
+
+/**
+ * Arguments: index on filter_cases.
+ */
+void BM_DDSFilterExpression_evaluate(
+        benchmark::State& state)
+{
+    const FilterCase& filter_case = filter_cases[state.range(0)];
+    state.SetLabel(filter_case.expression);
+
+    FilterFixture fixture;
+    if (!fixture.create_filter(filter_case))
+    {
+        state.SkipWithError("Could not create filter");
+        return;
+    }
+
+    IContentFilter::FilterSampleInfo sample_info;
+    GUID_t reader_guid;
+    size_t index = 0;
+    int64_t accepted = 0;
+    for (auto _ : state)
+    {
+        if (fixture.filter().evaluate(fixture.payload(index++), sample_info, reader_guid))
+        {
+            ++accepted;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["accepted_ratio"] = static_cast<double>(accepted) / static_cast<double>(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_DDSFilterExpression_evaluate)->DenseRange(0, sizeof(filter_cases) / sizeof(filter_cases[0]) - 1);
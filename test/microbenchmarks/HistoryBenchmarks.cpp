@@ -0,0 +1,300 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HistoryBenchmarks.cpp
+ *
+ * Insertion of received changes on ReaderHistory and DataReaderHistory, with changes coming interleaved from several
+ * writers.
+ */
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/topic/TopicDescription.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/RTPSDomain.h>
+
+#include <fastdds/subscriber/history/DataReaderHistory.hpp>
+
+#include "BenchmarkParticipant.hpp"
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::microbenchmarks::BenchmarkParticipant;
+
+namespace {
+
+constexpr uint32_t payload_size = 256u;
+
+//! Keyless type with a fixed size, only used to configure the DataReaderHistory
+class FixedSizeType : public eprosima::fastdds::dds::TopicDataType
+{
+public:
+
+    FixedSizeType()
+    {
+        setName("microbenchmarks::FixedSizeType");
+        m_typeSize = payload_size + 4u;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void*,
+            SerializedPayload_t*) override
+    {
+        return false;
+    }
+
+    bool deserialize(
+            SerializedPayload_t*,
+            void*) override
+    {
+        return false;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void*) override
+    {
+        return []()
+               {
+                   return payload_size + 4u;
+               };
+    }
+
+    void* createData() override
+    {
+        return nullptr;
+    }
+
+    void deleteData(
+            void*) override
+    {
+    }
+
+    bool getKey(
+            void*,
+            InstanceHandle_t*,
+            bool) override
+    {
+        return false;
+    }
+
+};
+
+//! Standalone topic description, the DataReaderHistory only takes the names from it
+class BenchmarkTopic : public eprosima::fastdds::dds::TopicDescription
+{
+public:
+
+    BenchmarkTopic(
+            const std::string& name,
+            const std::string& type_name)
+        : TopicDescription(name, type_name)
+    {
+    }
+
+    eprosima::fastdds::dds::DomainParticipant* get_participant() const override
+    {
+        return nullptr;
+    }
+
+    eprosima::fastdds::dds::TopicDescriptionImpl* get_impl() const override
+    {
+        return nullptr;
+    }
+
+};
+
+//! Writers sending changes to the history, each one with its own sequence numbers
+class ChangeSource
+{
+public:
+
+    ChangeSource(
+            RTPSReader* reader,
+            uint32_t num_writers)
+        : reader_(reader)
+        , guids_(num_writers)
+        , sequences_(num_writers)
+    {
+        for (uint32_t i = 0; i < num_writers; ++i)
+        {
+            guids_[i].guidPrefix.value[0] = 0x01;
+            guids_[i].guidPrefix.value[11] = static_cast<octet>(i + 1);
+            guids_[i].entityId = EntityId_t(0x00000103);
+        }
+    }
+
+    //! Reserve the next change, from the writers in round-robin
+    CacheChange_t* next()
+    {
+        CacheChange_t* change = nullptr;
+        if (!reader_->reserveCache(&change, payload_size))
+        {
+            return nullptr;
+        }
+
+        change->kind = ALIVE;
+        change->writerGUID = guids_[next_writer_];
+        change->sequenceNumber = ++sequences_[next_writer_];
+        change->serializedPayload.length = payload_size;
+        next_writer_ = (next_writer_ + 1) % guids_.size();
+        return change;
+    }
+
+private:
+
+    RTPSReader* reader_;
+    std::vector<GUID_t> guids_;
+    std::vector<SequenceNumber_t> sequences_;
+    size_t next_writer_ = 0;
+};
+
+/**
+ * Fill a ReaderHistory with a batch of changes, then empty it.
+ * Arguments: changes on the batch, number of writers.
+ */
+void BM_ReaderHistory_received_change(
+        benchmark::State& state)
+{
+    const uint32_t batch = static_cast<uint32_t>(state.range(0));
+    const uint32_t num_writers = static_cast<uint32_t>(state.range(1));
+
+    BenchmarkParticipant participant;
+    if (!participant.is_valid())
+    {
+        state.SkipWithError("Could not create participant");
+        return;
+    }
+
+    HistoryAttributes hatt;
+    hatt.payloadMaxSize = payload_size;
+    hatt.initialReservedCaches = static_cast<int32_t>(batch);
+    hatt.maximumReservedCaches = 0;
+    ReaderHistory history(hatt);
+
+    ReaderAttributes ratt;
+    ratt.endpoint.reliabilityKind = BEST_EFFORT;
+    ratt.endpoint.topicKind = NO_KEY;
+    RTPSReader* reader = RTPSDomain::createRTPSReader(participant.participant(), ratt, &history);
+    if (nullptr == reader)
+    {
+        state.SkipWithError("Could not create reader");
+        return;
+    }
+
+    ChangeSource source(reader, num_writers);
+    for (auto _ : state)
+    {
+        for (uint32_t i = 0; i < batch; ++i)
+        {
+            history.received_change(source.next(), 0);
+        }
+        history.remove_all_changes();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * batch);
+
+    RTPSDomain::removeRTPSReader(reader);
+}
+
+/**
+ * Insert changes on a DataReaderHistory.
+ * With KEEP_LAST the history is left to evict the oldest sample on its own, with KEEP_ALL it is filled with a batch
+ * of changes and then emptied.
+ * Arguments: history kind, depth or changes on the batch, number of writers.
+ */
+void BM_DataReaderHistory_received_change(
+        benchmark::State& state)
+{
+    using namespace eprosima::fastdds::dds;
+    using eprosima::fastdds::dds::detail::DataReaderHistory;
+
+    const HistoryQosPolicyKind kind = static_cast<HistoryQosPolicyKind>(state.range(0));
+    const int32_t depth = static_cast<int32_t>(state.range(1));
+    const uint32_t num_writers = static_cast<uint32_t>(state.range(2));
+    state.SetLabel(KEEP_LAST_HISTORY_QOS == kind ? "KEEP_LAST" : "KEEP_ALL");
+
+    BenchmarkParticipant participant;
+    if (!participant.is_valid())
+    {
+        state.SkipWithError("Could not create participant");
+        return;
+    }
+
+    TypeSupport type(new FixedSizeType());
+    BenchmarkTopic topic("microbenchmarks_history", type.get_type_name());
+    DataReaderQos qos;
+    qos.history().kind = kind;
+    qos.history().depth = depth;
+    qos.resource_limits().max_samples = depth;
+    qos.resource_limits().allocated_samples = depth;
+    DataReaderHistory history(type, topic, qos);
+
+    ReaderAttributes ratt;
+    ratt.endpoint.reliabilityKind = BEST_EFFORT;
+    ratt.endpoint.topicKind = NO_KEY;
+    RTPSReader* reader = RTPSDomain::createRTPSReader(participant.participant(), ratt, &history);
+    if (nullptr == reader)
+    {
+        state.SkipWithError("Could not create reader");
+        return;
+    }
+
+    ChangeSource source(reader, num_writers);
+    if (KEEP_LAST_HISTORY_QOS == kind)
+    {
+        for (auto _ : state)
+        {
+            history.received_change(source.next(), 0);
+        }
+        state.SetItemsProcessed(state.iterations());
+    }
+    else
+    {
+        for (auto _ : state)
+        {
+            for (int32_t i = 0; i < depth; ++i)
+            {
+                history.received_change(source.next(), 0);
+            }
+            history.remove_all_changes();
+        }
+        state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * depth);
+    }
+
+    history.remove_all_changes();
+    RTPSDomain::removeRTPSReader(reader);
+}
+
+} // namespace
+
+BENCHMARK(BM_ReaderHistory_received_change)
+        ->Args({64, 1})->Args({64, 8})->Args({1024, 1})->Args({1024, 8});
+BENCHMARK(BM_DataReaderHistory_received_change)
+        ->Args({eprosima::fastdds::dds::KEEP_LAST_HISTORY_QOS, 1, 1})
+        ->Args({eprosima::fastdds::dds::KEEP_LAST_HISTORY_QOS, 64, 8})
+        ->Args({eprosima::fastdds::dds::KEEP_ALL_HISTORY_QOS, 64, 1})
+        ->Args({eprosima::fastdds::dds::KEEP_ALL_HISTORY_QOS, 1024, 8});
@@ -0,0 +1,155 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MessageReceiverBenchmarks.cpp
+ *
+ * Processing of a received RTPS message holding a single DATA submessage, from the header check to the insertion of
+ * the change on the history of a best-effort reader.
+ */
+
+#include <cstdint>
+#include <cstring>
+
+#include <benchmark/benchmark.h>
+
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/builtin/data/WriterProxyData.h>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/messages/CDRMessage.h>
+#include <fastdds/rtps/messages/MessageReceiver.h>
+#include <fastdds/rtps/messages/RTPSMessageCreator.h>
+#include <fastdds/rtps/reader/ReaderListener.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include "BenchmarkParticipant.hpp"
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::microbenchmarks::BenchmarkParticipant;
+
+namespace {
+
+//! Offset of the writerSN field of the DATA submessage following the RTPS header
+constexpr uint32_t sequence_number_offset = RTPSMESSAGE_HEADER_SIZE + RTPSMESSAGE_SUBMESSAGEHEADER_SIZE + 12u;
+
+//! Remove the changes as soon as they are notified, so the history does not grow during the benchmark
+class DiscardingListener : public ReaderListener
+{
+public:
+
+    void onNewCacheChangeAdded(
+            RTPSReader* reader,
+            const CacheChange_t* const change) override
+    {
+        reader->getHistory()->remove_change(const_cast<CacheChange_t*>(change));
+    }
+
+};
+
+void write_sequence_number(
+        CDRMessage_t& msg,
+        const SequenceNumber_t& sn)
+{
+    uint32_t length = msg.length;
+    msg.pos = sequence_number_offset;
+    CDRMessage::addSequenceNumber(&msg, &sn);
+    msg.length = length;
+}
+
+void BM_MessageReceiver_processCDRMsg(
+        benchmark::State& state)
+{
+    const uint32_t payload_size = static_cast<uint32_t>(state.range(0));
+
+    BenchmarkParticipant participant;
+    if (!participant.is_valid())
+    {
+        state.SkipWithError("Could not create participant");
+        return;
+    }
+
+    HistoryAttributes hatt;
+    hatt.payloadMaxSize = payload_size;
+    hatt.initialReservedCaches = 4;
+    hatt.maximumReservedCaches = 0;
+    ReaderHistory history(hatt);
+    DiscardingListener listener;
+
+    ReaderAttributes ratt;
+    ratt.endpoint.reliabilityKind = BEST_EFFORT;
+    ratt.endpoint.topicKind = NO_KEY;
+    RTPSReader* reader = RTPSDomain::createRTPSReader(participant.participant(), ratt, &history, &listener);
+    if (nullptr == reader)
+    {
+        state.SkipWithError("Could not create reader");
+        return;
+    }
+
+    GUID_t writer_guid;
+    writer_guid.guidPrefix.value[0] = 0x01;
+    writer_guid.guidPrefix.value[11] = 0x01;
+    writer_guid.entityId = EntityId_t(0x00000103);
+
+    WriterProxyData wdata(1u, 1u);
+    wdata.guid(writer_guid);
+    wdata.topicKind(NO_KEY);
+    wdata.m_qos.m_reliability.kind = eprosima::fastrtps::BEST_EFFORT_RELIABILITY_QOS;
+    reader->matched_writer_add(wdata);
+
+    // Serialize the message once, only the sequence number is updated on each iteration
+    CacheChange_t change;
+    change.writerGUID = writer_guid;
+    change.sequenceNumber = SequenceNumber_t(0, 1);
+    change.serializedPayload.reserve(payload_size);
+    change.serializedPayload.length = payload_size;
+    std::memset(change.serializedPayload.data, 0xA5, payload_size);
+
+    CDRMessage_t msg(RTPSMESSAGE_HEADER_SIZE + RTPSMESSAGE_DATA_MIN_LENGTH + payload_size + 64u);
+    bool is_big_submessage = false;
+    RTPSMessageCreator::addHeader(&msg, writer_guid.guidPrefix);
+    RTPSMessageCreator::addSubmessageData(&msg, &change, NO_KEY, c_EntityId_Unknown, false, nullptr,
+            &is_big_submessage);
+
+    Locator_t source_locator;
+    source_locator.kind = LOCATOR_KIND_UDPv4;
+    source_locator.port = 7400;
+    IPLocator::setIPv4(source_locator, 127, 0, 0, 1);
+    Locator_t reception_locator = source_locator;
+    reception_locator.port = 7411;
+
+    MessageReceiver receiver(participant.impl(), msg.max_size);
+    receiver.associateEndpoint(reader);
+
+    SequenceNumber_t sn(0, 1);
+    for (auto _ : state)
+    {
+        write_sequence_number(msg, sn);
+        receiver.processCDRMsg(source_locator, reception_locator, &msg);
+        ++sn;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * msg.length);
+
+    receiver.removeEndpoint(reader);
+    RTPSDomain::removeRTPSReader(reader);
+}
+
+} // namespace
+
+BENCHMARK(BM_MessageReceiver_processCDRMsg)->Arg(64)->Arg(1024)->Arg(16384);
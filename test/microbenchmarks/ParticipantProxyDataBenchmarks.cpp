@@ -0,0 +1,145 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ParticipantProxyDataBenchmarks.cpp
+ *
+ * Serialization and parsing of the participant announcements (DATA(p)) exchanged during discovery.
+ */
+
+#include <cstdint>
+#include <string>
+
+#include <benchmark/benchmark.h>
+
+#include <fastdds/rtps/attributes/RTPSParticipantAllocationAttributes.hpp>
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/builtin/data/ParticipantProxyData.h>
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <rtps/network/NetworkFactory.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+/**
+ * Fill an announcement similar to the ones of a participant on a host with several network interfaces.
+ */
+void fill_participant_data(
+        ParticipantProxyData& pdata,
+        uint32_t num_locators)
+{
+    pdata.m_guid.guidPrefix.value[0] = 0x01;
+    pdata.m_guid.guidPrefix.value[11] = 0x01;
+    pdata.m_guid.entityId = c_EntityId_RTPSParticipant;
+    pdata.m_key = pdata.m_guid;
+    pdata.m_participantName = "microbenchmarks_participant";
+    pdata.m_leaseDuration = eprosima::fastrtps::Duration_t(20, 0);
+    pdata.m_availableBuiltinEndpoints = 0x00000C3F;
+
+    for (uint32_t i = 0; i < num_locators; ++i)
+    {
+        Locator_t locator;
+        locator.kind = LOCATOR_KIND_UDPv4;
+        IPLocator::setIPv4(locator, 192, 168, static_cast<octet>(i), 10);
+        locator.port = 7410;
+        pdata.metatraffic_locators.add_unicast_locator(locator);
+        locator.port = 7411;
+        pdata.default_locators.add_unicast_locator(locator);
+    }
+
+    Locator_t multicast;
+    multicast.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(multicast, 239, 255, 0, 1);
+    multicast.port = 7400;
+    pdata.metatraffic_locators.add_multicast_locator(multicast);
+
+    pdata.m_properties.push_back("fastdds.application.id", "microbenchmarks");
+    pdata.m_properties.push_back("fastdds.application.metadata", std::string(64, 'm'));
+}
+
+RTPSParticipantAllocationAttributes allocation(
+        uint32_t num_locators)
+{
+    RTPSParticipantAllocationAttributes alloc;
+    alloc.locators.max_unicast_locators = num_locators;
+    alloc.locators.max_multicast_locators = 1u;
+    return alloc;
+}
+
+/**
+ * Arguments: unicast locators announced.
+ */
+void BM_ParticipantProxyData_write(
+        benchmark::State& state)
+{
+    const uint32_t num_locators = static_cast<uint32_t>(state.range(0));
+
+    ParticipantProxyData pdata(allocation(num_locators));
+    fill_participant_data(pdata, num_locators);
+
+    CDRMessage_t msg(pdata.get_serialized_size(true));
+    for (auto _ : state)
+    {
+        msg.pos = 0;
+        msg.length = 0;
+        benchmark::DoNotOptimize(pdata.writeToCDRMessage(&msg, true));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * msg.length);
+}
+
+/**
+ * Arguments: unicast locators announced.
+ */
+void BM_ParticipantProxyData_read(
+        benchmark::State& state)
+{
+    const uint32_t num_locators = static_cast<uint32_t>(state.range(0));
+
+    ParticipantProxyData source(allocation(num_locators));
+    fill_participant_data(source, num_locators);
+    CDRMessage_t msg(source.get_serialized_size(true));
+    source.writeToCDRMessage(&msg, true);
+
+    // Remote locators are only kept when a transport supporting them is registered
+    RTPSParticipantAttributes attr;
+    NetworkFactory network(attr);
+    eprosima::fastdds::rtps::UDPv4TransportDescriptor udp;
+    network.RegisterTransport(&udp);
+
+    ParticipantProxyData pdata(allocation(num_locators));
+    for (auto _ : state)
+    {
+        msg.pos = 0;
+        pdata.clear();
+        if (!pdata.readFromCDRMessage(&msg, true, network, false, false))
+        {
+            state.SkipWithError("Could not parse announcement");
+            break;
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * msg.length);
+}
+
+} // namespace
+
+BENCHMARK(BM_ParticipantProxyData_write)->Arg(1)->Arg(8);
+BENCHMARK(BM_ParticipantProxyData_read)->Arg(1)->Arg(8);
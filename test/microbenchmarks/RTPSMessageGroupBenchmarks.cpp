@@ -0,0 +1,153 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RTPSMessageGroupBenchmarks.cpp
+ *
+ * Serialization of DATA submessages on a RTPSMessageGroup. Messages are handed to a sender that drops them, so only
+ * the cost of building them is measured.
+ */
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/WriterAttributes.h>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/history/WriterHistory.h>
+#include <fastdds/rtps/messages/RTPSMessageGroup.h>
+#include <fastdds/rtps/messages/RTPSMessageSenderInterface.hpp>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastdds/rtps/writer/RTPSWriter.h>
+
+#include "BenchmarkParticipant.hpp"
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastdds::microbenchmarks::BenchmarkParticipant;
+
+namespace {
+
+//! Sender with a single remote reader that drops every message
+class NullSender : public RTPSMessageSenderInterface
+{
+public:
+
+    NullSender()
+    {
+        GUID_t reader_guid;
+        reader_guid.guidPrefix.value[0] = 0x02;
+        reader_guid.guidPrefix.value[11] = 0x01;
+        reader_guid.entityId = EntityId_t(0x00000104);
+        guids_.push_back(reader_guid);
+        prefixes_.push_back(reader_guid.guidPrefix);
+    }
+
+    bool destinations_have_changed() const override
+    {
+        return false;
+    }
+
+    GuidPrefix_t destination_guid_prefix() const override
+    {
+        return prefixes_.front();
+    }
+
+    const std::vector<GuidPrefix_t>& remote_participants() const override
+    {
+        return prefixes_;
+    }
+
+    const std::vector<GUID_t>& remote_guids() const override
+    {
+        return guids_;
+    }
+
+    bool send(
+            CDRMessage_t* message,
+            std::chrono::steady_clock::time_point) const override
+    {
+        benchmark::DoNotOptimize(message->buffer);
+        return true;
+    }
+
+    void lock() override
+    {
+    }
+
+    void unlock() override
+    {
+    }
+
+private:
+
+    std::vector<GuidPrefix_t> prefixes_;
+    std::vector<GUID_t> guids_;
+};
+
+void BM_RTPSMessageGroup_add_data(
+        benchmark::State& state)
+{
+    const uint32_t payload_size = static_cast<uint32_t>(state.range(0));
+
+    BenchmarkParticipant participant;
+    if (!participant.is_valid())
+    {
+        state.SkipWithError("Could not create participant");
+        return;
+    }
+
+    HistoryAttributes hatt;
+    hatt.payloadMaxSize = payload_size;
+    WriterHistory history(hatt);
+
+    WriterAttributes watt;
+    watt.endpoint.reliabilityKind = BEST_EFFORT;
+    watt.endpoint.topicKind = NO_KEY;
+    RTPSWriter* writer = RTPSDomain::createRTPSWriter(participant.participant(), watt, &history);
+    if (nullptr == writer)
+    {
+        state.SkipWithError("Could not create writer");
+        return;
+    }
+
+    CacheChange_t change;
+    change.writerGUID = writer->getGuid();
+    change.serializedPayload.reserve(payload_size);
+    change.serializedPayload.length = payload_size;
+    std::memset(change.serializedPayload.data, 0xA5, payload_size);
+
+    NullSender sender;
+    {
+        // Messages are flushed when the group is full, and when it is destroyed
+        RTPSMessageGroup group(participant.impl(), writer, &sender);
+        for (auto _ : state)
+        {
+            ++change.sequenceNumber;
+            benchmark::DoNotOptimize(group.add_data(change, false));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * payload_size);
+
+    RTPSDomain::removeRTPSWriter(writer);
+}
+
+} // namespace
+
+BENCHMARK(BM_RTPSMessageGroup_add_data)->Arg(64)->Arg(1024)->Arg(16384);
@@ -0,0 +1,115 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ResourceEventBenchmarks.cpp
+ *
+ * Scheduling of timed events on a ResourceEvent, as done by the writers and readers on every heartbeat, ACKNACK and
+ * deadline.
+ */
+
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <fastdds/rtps/resources/ResourceEvent.h>
+#include <fastdds/rtps/resources/TimedEvent.h>
+
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+//! Interval long enough for the events to never be triggered during the benchmark
+constexpr double idle_interval_ms = 3600.0 * 1000.0;
+
+/**
+ * Schedule an event and cancel it, while other events are pending on the same service.
+ * Arguments: number of other pending events.
+ */
+void BM_ResourceEvent_restart_cancel(
+        benchmark::State& state)
+{
+    const size_t num_pending = static_cast<size_t>(state.range(0));
+
+    ResourceEvent service;
+    service.init_thread();
+
+    std::vector<std::unique_ptr<TimedEvent>> pending;
+    pending.reserve(num_pending);
+    for (size_t i = 0; i < num_pending; ++i)
+    {
+        pending.emplace_back(new TimedEvent(service, []()
+                {
+                    return false;
+                }, idle_interval_ms + static_cast<double>(i)));
+        pending.back()->restart_timer();
+    }
+
+    TimedEvent event(service, []()
+            {
+                return false;
+            }, idle_interval_ms / 2.0);
+
+    for (auto _ : state)
+    {
+        event.restart_timer();
+        event.cancel_timer();
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Time from scheduling an event with no delay until its callback runs on the event thread.
+ */
+void BM_ResourceEvent_trigger(
+        benchmark::State& state)
+{
+    ResourceEvent service;
+    service.init_thread();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool triggered = false;
+
+    TimedEvent event(service, [&]()
+            {
+                std::lock_guard<std::mutex> guard(mutex);
+                triggered = true;
+                cv.notify_one();
+                return false;
+            }, 0);
+
+    for (auto _ : state)
+    {
+        event.restart_timer();
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&triggered]()
+                {
+                    return triggered;
+                });
+        triggered = false;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+} // namespace
+
+BENCHMARK(BM_ResourceEvent_restart_cancel)->Arg(0)->Arg(64)->Arg(1024);
+BENCHMARK(BM_ResourceEvent_trigger)->UseRealTime();
@@ -0,0 +1,148 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TopicPayloadPoolBenchmarks.cpp
+ *
+ * Reservation and release of payloads on the topic payload pools, for each memory management policy.
+ */
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastdds/rtps/resources/ResourceManagement.h>
+
+#include <rtps/history/PoolConfig.h>
+#include <rtps/history/TopicPayloadPoolRegistry.hpp>
+
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+constexpr uint32_t payload_size = 1024u;
+
+const char* policy_name(
+        MemoryManagementPolicy_t policy)
+{
+    switch (policy)
+    {
+        case PREALLOCATED_MEMORY_MODE:
+            return "PREALLOCATED";
+        case PREALLOCATED_WITH_REALLOC_MEMORY_MODE:
+            return "PREALLOCATED_WITH_REALLOC";
+        case DYNAMIC_RESERVE_MEMORY_MODE:
+            return "DYNAMIC_RESERVE";
+        case DYNAMIC_REUSABLE_MEMORY_MODE:
+            return "DYNAMIC_REUSABLE";
+    }
+    return "UNKNOWN";
+}
+
+/**
+ * Writer side: reserve a batch of payloads for new samples and release them afterwards, as a writer history with the
+ * given depth would do.
+ * Arguments: memory policy, number of payloads held at the same time.
+ */
+void BM_TopicPayloadPool_get_release(
+        benchmark::State& state)
+{
+    const MemoryManagementPolicy_t policy = static_cast<MemoryManagementPolicy_t>(state.range(0));
+    const uint32_t depth = static_cast<uint32_t>(state.range(1));
+    state.SetLabel(policy_name(policy));
+
+    PoolConfig config(policy, payload_size, depth, depth);
+    auto pool = TopicPayloadPoolRegistry::get("microbenchmarks_get_release", config);
+    pool->reserve_history(config, false);
+
+    std::vector<CacheChange_t> changes(depth);
+    for (auto _ : state)
+    {
+        for (CacheChange_t& change : changes)
+        {
+            pool->get_payload(payload_size, change);
+        }
+        for (CacheChange_t& change : changes)
+        {
+            pool->release_payload(change);
+        }
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * depth);
+
+    pool->release_history(config, false);
+}
+
+/**
+ * Reader side: copy a payload received on a reception buffer to the pool, and release it afterwards.
+ * Arguments: memory policy.
+ */
+void BM_TopicPayloadPool_copy_release(
+        benchmark::State& state)
+{
+    const MemoryManagementPolicy_t policy = static_cast<MemoryManagementPolicy_t>(state.range(0));
+    state.SetLabel(policy_name(policy));
+
+    PoolConfig config(policy, payload_size, 1u, 1u);
+    auto pool = TopicPayloadPoolRegistry::get("microbenchmarks_copy_release", config);
+    pool->reserve_history(config, true);
+
+    SerializedPayload_t received(payload_size);
+    received.length = payload_size;
+    std::memset(received.data, 0xA5, payload_size);
+
+    CacheChange_t change;
+    change.writerGUID.guidPrefix.value[0] = 0x01;
+    change.writerGUID.entityId = EntityId_t(0x00000103);
+    for (auto _ : state)
+    {
+        ++change.sequenceNumber;
+        IPayloadPool* owner = nullptr;
+        pool->get_payload(received, owner, change);
+        pool->release_payload(change);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * payload_size);
+
+    pool->release_history(config, true);
+}
+
+void policies(
+        benchmark::internal::Benchmark* b)
+{
+    for (int policy = PREALLOCATED_MEMORY_MODE; policy <= DYNAMIC_REUSABLE_MEMORY_MODE; ++policy)
+    {
+        b->Args({policy});
+    }
+}
+
+void policies_and_depths(
+        benchmark::internal::Benchmark* b)
+{
+    for (int policy = PREALLOCATED_MEMORY_MODE; policy <= DYNAMIC_REUSABLE_MEMORY_MODE; ++policy)
+    {
+        b->Args({policy, 1})->Args({policy, 64});
+    }
+}
+
+} // namespace
+
+BENCHMARK(BM_TopicPayloadPool_get_release)->Apply(policies_and_depths);
+BENCHMARK(BM_TopicPayloadPool_copy_release)->Apply(policies);
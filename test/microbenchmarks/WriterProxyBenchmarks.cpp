@@ -0,0 +1,218 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file WriterProxyBenchmarks.cpp
+ *
+ * Tracking of the sequence numbers received from a reliable writer: in order, out of order and with gaps announced
+ * by heartbeats.
+ */
+
+#include <cstdint>
+#include <mutex>
+
+#include <benchmark/benchmark.h>
+
+#include <fastdds/rtps/attributes/HistoryAttributes.h>
+#include <fastdds/rtps/attributes/ReaderAttributes.h>
+#include <fastdds/rtps/attributes/RTPSParticipantAllocationAttributes.hpp>
+#include <fastdds/rtps/builtin/data/WriterProxyData.h>
+#include <fastdds/rtps/history/ReaderHistory.h>
+#include <fastdds/rtps/reader/StatefulReader.h>
+#include <fastdds/rtps/RTPSDomain.h>
+#include <fastrtps/utils/collections/ResourceLimitedContainerConfig.hpp>
+
+#include <rtps/reader/WriterProxy.h>
+
+#include "BenchmarkParticipant.hpp"
+
+using namespace eprosima::fastrtps::rtps;
+using eprosima::fastrtps::ResourceLimitedContainerConfig;
+using eprosima::fastdds::microbenchmarks::BenchmarkParticipant;
+
+namespace {
+
+//! Reliable reader with a WriterProxy started for a remote writer
+class WriterProxyFixture
+{
+public:
+
+    WriterProxyFixture()
+        : history_(HistoryAttributes())
+        , wdata_(1u, 1u)
+    {
+        if (!participant_.is_valid())
+        {
+            return;
+        }
+
+        ReaderAttributes ratt;
+        ratt.endpoint.reliabilityKind = RELIABLE;
+        ratt.endpoint.topicKind = NO_KEY;
+        reader_ = dynamic_cast<StatefulReader*>(
+            RTPSDomain::createRTPSReader(participant_.participant(), ratt, &history_));
+        if (nullptr == reader_)
+        {
+            return;
+        }
+
+        GUID_t writer_guid;
+        writer_guid.guidPrefix.value[0] = 0x01;
+        writer_guid.guidPrefix.value[11] = 0x01;
+        writer_guid.entityId = EntityId_t(0x00000102);
+        wdata_.guid(writer_guid);
+        wdata_.topicKind(NO_KEY);
+
+        proxy_ = new WriterProxy(reader_, RemoteLocatorsAllocationAttributes(), ResourceLimitedContainerConfig());
+        std::lock_guard<RecursiveTimedMutex> guard(reader_->getMutex());
+        proxy_->start(wdata_, SequenceNumber_t());
+    }
+
+    ~WriterProxyFixture()
+    {
+        if (nullptr != proxy_)
+        {
+            {
+                std::lock_guard<RecursiveTimedMutex> guard(reader_->getMutex());
+                proxy_->stop();
+            }
+            delete proxy_;
+        }
+        if (nullptr != reader_)
+        {
+            RTPSDomain::removeRTPSReader(reader_);
+        }
+    }
+
+    bool is_valid() const
+    {
+        return nullptr != proxy_;
+    }
+
+    RecursiveTimedMutex& mutex()
+    {
+        return reader_->getMutex();
+    }
+
+    WriterProxy& proxy()
+    {
+        return *proxy_;
+    }
+
+private:
+
+    BenchmarkParticipant participant_;
+    ReaderHistory history_;
+    WriterProxyData wdata_;
+    StatefulReader* reader_ = nullptr;
+    WriterProxy* proxy_ = nullptr;
+};
+
+/**
+ * Changes received in order, the usual case.
+ */
+void BM_WriterProxy_in_order(
+        benchmark::State& state)
+{
+    WriterProxyFixture fixture;
+    if (!fixture.is_valid())
+    {
+        state.SkipWithError("Could not create writer proxy");
+        return;
+    }
+
+    SequenceNumber_t sn;
+    for (auto _ : state)
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(fixture.mutex());
+        benchmark::DoNotOptimize(fixture.proxy().received_change_set(++sn));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Changes received in reverse order in blocks, as when a burst is repaired after the first sample of the next one
+ * has already arrived.
+ * Arguments: changes on each block.
+ */
+void BM_WriterProxy_reversed(
+        benchmark::State& state)
+{
+    const uint32_t block = static_cast<uint32_t>(state.range(0));
+
+    WriterProxyFixture fixture;
+    if (!fixture.is_valid())
+    {
+        state.SkipWithError("Could not create writer proxy");
+        return;
+    }
+
+    SequenceNumber_t base;
+    for (auto _ : state)
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(fixture.mutex());
+        for (uint32_t i = block; i > 0; --i)
+        {
+            benchmark::DoNotOptimize(fixture.proxy().received_change_set(base + i));
+        }
+        base = base + block;
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * block);
+}
+
+/**
+ * A heartbeat announces a block of changes of which only half have been received. The missing ones are computed for
+ * the ACKNACK, and then repaired.
+ * Arguments: changes on each block.
+ */
+void BM_WriterProxy_heartbeat_and_repair(
+        benchmark::State& state)
+{
+    const uint32_t block = static_cast<uint32_t>(state.range(0));
+
+    WriterProxyFixture fixture;
+    if (!fixture.is_valid())
+    {
+        state.SkipWithError("Could not create writer proxy");
+        return;
+    }
+
+    SequenceNumber_t base;
+    for (auto _ : state)
+    {
+        std::lock_guard<RecursiveTimedMutex> guard(fixture.mutex());
+        WriterProxy& proxy = fixture.proxy();
+        for (uint32_t i = 2; i <= block; i += 2)
+        {
+            proxy.received_change_set(base + i);
+        }
+        proxy.missing_changes_update(base + block);
+        benchmark::DoNotOptimize(proxy.missing_changes());
+        for (uint32_t i = 1; i <= block; i += 2)
+        {
+            proxy.received_change_set(base + i);
+        }
+        base = base + block;
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * block);
+}
+
+} // namespace
+
+BENCHMARK(BM_WriterProxy_in_order);
+BENCHMARK(BM_WriterProxy_reversed)->Arg(16)->Arg(256);
+BENCHMARK(BM_WriterProxy_heartbeat_and_repair)->Arg(16)->Arg(256);
@@ -34,6 +34,7 @@ class RTPSWriter;
 class RTPSReader;
 struct SubmessageHeader_t;
 class ReceiverResource;
+class IPayloadPool;
 
 /**
  * Class MessageReceiver, process the received messages.
@@ -50,6 +51,18 @@ public:
 
     }
 
+    MessageReceiver(
+            RTPSParticipantImpl* /*participant*/,
+            uint32_t /*rec_buffer_size*/)
+    {
+    }
+
+    MessageReceiver(
+            const MessageReceiver& /*endpoints_owner*/,
+            uint32_t /*rec_buffer_size*/)
+    {
+    }
+
     virtual ~MessageReceiver()
     {
     }
@@ -69,6 +82,14 @@ public:
     {
     }
 
+    virtual void processCDRMsg(
+            const Locator_t& /*source_locator*/,
+            const Locator_t& /*reception_locator*/,
+            CDRMessage_t* /*msg*/,
+            IPayloadPool* /*buffer_owner*/ = nullptr)
+    {
+    }
+
     void setReceiverResource(
             ReceiverResource* /*receiverResource*/)
     {
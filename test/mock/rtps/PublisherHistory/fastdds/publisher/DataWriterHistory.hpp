@@ -130,6 +130,12 @@ public:
         return result;
     }
 
+    bool may_block_adding_change(
+            const InstanceHandle_t&)
+    {
+        return m_isHistoryFull;
+    }
+
     bool is_key_registered(
             const InstanceHandle_t& handle)
     {
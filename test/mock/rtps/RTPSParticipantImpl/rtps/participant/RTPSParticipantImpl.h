@@ -331,6 +331,10 @@ public:
 
     MOCK_METHOD(bool, ignore_participant, (const GuidPrefix_t&));
 
+    MOCK_METHOD(bool, is_participant_ignored, (const GuidPrefix_t&));
+
+    MOCK_METHOD(void, assert_remote_participant_liveliness, (const GuidPrefix_t&));
+
 private:
 
     MockParticipantListener listener_;
@@ -161,6 +161,11 @@ public:
     MOCK_METHOD1(reader_data_filter, void(
             fastdds::rtps::IReaderDataFilter* filter));
 
+    MOCK_METHOD0(begin_batch, void());
+
+    MOCK_METHOD1(end_batch, void(
+            const std::chrono::time_point<std::chrono::steady_clock>&));
+
     // *INDENT-ON*
 
     const GUID_t& getGuid() const
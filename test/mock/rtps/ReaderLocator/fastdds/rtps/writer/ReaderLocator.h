@@ -144,6 +144,11 @@ public:
         return true;
     }
 
+    void shm_payload_descriptors(
+            bool /*accepted*/)
+    {
+    }
+
     /**
      * Check if the destinations managed by this sender interface have changed.
      *
@@ -0,0 +1,63 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReaderProxy.h
+ */
+
+#ifndef _FASTDDS_RTPS_WRITER_READERPROXY_H_
+#define _FASTDDS_RTPS_WRITER_READERPROXY_H_
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/common/Guid.h>
+#include <fastdds/rtps/common/SequenceNumber.h>
+
+namespace eprosima {
+namespace fastrtps {
+namespace rtps {
+
+/**
+ * ReaderProxy class that helps to keep the state of a specific Reader with respect to the RTPSWriter.
+ * @ingroup WRITER_MODULE
+ */
+class ReaderProxy
+{
+public:
+
+    const GUID_t& guid() const
+    {
+        return guid_;
+    }
+
+    bool rtps_is_relevant(
+            CacheChange_t* /*change*/) const
+    {
+        return true;
+    }
+
+    bool change_is_acked(
+            const SequenceNumber_t& /*seq_num*/) const
+    {
+        return acked_;
+    }
+
+    GUID_t guid_;
+    bool acked_ = false;
+};
+
+} // namespace rtps
+} // namespace fastrtps
+} // namespace eprosima
+
+#endif // _FASTDDS_RTPS_WRITER_READERPROXY_H_
@@ -96,6 +96,17 @@ public:
         return false;
     }
 
+    void shm_payload_descriptors(
+            bool accepted)
+    {
+        shm_payload_descriptors_ = accepted;
+    }
+
+    bool shm_payload_descriptors() const
+    {
+        return shm_payload_descriptors_;
+    }
+
     void add_unicast_locator(
             const Locator_t& locator)
     {
@@ -393,6 +404,7 @@ private:
     InstanceHandle_t m_RTPSParticipantKey;
     uint16_t m_userDefinedId;
     fastdds::rtps::ContentFilterProperty content_filter_;
+    bool shm_payload_descriptors_ = false;
 
 };
 
@@ -54,6 +54,15 @@ public:
     {
     }
 
+    void disable()
+    {
+    }
+
+    bool is_shared() const
+    {
+        return shared_;
+    }
+
     ReceiverResource(
             ReceiverResource&&)
     {
@@ -101,7 +110,8 @@ protected:
     ReceiverResource(
             TransportInterface& transport,
             const Locator_t& locator,
-            uint32_t max_recv_buffer_size)
+            uint32_t max_recv_buffer_size,
+            bool = false)
         : mValid(false)
         , m_maxMsgSize(max_recv_buffer_size)
     {
@@ -128,6 +138,7 @@ protected:
     std::function<bool(const Locator_t&)> LocatorMapsToManagedChannel;
     bool mValid;
     uint32_t m_maxMsgSize;
+    bool shared_ = false;
 
 private:
 
@@ -0,0 +1,50 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file SharedMemPayloadPool.hpp
+ */
+
+#ifndef _FASTDDS_SHAREDMEM_PAYLOAD_POOL_H_
+#define _FASTDDS_SHAREDMEM_PAYLOAD_POOL_H_
+
+#include <cstdint>
+#include <memory>
+
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/history/IPayloadPool.h>
+#include <rtps/history/PoolConfig.h>
+
+namespace eprosima {
+namespace fastdds {
+namespace rtps {
+
+class SharedMemPayloadPool : public fastrtps::rtps::IPayloadPool
+{
+public:
+
+    static std::shared_ptr<SharedMemPayloadPool> create(
+            uint32_t /*segment_size*/,
+            const fastrtps::rtps::PoolConfig& /*config*/)
+    {
+        return nullptr;
+    }
+
+};
+
+}  // namespace rtps
+}  // namespace fastdds
+}  // namespace eprosima
+
+#endif  // _FASTDDS_SHAREDMEM_PAYLOAD_POOL_H_
@@ -110,6 +110,58 @@ typedef struct SharedMemTransportDescriptor : public PortBasedTransportDescripto
         rtps_dump_file_ = rtps_dump_file;
     }
 
+    //! Return whether the segment buffers are allocated with the lock-free size-class allocator
+    RTPS_DllAPI bool lock_free_segment_allocation() const
+    {
+        return lock_free_segment_allocation_;
+    }
+
+    //! Set whether the segment buffers are allocated with the lock-free size-class allocator
+    RTPS_DllAPI void lock_free_segment_allocation(
+            bool lock_free_segment_allocation)
+    {
+        lock_free_segment_allocation_ = lock_free_segment_allocation;
+    }
+
+    //! Return the time a listener busy-polls its port for new data before blocking on it (us)
+    RTPS_DllAPI uint32_t listener_spin_budget_us() const
+    {
+        return listener_spin_budget_us_;
+    }
+
+    //! Set the time a listener busy-polls its port for new data before blocking on it (us)
+    RTPS_DllAPI void listener_spin_budget_us(
+            uint32_t listener_spin_budget_us)
+    {
+        listener_spin_budget_us_ = listener_spin_budget_us;
+    }
+
+    //! Return whether the segment memory is advised to be backed by huge pages
+    RTPS_DllAPI bool segment_huge_pages() const
+    {
+        return segment_huge_pages_;
+    }
+
+    //! Set whether the segment memory is advised to be backed by huge pages
+    RTPS_DllAPI void segment_huge_pages(
+            bool segment_huge_pages)
+    {
+        segment_huge_pages_ = segment_huge_pages;
+    }
+
+    //! Return the NUMA node the segment memory is bound to (negative means no binding)
+    RTPS_DllAPI int32_t segment_numa_node() const
+    {
+        return segment_numa_node_;
+    }
+
+    //! Set the NUMA node the segment memory is bound to (negative means no binding)
+    RTPS_DllAPI void segment_numa_node(
+            int32_t segment_numa_node)
+    {
+        segment_numa_node_ = segment_numa_node;
+    }
+
     //! Return the thread settings for the transport dump thread
     RTPS_DllAPI ThreadSettings dump_thread() const
     {
@@ -129,6 +181,10 @@ private:
     uint32_t port_queue_capacity_;
     uint32_t healthy_check_timeout_ms_;
     std::string rtps_dump_file_;
+    int32_t segment_numa_node_ = -1;
+    bool segment_huge_pages_ = false;
+    bool lock_free_segment_allocation_ = false;
+    uint32_t listener_spin_budget_us_ = 0;
     ThreadSettings dump_thread_;
 
 }SharedMemTransportDescriptor;
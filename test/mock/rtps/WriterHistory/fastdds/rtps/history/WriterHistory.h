@@ -53,6 +53,7 @@ public:
     virtual ~WriterHistory() = default;
 
     using iterator = std::vector<CacheChange_t*>::iterator;
+    using const_iterator = std::vector<CacheChange_t*>::const_iterator;
 
     // *INDENT-OFF* Uncrustify makes a mess with MOCK_METHOD macros
     MOCK_METHOD1(add_change_mock, bool(CacheChange_t*));
@@ -144,6 +145,19 @@ public:
         return ret;
     }
 
+    iterator remove_change(
+            const_iterator removal,
+            bool release = true)
+    {
+        CacheChange_t* change = *removal;
+        iterator ret = m_changes.erase(m_changes.begin() + (removal - m_changes.cbegin()));
+        if (release)
+        {
+            delete change;
+        }
+        return ret;
+    }
+
     virtual bool remove_change_g(
             fastrtps::rtps::CacheChange_t* a_change)
     {
@@ -0,0 +1,398 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_DiscoveryServerStressTest.cpp
+ *
+ * Measures the time a discovery server needs to match the endpoints of many clients created at once.
+ * The server and all the clients live in this process and communicate over UDP loopback.
+ */
+
+#include "../optionarg.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <fastdds/dds/core/policy/ParameterTypes.hpp>
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/DataWriterListener.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+#include <fastdds/dds/topic/TopicDataType.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+#include <fastdds/rtps/attributes/ServerAttributes.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#if defined(_MSC_VER)
+#pragma warning (push)
+#pragma warning (disable:4512)
+#endif // if defined(_MSC_VER)
+
+using namespace eprosima::fastdds::dds;
+using namespace eprosima::fastrtps::rtps;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    CLIENTS,
+    TOPICS,
+    ENDPOINTS,
+    THREADS,
+    ROUNDS,
+    PORT,
+    TIMEOUT
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT, 0, "",  "",          Arg::None,
+      "Usage: DiscoveryServerStressTest [options]\n\nGeneral options:" },
+    { HELP,        0, "h", "help",      Arg::None,
+      "  -h       \t--help           \tProduce help message." },
+    { CLIENTS,     0, "c", "clients",   Arg::Numeric,
+      "  -c <num>,\t--clients=<num>  \tNumber of client participants (Default: 50)." },
+    { TOPICS,      0, "t", "topics",    Arg::Numeric,
+      "  -t <num>,\t--topics=<num>   \tNumber of topics (Default: 10)." },
+    { ENDPOINTS,   0, "e", "endpoints", Arg::Numeric,
+      "  -e <num>,\t--endpoints=<num>\tWriters and readers created by each client (Default: 2)." },
+    { THREADS,     0, "",  "threads",   Arg::Numeric,
+      "           \t--threads=<num>  \tDiscovery database processing threads on the server (Default: 1)." },
+    { ROUNDS,      0, "r", "rounds",    Arg::Numeric,
+      "  -r <num>,\t--rounds=<num>   \tTimes all the clients are created and destroyed (Default: 1)." },
+    { PORT,        0, "p", "port",      Arg::Numeric,
+      "  -p <num>,\t--port=<num>     \tServer UDP port on loopback (Default: 11811)." },
+    { TIMEOUT,     0, "",  "timeout",   Arg::Numeric,
+      "           \t--timeout=<num>  \tSeconds to wait for the matching of each round (Default: 300)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+//! Type without contents. Only discovery traffic is exchanged
+class StressDataType : public TopicDataType
+{
+public:
+
+    StressDataType()
+    {
+        setName("StressDataType");
+        m_typeSize = 4;
+        m_isGetKeyDefined = false;
+    }
+
+    bool serialize(
+            void* /*data*/,
+            SerializedPayload_t* /*payload*/) override
+    {
+        return false;
+    }
+
+    bool deserialize(
+            SerializedPayload_t* /*payload*/,
+            void* /*data*/) override
+    {
+        return false;
+    }
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* /*data*/) override
+    {
+        return []()
+               {
+                   return 4u;
+               };
+    }
+
+    void* createData() override
+    {
+        return nullptr;
+    }
+
+    void deleteData(
+            void* /*data*/) override
+    {
+    }
+
+    bool getKey(
+            void* /*data*/,
+            InstanceHandle_t* /*ihandle*/,
+            bool /*force_md5*/) override
+    {
+        return false;
+    }
+
+};
+
+//! Counts the matches of all the endpoints of the test
+class MatchCounter : public DataWriterListener, public DataReaderListener
+{
+public:
+
+    void on_publication_matched(
+            DataWriter* /*writer*/,
+            const PublicationMatchedStatus& info) override
+    {
+        count(writer_matches_, info.current_count_change);
+    }
+
+    void on_subscription_matched(
+            DataReader* /*reader*/,
+            const SubscriptionMatchedStatus& info) override
+    {
+        count(reader_matches_, info.current_count_change);
+    }
+
+    void reset()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        writer_matches_ = 0;
+        reader_matches_ = 0;
+    }
+
+    bool wait(
+            int64_t expected,
+            std::chrono::seconds timeout)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        return cv_.wait_for(lock, timeout, [this, expected]()
+                       {
+                           return writer_matches_ == expected && reader_matches_ == expected;
+                       });
+    }
+
+private:
+
+    void count(
+            int64_t& matches,
+            int32_t change)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            matches += change;
+        }
+        cv_.notify_all();
+    }
+
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    int64_t writer_matches_ = 0;
+    int64_t reader_matches_ = 0;
+};
+
+static const char* server_prefix = "44.53.00.5f.45.50.52.4f.53.49.4d.41";
+
+static DomainParticipantQos loopback_qos(
+        const std::string& name)
+{
+    DomainParticipantQos pqos;
+    pqos.name(name);
+    pqos.transport().use_builtin_transports = false;
+    auto udp = std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>();
+    udp->interfaceWhiteList.push_back("127.0.0.1");
+    pqos.transport().user_transports.push_back(udp);
+    return pqos;
+}
+
+static Locator_t server_locator(
+        uint16_t port)
+{
+    Locator_t locator;
+    locator.kind = LOCATOR_KIND_UDPv4;
+    IPLocator::setIPv4(locator, "127.0.0.1");
+    IPLocator::setPhysicalPort(locator, port);
+    return locator;
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+
+    uint32_t num_clients = 50;
+    uint32_t num_topics = 10;
+    uint32_t num_endpoints = 2;
+    uint32_t num_threads = 1;
+    uint32_t num_rounds = 1;
+    uint16_t port = 11811;
+    uint32_t timeout_sec = 300;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP] || options[UNKNOWN_OPT])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        uint32_t value = static_cast<uint32_t>(strtol(opt.arg, nullptr, 10));
+        switch (opt.index())
+        {
+            case CLIENTS:
+                num_clients = value;
+                break;
+            case TOPICS:
+                num_topics = value > 0 ? value : 1;
+                break;
+            case ENDPOINTS:
+                num_endpoints = value;
+                break;
+            case THREADS:
+                num_threads = value;
+                break;
+            case ROUNDS:
+                num_rounds = value;
+                break;
+            case PORT:
+                port = static_cast<uint16_t>(value);
+                break;
+            case TIMEOUT:
+                timeout_sec = value;
+                break;
+            default:
+                break;
+        }
+    }
+
+    Log::SetVerbosity(Log::Kind::Error);
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    TypeSupport type(new StressDataType());
+
+    // Server
+    DomainParticipantQos server_qos = loopback_qos("DS-Stress-Server");
+    server_qos.wire_protocol().builtin.discovery_config.discoveryProtocol = DiscoveryProtocol_t::SERVER;
+    std::istringstream(server_prefix) >> server_qos.wire_protocol().prefix;
+    server_qos.wire_protocol().builtin.metatrafficUnicastLocatorList.push_back(server_locator(port));
+    server_qos.properties().properties().emplace_back(parameter_discovery_processing_threads,
+            std::to_string(num_threads));
+    DomainParticipant* server = factory->create_participant(0, server_qos);
+    if (nullptr == server)
+    {
+        std::cout << "Error creating the server participant" << std::endl;
+        return 1;
+    }
+
+    // Every reader matches all the writers on its topic, and the other way around
+    std::vector<int64_t> endpoints_per_topic(num_topics, 0);
+    for (uint32_t i = 0; i < num_clients * num_endpoints; ++i)
+    {
+        ++endpoints_per_topic[i % num_topics];
+    }
+    int64_t expected_matches = 0;
+    for (int64_t endpoints : endpoints_per_topic)
+    {
+        expected_matches += endpoints * endpoints;
+    }
+
+    std::cout << "Clients: " << num_clients << ", topics: " << num_topics << ", endpoints per client: " <<
+        num_endpoints << ", processing threads: " << num_threads << ", expected matches: " << expected_matches <<
+        std::endl;
+
+    MatchCounter counter;
+    eprosima::fastdds::rtps::RemoteServerAttributes remote_server;
+    std::istringstream(server_prefix) >> remote_server.guidPrefix;
+    remote_server.metatrafficUnicastLocatorList.push_back(server_locator(port));
+
+    int ret = 0;
+    for (uint32_t round = 0; round < num_rounds && 0 == ret; ++round)
+    {
+        counter.reset();
+        std::vector<DomainParticipant*> clients;
+        clients.reserve(num_clients);
+
+        auto start = std::chrono::steady_clock::now();
+        for (uint32_t c = 0; c < num_clients; ++c)
+        {
+            DomainParticipantQos client_qos = loopback_qos("DS-Stress-Client-" + std::to_string(c));
+            client_qos.wire_protocol().builtin.discovery_config.discoveryProtocol = DiscoveryProtocol_t::CLIENT;
+            client_qos.wire_protocol().builtin.discovery_config.m_DiscoveryServers.push_back(remote_server);
+            DomainParticipant* client = factory->create_participant(0, client_qos);
+            if (nullptr == client)
+            {
+                std::cout << "Error creating client participant " << c << std::endl;
+                ret = 1;
+                break;
+            }
+            clients.push_back(client);
+            type.register_type(client);
+
+            Publisher* publisher = client->create_publisher(PUBLISHER_QOS_DEFAULT);
+            Subscriber* subscriber = client->create_subscriber(SUBSCRIBER_QOS_DEFAULT);
+            for (uint32_t e = 0; e < num_endpoints; ++e)
+            {
+                std::string topic_name = "stress_topic_" + std::to_string((c * num_endpoints + e) % num_topics);
+                Topic* topic = client->create_topic(topic_name, type.get_type_name(), TOPIC_QOS_DEFAULT);
+                publisher->create_datawriter(topic, DATAWRITER_QOS_DEFAULT, &counter);
+                subscriber->create_datareader(topic, DATAREADER_QOS_DEFAULT, &counter);
+            }
+        }
+
+        if (0 == ret)
+        {
+            if (counter.wait(expected_matches, std::chrono::seconds(timeout_sec)))
+            {
+                auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::steady_clock::now() - start);
+                std::cout << "Round " << round << ": all endpoints matched in " << elapsed.count() << " ms" <<
+                    std::endl;
+            }
+            else
+            {
+                std::cout << "Round " << round << ": timeout waiting for the endpoints to match" << std::endl;
+                ret = 1;
+            }
+        }
+
+        for (DomainParticipant* client : clients)
+        {
+            client->delete_contained_entities();
+            factory->delete_participant(client);
+        }
+    }
+
+    server->delete_contained_entities();
+    factory->delete_participant(server);
+
+    return ret;
+}
+
+#if defined(_MSC_VER)
+#pragma warning (pop)
+#endif // if defined(_MSC_VER)
@@ -0,0 +1,418 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main_FlatDynamicDataBenchmark.cpp
+ *
+ * Compares DynamicData and FlatDynamicData when filling, serializing and deserializing samples of a type with nested
+ * structures and sequences:
+ *
+ *     struct Point { double x; double y; double z; };
+ *     struct Item { long id; string name; Point position; sequence<double> values; };
+ *     struct Sample { unsigned long id; Item header; sequence<Item> items; };
+ */
+
+#include "../optionarg.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/FlatDynamicData.h>
+
+#if defined(_MSC_VER)
+#pragma warning (push)
+#pragma warning (disable:4512)
+#endif // if defined(_MSC_VER)
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::types;
+
+enum  optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    ITERATIONS,
+    ITEMS,
+    VALUES
+};
+
+const option::Descriptor usage[] = {
+    { UNKNOWN_OPT, 0, "",  "",           Arg::None,
+      "Usage: FlatDynamicDataBenchmark [options]\n\nGeneral options:" },
+    { HELP,        0, "h", "help",       Arg::None,
+      "  -h       \t--help            \tProduce help message." },
+    { ITERATIONS,  0, "i", "iterations", Arg::Numeric,
+      "  -i <num>,\t--iterations=<num>\tSamples processed on each measurement (Default: 10000)." },
+    { ITEMS,       0, "n", "items",      Arg::Numeric,
+      "  -n <num>,\t--items=<num>     \tElements of the sequence of structures (Default: 16)." },
+    { VALUES,      0, "v", "values",     Arg::Numeric,
+      "  -v <num>,\t--values=<num>    \tElements of each sequence of doubles (Default: 16)." },
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Types
+{
+    DynamicType_ptr item;
+    DynamicType_ptr sample;
+};
+
+Types create_types()
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+
+    DynamicTypeBuilder* point_builder = factory->create_struct_builder();
+    point_builder->set_name("Point");
+    point_builder->add_member(0, "x", factory->create_float64_type());
+    point_builder->add_member(1, "y", factory->create_float64_type());
+    point_builder->add_member(2, "z", factory->create_float64_type());
+    DynamicType_ptr point = point_builder->build();
+
+    DynamicTypeBuilder* item_builder = factory->create_struct_builder();
+    item_builder->set_name("Item");
+    item_builder->add_member(0, "id", factory->create_int32_type());
+    item_builder->add_member(1, "name", factory->create_string_type());
+    item_builder->add_member(2, "position", point);
+    item_builder->add_member(3, "values", factory->create_sequence_builder(factory->create_float64_type())->build());
+
+    Types types;
+    types.item = item_builder->build();
+
+    DynamicTypeBuilder* sample_builder = factory->create_struct_builder();
+    sample_builder->set_name("Sample");
+    sample_builder->add_member(0, "id", factory->create_uint32_type());
+    sample_builder->add_member(1, "header", types.item);
+    sample_builder->add_member(2, "items", factory->create_sequence_builder(types.item)->build());
+    types.sample = sample_builder->build();
+    return types;
+}
+
+void fill_item(
+        DynamicData* item,
+        int32_t id,
+        uint32_t num_values)
+{
+    item->set_int32_value(id, 0);
+    item->set_string_value("item_" + std::to_string(id), 1);
+
+    DynamicData* position = item->loan_value(2);
+    position->set_float64_value(1.0 * id, 0);
+    position->set_float64_value(2.0 * id, 1);
+    position->set_float64_value(3.0 * id, 2);
+    item->return_loaned_value(position);
+
+    MemberId value_id = MEMBER_ID_INVALID;
+    DynamicData* values = item->loan_value(3);
+    for (uint32_t i = 0; i < num_values; ++i)
+    {
+        values->insert_float64_value(0.5 * i, value_id);
+    }
+    item->return_loaned_value(values);
+}
+
+DynamicData* create_dynamic_sample(
+        const Types& types,
+        uint32_t num_items,
+        uint32_t num_values)
+{
+    DynamicData* sample = DynamicDataFactory::get_instance()->create_data(types.sample);
+    sample->set_uint32_value(1, 0);
+
+    DynamicData* header = sample->loan_value(1);
+    fill_item(header, 0, num_values);
+    sample->return_loaned_value(header);
+
+    MemberId item_id = MEMBER_ID_INVALID;
+    DynamicData* items = sample->loan_value(2);
+    for (uint32_t i = 0; i < num_items; ++i)
+    {
+        items->insert_sequence_data(item_id);
+        DynamicData* item = items->loan_value(item_id);
+        fill_item(item, static_cast<int32_t>(i + 1), num_values);
+        items->return_loaned_value(item);
+    }
+    sample->return_loaned_value(items);
+    return sample;
+}
+
+void fill_item(
+        FlatDynamicData& data,
+        const FlatDynamicData::Ref& item,
+        int32_t id,
+        uint32_t num_values)
+{
+    FlatDynamicData::Ref member;
+    FlatDynamicData::Ref element;
+    data.get_member(member, item, 0);
+    data.set_value(member, id);
+    data.get_member(member, item, 1);
+    data.set_value(member, "item_" + std::to_string(id));
+
+    FlatDynamicData::Ref position;
+    data.get_member(position, item, 2);
+    for (uint32_t i = 0; i < 3; ++i)
+    {
+        data.get_member(member, position, i);
+        data.set_value(member, (i + 1.0) * id);
+    }
+
+    data.get_member(member, item, 3);
+    data.resize(member, num_values);
+    for (uint32_t i = 0; i < num_values; ++i)
+    {
+        data.get_element(element, member, i);
+        data.set_value(element, 0.5 * i);
+    }
+}
+
+void fill_flat_sample(
+        FlatDynamicData& data,
+        uint32_t num_items,
+        uint32_t num_values)
+{
+    data.clear();
+    FlatDynamicData::Ref root = data.root();
+    FlatDynamicData::Ref member;
+    FlatDynamicData::Ref element;
+
+    data.get_member(member, root, 0);
+    data.set_value(member, static_cast<uint32_t>(1));
+    data.get_member(member, root, 1);
+    fill_item(data, member, 0, num_values);
+
+    FlatDynamicData::Ref items;
+    data.get_member(items, root, 2);
+    data.resize(items, num_items);
+    for (uint32_t i = 0; i < num_items; ++i)
+    {
+        data.get_element(element, items, i);
+        fill_item(data, element, static_cast<int32_t>(i + 1), num_values);
+    }
+}
+
+bool serialize(
+        const FlatDynamicData& data,
+        SerializedPayload_t& payload)
+{
+    eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload.data), payload.max_size);
+    eprosima::fastcdr::Cdr ser(fastbuffer
+#if FASTCDR_VERSION_MAJOR == 1
+            , eprosima::fastcdr::Cdr::DEFAULT_ENDIAN
+            , eprosima::fastcdr::Cdr::CdrType::DDS_CDR
+#endif // FASTCDR_VERSION_MAJOR == 1
+            );
+    try
+    {
+        ser.serialize_encapsulation();
+        data.serialize(ser);
+    }
+    catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+    {
+        return false;
+    }
+#if FASTCDR_VERSION_MAJOR == 1
+    payload.length = static_cast<uint32_t>(ser.getSerializedDataLength());
+#else
+    payload.length = static_cast<uint32_t>(ser.get_serialized_data_length());
+#endif // FASTCDR_VERSION_MAJOR == 1
+    return true;
+}
+
+bool deserialize(
+        FlatDynamicData& data,
+        SerializedPayload_t& payload)
+{
+    eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload.data), payload.length);
+    eprosima::fastcdr::Cdr deser(fastbuffer
+#if FASTCDR_VERSION_MAJOR == 1
+            , eprosima::fastcdr::Cdr::DEFAULT_ENDIAN
+            , eprosima::fastcdr::Cdr::CdrType::DDS_CDR
+#endif // FASTCDR_VERSION_MAJOR == 1
+            );
+    try
+    {
+        deser.read_encapsulation();
+    }
+    catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+    {
+        return false;
+    }
+    return data.deserialize(deser);
+}
+
+template<typename Function>
+double measure_ns(
+        uint32_t iterations,
+        Function function)
+{
+    Clock::time_point start = Clock::now();
+    for (uint32_t i = 0; i < iterations; ++i)
+    {
+        function();
+    }
+    std::chrono::duration<double, std::nano> elapsed = Clock::now() - start;
+    return elapsed.count() / iterations;
+}
+
+void print_result(
+        const std::string& operation,
+        double dynamic_ns,
+        double flat_ns)
+{
+    std::cout << std::left << std::setw(14) << operation << std::right << std::fixed << std::setprecision(1)
+              << std::setw(16) << dynamic_ns << std::setw(16) << flat_ns
+              << std::setw(10) << std::setprecision(2) << dynamic_ns / flat_ns << "x" << std::endl;
+}
+
+} // namespace
+
+int main(
+        int argc,
+        char** argv)
+{
+    int columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 80;
+
+    uint32_t iterations = 10000;
+    uint32_t num_items = 16;
+    uint32_t num_values = 16;
+
+    argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error())
+    {
+        return 1;
+    }
+
+    if (options[HELP] || options[UNKNOWN_OPT])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return 0;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        uint32_t value = static_cast<uint32_t>(strtol(opt.arg, nullptr, 10));
+        switch (opt.index())
+        {
+            case ITERATIONS:
+                iterations = value > 0 ? value : 1;
+                break;
+            case ITEMS:
+                num_items = value;
+                break;
+            case VALUES:
+                num_values = value;
+                break;
+            default:
+                break;
+        }
+    }
+
+    Types types = create_types();
+    DynamicPubSubType pubsub_type(types.sample);
+    std::shared_ptr<const FlatDynamicLayout> layout = FlatDynamicLayout::create(types.sample);
+    if (!layout)
+    {
+        std::cerr << "Error computing the layout of the sample type" << std::endl;
+        return 1;
+    }
+
+    DynamicData* dynamic_sample = create_dynamic_sample(types, num_items, num_values);
+    FlatDynamicData flat_sample(layout);
+    fill_flat_sample(flat_sample, num_items, num_values);
+
+    SerializedPayload_t dynamic_payload(pubsub_type.getSerializedSizeProvider(dynamic_sample)());
+    SerializedPayload_t flat_payload(static_cast<uint32_t>(flat_sample.getCdrSerializedSize()) + 4u);
+    if (!pubsub_type.serialize(dynamic_sample, &dynamic_payload) || !serialize(flat_sample, flat_payload) ||
+            dynamic_payload.length != flat_payload.length)
+    {
+        std::cerr << "Both representations should serialize to the same size" << std::endl;
+        return 1;
+    }
+
+    std::cout << "Sample of " << dynamic_payload.length << " bytes: " << num_items << " items with "
+              << num_values << " values each, " << iterations << " iterations" << std::endl;
+    std::cout << std::left << std::setw(14) << "ns/sample" << std::right << std::setw(16) << "DynamicData"
+              << std::setw(16) << "FlatDynamicData" << std::setw(11) << "speedup" << std::endl;
+
+    double dynamic_ns = measure_ns(iterations, [&]()
+                    {
+                        DynamicData* data = create_dynamic_sample(types, num_items, num_values);
+                        DynamicDataFactory::get_instance()->delete_data(data);
+                    });
+    FlatDynamicData flat_fill(layout);
+    double flat_ns = measure_ns(iterations, [&]()
+                    {
+                        fill_flat_sample(flat_fill, num_items, num_values);
+                    });
+    print_result("fill", dynamic_ns, flat_ns);
+
+    dynamic_ns = measure_ns(iterations, [&]()
+                    {
+                        pubsub_type.serialize(dynamic_sample, &dynamic_payload);
+                    });
+    flat_ns = measure_ns(iterations, [&]()
+                    {
+                        serialize(flat_sample, flat_payload);
+                    });
+    print_result("serialize", dynamic_ns, flat_ns);
+
+    DynamicData* dynamic_received = DynamicDataFactory::get_instance()->create_data(types.sample);
+    FlatDynamicData flat_received(layout);
+    dynamic_ns = measure_ns(iterations, [&]()
+                    {
+                        pubsub_type.deserialize(&dynamic_payload, dynamic_received);
+                    });
+    flat_ns = measure_ns(iterations, [&]()
+                    {
+                        deserialize(flat_received, flat_payload);
+                    });
+    print_result("deserialize", dynamic_ns, flat_ns);
+
+    DynamicDataFactory::get_instance()->delete_data(dynamic_received);
+    DynamicDataFactory::get_instance()->delete_data(dynamic_sample);
+    DynamicDataFactory::delete_instance();
+    DynamicTypeBuilderFactory::delete_instance();
+    eprosima::fastdds::dds::Log::KillThread();
+    return 0;
+}
+
+#if defined(_MSC_VER)
+#pragma warning (pop)
+#endif // if defined(_MSC_VER)
@@ -0,0 +1,326 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyHistogram.cpp
+ *
+ */
+
+#include "LatencyHistogram.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+
+namespace {
+
+//! Number of bits needed to represent a positive value
+int32_t bit_length(
+        uint64_t value)
+{
+    int32_t bits = 0;
+    while (value != 0)
+    {
+        ++bits;
+        value >>= 1;
+    }
+    return bits;
+}
+
+} // namespace
+
+LatencyHistogram::LatencyHistogram(
+        int64_t highest_trackable_value,
+        int significant_digits)
+    : highest_trackable_value_(std::max<int64_t>(highest_trackable_value, 2))
+    , significant_digits_(std::min(std::max(significant_digits, 1), 5))
+{
+    // Sub-buckets are sized so that values up to 2 * 10^digits are recorded with a resolution of one unit.
+    int64_t largest_value_with_single_unit_resolution = 2;
+    for (int i = 0; i < significant_digits_; ++i)
+    {
+        largest_value_with_single_unit_resolution *= 10;
+    }
+    int32_t sub_bucket_count_magnitude = bit_length(static_cast<uint64_t>(largest_value_with_single_unit_resolution));
+    sub_bucket_half_count_magnitude_ = std::max(sub_bucket_count_magnitude, 1) - 1;
+    sub_bucket_count_ = 1 << (sub_bucket_half_count_magnitude_ + 1);
+    sub_bucket_half_count_ = sub_bucket_count_ / 2;
+    sub_bucket_mask_ = static_cast<int64_t>(sub_bucket_count_) - 1;
+
+    // Each bucket doubles the range of the previous one
+    int64_t smallest_untrackable_value = sub_bucket_count_;
+    bucket_count_ = 1;
+    while (smallest_untrackable_value <= highest_trackable_value_)
+    {
+        if (smallest_untrackable_value > (std::numeric_limits<int64_t>::max)() / 2)
+        {
+            ++bucket_count_;
+            break;
+        }
+        smallest_untrackable_value <<= 1;
+        ++bucket_count_;
+    }
+
+    counts_.assign(static_cast<size_t>(bucket_count_ + 1) * static_cast<size_t>(sub_bucket_half_count_), 0);
+}
+
+void LatencyHistogram::record(
+        int64_t value,
+        uint64_t count)
+{
+    value = std::min(std::max<int64_t>(value, 0), highest_trackable_value_);
+
+    counts_[counts_index_for(value)] += count;
+
+    if (0 == total_count_)
+    {
+        min_value_ = value;
+        max_value_ = value;
+    }
+    else
+    {
+        min_value_ = std::min(min_value_, value);
+        max_value_ = std::max(max_value_, value);
+    }
+    total_count_ += count;
+}
+
+void LatencyHistogram::add(
+        const LatencyHistogram& other)
+{
+    if (0 == other.total_count_)
+    {
+        return;
+    }
+
+    // Keep the exact extremes of both histograms, instead of the ones of the buckets where they are recorded
+    int64_t other_min = std::min(other.min_value_, highest_trackable_value_);
+    int64_t other_max = std::min(other.max_value_, highest_trackable_value_);
+    int64_t min_value = (0 == total_count_) ? other_min : std::min(min_value_, other_min);
+    int64_t max_value = (0 == total_count_) ? other_max : std::max(max_value_, other_max);
+
+    for (size_t i = 0; i < other.counts_.size(); ++i)
+    {
+        if (0 != other.counts_[i])
+        {
+            record(other.value_at_index(i), other.counts_[i]);
+        }
+    }
+
+    min_value_ = min_value;
+    max_value_ = max_value;
+}
+
+void LatencyHistogram::reset()
+{
+    std::fill(counts_.begin(), counts_.end(), 0);
+    total_count_ = 0;
+    min_value_ = 0;
+    max_value_ = 0;
+}
+
+int64_t LatencyHistogram::min() const
+{
+    return min_value_;
+}
+
+int64_t LatencyHistogram::max() const
+{
+    return max_value_;
+}
+
+double LatencyHistogram::mean() const
+{
+    if (0 == total_count_)
+    {
+        return 0.0;
+    }
+
+    double total = 0.0;
+    for (size_t i = 0; i < counts_.size(); ++i)
+    {
+        if (0 != counts_[i])
+        {
+            total += static_cast<double>(median_equivalent(value_at_index(i))) * static_cast<double>(counts_[i]);
+        }
+    }
+    return total / static_cast<double>(total_count_);
+}
+
+double LatencyHistogram::stdev() const
+{
+    if (0 == total_count_)
+    {
+        return 0.0;
+    }
+
+    double mean_value = mean();
+    double geometric_deviation_total = 0.0;
+    for (size_t i = 0; i < counts_.size(); ++i)
+    {
+        if (0 != counts_[i])
+        {
+            double deviation = static_cast<double>(median_equivalent(value_at_index(i))) - mean_value;
+            geometric_deviation_total += deviation * deviation * static_cast<double>(counts_[i]);
+        }
+    }
+    return std::sqrt(geometric_deviation_total / static_cast<double>(total_count_));
+}
+
+int64_t LatencyHistogram::value_at_percentile(
+        double percentile) const
+{
+    if (0 == total_count_)
+    {
+        return 0;
+    }
+
+    percentile = std::min(std::max(percentile, 0.0), 100.0);
+    uint64_t count_at_percentile =
+            static_cast<uint64_t>(((percentile / 100.0) * static_cast<double>(total_count_)) + 0.5);
+    count_at_percentile = std::max<uint64_t>(count_at_percentile, 1);
+
+    uint64_t total = 0;
+    for (size_t i = 0; i < counts_.size(); ++i)
+    {
+        total += counts_[i];
+        if (total >= count_at_percentile)
+        {
+            return std::min(highest_equivalent(value_at_index(i)), max_value_);
+        }
+    }
+    return max_value_;
+}
+
+void LatencyHistogram::output_percentile_distribution(
+        std::ostream& out,
+        int32_t ticks_per_half_distance,
+        double value_unit_scaling) const
+{
+    char line[128];
+
+    std::snprintf(line, sizeof(line), "%12s %14s %10s %14s\n\n", "Value", "Percentile", "TotalCount",
+            "1/(1-Percentile)");
+    out << line;
+
+    // Percentiles are reported with a resolution that doubles each time the distance to 100% is halved
+    double percentile_to_iterate_to = 0.0;
+    uint64_t total = 0;
+    for (size_t i = 0; i < counts_.size() && total < total_count_; ++i)
+    {
+        if (0 == counts_[i])
+        {
+            continue;
+        }
+
+        total += counts_[i];
+        double value = static_cast<double>(std::min(highest_equivalent(value_at_index(i)), max_value_)) /
+                value_unit_scaling;
+
+        if (total == total_count_)
+        {
+            std::snprintf(line, sizeof(line), "%12.3f %2.12f %10llu\n", value, 1.0,
+                    static_cast<unsigned long long>(total));
+            out << line;
+            break;
+        }
+
+        double current_percentile = (100.0 * static_cast<double>(total)) / static_cast<double>(total_count_);
+        while (current_percentile >= percentile_to_iterate_to)
+        {
+            double percentile = percentile_to_iterate_to / 100.0;
+            std::snprintf(line, sizeof(line), "%12.3f %2.12f %10llu %14.2f\n", value, percentile,
+                    static_cast<unsigned long long>(total), 1.0 / (1.0 - percentile));
+            out << line;
+
+            double half_distance = std::floor(std::log2(100.0 / (100.0 - percentile_to_iterate_to))) + 1.0;
+            double percentile_reporting_ticks = static_cast<double>(ticks_per_half_distance) *
+                    std::pow(2.0, half_distance);
+            percentile_to_iterate_to += 100.0 / percentile_reporting_ticks;
+        }
+    }
+
+    std::snprintf(line, sizeof(line), "#[Mean    = %12.3f, StdDeviation   = %12.3f]\n",
+            mean() / value_unit_scaling, stdev() / value_unit_scaling);
+    out << line;
+    std::snprintf(line, sizeof(line), "#[Max     = %12.3f, Total count    = %12llu]\n",
+            static_cast<double>(max_value_) / value_unit_scaling, static_cast<unsigned long long>(total_count_));
+    out << line;
+    std::snprintf(line, sizeof(line), "#[Buckets = %12d, SubBuckets     = %12d]\n", bucket_count_,
+            sub_bucket_count_);
+    out << line;
+}
+
+size_t LatencyHistogram::counts_index_for(
+        int64_t value) const
+{
+    int32_t bucket = bucket_index(value);
+    int32_t sub_bucket = static_cast<int32_t>(value >> bucket);
+    int32_t bucket_base_index = (bucket + 1) << sub_bucket_half_count_magnitude_;
+    size_t index = static_cast<size_t>(bucket_base_index + (sub_bucket - sub_bucket_half_count_));
+    assert(index < counts_.size());
+    return index;
+}
+
+int64_t LatencyHistogram::value_at_index(
+        size_t index) const
+{
+    int32_t bucket = static_cast<int32_t>(index >> sub_bucket_half_count_magnitude_) - 1;
+    int32_t sub_bucket = static_cast<int32_t>(index & static_cast<size_t>(sub_bucket_half_count_ - 1)) +
+            sub_bucket_half_count_;
+    if (bucket < 0)
+    {
+        sub_bucket -= sub_bucket_half_count_;
+        bucket = 0;
+    }
+    return static_cast<int64_t>(sub_bucket) << bucket;
+}
+
+int64_t LatencyHistogram::size_of_equivalent_range(
+        int64_t value) const
+{
+    int32_t bucket = bucket_index(value);
+    int32_t sub_bucket = static_cast<int32_t>(value >> bucket);
+    int32_t adjusted_bucket = (sub_bucket >= sub_bucket_count_) ? bucket + 1 : bucket;
+    return int64_t(1) << adjusted_bucket;
+}
+
+int64_t LatencyHistogram::lowest_equivalent(
+        int64_t value) const
+{
+    int32_t bucket = bucket_index(value);
+    return (value >> bucket) << bucket;
+}
+
+int64_t LatencyHistogram::highest_equivalent(
+        int64_t value) const
+{
+    return lowest_equivalent(value) + size_of_equivalent_range(value) - 1;
+}
+
+int64_t LatencyHistogram::median_equivalent(
+        int64_t value) const
+{
+    return lowest_equivalent(value) + (size_of_equivalent_range(value) >> 1);
+}
+
+int32_t LatencyHistogram::bucket_index(
+        int64_t value) const
+{
+    // Smallest power of two containing the value, measured from the first bucket
+    int32_t pow2_ceiling = bit_length(static_cast<uint64_t>(value | sub_bucket_mask_));
+    return pow2_ceiling - (sub_bucket_half_count_magnitude_ + 1);
+}
@@ -0,0 +1,135 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyHistogram.hpp
+ *
+ */
+
+#ifndef LATENCYHISTOGRAM_H_
+#define LATENCYHISTOGRAM_H_
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+/**
+ * Histogram of latencies with the layout of HdrHistogram.
+ *
+ * Values are recorded on buckets whose width doubles on each power of two, each one split in a fixed number of
+ * sub-buckets, so the relative error of any recorded value is bounded by the configured significant digits.
+ * The memory used only depends on the trackable range, not on the number of recorded values, and two histograms
+ * can be merged by adding their counts.
+ */
+class LatencyHistogram
+{
+public:
+
+    /**
+     * @param highest_trackable_value Largest value that can be told apart. Larger values are recorded as this one.
+     * @param significant_digits Decimal digits of precision kept for every value, between 1 and 5.
+     */
+    LatencyHistogram(
+            int64_t highest_trackable_value,
+            int significant_digits);
+
+    /**
+     * Records a value.
+     * @param value Value to record. Negative values are recorded as 0.
+     * @param count Number of times the value is recorded.
+     */
+    void record(
+            int64_t value,
+            uint64_t count = 1);
+
+    /**
+     * Adds all the values recorded on another histogram.
+     * @param other Histogram to add, which may have a different configuration.
+     */
+    void add(
+            const LatencyHistogram& other);
+
+    //! Removes all the recorded values.
+    void reset();
+
+    uint64_t total_count() const
+    {
+        return total_count_;
+    }
+
+    int64_t min() const;
+
+    int64_t max() const;
+
+    double mean() const;
+
+    double stdev() const;
+
+    /**
+     * @param percentile Percentile, between 0 and 100.
+     * @return Highest value equivalent to the one at the given percentile, or 0 if the histogram is empty.
+     */
+    int64_t value_at_percentile(
+            double percentile) const;
+
+    /**
+     * Writes the percentile distribution on the text format of HdrHistogram (.hgrm), which can be plotted and compared
+     * with other runs using the HdrHistogram tools.
+     * @param out Stream to write to.
+     * @param ticks_per_half_distance Number of reported percentiles between the current one and 100%.
+     * @param value_unit_scaling Ratio by which the recorded values are divided when written.
+     */
+    void output_percentile_distribution(
+            std::ostream& out,
+            int32_t ticks_per_half_distance,
+            double value_unit_scaling) const;
+
+private:
+
+    size_t counts_index_for(
+            int64_t value) const;
+
+    int64_t value_at_index(
+            size_t index) const;
+
+    int64_t size_of_equivalent_range(
+            int64_t value) const;
+
+    int64_t lowest_equivalent(
+            int64_t value) const;
+
+    int64_t highest_equivalent(
+            int64_t value) const;
+
+    int64_t median_equivalent(
+            int64_t value) const;
+
+    int32_t bucket_index(
+            int64_t value) const;
+
+    int64_t highest_trackable_value_;
+    int significant_digits_;
+    int32_t sub_bucket_half_count_magnitude_;
+    int32_t sub_bucket_count_;
+    int32_t sub_bucket_half_count_;
+    int64_t sub_bucket_mask_;
+    int32_t bucket_count_;
+
+    std::vector<uint64_t> counts_;
+    uint64_t total_count_ = 0;
+    int64_t min_value_ = 0;
+    int64_t max_value_ = 0;
+};
+
+#endif /* LATENCYHISTOGRAM_H_ */
@@ -40,13 +40,20 @@
 
 
 #define TIME_LIMIT_US 10000
+// Latencies are recorded in nanoseconds, up to one minute and with 3 significant digits
+#define HISTOGRAM_HIGHEST_VALUE_NS 60000000000LL
+#define HISTOGRAM_SIGNIFICANT_DIGITS 3
+// Time waiting for the echoes still in flight after the last sample is sent on open loop
+#define OPEN_LOOP_DRAIN_TIME_MS 1000
 
 using namespace eprosima::fastdds::dds;
 using namespace eprosima::fastrtps::rtps;
 using namespace eprosima::fastrtps::types;
 
 LatencyTestPublisher::LatencyTestPublisher()
-    : latency_command_type_(new TestCommandDataType())
+    : histogram_(HISTOGRAM_HIGHEST_VALUE_NS, HISTOGRAM_SIGNIFICANT_DIGITS)
+    , uncorrected_histogram_(HISTOGRAM_HIGHEST_VALUE_NS, HISTOGRAM_SIGNIFICANT_DIGITS)
+    , latency_command_type_(new TestCommandDataType())
     , data_writer_listener_(this)
     , data_reader_listener_(this)
     , command_writer_listener_(this)
@@ -96,6 +103,7 @@ bool LatencyTestPublisher::init(
         bool export_csv,
         const std::string& export_prefix,
         std::string raw_data_file,
+        bool export_histograms,
         const PropertyPolicy& part_property_policy,
         const PropertyPolicy& property_policy,
         const std::string& xml_config_file,
@@ -104,6 +112,7 @@ bool LatencyTestPublisher::init(
         bool data_loans,
         Arg::EnablerValue shared_memory,
         int forced_domain,
+        uint32_t rate,
         LatencyDataSizes& latency_data_sizes)
 {
     // Initialize state
@@ -119,6 +128,8 @@ bool LatencyTestPublisher::init(
     shared_memory_ = shared_memory;
     forced_domain_ = forced_domain;
     raw_data_file_ = raw_data_file;
+    export_histograms_ = export_histograms;
+    rate_ = rate;
     pid_ = pid;
     hostname_ = hostname;
 
@@ -577,33 +588,37 @@ void LatencyTestPublisher::LatencyDataReaderListener::on_data_available(
             bounce_time = std::chrono::duration<uint32_t, std::nano>(pub->latency_data_in_->bounce);
         }
 
+        unsigned int seqnum = pub->dynamic_types_ ?
+                pub->dynamic_data_in_->get_uint32_value(0) :
+                pub->latency_data_in_->seqnum;
+
+        if (pub->rate_ > 0)
+        {
+            // Several samples are in flight, so the echo is matched with the send times of its sequence number
+            if (0 == seqnum || seqnum >= pub->sent_times_.size())
+            {
+                EPROSIMA_LOG_INFO(LatencyTest, "Echo message received is not the expected one");
+            }
+            else
+            {
+                pub->end_time_ = std::chrono::steady_clock::now();
+                pub->end_time_ -= bounce_time;
+                pub->record_latency(seqnum, pub->end_time_ - pub->scheduled_times_[seqnum],
+                        pub->end_time_ - pub->sent_times_[seqnum]);
+            }
+        }
         // Check if is the expected echo message
-        if ((pub->dynamic_types_
-                && (pub->dynamic_data_in_->get_uint32_value(0)
-                != pub->dynamic_data_out_->get_uint32_value(0)))
-                || (!pub->dynamic_types_
-                && (pub->latency_data_in_->seqnum
-                != pub->latency_data_out_->seqnum)))
+        else if (seqnum != (pub->dynamic_types_ ?
+                pub->dynamic_data_out_->get_uint32_value(0) :
+                pub->latency_data_out_->seqnum))
         {
             EPROSIMA_LOG_INFO(LatencyTest, "Echo message received is not the expected one");
         }
         else
         {
-            // Factor of 2 below is to calculate the roundtrip divided by two. Note that nor the overhead does not
-            // need to be halved, as we access the clock twice per round trip
             pub->end_time_ = std::chrono::steady_clock::now();
             pub->end_time_ -= bounce_time;
-            auto roundtrip = std::chrono::duration<double, std::micro>(pub->end_time_ - pub->start_time_) / 2.0;
-            roundtrip -= pub->overhead_time_;
-
-            // Discard samples were loan failed due to payload outages
-            // in that case the roundtrip will match the os scheduler quantum slice
-            if (roundtrip.count() > 0
-                    && !(pub->data_loans_ && roundtrip.count() > 10000))
-            {
-                pub->times_.push_back(roundtrip);
-                ++pub->received_count_;
-            }
+            pub->record_latency(seqnum, pub->end_time_ - pub->start_time_, pub->end_time_ - pub->start_time_);
 
             // Reset seqnum from out data
             if (pub->dynamic_types_)
@@ -622,7 +637,10 @@ void LatencyTestPublisher::LatencyDataReaderListener::on_data_available(
         }
 
         ++pub->data_msg_count_;
-        notify = pub->data_msg_count_ >= pub->subscribers_;
+        // On open loop only the end of the test is waited for, when all the echoes have been received
+        notify = pub->data_msg_count_ >= (pub->rate_ > 0 ?
+                pub->subscribers_ * static_cast<int>(pub->samples_ + 1) :
+                pub->subscribers_);
     }
 
     if (notify)
@@ -658,8 +676,11 @@ void LatencyTestPublisher::run()
 
     // Print a summary table with the measurements
     printf("Printing round-trip times in us, statistics for %d samples\n", samples_);
-    printf("   Bytes, Samples,   stdev,    mean,     min,     50%%,     90%%,     99%%,  99.99%%,     max\n");
-    printf("--------,--------,--------,--------,--------,--------,--------,--------,--------,--------,\n");
+    if (rate_ > 0)
+    {
+        printf("Open loop at %u samples/s, times measured from the scheduled send time\n", rate_);
+    }
+    print_header();
     for (uint16_t i = 0; i < stats_.size(); i++)
     {
         print_stats(DATA_BASE_INDEX + i, stats_[i]);
@@ -670,6 +691,16 @@ void LatencyTestPublisher::run()
         }
     }
 
+    if (rate_ > 0)
+    {
+        printf("\nOpen loop at %u samples/s, times measured from the actual send time\n", rate_);
+        print_header();
+        for (TimeStats& stats : uncorrected_stats_)
+        {
+            print_row(stats);
+        }
+    }
+
     if (export_csv_)
     {
         export_csv("_minimum_", str_reliable, *output_files_[MINIMUM_INDEX]);
@@ -699,7 +730,6 @@ bool LatencyTestPublisher::test(
         uint32_t datasize)
 {
     test_status_ = 0;
-    received_count_ = 0;
 
     if (dynamic_types_)
     {
@@ -758,6 +788,8 @@ bool LatencyTestPublisher::test(
 
     // Signal the subscribers the publisher is READY
     times_.clear();
+    histogram_.reset();
+    uncorrected_histogram_.reset();
     TestCommandType command;
     command.m_command = READY;
     if (!command_writer_->write(&command))
@@ -783,90 +815,9 @@ bool LatencyTestPublisher::test(
             return command_msg_count_ >= subscribers_;
         });
 
-    // The first measurement it's usually not representative, so we take one more and then drop the first one.
-    for (unsigned int count = 1; count <= samples_ + 1; ++count)
+    if (!(rate_ > 0 ? send_open_loop() : send_closed_loop()))
     {
-        void* data = nullptr;
-
-        if (dynamic_types_)
-        {
-            dynamic_data_in_->set_uint32_value(0, 0);
-            dynamic_data_out_->set_uint32_value(count, 0);
-            data = dynamic_data_out_;
-        }
-        else
-        {
-            // Initialize the sample to send
-            latency_data_out_->seqnum = count;
-
-            // loan each sample
-            if (data_loans_)
-            {
-                latency_data_in_ = nullptr;
-                int trials = 10;
-                bool loaned = false;
-
-                while (trials-- != 0 && !loaned)
-                {
-                    loaned = (ReturnCode_t::RETCODE_OK
-                            ==  data_writer_->loan_sample(
-                                data,
-                                DataWriter::LoanInitializationKind::NO_LOAN_INITIALIZATION));
-
-                    std::this_thread::yield();
-
-                    if (!loaned)
-                    {
-                        EPROSIMA_LOG_INFO(LatencyTest, "Publisher trying to loan: " << trials);
-                    }
-                }
-
-                if (!loaned)
-                {
-                    EPROSIMA_LOG_ERROR(LatencyTest, "Problem on Publisher test data with loan");
-                    continue; // next iteration
-                }
-
-                // copy the data to the loan
-                auto data_type = std::static_pointer_cast<LatencyDataType>(latency_data_type_);
-                data_type->copy_data(*latency_data_out_, *(LatencyType*)data);
-            }
-            else
-            {
-                data = latency_data_out_;
-            }
-
-            // reset the reception sample data
-            if (latency_data_in_)
-            {
-                latency_data_in_->seqnum = 0;
-            }
-        }
-
-        start_time_ = std::chrono::steady_clock::now();
-
-        // Data publishing
-        if (!data_writer_->write(data))
-        {
-            // return the loan
-            if (data_loans_)
-            {
-                data_writer_->discard_loan(data);
-            }
-
-            EPROSIMA_LOG_ERROR(LatencyTest, "Publisher write operation failed");
-            return false;
-        }
-
-        std::unique_lock<std::mutex> lock(mutex_);
-        // the wait timeouts due possible message leaks
-        data_msg_cv_.wait_for(lock,
-                std::chrono::milliseconds(100),
-                [&]()
-                {
-                    return data_msg_count_ >= subscribers_;
-                });
-        data_msg_count_ = 0;
+        return false;
     }
 
     command.m_command = STOP;
@@ -918,9 +869,6 @@ bool LatencyTestPublisher::test(
         return false;
     }
 
-    // Drop the first measurement, as it's usually not representative
-    times_.erase(times_.begin());
-
     // Log all data to CSV file if specified
     if (raw_data_file_ != "")
     {
@@ -929,75 +877,276 @@ bool LatencyTestPublisher::test(
 
     analyze_times(datasize);
 
+    if (export_histograms_)
+    {
+        export_histograms(datasize);
+    }
+
     return true;
 }
 
-void LatencyTestPublisher::analyze_times(
-        uint32_t datasize)
+bool LatencyTestPublisher::send_closed_loop()
 {
-    // Collect statistics
-    TimeStats stats;
-    stats.bytes_ = datasize;
-    stats.received_ = received_count_ - 1;  // Because we are not counting the first one.
-    stats.minimum_ = *min_element(times_.begin(), times_.end());
-    stats.maximum_ = *max_element(times_.begin(), times_.end());
-    stats.mean_ = accumulate(times_.begin(), times_.end(),
-                    std::chrono::duration<double, std::micro>(0)).count() / times_.size();
-
-    double aux_stdev = 0;
-    for (std::vector<std::chrono::duration<double, std::micro>>::iterator tit = times_.begin(); tit != times_.end();
-            ++tit)
+    // The first measurement it's usually not representative, so we take one more and then drop the first one.
+    for (unsigned int count = 1; count <= samples_ + 1; ++count)
     {
-        aux_stdev += pow(((*tit).count() - stats.mean_), 2);
+        void* data = nullptr;
+
+        if (!prepare_sample(count, data))
+        {
+            continue; // next iteration
+        }
+
+        start_time_ = std::chrono::steady_clock::now();
+
+        // Data publishing
+        if (!write_sample(data))
+        {
+            return false;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex_);
+        // the wait timeouts due possible message leaks
+        data_msg_cv_.wait_for(lock,
+                std::chrono::milliseconds(100),
+                [&]()
+                {
+                    return data_msg_count_ >= subscribers_;
+                });
+        data_msg_count_ = 0;
     }
-    aux_stdev = sqrt(aux_stdev / times_.size());
-    stats.stdev_ = aux_stdev;
 
-    /* Percentiles */
-    sort(times_.begin(), times_.end());
+    return true;
+}
 
-    size_t elem = 0;
-    elem = static_cast<size_t>(times_.size() * 0.5);
-    if (elem > 0 && elem <= times_.size())
+bool LatencyTestPublisher::send_open_loop()
+{
+    const std::chrono::nanoseconds interval(1000000000 / rate_);
+
+    // The send times are indexed by sequence number. The schedule is fixed beforehand, so it does not depend on how
+    // long each write takes.
+    std::chrono::steady_clock::time_point test_start = std::chrono::steady_clock::now();
     {
-        stats.percentile_50_ = times_.at(--elem).count();
+        std::lock_guard<std::mutex> lock(mutex_);
+        scheduled_times_.assign(samples_ + 2, std::chrono::steady_clock::time_point());
+        sent_times_.assign(samples_ + 2, std::chrono::steady_clock::time_point());
+        for (unsigned int count = 1; count <= samples_ + 1; ++count)
+        {
+            scheduled_times_[count] = test_start + interval * (count - 1);
+        }
     }
-    else
+
+    // The first measurement it's usually not representative, so we take one more and then drop the first one.
+    for (unsigned int count = 1; count <= samples_ + 1; ++count)
     {
-        stats.percentile_50_ = NAN;
+        // If the previous write was delayed past this sample's slot, it is sent right away
+        std::this_thread::sleep_until(scheduled_times_[count]);
+
+        void* data = nullptr;
+
+        if (!prepare_sample(count, data))
+        {
+            continue; // next iteration
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            sent_times_[count] = std::chrono::steady_clock::now();
+        }
+
+        // Data publishing
+        if (!write_sample(data))
+        {
+            return false;
+        }
     }
 
-    elem = static_cast<size_t>(times_.size() * 0.9);
-    if (elem > 0 && elem <= times_.size())
+    // Wait for the echoes still in flight
+    std::unique_lock<std::mutex> lock(mutex_);
+    data_msg_cv_.wait_for(lock,
+            std::chrono::milliseconds(OPEN_LOOP_DRAIN_TIME_MS),
+            [&]()
+            {
+                return data_msg_count_ >= subscribers_ * static_cast<int>(samples_ + 1);
+            });
+    data_msg_count_ = 0;
+
+    return true;
+}
+
+bool LatencyTestPublisher::prepare_sample(
+        unsigned int seqnum,
+        void*& data)
+{
+    // On open loop the listener may be taking an echo on the reception sample, so it is not reset
+    bool reset_reception = 0 == rate_;
+
+    if (dynamic_types_)
     {
-        stats.percentile_90_ = times_.at(--elem).count();
+        if (reset_reception)
+        {
+            dynamic_data_in_->set_uint32_value(0, 0);
+        }
+        dynamic_data_out_->set_uint32_value(seqnum, 0);
+        data = dynamic_data_out_;
     }
     else
     {
-        stats.percentile_90_ = NAN;
+        // Initialize the sample to send
+        latency_data_out_->seqnum = seqnum;
+
+        // loan each sample
+        if (data_loans_)
+        {
+            if (reset_reception)
+            {
+                latency_data_in_ = nullptr;
+            }
+            int trials = 10;
+            bool loaned = false;
+
+            while (trials-- != 0 && !loaned)
+            {
+                loaned = (ReturnCode_t::RETCODE_OK
+                        ==  data_writer_->loan_sample(
+                            data,
+                            DataWriter::LoanInitializationKind::NO_LOAN_INITIALIZATION));
+
+                std::this_thread::yield();
+
+                if (!loaned)
+                {
+                    EPROSIMA_LOG_INFO(LatencyTest, "Publisher trying to loan: " << trials);
+                }
+            }
+
+            if (!loaned)
+            {
+                EPROSIMA_LOG_ERROR(LatencyTest, "Problem on Publisher test data with loan");
+                return false;
+            }
+
+            // copy the data to the loan
+            auto data_type = std::static_pointer_cast<LatencyDataType>(latency_data_type_);
+            data_type->copy_data(*latency_data_out_, *(LatencyType*)data);
+        }
+        else
+        {
+            data = latency_data_out_;
+        }
+
+        // reset the reception sample data
+        if (reset_reception && latency_data_in_)
+        {
+            latency_data_in_->seqnum = 0;
+        }
+    }
+
+    return true;
+}
+
+bool LatencyTestPublisher::write_sample(
+        void* data)
+{
+    if (!data_writer_->write(data))
+    {
+        // return the loan
+        if (data_loans_)
+        {
+            data_writer_->discard_loan(data);
+        }
+
+        EPROSIMA_LOG_ERROR(LatencyTest, "Publisher write operation failed");
+        return false;
     }
 
-    elem = static_cast<size_t>(times_.size() * 0.99);
-    if (elem > 0 && elem <= times_.size())
+    return true;
+}
+
+void LatencyTestPublisher::record_latency(
+        unsigned int seqnum,
+        std::chrono::steady_clock::duration elapsed,
+        std::chrono::steady_clock::duration sent_elapsed)
+{
+    // Drop the first measurement, as it's usually not representative
+    if (seqnum <= 1)
     {
-        stats.percentile_99_ = times_.at(--elem).count();
+        return;
     }
-    else
+
+    // Factor of 2 below is to calculate the roundtrip divided by two. Note that nor the overhead does not
+    // need to be halved, as we access the clock twice per round trip
+    auto roundtrip = std::chrono::duration<double, std::micro>(elapsed) / 2.0 - overhead_time_;
+    auto sent_roundtrip = std::chrono::duration<double, std::micro>(sent_elapsed) / 2.0 - overhead_time_;
+
+    // Discard samples were loan failed due to payload outages
+    // in that case the roundtrip will match the os scheduler quantum slice
+    if (roundtrip.count() <= 0
+            || (data_loans_ && sent_roundtrip.count() > 10000))
     {
-        stats.percentile_99_ = NAN;
+        return;
     }
 
-    elem = static_cast<size_t>(times_.size() * 0.9999);
-    if (elem > 0 && elem <= times_.size())
+    histogram_.record(static_cast<int64_t>(roundtrip.count() * 1000.0));
+    if (rate_ > 0)
     {
-        stats.percentile_9999_ = times_.at(--elem).count();
+        uncorrected_histogram_.record(static_cast<int64_t>(sent_roundtrip.count() * 1000.0));
     }
-    else
+
+    if (raw_data_file_ != "")
     {
-        stats.percentile_9999_ = NAN;
+        times_.push_back(roundtrip);
     }
+}
+
+void LatencyTestPublisher::analyze_times(
+        uint32_t datasize)
+{
+    // Collect statistics
+    auto collect = [datasize](const LatencyHistogram& histogram) -> TimeStats
+            {
+                TimeStats stats;
+                stats.bytes_ = datasize;
+                stats.received_ = static_cast<unsigned int>(histogram.total_count());
 
-    stats_.push_back(stats);
+                if (0 == histogram.total_count())
+                {
+                    stats.percentile_50_ = NAN;
+                    stats.percentile_90_ = NAN;
+                    stats.percentile_99_ = NAN;
+                    stats.percentile_999_ = NAN;
+                    stats.percentile_9999_ = NAN;
+                    return stats;
+                }
+
+                // Histograms record nanoseconds
+                stats.minimum_ = std::chrono::duration<double, std::micro>(histogram.min() / 1000.0);
+                stats.maximum_ = std::chrono::duration<double, std::micro>(histogram.max() / 1000.0);
+                stats.mean_ = histogram.mean() / 1000.0;
+                stats.stdev_ = histogram.stdev() / 1000.0;
+
+                /* Percentiles */
+                stats.percentile_50_ = histogram.value_at_percentile(50.0) / 1000.0;
+                stats.percentile_90_ = histogram.value_at_percentile(90.0) / 1000.0;
+                stats.percentile_99_ = histogram.value_at_percentile(99.0) / 1000.0;
+                stats.percentile_999_ = histogram.value_at_percentile(99.9) / 1000.0;
+                stats.percentile_9999_ = histogram.value_at_percentile(99.99) / 1000.0;
+
+                return stats;
+            };
+
+    stats_.push_back(collect(histogram_));
+
+    if (rate_ > 0)
+    {
+        uncorrected_stats_.push_back(collect(uncorrected_histogram_));
+    }
+}
+
+void LatencyTestPublisher::print_header()
+{
+    printf("   Bytes, Samples,   stdev,    mean,     min,     50%%,     90%%,     99%%,   99.9%%,  99.99%%,     max\n");
+    printf("--------,--------,--------,--------,--------,--------,--------,--------,--------,--------,--------,\n");
 }
 
 void LatencyTestPublisher::print_stats(
@@ -1008,15 +1157,22 @@ void LatencyTestPublisher::print_stats(
     *output_files_[AVERAGE_INDEX] << "\"" << stats.mean_ << "\"";
     *output_files_[data_index] << "\"" << stats.minimum_.count() << "\",\"" << stats.mean_ << "\"" << std::endl;
 
+    print_row(stats);
+}
 
+void LatencyTestPublisher::print_row(
+        const TimeStats& stats)
+{
 #ifdef _WIN32
-    printf("%8I64u,%8u,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f \n",
+    printf("%8I64u,%8u,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f \n",
             stats.bytes_, stats.received_, stats.stdev_, stats.mean_, stats.minimum_.count(), stats.percentile_50_,
-            stats.percentile_90_, stats.percentile_99_, stats.percentile_9999_, stats.maximum_.count());
+            stats.percentile_90_, stats.percentile_99_, stats.percentile_999_, stats.percentile_9999_,
+            stats.maximum_.count());
 #else
-    printf("%8" PRIu64 ",%8u,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f \n",
+    printf("%8" PRIu64 ",%8u,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f,%8.3f \n",
             stats.bytes_, stats.received_, stats.stdev_, stats.mean_, stats.minimum_.count(), stats.percentile_50_,
-            stats.percentile_90_, stats.percentile_99_, stats.percentile_9999_, stats.maximum_.count());
+            stats.percentile_90_, stats.percentile_99_, stats.percentile_999_, stats.percentile_9999_,
+            stats.maximum_.count());
 #endif // ifdef _WIN32
 }
 
@@ -1033,6 +1189,31 @@ void LatencyTestPublisher::export_raw_data(
     data_file.close();
 }
 
+void LatencyTestPublisher::export_histograms(
+        uint32_t datasize)
+{
+    std::string prefix = export_prefix_;
+    if (prefix.length() == 0)
+    {
+        prefix = "perf_LatencyTest";
+    }
+    prefix += "_" + std::to_string(datasize) + "_" + (reliable_ ? "reliable" : "besteffort");
+
+    // Percentile distributions in microseconds, with 5 reported percentiles per half distance to 100% as the
+    // HdrHistogram tools do
+    std::ofstream out_file;
+    out_file.open(prefix + ".hgrm");
+    histogram_.output_percentile_distribution(out_file, 5, 1000.0);
+    out_file.close();
+
+    if (rate_ > 0)
+    {
+        out_file.open(prefix + "_uncorrected.hgrm");
+        uncorrected_histogram_.output_percentile_distribution(out_file, 5, 1000.0);
+        out_file.close();
+    }
+}
+
 int32_t LatencyTestPublisher::total_matches() const
 {
     // no need to lock because is used always within a
@@ -39,6 +39,7 @@
 #include <fastrtps/types/DynamicTypeBuilderPtr.h>
 #include <fastrtps/types/MemberDescriptor.h>
 #include <fastrtps/types/TypeDescriptor.h>
+#include "LatencyHistogram.hpp"
 #include "LatencyTestTypes.hpp"
 
 #include "../optionarg.hpp"
@@ -55,6 +56,7 @@ public:
         , percentile_50_(0)
         , percentile_90_(0)
         , percentile_99_(0)
+        , percentile_999_(0)
         , percentile_9999_(0)
         , mean_(0)
         , stdev_(0)
@@ -72,6 +74,7 @@ public:
     double percentile_50_;
     double percentile_90_;
     double percentile_99_;
+    double percentile_999_;
     double percentile_9999_;
     double mean_;
     double stdev_;
@@ -95,6 +98,7 @@ public:
             bool export_csv,
             const std::string& export_prefix,
             std::string raw_data_file,
+            bool export_histograms,
             const eprosima::fastrtps::rtps::PropertyPolicy& part_property_policy,
             const eprosima::fastrtps::rtps::PropertyPolicy& property_policy,
             const std::string& xml_config_file,
@@ -103,6 +107,7 @@ public:
             bool data_loans,
             Arg::EnablerValue shared_memory,
             int forced_domain,
+            uint32_t rate,
             LatencyDataSizes& latency_data_sizes);
 
     void run();
@@ -121,16 +126,60 @@ private:
     bool test(
             uint32_t datasize);
 
+    /**
+     * Sends a sample and waits for its echoes before sending the next one.
+     */
+    bool send_closed_loop();
+
+    /**
+     * Sends the samples at a fixed rate, without waiting for their echoes.
+     * Latencies are measured from the time each sample was scheduled to be sent, so the time a sample waits because
+     * a previous one blocked the publisher is accounted for (coordinated omission).
+     */
+    bool send_open_loop();
+
+    /**
+     * Fills the sample to send.
+     * @return false when the sample cannot be sent and should be skipped.
+     */
+    bool prepare_sample(
+            unsigned int seqnum,
+            void*& data);
+
+    bool write_sample(
+            void* data);
+
+    /**
+     * Records the latency of an echoed sample.
+     * @param seqnum Sequence number of the echoed sample.
+     * @param elapsed Round trip of the sample, without the time spent on the subscriber. On open loop it is measured
+     * from the time the sample was scheduled to be sent.
+     * @param sent_elapsed Round trip of the sample from its actual send time. On open loop it is shorter than
+     * @c elapsed when the sample was sent later than scheduled.
+     */
+    void record_latency(
+            unsigned int seqnum,
+            std::chrono::steady_clock::duration elapsed,
+            std::chrono::steady_clock::duration sent_elapsed);
+
     void analyze_times(
             uint32_t datasize);
 
+    void print_header();
+
     void print_stats(
             uint32_t data_index,
             TimeStats& TS);
 
+    void print_row(
+            const TimeStats& TS);
+
     void export_raw_data(
             uint32_t datasize);
 
+    void export_histograms(
+            uint32_t datasize);
+
     void export_csv(
             const std::string& data_name,
             const std::string& str_reliable,
@@ -172,11 +221,20 @@ private:
     std::chrono::steady_clock::time_point start_time_;
     std::chrono::steady_clock::time_point end_time_;
     std::chrono::duration<double, std::micro> overhead_time_;
+    // Only kept when the raw data is exported, as the statistics are computed from the histograms
     std::vector<std::chrono::duration<double, std::micro>> times_;
+    // Latencies in nanoseconds, measured from the scheduled send time on open loop
+    LatencyHistogram histogram_;
+    // Latencies in nanoseconds, measured from the actual send time on open loop
+    LatencyHistogram uncorrected_histogram_;
+    // Scheduled and actual send times of each sequence number on open loop
+    std::vector<std::chrono::steady_clock::time_point> scheduled_times_;
+    std::vector<std::chrono::steady_clock::time_point> sent_times_;
 
     /* Data */
     eprosima::fastrtps::SampleInfo_t sampleinfo_;
     std::vector<TimeStats> stats_;
+    std::vector<TimeStats> uncorrected_stats_;
     uint64_t raw_sample_count_ = 0;
 
     /* Test synchronization */
@@ -186,7 +244,6 @@ private:
     std::condition_variable data_msg_cv_;
     int command_msg_count_ = 0;
     int data_msg_count_ = 0;
-    unsigned int received_count_ = 0;
     int test_status_ = 0;
 
     /* Files */
@@ -200,6 +257,7 @@ private:
 
     /* Test configuration and Flags */
     bool export_csv_ = false;
+    bool export_histograms_ = false;
     bool reliable_ = false;
     bool dynamic_types_ = false;
     Arg::EnablerValue data_sharing_ = Arg::EnablerValue::NO_SET;
@@ -208,6 +266,8 @@ private:
     int forced_domain_ = -1;
     int subscribers_ = 0;
     unsigned int samples_ = 0;
+    // Samples sent per second on open loop, 0 on closed loop
+    uint32_t rate_ = 0;
     bool hostname_ = false;
     uint32_t pid_ = 0;
 
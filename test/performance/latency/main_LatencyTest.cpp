@@ -57,6 +57,8 @@ enum  optionIndex
     EXPORT_CSV,
     EXPORT_RAW_DATA,
     EXPORT_PREFIX,
+    EXPORT_HISTOGRAMS,
+    RATE,
     USE_SECURITY,
     CERTS_PATH,
     XML_FILE,
@@ -120,6 +122,10 @@ const option::Descriptor usage[] = {
       "               --export_raw_data     File name to export all raw data as CSV." },
     { EXPORT_PREFIX,   0, "",  "export_prefix",   Arg::String,
       "               --export_prefix       File prefix for the CSV file." },
+    { EXPORT_HISTOGRAMS, 0, "",  "export_histograms", Arg::None,
+      "               --export_histograms   Flag to export the percentile distributions as HdrHistogram files." },
+    { RATE,            0, "",  "rate",            Arg::Numeric,
+      "               --rate=<num>          Samples per second sent on open loop, without waiting for the echoes." },
     { UNKNOWN_OPT,     0, "",  "",                Arg::None,     "\nSubscriber options:"},
     { ECHO_OPT,        0, "e", "echo",            Arg::Required,
       "  -e <arg>,    --echo=<arg>          Echo mode (\"true\"/\"false\")." },
@@ -223,6 +229,8 @@ int main(
     bool export_csv = false;
     std::string export_prefix = "";
     std::string raw_data_file = "";
+    bool export_histograms = false;
+    uint32_t rate = 0;
     std::string xml_config_file = "";
     bool dynamic_types = false;
     int forced_domain = -1;
@@ -332,6 +340,12 @@ int main(
             case EXPORT_RAW_DATA:
                 raw_data_file = opt.arg;
                 break;
+            case EXPORT_HISTOGRAMS:
+                export_histograms = true;
+                break;
+            case RATE:
+                rate = strtol(opt.arg, nullptr, 10);
+                break;
             case EXPORT_PREFIX:
                 if (opt.arg != nullptr)
                 {
@@ -500,8 +514,8 @@ int main(
                   << std::endl;
         LatencyTestPublisher latency_publisher;
         if (latency_publisher.init(subscribers, samples, reliable, seed, hostname, export_csv, export_prefix,
-                raw_data_file, pub_part_property_policy, pub_property_policy, xml_config_file,
-                dynamic_types, data_sharing, data_loans, shared_memory, forced_domain, data_sizes))
+                raw_data_file, export_histograms, pub_part_property_policy, pub_property_policy, xml_config_file,
+                dynamic_types, data_sharing, data_loans, shared_memory, forced_domain, rate, data_sizes))
         {
             latency_publisher.run();
         }
@@ -534,9 +548,9 @@ int main(
         // Initialize publisher
         LatencyTestPublisher latency_publisher;
         bool pub_init = latency_publisher.init(subscribers, samples, reliable, seed, hostname, export_csv,
-                        export_prefix, raw_data_file, pub_part_property_policy, pub_property_policy,
-                        xml_config_file, dynamic_types, data_sharing, data_loans, shared_memory, forced_domain,
-                        data_sizes);
+                        export_prefix, raw_data_file, export_histograms, pub_part_property_policy,
+                        pub_property_policy, xml_config_file, dynamic_types, data_sharing, data_loans, shared_memory,
+                        forced_domain, rate, data_sizes);
 
         // Initialize subscribers
         std::vector<std::shared_ptr<LatencyTestSubscriber>> latency_subscribers;
@@ -126,6 +126,7 @@ bool ThroughputPublisher::init(
         bool dynamic_types,
         Arg::EnablerValue data_sharing,
         bool data_loans,
+        bool write_batch,
         Arg::EnablerValue shared_memory,
         int forced_domain)
 {
@@ -134,6 +135,7 @@ bool ThroughputPublisher::init(
     dynamic_types_ = dynamic_types;
     data_sharing_ = data_sharing;
     data_loans_ = data_loans;
+    write_batch_ = write_batch;
     shared_memory_ = shared_memory;
     reliable_ = reliable;
     forced_domain_ = forced_domain;
@@ -245,8 +247,12 @@ bool ThroughputPublisher::init(
         return false;
     }
 
-    // Load the property policy specified
-    dw_qos_.properties(property_policy);
+    // If the user has specified a property policy with command line arguments, it overrides whatever the XML
+    // configures.
+    if (PropertyPolicyHelper::length(property_policy) > 0)
+    {
+        dw_qos_.properties(property_policy);
+    }
 
     // Reliability
     ReliabilityQosPolicy rp;
@@ -726,6 +732,16 @@ bool ThroughputPublisher::test(
     std::chrono::duration<double, std::micro> test_start_ack_duration =
             std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - test_start_sent_tp);
 
+    // Samples of a batch, when they are written together
+    std::vector<void*> batch_samples;
+    if (write_batch_)
+    {
+        for (uint32_t sample = 0; sample < demand; sample++)
+        {
+            batch_samples.push_back(throughput_data_type_.create_data());
+        }
+    }
+
     // Send batches until test_time_ns is reached
     t_start_ = std::chrono::steady_clock::now();
     uint32_t seqnum = 0;
@@ -734,43 +750,54 @@ bool ThroughputPublisher::test(
         // Get start time
         batch_start = std::chrono::steady_clock::now();
         // Send a batch of size demand
-        for (uint32_t sample = 0; sample < demand; sample++)
+        if (write_batch_)
         {
-            if (dynamic_types_)
+            for (void* data : batch_samples)
             {
-                dynamic_data_->set_uint32_value(++seqnum, 0);
-                data_writer_->write(dynamic_data_);
+                static_cast<ThroughputType*>(data)->seqnum = ++seqnum;
             }
-            else if (data_loans_)
+            data_writer_->write_batch(batch_samples);
+        }
+        else
+        {
+            for (uint32_t sample = 0; sample < demand; sample++)
             {
-                // Try loan a sample
-                void* data = nullptr;
-                if (ReturnCode_t::RETCODE_OK
-                        ==  data_writer_->loan_sample(
-                            data,
-                            DataWriter::LoanInitializationKind::NO_LOAN_INITIALIZATION))
+                if (dynamic_types_)
                 {
-                    // initialize and send the sample
-                    static_cast<ThroughputType*>(data)->seqnum = ++seqnum;
+                    dynamic_data_->set_uint32_value(++seqnum, 0);
+                    data_writer_->write(dynamic_data_);
+                }
+                else if (data_loans_)
+                {
+                    // Try loan a sample
+                    void* data = nullptr;
+                    if (ReturnCode_t::RETCODE_OK
+                            ==  data_writer_->loan_sample(
+                                data,
+                                DataWriter::LoanInitializationKind::NO_LOAN_INITIALIZATION))
+                    {
+                        // initialize and send the sample
+                        static_cast<ThroughputType*>(data)->seqnum = ++seqnum;
 
-                    if (!data_writer_->write(data))
+                        if (!data_writer_->write(data))
+                        {
+                            data_writer_->discard_loan(data);
+                        }
+                    }
+                    else
                     {
-                        data_writer_->discard_loan(data);
+                        std::this_thread::yield();
+                        // try again this sample
+                        --sample;
+                        continue;
                     }
                 }
                 else
                 {
-                    std::this_thread::yield();
-                    // try again this sample
-                    --sample;
-                    continue;
+                    throughput_data_->seqnum = ++seqnum;
+                    data_writer_->write(throughput_data_);
                 }
             }
-            else
-            {
-                throughput_data_->seqnum = ++seqnum;
-                data_writer_->write(throughput_data_);
-            }
         }
         // Get end time
         t_end_ = std::chrono::steady_clock::now();
@@ -790,6 +817,11 @@ bool ThroughputPublisher::test(
         clock_overhead += t_overhead_ * 2; // We access the clock twice per batch.
     }
 
+    for (void* data : batch_samples)
+    {
+        throughput_data_type_.delete_data(data);
+    }
+
     size_t removed = 0;
     data_writer_->clear_history(&removed);
 
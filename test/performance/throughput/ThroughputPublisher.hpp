@@ -68,6 +68,7 @@ public:
             bool dynamic_types,
             Arg::EnablerValue data_sharing,
             bool data_loans,
+            bool write_batch,
             Arg::EnablerValue shared_memory,
             int forced_domain);
 
@@ -147,6 +148,7 @@ private:
     bool dynamic_types_ = false;
     Arg::EnablerValue data_sharing_ = Arg::EnablerValue::NO_SET;
     bool data_loans_ = false;
+    bool write_batch_ = false;
     Arg::EnablerValue shared_memory_ = Arg::EnablerValue::NO_SET;
     bool ready_ = true;
     bool reliable_ = false;
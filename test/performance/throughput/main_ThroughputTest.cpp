@@ -64,7 +64,8 @@ enum  optionIndex
     SUBSCRIBERS,
     DATA_SHARING,
     DATA_LOAN,
-    SHARED_MEMORY
+    SHARED_MEMORY,
+    WRITE_BATCH
 };
 
 enum TestAgent
@@ -124,6 +125,8 @@ const option::Descriptor usage[] = {
       "  -f <arg>,  --file=<arg>             File to read the payload demands from." },
     { EXPORT_CSV,    0, "",  "export_csv",      Arg::String,
       "             --export_csv             Flag to export a CVS file." },
+    { WRITE_BATCH,   0, "",  "write_batch",     Arg::None,
+      "             --write_batch            Write each block of samples with a single write_batch call." },
     { UNKNOWN_OPT,   0, "",   "",               Arg::None,
       "\nNote:\nIf no demand or msg_size is provided the .csv file is used.\n"},
     { 0, 0, 0, 0, 0, 0 }
@@ -174,6 +177,7 @@ int main(
     Arg::EnablerValue data_sharing = Arg::EnablerValue::NO_SET;
     bool data_loans = false;
     Arg::EnablerValue shared_memory = Arg::EnablerValue::NO_SET;
+    bool write_batch = false;
 
     argc -= (argc > 0); argv += (argc > 0); // skip program name argv[0] if present
     if (argc)
@@ -343,6 +347,9 @@ int main(
             case DATA_LOAN:
                 data_loans = true;
                 break;
+            case WRITE_BATCH:
+                write_batch = true;
+                break;
             case SHARED_MEMORY:
                 if (0 == strncasecmp(opt.arg, "on", 2))
                 {
@@ -380,6 +387,12 @@ int main(
         return 1;
     }
 
+    if (write_batch && (data_loans || dynamic_types))
+    {
+        EPROSIMA_LOG_ERROR(ThroughputTest, "Batched writes NOT supported with loans or dynamic types");
+        return 1;
+    }
+
     PropertyPolicy pub_part_property_policy;
     PropertyPolicy sub_part_property_policy;
     PropertyPolicy pub_property_policy;
@@ -481,6 +494,7 @@ int main(
                     dynamic_types,
                     data_sharing,
                     data_loans,
+                    write_batch,
                     shared_memory,
                     forced_domain)
                 )
@@ -538,6 +552,7 @@ int main(
                     dynamic_types,
                     data_sharing,
                     data_loans,
+                    write_batch,
                     shared_memory,
                     forced_domain))
         {
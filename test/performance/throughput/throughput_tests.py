@@ -76,6 +76,12 @@ if __name__ == '__main__':
         help='Enable the use of the loan sample API (Defaults: disable)',
         required=False
     )
+    parser.add_argument(
+        '--write_batch',
+        action='store_true',
+        help='Write each block of samples with a single write_batch call (Defaults: disable)',
+        required=False
+    )
     parser.add_argument(
         '-R',
         '--reliability',
@@ -135,6 +141,9 @@ if __name__ == '__main__':
     elif args.data_loans:
         filename_options += '_data_loans'
 
+    if args.write_batch:
+        filename_options += '_write_batch'
+
     # Demands files options
     demands_options = []
     if args.demands_file:
@@ -159,6 +168,9 @@ if __name__ == '__main__':
     if args.data_loans:
         data_options += ['--data_loans']
 
+    if args.write_batch:
+        data_options += ['--write_batch']
+
     reliability_options = []
     if args.reliability:
         reliability_options = ['--reliability=reliable']
@@ -776,6 +776,48 @@ TEST(DataWriterTests, Write)
     ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
 }
 
+TEST(DataWriterTests, WriteBatch)
+{
+    DomainParticipant* participant =
+            DomainParticipantFactory::get_instance()->create_participant(0, PARTICIPANT_QOS_DEFAULT);
+    ASSERT_NE(participant, nullptr);
+
+    Publisher* publisher = participant->create_publisher(PUBLISHER_QOS_DEFAULT);
+    ASSERT_NE(publisher, nullptr);
+
+    TypeSupport type(new TopicDataTypeMock());
+    type.register_type(participant);
+
+    Topic* topic = participant->create_topic("footopic", type.get_type_name(), TOPIC_QOS_DEFAULT);
+    ASSERT_NE(topic, nullptr);
+
+    DataWriterQos qos = DATAWRITER_QOS_DEFAULT;
+    qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    qos.history().depth = 2;
+    DataWriter* datawriter = publisher->create_datawriter(topic, qos);
+    ASSERT_NE(datawriter, nullptr);
+
+    FooType data[3];
+    std::vector<void*> samples = {&data[0], &data[1], &data[2]};
+
+    // The history is filled while writing the batch
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write_batch(samples));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, datawriter->write_batch({}));
+
+    // Samples after an invalid one are not written
+    samples[1] = nullptr;
+    ASSERT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, datawriter->write_batch(samples));
+
+    size_t removed = 0;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, datawriter->clear_history(&removed));
+    EXPECT_EQ(2u, removed);
+
+    ASSERT_TRUE(publisher->delete_datawriter(datawriter) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_topic(topic) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(participant->delete_publisher(publisher) == ReturnCode_t::RETCODE_OK);
+    ASSERT_TRUE(DomainParticipantFactory::get_instance()->delete_participant(participant) == ReturnCode_t::RETCODE_OK);
+}
+
 TEST(DataWriterTests, WriteWithTimestamp)
 {
     DomainParticipant* participant =
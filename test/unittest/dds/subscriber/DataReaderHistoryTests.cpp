@@ -1,3 +1,6 @@
+#include <limits>
+#include <vector>
+
 #include <fastdds/subscriber/history/DataReaderHistory.hpp>
 #include <fastdds/rtps/reader/RTPSReader.h>
 #include <fastdds/dds/topic/TopicDataType.hpp>
@@ -260,6 +263,145 @@ TEST(DataReaderHistory, exclusive_ownership_keyed_sample_reception)
     ASSERT_EQ(18u, history.getHistorySize());
 }
 
+/*!
+ * Tests that removing a writer, or changing its strength, only affects the instances it has written.
+ */
+TEST(DataReaderHistory, writer_removal_and_strength_update_keyed)
+{
+    TestType* type_ = new TestType();
+    // These functions was called due to the type is keyed.
+    EXPECT_CALL(*type_, createData()).Times(1);
+    EXPECT_CALL(*type_, deleteData(nullptr)).Times(1);
+
+    const TypeSupport type(type_);
+    type->m_isGetKeyDefined = true;
+    const Topic topic("test", "test");
+    DataReaderQos qos;
+    qos.ownership().kind = eprosima::fastdds::dds::EXCLUSIVE_OWNERSHIP_QOS;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    DataReaderHistory history(type, topic, qos);
+    eprosima::fastrtps::RecursiveTimedMutex mutex;
+    eprosima::fastrtps::rtps::StatelessReader reader(&history, &mutex);
+
+    const InstanceHandle_t instance_1 = eprosima::fastrtps::rtps::GUID_t{{}, 1};
+    const InstanceHandle_t instance_2 = eprosima::fastrtps::rtps::GUID_t{{}, 2};
+    eprosima::fastrtps::rtps::CacheChange_t dw1_change;
+    dw1_change.writerGUID = {{}, 1};
+    dw1_change.reader_info.writer_ownership_strength = 1;
+    eprosima::fastrtps::rtps::CacheChange_t dw2_change;
+    dw2_change.writerGUID = {{}, 2};
+    dw2_change.reader_info.writer_ownership_strength = 2;
+
+    // DW1 writes instance 1, DW2 writes both instances and owns them.
+    dw1_change.instanceHandle = instance_1;
+    ++dw1_change.sequenceNumber;
+    ASSERT_TRUE(history.received_change(&dw1_change, 0));
+    ASSERT_TRUE(history.update_instance_nts(&dw1_change));
+
+    dw2_change.instanceHandle = instance_1;
+    ++dw2_change.sequenceNumber;
+    ASSERT_TRUE(history.received_change(&dw2_change, 0));
+    ASSERT_TRUE(history.update_instance_nts(&dw2_change));
+
+    dw2_change.instanceHandle = instance_2;
+    ++dw2_change.sequenceNumber;
+    ASSERT_TRUE(history.received_change(&dw2_change, 0));
+    ASSERT_TRUE(history.update_instance_nts(&dw2_change));
+
+    // DW1 sample is rejected on instance 1, as DW2 is stronger.
+    ++dw1_change.sequenceNumber;
+    ASSERT_TRUE(history.received_change(&dw1_change, 0));
+    ASSERT_FALSE(history.update_instance_nts(&dw1_change));
+
+    // DW2 lowers its strength, so DW1 becomes the owner of instance 1.
+    history.writer_update_its_ownership_strength_nts(dw2_change.writerGUID, 0);
+    ++dw1_change.sequenceNumber;
+    ASSERT_TRUE(history.received_change(&dw1_change, 0));
+    ASSERT_TRUE(history.update_instance_nts(&dw1_change));
+
+    // Removing DW1 leaves both instances alive, as DW2 is still writing them.
+    history.writer_not_alive(dw1_change.writerGUID);
+    EXPECT_EQ(ALIVE_INSTANCE_STATE, history.get_mask_status().instance_states);
+
+    // Removing DW2 leaves both instances without writers.
+    history.writer_not_alive(dw2_change.writerGUID);
+    EXPECT_EQ(NOT_ALIVE_NO_WRITERS_INSTANCE_STATE, history.get_mask_status().instance_states);
+
+    // Removing an unknown writer does nothing.
+    history.writer_not_alive({{}, 3});
+    EXPECT_EQ(NOT_ALIVE_NO_WRITERS_INSTANCE_STATE, history.get_mask_status().instance_states);
+}
+
+/*!
+ * Tests that the instances indexed for each writer follow the instances evicted from the history, and the writers
+ * dropped from an instance when it becomes alive again after being disposed.
+ */
+TEST(DataReaderHistory, writer_index_follows_instance_churn_keyed)
+{
+    constexpr int32_t max_instances = 4;
+    constexpr uint32_t num_keys = 5 * max_instances;
+
+    TestType* type_ = new TestType();
+    // These functions was called due to the type is keyed.
+    EXPECT_CALL(*type_, createData()).Times(1);
+    EXPECT_CALL(*type_, deleteData(nullptr)).Times(1);
+
+    const TypeSupport type(type_);
+    type->m_isGetKeyDefined = true;
+    const Topic topic("test", "test");
+    DataReaderQos qos;
+    qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    qos.resource_limits().max_instances = max_instances;
+    DataReaderHistory history(type, topic, qos);
+    eprosima::fastrtps::RecursiveTimedMutex mutex;
+    eprosima::fastrtps::rtps::StatelessReader reader(&history, &mutex);
+
+    const eprosima::fastrtps::rtps::GUID_t dw1_guid{{}, 1};
+    const eprosima::fastrtps::rtps::GUID_t dw2_guid{{}, 2};
+    std::vector<eprosima::fastrtps::rtps::CacheChange_t> changes(2 * num_keys + 4);
+    size_t next_change = 0;
+    auto receive = [&](
+        const eprosima::fastrtps::rtps::GUID_t& writer_guid,
+        uint32_t key,
+        eprosima::fastrtps::rtps::ChangeKind_t kind)
+            {
+                eprosima::fastrtps::rtps::CacheChange_t& change = changes[next_change++];
+                change.writerGUID = writer_guid;
+                change.sequenceNumber = {0, static_cast<uint32_t>(next_change)};
+                change.kind = kind;
+                change.instanceHandle = eprosima::fastrtps::rtps::GUID_t{{}, key};
+                change.reader_info.writer_ownership_strength = (std::numeric_limits<uint32_t>::max)();
+                ASSERT_TRUE(history.received_change(&change, 0));
+                history.update_instance_nts(&change);
+            };
+
+    // Each key is written and disposed by DW1, so the disposed instances are evicted to make room for new keys
+    for (uint32_t key = 1; key <= num_keys; ++key)
+    {
+        receive(dw1_guid, key, eprosima::fastrtps::rtps::ALIVE);
+        receive(dw1_guid, key, eprosima::fastrtps::rtps::NOT_ALIVE_DISPOSED);
+        EXPECT_GE(static_cast<size_t>(max_instances), history.writer_instances_count_nts(dw1_guid));
+    }
+
+    // DW2 writes the last disposed key, which drops DW1 from its alive writers
+    const size_t dw1_instances = history.writer_instances_count_nts(dw1_guid);
+    receive(dw2_guid, num_keys, eprosima::fastrtps::rtps::ALIVE);
+    EXPECT_EQ(1u, history.writer_instances_count_nts(dw2_guid));
+    EXPECT_EQ(dw1_instances - 1, history.writer_instances_count_nts(dw1_guid));
+
+    // DW1 writes it too, and then disposes it and writes it again, which drops DW2 from its alive writers
+    receive(dw1_guid, num_keys, eprosima::fastrtps::rtps::ALIVE);
+    EXPECT_EQ(dw1_instances, history.writer_instances_count_nts(dw1_guid));
+    receive(dw1_guid, num_keys, eprosima::fastrtps::rtps::NOT_ALIVE_DISPOSED);
+    EXPECT_EQ(1u, history.writer_instances_count_nts(dw2_guid));
+    receive(dw1_guid, num_keys, eprosima::fastrtps::rtps::ALIVE);
+    EXPECT_EQ(0u, history.writer_instances_count_nts(dw2_guid));
+    EXPECT_EQ(dw1_instances, history.writer_instances_count_nts(dw1_guid));
+
+    history.writer_not_alive(dw1_guid);
+    EXPECT_EQ(0u, history.writer_instances_count_nts(dw1_guid));
+}
+
 int main(
         int argc,
         char** argv)
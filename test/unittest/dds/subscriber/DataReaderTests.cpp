@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include <array>
+#include <atomic>
 #include <cassert>
 #include <chrono>
 #include <forward_list>
@@ -51,6 +52,7 @@
 #include <fastdds/dds/subscriber/DataReader.hpp>
 #include <fastdds/dds/subscriber/DataReaderListener.hpp>
 #include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/subscriber/SampleInfoBatch.hpp>
 #include <fastdds/dds/subscriber/Subscriber.hpp>
 #include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
 #include <fastdds/dds/subscriber/qos/SubscriberQos.hpp>
@@ -1654,6 +1656,99 @@ TEST_F(DataReaderTests, get_unread_count)
     EXPECT_EQ(0, data_reader_->get_unread_count());
 }
 
+class DataAvailableCounter : public DataReaderListener
+{
+public:
+
+    void on_data_available(
+            DataReader* /*reader*/) override
+    {
+        ++count;
+    }
+
+    bool wait_for_count(
+            uint32_t expected,
+            std::chrono::milliseconds timeout)
+    {
+        auto end = std::chrono::steady_clock::now() + timeout;
+        while (count < expected && std::chrono::steady_clock::now() < end)
+        {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return count >= expected;
+    }
+
+    std::atomic<uint32_t> count{0u};
+};
+
+/*
+ * This test checks that data available is notified once per coalesced group of samples, either when enough samples
+ * have been received or when the coalescing period expires, and that pending samples can always be read.
+ */
+TEST_F(DataReaderTests, notification_coalescing)
+{
+    static constexpr int32_t num_samples = 4;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.properties().properties().emplace_back("fastdds.notification_coalescing_samples",
+            std::to_string(num_samples));
+    reader_qos.properties().properties().emplace_back("fastdds.notification_coalescing_period_us", "200000");
+
+    DataAvailableCounter listener;
+    create_instance_handles();
+    create_entities(&listener, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(0);
+    data.message()[1] = '\0';
+
+    // A single notification when enough samples have been received
+    for (char i = 0; i < num_samples; ++i)
+    {
+        data.message()[0] = i + '0';
+        EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_writer_->write(&data, handle_ok_));
+    }
+    EXPECT_TRUE(listener.wait_for_count(1u, std::chrono::milliseconds(100)));
+    EXPECT_EQ(1u, listener.count);
+
+    // Fewer samples are notified when the coalescing period expires
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_writer_->write(&data, handle_ok_));
+    EXPECT_TRUE(listener.wait_for_count(2u, std::chrono::seconds(2)));
+    EXPECT_EQ(2u, listener.count);
+
+    // Pending samples are processed when reading
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_writer_->write(&data, handle_ok_));
+    EXPECT_TRUE(data_reader_->wait_for_unread_message({1, 0}));
+    FooSeq values;
+    SampleInfoSeq infos;
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_reader_->take(values, infos));
+    EXPECT_EQ(num_samples + 2, values.length());
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_reader_->return_loan(values, infos));
+
+    // And when looking for the first untaken sample
+    data.message()[0] = 'p';
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_writer_->write(&data, handle_ok_));
+    EXPECT_TRUE(data_reader_->wait_for_unread_message({1, 0}));
+    SampleInfo info;
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_reader_->get_first_untaken_info(&info));
+    EXPECT_EQ(SampleStateKind::NOT_READ_SAMPLE_STATE, info.sample_state);
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_reader_->take(values, infos));
+    ASSERT_EQ(1, values.length());
+    EXPECT_EQ('p', values[0].message()[0]);
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_reader_->return_loan(values, infos));
+
+    // Nothing is left to notify when the coalescing period expires
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    EXPECT_EQ(2u, listener.count);
+}
+
 template<typename DataType>
 void lookup_instance_test(
         DataType& data,
@@ -2043,6 +2138,217 @@ struct oarraystream : virtual arraybuf, std::ostream
 
 };
 
+/*
+ * This test checks the batched read / take APIs for plain types.
+ */
+TEST_F(DataReaderTests, read_take_batch)
+{
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+    static constexpr int32_t num_samples = 10;
+
+    const ReturnCode_t& ok_code = ReturnCode_t::RETCODE_OK;
+    const ReturnCode_t& no_data_code = ReturnCode_t::RETCODE_NO_DATA;
+    const ReturnCode_t& bad_parameter_code = ReturnCode_t::RETCODE_BAD_PARAMETER;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = num_samples;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+    reader_qos.resource_limits().max_instances = 1;
+    reader_qos.resource_limits().max_samples_per_instance = num_samples;
+    reader_qos.resource_limits().max_samples = num_samples;
+
+    create_instance_handles();
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.index(0);
+    data.message()[1] = '\0';
+
+    for (char i = 0; i < num_samples; ++i)
+    {
+        data.message()[0] = i + '0';
+        EXPECT_EQ(ok_code, data_writer_->write(&data, handle_ok_));
+    }
+    EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+    FooType values[num_samples];
+    SampleStateKind sample_states[num_samples];
+    int32_t sample_ranks[num_samples];
+    SequenceNumber_t sequence_numbers[num_samples];
+    bool valid_data[num_samples];
+    SampleInfoBatch infos;
+    infos.sample_states = sample_states;
+    infos.sample_ranks = sample_ranks;
+    infos.sequence_numbers = sequence_numbers;
+    infos.valid_data = valid_data;
+    int32_t count = -1;
+
+    // Wrong parameters
+    EXPECT_EQ(bad_parameter_code, data_reader_->read_batch(values, 0, infos, count));
+    EXPECT_EQ(0, count);
+    EXPECT_EQ(bad_parameter_code, data_reader_->take_batch(static_cast<FooType*>(nullptr), 1, infos, count));
+    EXPECT_EQ(bad_parameter_code, data_reader_->read_batch(static_cast<void*>(values), 0u, 1, infos, count));
+
+    // Read the first half of the samples
+    EXPECT_EQ(ok_code, data_reader_->read_batch(values, num_samples / 2, infos, count));
+    ASSERT_EQ(num_samples / 2, count);
+    for (int32_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(0u, values[i].index());
+        EXPECT_EQ(static_cast<char>('0' + i), values[i].message()[0]);
+        EXPECT_EQ(NOT_READ_SAMPLE_STATE, sample_states[i]);
+        EXPECT_EQ(count - 1 - i, sample_ranks[i]);
+        EXPECT_TRUE(valid_data[i]);
+        if (i > 0)
+        {
+            EXPECT_LT(sequence_numbers[i - 1], sequence_numbers[i]);
+        }
+    }
+
+    // Only unread samples should be returned now
+    EXPECT_EQ(ok_code, data_reader_->read_batch(values, num_samples, infos, count, NOT_READ_SAMPLE_STATE));
+    ASSERT_EQ(num_samples / 2, count);
+    EXPECT_EQ('0' + num_samples / 2, values[0].message()[0]);
+
+    // Take everything
+    EXPECT_EQ(ok_code, data_reader_->take_batch(values, num_samples, infos, count));
+    ASSERT_EQ(num_samples, count);
+    for (int32_t i = 0; i < count; ++i)
+    {
+        EXPECT_EQ(static_cast<char>('0' + i), values[i].message()[0]);
+        EXPECT_EQ(READ_SAMPLE_STATE, sample_states[i]);
+    }
+    EXPECT_EQ(no_data_code, data_reader_->take_batch(values, num_samples, infos, count));
+    EXPECT_EQ(0, count);
+}
+
+/*
+ * Batched read / take is only available for plain types.
+ */
+TEST_F(DataReaderTests, read_take_batch_not_plain)
+{
+    type_.reset(new FooBoundedTypeSupport());
+    create_entities();
+
+    FooBoundedType values[1];
+    SampleInfoBatch infos;
+    int32_t count = -1;
+    EXPECT_EQ(ReturnCode_t::RETCODE_ILLEGAL_OPERATION, data_reader_->read_batch(values, 1, infos, count));
+    EXPECT_EQ(ReturnCode_t::RETCODE_ILLEGAL_OPERATION, data_reader_->take_batch(values, 1, infos, count));
+    EXPECT_EQ(0, count);
+}
+
+/*
+ * Type support serializing the samples with the byte order opposite to the local one.
+ */
+class SwappedFooTypeSupport : public FooTypeSupport
+{
+
+public:
+
+    SwappedFooTypeSupport()
+        : FooTypeSupport()
+    {
+    }
+
+    bool serialize(
+            void* data,
+            SerializedPayload_t* payload,
+            DataRepresentationId_t data_representation) override
+    {
+        FooType* p_type = static_cast<FooType*>(data);
+
+        eprosima::fastcdr::FastBuffer fb(reinterpret_cast<char*>(payload->data), payload->max_size);
+        eprosima::fastcdr::Cdr ser(fb,
+                eprosima::fastcdr::Cdr::DEFAULT_ENDIAN == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ?
+                eprosima::fastcdr::Cdr::LITTLE_ENDIANNESS : eprosima::fastcdr::Cdr::BIG_ENDIANNESS,
+                data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+                eprosima::fastcdr::CdrVersion::XCDRv1 : eprosima::fastcdr::CdrVersion::XCDRv2);
+        payload->encapsulation = ser.endianness() == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+#if FASTCDR_VERSION_MAJOR > 1
+        ser.set_encoding_flag(
+            data_representation == DataRepresentationId_t::XCDR_DATA_REPRESENTATION ?
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR  :
+            eprosima::fastcdr::EncodingAlgorithmFlag::PLAIN_CDR2);
+#endif // FASTCDR_VERSION_MAJOR > 1
+
+        try
+        {
+            ser.serialize_encapsulation();
+            p_type->serialize(ser);
+        }
+        catch (eprosima::fastcdr::exception::NotEnoughMemoryException& /*exception*/)
+        {
+            return false;
+        }
+
+#if FASTCDR_VERSION_MAJOR == 1
+        payload->length = static_cast<uint32_t>(ser.getSerializedDataLength());
+#else
+        payload->length = static_cast<uint32_t>(ser.get_serialized_data_length());
+#endif // FASTCDR_VERSION_MAJOR == 1
+        return true;
+    }
+
+};
+
+/*
+ * Samples serialized with the opposite byte order cannot be copied as they are, and should be deserialized by the
+ * batched read / take APIs.
+ */
+TEST_F(DataReaderTests, read_take_batch_swapped_endianness)
+{
+    type_.reset(new SwappedFooTypeSupport());
+
+    static const Duration_t time_to_wait(0, 100 * 1000 * 1000);
+    static constexpr int32_t num_samples = 4;
+
+    DataWriterQos writer_qos = DATAWRITER_QOS_DEFAULT;
+    writer_qos.history().kind = KEEP_LAST_HISTORY_QOS;
+    writer_qos.history().depth = num_samples;
+    writer_qos.publish_mode().kind = SYNCHRONOUS_PUBLISH_MODE;
+    writer_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+
+    DataReaderQos reader_qos = DATAREADER_QOS_DEFAULT;
+    reader_qos.reliability().kind = RELIABLE_RELIABILITY_QOS;
+    reader_qos.history().kind = KEEP_ALL_HISTORY_QOS;
+
+    create_entities(nullptr, reader_qos, SUBSCRIBER_QOS_DEFAULT, writer_qos);
+
+    FooType data;
+    data.message()[1] = '\0';
+
+    // Indexes whose bytes differ, so a copy without swapping would be noticed
+    for (char i = 0; i < num_samples; ++i)
+    {
+        data.index(0x01020300u + static_cast<uint32_t>(i));
+        data.message()[0] = i + '0';
+        EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_writer_->write(&data, HANDLE_NIL));
+    }
+    EXPECT_TRUE(data_reader_->wait_for_unread_message(time_to_wait));
+
+    FooType values[num_samples];
+    bool valid_data[num_samples];
+    SampleInfoBatch infos;
+    infos.valid_data = valid_data;
+    int32_t count = -1;
+
+    EXPECT_EQ(ReturnCode_t::RETCODE_OK, data_reader_->take_batch(values, num_samples, infos, count));
+    ASSERT_EQ(num_samples, count);
+    for (int32_t i = 0; i < count; ++i)
+    {
+        EXPECT_TRUE(valid_data[i]);
+        EXPECT_EQ(0x01020300u + static_cast<uint32_t>(i), values[i].index());
+        EXPECT_EQ(static_cast<char>('0' + i), values[i].message()[0]);
+    }
+}
+
 /*
  *  This test deals with issues covered on PR #3044.
  *  It checks (read|take)_next_instance methods iterate properly over all
@@ -0,0 +1,391 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+
+#include <fastdds/dds/log/Log.hpp>
+#include <fastdds/rtps/common/SerializedPayload.h>
+#include <fastrtps/types/DynamicData.h>
+#include <fastrtps/types/DynamicDataFactory.h>
+#include <fastrtps/types/DynamicPubSubType.h>
+#include <fastrtps/types/DynamicType.h>
+#include <fastrtps/types/DynamicTypeBuilder.h>
+#include <fastrtps/types/DynamicTypeBuilderFactory.h>
+#include <fastrtps/types/FlatDynamicData.h>
+
+using namespace eprosima::fastrtps;
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastrtps::types;
+
+class FlatDynamicDataTests : public ::testing::Test
+{
+public:
+
+    ~FlatDynamicDataTests()
+    {
+        eprosima::fastdds::dds::Log::KillThread();
+    }
+
+    void SetUp() override
+    {
+        DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+
+        // struct Inner { long id; string name; sequence<double> values; };
+        DynamicTypeBuilder* inner_builder = factory->create_struct_builder();
+        inner_builder->set_name("Inner");
+        inner_builder->add_member(0, "id", factory->create_int32_type());
+        inner_builder->add_member(1, "name", factory->create_string_type());
+        inner_builder->add_member(2, "values",
+                factory->create_sequence_builder(factory->create_float64_type())->build());
+        inner_type_ = inner_builder->build();
+
+        // struct Outer {
+        //     octet flag; Inner inner; sequence<Inner, 10> items; long long array[3]; unsigned short last;
+        // };
+        DynamicTypeBuilder* outer_builder = factory->create_struct_builder();
+        outer_builder->set_name("Outer");
+        outer_builder->add_member(0, "flag", factory->create_byte_type());
+        outer_builder->add_member(1, "inner", inner_type_);
+        outer_builder->add_member(2, "items", factory->create_sequence_builder(inner_type_, 10)->build());
+        outer_builder->add_member(3, "array",
+                factory->create_array_builder(factory->create_int64_type(), {3})->build());
+        outer_builder->add_member(4, "last", factory->create_uint16_type());
+        outer_type_ = outer_builder->build();
+    }
+
+    void TearDown() override
+    {
+        DynamicDataFactory::delete_instance();
+        DynamicTypeBuilderFactory::delete_instance();
+    }
+
+    DynamicData* create_outer_data()
+    {
+        DynamicData* data = DynamicDataFactory::get_instance()->create_data(outer_type_);
+        data->set_byte_value(7, 0);
+
+        MemberId id = MEMBER_ID_INVALID;
+        DynamicData* inner = data->loan_value(1);
+        inner->set_int32_value(42, 0);
+        inner->set_string_value("inner", 1);
+        DynamicData* values = inner->loan_value(2);
+        values->insert_float64_value(1.5, id);
+        values->insert_float64_value(2.5, id);
+        inner->return_loaned_value(values);
+        data->return_loaned_value(inner);
+
+        DynamicData* items = data->loan_value(2);
+        for (int32_t i = 0; i < 2; ++i)
+        {
+            items->insert_sequence_data(id);
+            DynamicData* item = items->loan_value(id);
+            item->set_int32_value(i + 1, 0);
+            item->set_string_value("item_" + std::to_string(i), 1);
+            items->return_loaned_value(item);
+        }
+        data->return_loaned_value(items);
+
+        DynamicData* array = data->loan_value(3);
+        array->set_int64_value(-1, 0);
+        array->set_int64_value(0, 1);
+        array->set_int64_value(1, 2);
+        data->return_loaned_value(array);
+
+        data->set_uint16_value(65535, 4);
+        return data;
+    }
+
+    static bool serialize(
+            const FlatDynamicData& data,
+            SerializedPayload_t& payload)
+    {
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload.data), payload.max_size);
+        eprosima::fastcdr::Cdr ser(fastbuffer
+#if FASTCDR_VERSION_MAJOR == 1
+                , eprosima::fastcdr::Cdr::DEFAULT_ENDIAN
+                , eprosima::fastcdr::Cdr::CdrType::DDS_CDR
+#endif // FASTCDR_VERSION_MAJOR == 1
+                );
+        try
+        {
+            ser.serialize_encapsulation();
+            data.serialize(ser);
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+#if FASTCDR_VERSION_MAJOR == 1
+        payload.length = static_cast<uint32_t>(ser.getSerializedDataLength());
+#else
+        payload.length = static_cast<uint32_t>(ser.get_serialized_data_length());
+#endif // FASTCDR_VERSION_MAJOR == 1
+        return true;
+    }
+
+    static bool deserialize(
+            FlatDynamicData& data,
+            SerializedPayload_t& payload)
+    {
+        eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload.data), payload.length);
+        eprosima::fastcdr::Cdr deser(fastbuffer
+#if FASTCDR_VERSION_MAJOR == 1
+                , eprosima::fastcdr::Cdr::DEFAULT_ENDIAN
+                , eprosima::fastcdr::Cdr::CdrType::DDS_CDR
+#endif // FASTCDR_VERSION_MAJOR == 1
+                );
+        try
+        {
+            deser.read_encapsulation();
+        }
+        catch (eprosima::fastcdr::exception::Exception& /*exception*/)
+        {
+            return false;
+        }
+        return data.deserialize(deser);
+    }
+
+    DynamicType_ptr inner_type_;
+    DynamicType_ptr outer_type_;
+};
+
+TEST_F(FlatDynamicDataTests, layout)
+{
+    std::shared_ptr<const FlatDynamicLayout> layout = FlatDynamicLayout::create(outer_type_);
+    ASSERT_NE(nullptr, layout);
+
+    const FlatDynamicLayout::Node* root = layout->root();
+    ASSERT_EQ(TK_STRUCTURE, root->kind);
+    ASSERT_EQ(5u, root->members.size());
+    EXPECT_FALSE(root->is_plain);
+
+    // Members are laid out in order, each one aligned to its own alignment
+    uint32_t end = 0;
+    for (const FlatDynamicLayout::Member& member : root->members)
+    {
+        EXPECT_LE(end, member.offset);
+        EXPECT_EQ(0u, member.offset % member.node->alignment);
+        end = member.offset + member.node->size;
+    }
+    EXPECT_LE(end, root->size);
+    EXPECT_EQ(0u, root->size % root->alignment);
+
+    const FlatDynamicLayout::Node* array = root->members[3].node;
+    EXPECT_EQ(TK_ARRAY, array->kind);
+    EXPECT_EQ(3u, array->bound);
+    EXPECT_EQ(3 * sizeof(int64_t), array->size);
+    EXPECT_TRUE(array->is_plain);
+
+    const FlatDynamicLayout::Node* items = root->members[2].node;
+    EXPECT_EQ(TK_SEQUENCE, items->kind);
+    EXPECT_EQ(10u, items->bound);
+    EXPECT_EQ(TK_STRUCTURE, items->element->kind);
+}
+
+TEST_F(FlatDynamicDataTests, unsupported_kind)
+{
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    DynamicTypeBuilder* builder = factory->create_struct_builder();
+    builder->set_name("WithWString");
+    builder->add_member(0, "text", factory->create_wstring_type());
+
+    EXPECT_EQ(nullptr, FlatDynamicLayout::create(builder->build()));
+    EXPECT_EQ(nullptr, FlatDynamicLayout::create(DynamicType_ptr()));
+}
+
+TEST_F(FlatDynamicDataTests, same_representation_as_dynamic_data)
+{
+    DynamicPubSubType pubsub_type(outer_type_);
+    DynamicData* data = create_outer_data();
+    SerializedPayload_t payload(4096);
+    ASSERT_TRUE(pubsub_type.serialize(data, &payload));
+
+    // Deserialize what DynamicData serialized
+    FlatDynamicData flat(FlatDynamicLayout::create(outer_type_));
+    ASSERT_TRUE(deserialize(flat, payload));
+
+    FlatDynamicData::Ref root = flat.root();
+    FlatDynamicData::Ref member;
+    octet flag = 0;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(member, root, 0));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_value(flag, member));
+    EXPECT_EQ(7, flag);
+
+    FlatDynamicData::Ref inner;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member_by_name(inner, root, "inner"));
+    int32_t id = 0;
+    std::string name;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(member, inner, 0));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_value(id, member));
+    EXPECT_EQ(42, id);
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(member, inner, 1));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_value(name, member));
+    EXPECT_EQ("inner", name);
+
+    FlatDynamicData::Ref values;
+    FlatDynamicData::Ref element;
+    double value = 0;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(values, inner, 2));
+    ASSERT_EQ(2u, flat.get_item_count(values));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_element(element, values, 1));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_value(value, element));
+    EXPECT_EQ(2.5, value);
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, flat.get_element(element, values, 2));
+
+    FlatDynamicData::Ref items;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(items, root, 2));
+    ASSERT_EQ(2u, flat.get_item_count(items));
+    for (uint32_t i = 0; i < 2; ++i)
+    {
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_element(element, items, i));
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(member, element, 1));
+        ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_value(name, member));
+        EXPECT_EQ("item_" + std::to_string(i), name);
+    }
+
+    FlatDynamicData::Ref array;
+    int64_t array_value = 0;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(array, root, 3));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_element(element, array, 0));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_value(array_value, element));
+    EXPECT_EQ(-1, array_value);
+
+    uint16_t last = 0;
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(member, root, 4));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_value(last, member));
+    EXPECT_EQ(65535, last);
+
+    // Values are accessed with their own type
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, flat.get_value(id, member));
+
+    // Serialize back and let DynamicData read it
+    EXPECT_EQ(pubsub_type.getSerializedSizeProvider(data)(), flat.getCdrSerializedSize() + 4u);
+    SerializedPayload_t flat_payload(4096);
+    ASSERT_TRUE(serialize(flat, flat_payload));
+    EXPECT_EQ(payload.length, flat_payload.length);
+
+    DynamicData* copy = DynamicDataFactory::get_instance()->create_data(outer_type_);
+    ASSERT_TRUE(pubsub_type.deserialize(&flat_payload, copy));
+    EXPECT_TRUE(data->equals(copy));
+
+    DynamicDataFactory::get_instance()->delete_data(copy);
+    DynamicDataFactory::get_instance()->delete_data(data);
+}
+
+TEST_F(FlatDynamicDataTests, sequences_and_strings)
+{
+    FlatDynamicData flat(FlatDynamicLayout::create(outer_type_));
+    FlatDynamicData::Ref root = flat.root();
+    FlatDynamicData::Ref items;
+    FlatDynamicData::Ref element;
+    FlatDynamicData::Ref name;
+    std::string value;
+
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(items, root, 2));
+    EXPECT_EQ(ReturnCode_t::RETCODE_BAD_PARAMETER, flat.resize(items, 11));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.resize(items, 3));
+
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_element(element, items, 0));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(name, element, 1));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.set_value(name, std::string("a longer first value")));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.set_value(name, std::string("first")));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_element(element, items, 2));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(name, element, 1));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.set_value(name, std::string("third")));
+
+    // Shrinking keeps the remaining elements, growing again adds empty ones
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.resize(items, 1));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.resize(items, 3));
+    ASSERT_EQ(3u, flat.get_item_count(items));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_element(element, items, 0));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(name, element, 1));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_value(value, name));
+    EXPECT_EQ("first", value);
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_element(element, items, 2));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(name, element, 1));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_value(value, name));
+    EXPECT_TRUE(value.empty());
+
+    // A sample deserialized from another one holds the same values
+    SerializedPayload_t payload(4096);
+    ASSERT_TRUE(serialize(flat, payload));
+    FlatDynamicData copy(flat.layout());
+    ASSERT_TRUE(deserialize(copy, payload));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, copy.get_member(items, copy.root(), 2));
+    ASSERT_EQ(3u, copy.get_item_count(items));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, copy.get_element(element, items, 0));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, copy.get_member(name, element, 1));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, copy.get_value(value, name));
+    EXPECT_EQ("first", value);
+
+    // A truncated representation leaves the sample empty
+    payload.length -= 4;
+    EXPECT_FALSE(deserialize(copy, payload));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, copy.get_member(items, copy.root(), 2));
+    EXPECT_EQ(0u, copy.get_item_count(items));
+}
+
+TEST_F(FlatDynamicDataTests, forged_sequence_length)
+{
+    // struct Holder { sequence<Inner> items; };
+    DynamicTypeBuilderFactory* factory = DynamicTypeBuilderFactory::get_instance();
+    DynamicTypeBuilder* holder_builder = factory->create_struct_builder();
+    holder_builder->set_name("Holder");
+    holder_builder->add_member(0, "items", factory->create_sequence_builder(inner_type_)->build());
+    DynamicType_ptr holder_type = holder_builder->build();
+
+    // A length of 100 million elements, which would take 2GB on the sample, followed by a single element
+    SerializedPayload_t payload(64);
+    eprosima::fastcdr::FastBuffer fastbuffer(reinterpret_cast<char*>(payload.data), payload.max_size);
+    eprosima::fastcdr::Cdr ser(fastbuffer
+#if FASTCDR_VERSION_MAJOR == 1
+            , eprosima::fastcdr::Cdr::DEFAULT_ENDIAN
+            , eprosima::fastcdr::Cdr::CdrType::DDS_CDR
+#endif // FASTCDR_VERSION_MAJOR == 1
+            );
+    ser.serialize_encapsulation();
+    ser << static_cast<uint32_t>(100000000) << static_cast<int32_t>(1) << static_cast<uint32_t>(0)
+        << static_cast<uint32_t>(0);
+#if FASTCDR_VERSION_MAJOR == 1
+    payload.length = static_cast<uint32_t>(ser.getSerializedDataLength());
+#else
+    payload.length = static_cast<uint32_t>(ser.get_serialized_data_length());
+#endif // FASTCDR_VERSION_MAJOR == 1
+
+    // The length is rejected before growing the sample, as the buffer cannot hold that many elements
+    FlatDynamicData flat(FlatDynamicLayout::create(holder_type));
+    FlatDynamicData::Ref items;
+    EXPECT_FALSE(deserialize(flat, payload));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(items, flat.root(), 0));
+    EXPECT_EQ(0u, flat.get_item_count(items));
+
+    // The same buffer with the right length is deserialized
+    ser.reset();
+    ser.serialize_encapsulation();
+    ser << static_cast<uint32_t>(1);
+    EXPECT_TRUE(deserialize(flat, payload));
+    ASSERT_EQ(ReturnCode_t::RETCODE_OK, flat.get_member(items, flat.root(), 0));
+    EXPECT_EQ(1u, flat.get_item_count(items));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,509 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <set>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/attributes/ThreadSettings.hpp>
+#include <fastdds/rtps/common/CacheChange.h>
+#include <fastdds/rtps/writer/ReaderProxy.h>
+
+#include <nlohmann/json.hpp>
+#include <rtps/builtin/discovery/database/backup/BackupFileWriter.hpp>
+#include <rtps/builtin/discovery/database/backup/BinaryBackupFunctions.hpp>
+#include <rtps/builtin/discovery/database/DiscoveryDataBase.hpp>
+#include <rtps/builtin/discovery/database/DiscoveryParticipantChangeData.hpp>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace eprosima::fastdds::rtps::ddb;
+
+using eprosima::fastdds::rtps::ThreadSettings;
+
+static GuidPrefix_t make_prefix(
+        octet id)
+{
+    GuidPrefix_t prefix;
+    prefix.value[0] = 0x01;
+    prefix.value[11] = id;
+    return prefix;
+}
+
+/**
+ * Creates a discovery change for an entity, with a payload filled with its last GUID byte.
+ */
+static CacheChange_t* make_change(
+        const GUID_t& entity_guid,
+        const EntityId_t& writer_id,
+        int32_t sequence_number)
+{
+    constexpr uint32_t payload_size = 32u;
+    CacheChange_t* change = new CacheChange_t(payload_size);
+    change->kind = ALIVE;
+    change->writerGUID = GUID_t(entity_guid.guidPrefix, writer_id);
+    change->instanceHandle = InstanceHandle_t(entity_guid);
+    change->sequenceNumber = SequenceNumber_t(0, sequence_number);
+    change->sourceTimestamp = Time_t(sequence_number, 100u);
+    change->reader_info.receptionTimestamp = Time_t(sequence_number, 200u);
+
+    SampleIdentity identity;
+    identity.writer_guid(change->writerGUID);
+    identity.sequence_number(change->sequenceNumber);
+    change->write_params.sample_identity(identity);
+    change->write_params.related_sample_identity(identity);
+
+    change->serializedPayload.encapsulation = PL_CDR_LE;
+    change->serializedPayload.length = payload_size;
+    memset(change->serializedPayload.data, entity_guid.entityId.value[3] ^ entity_guid.guidPrefix.value[11],
+            payload_size);
+    return change;
+}
+
+/**
+ * Creates the changes of a record, as the server does when restoring a snapshot.
+ */
+static void changes_from_records(
+        const std::vector<BackupEntityRecord>& records,
+        std::map<InstanceHandle_t, CacheChange_t*>& changes_map)
+{
+    for (const BackupEntityRecord& record : records)
+    {
+        CacheChange_t* change = new CacheChange_t(record.change.length);
+        ASSERT_TRUE(record.change.to_change(*change));
+        changes_map[change->instanceHandle] = change;
+    }
+}
+
+//! Releases the changes owned by a database
+static void release_database(
+        DiscoveryDataBase& db)
+{
+    db.disable();
+    std::set<CacheChange_t*> changes;
+    for (CacheChange_t* change : db.clear())
+    {
+        changes.insert(change);
+    }
+    for (CacheChange_t* change : changes)
+    {
+        delete change;
+    }
+}
+
+/**
+ * Adds some participants to a database, with a writer and a reader on each topic, and processes its data queues.
+ */
+static void add_participants(
+        DiscoveryDataBase& db,
+        octet first_participant,
+        octet num_participants,
+        const std::vector<std::string>& topics)
+{
+    for (octet p = first_participant; p < first_participant + num_participants; ++p)
+    {
+        GuidPrefix_t prefix = make_prefix(p);
+        RemoteLocatorList locators(1, 1);
+        Locator_t locator(LOCATOR_KIND_UDPv4, 11811u + p);
+        locator.address[12] = 127;
+        locator.address[15] = p;
+        locators.add_unicast_locator(locator);
+        db.update(make_change(GUID_t(prefix, c_EntityId_RTPSParticipant), c_EntityId_SPDPWriter, p),
+                DiscoveryParticipantChangeData(locators, true, true));
+    }
+    db.process_pdp_data_queue();
+
+    for (octet p = first_participant; p < first_participant + num_participants; ++p)
+    {
+        GuidPrefix_t prefix = make_prefix(p);
+        for (uint32_t t = 0; t < topics.size(); ++t)
+        {
+            EntityId_t writer_id(((t + 1u) << 8) | 0x03u);
+            EntityId_t reader_id(((t + 1u) << 8) | 0x04u);
+            db.update(make_change(GUID_t(prefix, writer_id), c_EntityId_SEDPPubWriter, p), topics[t]);
+            db.update(make_change(GUID_t(prefix, reader_id), c_EntityId_SEDPSubWriter, p), topics[t]);
+        }
+    }
+    db.process_edp_data_queue();
+}
+
+//! Identifies the changes of a list, which belong to different databases when compared
+static std::vector<std::pair<InstanceHandle_t, SequenceNumber_t>> change_ids(
+        const std::vector<CacheChange_t*>& changes)
+{
+    std::vector<std::pair<InstanceHandle_t, SequenceNumber_t>> ids;
+    for (const CacheChange_t* change : changes)
+    {
+        ids.emplace_back(change->instanceHandle, change->sequenceNumber);
+    }
+    return ids;
+}
+
+//! Returns the contents of a file, or an empty vector if it cannot be read
+static std::vector<octet> file_contents(
+        const std::string& file_name)
+{
+    BackupFileView view;
+    if (!view.open(file_name))
+    {
+        return {};
+    }
+    return std::vector<octet>(view.data(), view.data() + view.size());
+}
+
+class BinaryBackupDataBaseTests : public ::testing::Test
+{
+protected:
+
+    BinaryBackupDataBaseTests()
+        : db_(make_prefix(0xFF), {})
+    {
+    }
+
+    void SetUp() override
+    {
+        add_participants(db_, 1u, 3u, {"topic_a", "topic_b"});
+        db_.process_dirty_topics();
+    }
+
+    void TearDown() override
+    {
+        release_database(db_);
+    }
+
+    DiscoveryDataBase db_;
+};
+
+/*
+ * A change record read back from its binary form holds the same information than the change it was written from,
+ * and is copied into a change only when its payload has room for it.
+ */
+TEST(BinaryBackupTests, change_record_round_trip)
+{
+    std::unique_ptr<CacheChange_t> change(make_change(GUID_t(make_prefix(1), EntityId_t(0x103)),
+            c_EntityId_SEDPPubWriter, 7));
+    change->kind = NOT_ALIVE_DISPOSED_UNREGISTERED;
+    change->isRead = true;
+
+    std::vector<octet> buffer;
+    to_binary(buffer, *change);
+
+    BinaryBackupReader reader(buffer.data(), buffer.size());
+    BackupChangeRecord record;
+    ASSERT_TRUE(from_binary(reader, record));
+    EXPECT_EQ(0u, reader.remaining());
+
+    EXPECT_EQ(change->kind, record.kind);
+    EXPECT_EQ(change->writerGUID, record.writer_guid);
+    EXPECT_EQ(change->instanceHandle, record.instance_handle);
+    EXPECT_EQ(change->sequenceNumber, record.sequence_number);
+    EXPECT_TRUE(record.is_read);
+    EXPECT_EQ(change->sourceTimestamp, record.source_timestamp);
+    EXPECT_EQ(change->reader_info.receptionTimestamp, record.reception_timestamp);
+    EXPECT_EQ(change->write_params.sample_identity(), record.sample_identity);
+    EXPECT_EQ(change->write_params.related_sample_identity(), record.related_sample_identity);
+    EXPECT_EQ(change->serializedPayload.encapsulation, record.encapsulation);
+    ASSERT_EQ(change->serializedPayload.length, record.length);
+    EXPECT_EQ(0, memcmp(change->serializedPayload.data, record.data, record.length));
+
+    CacheChange_t restored(record.length);
+    ASSERT_TRUE(record.to_change(restored));
+    EXPECT_EQ(change->kind, restored.kind);
+    EXPECT_EQ(change->writerGUID, restored.writerGUID);
+    EXPECT_EQ(change->instanceHandle, restored.instanceHandle);
+    EXPECT_EQ(change->sequenceNumber, restored.sequenceNumber);
+    EXPECT_EQ(change->write_params.sample_identity(), restored.write_params.sample_identity());
+    EXPECT_TRUE(change->serializedPayload == restored.serializedPayload);
+
+    CacheChange_t too_small(record.length / 2u);
+    EXPECT_FALSE(record.to_change(too_small));
+}
+
+/*
+ * A change record cut at any point is rejected.
+ */
+TEST(BinaryBackupTests, change_record_truncated)
+{
+    std::unique_ptr<CacheChange_t> change(make_change(GUID_t(make_prefix(1), EntityId_t(0x103)),
+            c_EntityId_SEDPPubWriter, 7));
+
+    std::vector<octet> buffer;
+    to_binary(buffer, *change);
+
+    for (size_t size = 0; size < buffer.size(); ++size)
+    {
+        BinaryBackupReader reader(buffer.data(), size);
+        BackupChangeRecord record;
+        EXPECT_FALSE(from_binary(reader, record)) << "Record truncated to " << size << " bytes";
+    }
+}
+
+/*
+ * The changes are appended to the changes file, after its header. A snapshot replaces the snapshot file and leaves
+ * the changes file with the changes appended after it only.
+ */
+TEST(BinaryBackupTests, backup_file_writer)
+{
+    const std::string changes_file = "BinaryBackupTests_changes.bin";
+    const std::string snapshot_file = "BinaryBackupTests_snapshot.bin";
+    std::remove(changes_file.c_str());
+    std::remove(snapshot_file.c_str());
+
+    std::vector<octet> header;
+    write_backup_header(header, BackupFileKind::CHANGES);
+    ASSERT_EQ(binary_backup_header_size, header.size());
+
+    auto expected_record = [](
+        std::vector<octet>& expected,
+        const std::vector<octet>& record)
+            {
+                binary_append(expected, static_cast<uint32_t>(record.size()));
+                expected.insert(expected.end(), record.begin(), record.end());
+            };
+
+    std::vector<octet> expected = header;
+    {
+        BackupFileWriter writer(changes_file, snapshot_file, std::chrono::milliseconds(1), ThreadSettings(), 0u);
+        for (octet i = 1; i <= 3u; ++i)
+        {
+            std::vector<octet> record(i * 10u, i);
+            expected_record(expected, record);
+            writer.append_change(std::move(record));
+        }
+    }
+    EXPECT_EQ(expected, file_contents(changes_file));
+    EXPECT_TRUE(file_contents(snapshot_file).empty());
+
+    // A new writer keeps the changes not yet included on a snapshot
+    std::vector<octet> snapshot;
+    write_backup_header(snapshot, BackupFileKind::SNAPSHOT);
+    snapshot.resize(snapshot.size() + 100u, 0xAB);
+    {
+        BackupFileWriter writer(changes_file, snapshot_file, std::chrono::milliseconds(1), ThreadSettings(), 0u);
+        writer.append_change(std::vector<octet>(5u, 0x04));
+        writer.store_snapshot(std::vector<octet>(snapshot));
+
+        std::vector<octet> record(7u, 0x05);
+        expected = header;
+        expected_record(expected, record);
+        writer.append_change(std::move(record));
+    }
+    EXPECT_EQ(expected, file_contents(changes_file));
+    EXPECT_EQ(snapshot, file_contents(snapshot_file));
+
+    std::remove(changes_file.c_str());
+    std::remove(snapshot_file.c_str());
+}
+
+/*
+ * A database restored from the binary snapshot of another one holds the same entities.
+ */
+TEST_F(BinaryBackupDataBaseTests, restore_round_trip)
+{
+    std::vector<octet> snapshot;
+    db_.to_binary(snapshot);
+
+    std::vector<BackupEntityRecord> records;
+    ASSERT_TRUE(read_backup_snapshot(snapshot.data(), snapshot.size(), records));
+    // 3 participants with 2 writers and 2 readers each
+    ASSERT_EQ(15u, records.size());
+
+    std::map<InstanceHandle_t, CacheChange_t*> changes_map;
+    changes_from_records(records, changes_map);
+
+    DiscoveryDataBase restored(make_prefix(0xFF), {});
+    ASSERT_TRUE(restored.from_binary(records, changes_map));
+
+    nlohmann::json expected_json;
+    nlohmann::json restored_json;
+    db_.to_json(expected_json);
+    restored.to_json(restored_json);
+    EXPECT_EQ(expected_json, restored_json);
+
+    // The restored database serializes back to the same snapshot
+    std::vector<octet> restored_snapshot;
+    restored.to_binary(restored_snapshot);
+    EXPECT_EQ(snapshot.size(), restored_snapshot.size());
+
+    release_database(restored);
+}
+
+/*
+ * A snapshot cut at any point is rejected, unless the cut falls between two records.
+ */
+TEST_F(BinaryBackupDataBaseTests, snapshot_truncated)
+{
+    std::vector<octet> snapshot;
+    db_.to_binary(snapshot);
+
+    // Offsets where a record ends
+    std::set<size_t> boundaries;
+    size_t pos = binary_backup_header_size;
+    while (pos < snapshot.size())
+    {
+        uint32_t record_size = 0;
+        memcpy(&record_size, &snapshot[pos], sizeof(record_size));
+        pos += sizeof(record_size) + record_size;
+        boundaries.insert(pos);
+    }
+    ASSERT_EQ(snapshot.size(), pos);
+
+    for (size_t size = 0; size < snapshot.size(); ++size)
+    {
+        std::vector<BackupEntityRecord> records;
+        bool at_boundary = binary_backup_header_size == size || boundaries.count(size) > 0;
+        EXPECT_EQ(at_boundary, read_backup_snapshot(snapshot.data(), size, records))
+            << "Snapshot truncated to " << size << " bytes";
+    }
+
+    // A changes file is not a snapshot
+    std::vector<octet> changes;
+    write_backup_header(changes, BackupFileKind::CHANGES);
+    std::vector<BackupEntityRecord> records;
+    EXPECT_FALSE(read_backup_snapshot(changes.data(), changes.size(), records));
+}
+
+/*
+ * A corrupted snapshot leaves the database untouched, and the changes owned by the caller.
+ */
+TEST_F(BinaryBackupDataBaseTests, restore_corrupted)
+{
+    std::vector<octet> snapshot;
+    db_.to_binary(snapshot);
+
+    std::vector<BackupEntityRecord> records;
+    ASSERT_TRUE(read_backup_snapshot(snapshot.data(), snapshot.size(), records));
+
+    auto check_rejected = [](
+        const std::vector<BackupEntityRecord>& corrupted)
+            {
+                std::map<InstanceHandle_t, CacheChange_t*> changes_map;
+                changes_from_records(corrupted, changes_map);
+
+                DiscoveryDataBase restored(make_prefix(0xFF), {});
+                EXPECT_FALSE(restored.from_binary(corrupted, changes_map));
+
+                nlohmann::json restored_json;
+                restored.to_json(restored_json);
+                EXPECT_TRUE(restored_json["participants"].empty());
+                EXPECT_TRUE(restored_json["writers"].empty());
+                EXPECT_TRUE(restored_json["readers"].empty());
+
+                release_database(restored);
+                for (auto& change : changes_map)
+                {
+                    delete change.second;
+                }
+            };
+
+    // Endpoints of a participant that is not on the snapshot
+    std::vector<BackupEntityRecord> corrupted(records.begin() + 1, records.end());
+    check_rejected(corrupted);
+
+    // The same participant twice
+    corrupted = records;
+    corrupted.push_back(records.front());
+    corrupted.back().change.instance_handle.value[0] ^= 0xFF;
+    check_rejected(corrupted);
+}
+
+/*
+ * Processing the dirty topics in parallel leaves the database on the same state, and sends the same changes in the
+ * same order, as processing them on a single thread.
+ */
+TEST(DiscoveryDataBaseTests, parallel_processing_matches_serial)
+{
+    std::vector<std::string> topics;
+    for (char t = 'a'; t <= 'p'; ++t)
+    {
+        topics.push_back(std::string("topic_") + t);
+    }
+
+    DiscoveryDataBase serial(make_prefix(0xFF), {});
+    DiscoveryDataBase parallel(make_prefix(0xFF), {});
+    parallel.enable_parallel_processing(4u, ThreadSettings(), 0u);
+
+    auto check_same_state = [&serial, &parallel]()
+            {
+                EXPECT_EQ(change_ids(serial.pdp_to_send()), change_ids(parallel.pdp_to_send()));
+                EXPECT_EQ(change_ids(serial.edp_publications_to_send()),
+                        change_ids(parallel.edp_publications_to_send()));
+                EXPECT_EQ(change_ids(serial.edp_subscriptions_to_send()),
+                        change_ids(parallel.edp_subscriptions_to_send()));
+
+                nlohmann::json serial_json;
+                nlohmann::json parallel_json;
+                serial.to_json(serial_json);
+                parallel.to_json(parallel_json);
+                EXPECT_EQ(serial_json, parallel_json);
+            };
+
+    // Every participant acknowledges the DATA(p) sent, so the endpoints are sent on the next processing
+    auto acknowledge_pdp = [](DiscoveryDataBase& db, octet num_participants)
+            {
+                for (CacheChange_t* change : db.pdp_to_send())
+                {
+                    for (octet p = 1; p <= num_participants; ++p)
+                    {
+                        ReaderProxy proxy;
+                        proxy.guid_ = GUID_t(make_prefix(p), c_EntityId_SPDPReader);
+                        proxy.acked_ = true;
+                        db.functor(change)(&proxy);
+                    }
+                }
+                db.clear_pdp_to_send();
+                db.clear_edp_publications_to_send();
+                db.clear_edp_subscriptions_to_send();
+            };
+
+    add_participants(serial, 1u, 4u, topics);
+    add_participants(parallel, 1u, 4u, topics);
+    EXPECT_EQ(serial.process_dirty_topics(), parallel.process_dirty_topics());
+    check_same_state();
+    EXPECT_FALSE(serial.pdp_to_send().empty());
+
+    acknowledge_pdp(serial, 4u);
+    acknowledge_pdp(parallel, 4u);
+    EXPECT_EQ(serial.process_dirty_topics(), parallel.process_dirty_topics());
+    check_same_state();
+    EXPECT_FALSE(serial.edp_publications_to_send().empty());
+    EXPECT_FALSE(serial.edp_subscriptions_to_send().empty());
+
+    // New participants make the topics dirty again
+    acknowledge_pdp(serial, 4u);
+    acknowledge_pdp(parallel, 4u);
+    add_participants(serial, 5u, 2u, topics);
+    add_participants(parallel, 5u, 2u, topics);
+    EXPECT_EQ(serial.process_dirty_topics(), parallel.process_dirty_topics());
+    check_same_state();
+    EXPECT_FALSE(serial.pdp_to_send().empty());
+
+    release_database(serial);
+    release_database(parallel);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -176,6 +176,140 @@ TEST_F(ReaderHistoryTests, get_change)
     }
 }
 
+TEST_F(ReaderHistoryTests, get_change_after_removal)
+{
+    EXPECT_CALL(*readerMock, change_removed_by_history(_)).Times(num_writers).
+            WillRepeatedly(Return(true));
+    EXPECT_CALL(*readerMock, releaseCache(_)).Times(num_writers);
+
+    for (uint32_t i = 0; i < num_changes; i++)
+    {
+        history->add_change(changes_list[i]);
+    }
+
+    // Remove the first change of each writer
+    for (uint32_t i = 0; i < num_changes; i += num_sequence_numbers)
+    {
+        ASSERT_TRUE(history->remove_change(changes_list[i]));
+        ASSERT_FALSE(history->remove_change(changes_list[i]));
+    }
+
+    for (uint32_t i = 0; i < num_changes; i++)
+    {
+        CacheChange_t* ch = nullptr;
+        bool is_removed = 0 == (i % num_sequence_numbers);
+        ASSERT_EQ(!is_removed, history->get_change(changes_list[i]->sequenceNumber, changes_list[i]->writerGUID, &ch));
+        ASSERT_EQ(is_removed ? nullptr : changes_list[i], ch);
+        ASSERT_EQ(is_removed, history->changesEnd() == history->find_change(changes_list[i]));
+    }
+
+    for (uint32_t i = 1; i <= num_writers; i++)
+    {
+        CacheChange_t* ch = nullptr;
+        ASSERT_TRUE(history->get_min_change_from(&ch, GUID_t(GuidPrefix_t::unknown(), i)));
+        ASSERT_EQ(changes_list[(i - 1) * num_sequence_numbers + 1], ch);
+    }
+}
+
+TEST_F(ReaderHistoryTests, remove_fragmented_changes_until)
+{
+    constexpr uint32_t n_changes = 6;
+    GUID_t writer_guid = GUID_t(GuidPrefix_t::unknown(), 1U);
+    GUID_t other_writer_guid = GUID_t(GuidPrefix_t::unknown(), 2U);
+    std::vector<CacheChange_t*> changes;
+
+    // Even changes are being reassembled. Changes of the other writer should never be removed.
+    for (uint32_t i = 1; i <= n_changes; i++)
+    {
+        for (const GUID_t& guid : {writer_guid, other_writer_guid})
+        {
+            CacheChange_t* ch = new CacheChange_t(history_attr.payloadMaxSize);
+            ch->writerGUID = guid;
+            ch->sequenceNumber = SequenceNumber_t(0, i);
+            ch->sourceTimestamp = rtps::Time_t(0, i);
+            ch->serializedPayload.length = history_attr.payloadMaxSize;
+            ch->setFragmentSize(static_cast<uint16_t>(history_attr.payloadMaxSize), 0 == (i % 2));
+            changes.push_back(ch);
+            history->add_change(ch);
+        }
+    }
+
+    EXPECT_CALL(*readerMock, change_removed_by_history(_)).Times(2).
+            WillRepeatedly(Return(true));
+    EXPECT_CALL(*readerMock, releaseCache(_)).Times(2);
+
+    ASSERT_TRUE(history->remove_fragmented_changes_until(SequenceNumber_t(0, 5), writer_guid));
+    ASSERT_EQ(history->getHistorySize(), 2 * n_changes - 2);
+
+    for (CacheChange_t* ch : changes)
+    {
+        CacheChange_t* found = nullptr;
+        bool is_removed = writer_guid == ch->writerGUID && ch->sequenceNumber < SequenceNumber_t(0, 5) &&
+                !ch->is_fully_assembled();
+        ASSERT_EQ(!is_removed, history->get_change(ch->sequenceNumber, ch->writerGUID, &found));
+    }
+
+    for (CacheChange_t* ch : changes)
+    {
+        delete ch;
+    }
+}
+
+TEST_F(ReaderHistoryTests, get_change_being_reassembled)
+{
+    GUID_t writer_guid = GUID_t(GuidPrefix_t::unknown(), 1U);
+
+    for (uint32_t i = 0; i < num_changes; i++)
+    {
+        history->add_change(changes_list[i]);
+    }
+
+    CacheChange_t* fragmented = new CacheChange_t(history_attr.payloadMaxSize);
+    fragmented->writerGUID = writer_guid;
+    fragmented->sequenceNumber = SequenceNumber_t(0, num_sequence_numbers + 1);
+    fragmented->sourceTimestamp = rtps::Time_t(0, num_changes);
+    fragmented->serializedPayload.length = history_attr.payloadMaxSize;
+    fragmented->setFragmentSize(static_cast<uint16_t>(history_attr.payloadMaxSize), true);
+    ASSERT_FALSE(fragmented->is_fully_assembled());
+    history->add_change(fragmented);
+
+    CacheChange_t* ch = nullptr;
+    ASSERT_TRUE(history->get_change(fragmented->sequenceNumber, writer_guid, &ch));
+    ASSERT_EQ(fragmented, ch);
+
+    // Complete the change, and add another one so the completed change is not tracked as fragmented anymore
+    SerializedPayload_t fragments(history_attr.payloadMaxSize);
+    fragments.length = history_attr.payloadMaxSize;
+    ASSERT_TRUE(fragmented->add_fragments(fragments, 1, 1));
+    ASSERT_TRUE(fragmented->is_fully_assembled());
+
+    CacheChange_t* next = new CacheChange_t(0);
+    next->writerGUID = writer_guid;
+    next->sequenceNumber = SequenceNumber_t(0, num_sequence_numbers + 2);
+    next->sourceTimestamp = rtps::Time_t(0, num_changes + 1);
+    history->add_change(next);
+
+    ch = nullptr;
+    ASSERT_TRUE(history->get_change(fragmented->sequenceNumber, writer_guid, &ch));
+    ASSERT_EQ(fragmented, ch);
+    ASSERT_EQ(fragmented, *history->find_change(fragmented));
+
+    // A completed change is not removed as fragmented
+    ASSERT_TRUE(history->remove_fragmented_changes_until(next->sequenceNumber, writer_guid));
+    ASSERT_EQ(history->getHistorySize(), num_changes + 2);
+
+    EXPECT_CALL(*readerMock, change_removed_by_history(_)).Times(2).
+            WillRepeatedly(Return(true));
+    EXPECT_CALL(*readerMock, releaseCache(_)).Times(2);
+
+    ASSERT_TRUE(history->remove_change(fragmented));
+    ASSERT_TRUE(history->remove_change(next));
+    ASSERT_FALSE(history->get_change(fragmented->sequenceNumber, writer_guid, &ch));
+
+    delete fragmented;
+    delete next;
+}
+
 TEST_F(ReaderHistoryTests, change_order)
 {
     constexpr uint32_t n_writers = 4;
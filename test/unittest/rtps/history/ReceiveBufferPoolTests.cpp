@@ -0,0 +1,158 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/CacheChange.h>
+
+#include <rtps/history/ReceiveBufferPool.hpp>
+
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+constexpr uint32_t buffer_size = 256u;
+
+//! Simulates the assignment of a payload received at the given offset of a buffer
+void adopt(
+        IPayloadPool* pool,
+        octet* buffer,
+        uint32_t offset,
+        uint32_t length,
+        CacheChange_t& change)
+{
+    SerializedPayload_t data;
+    data.data = buffer + offset;
+    data.length = length;
+    data.max_size = length;
+
+    IPayloadPool* owner = pool;
+    bool adopted = pool->get_payload(data, owner, change);
+    data.data = nullptr;
+    ASSERT_TRUE(adopted);
+    EXPECT_EQ(pool, owner);
+}
+
+} // namespace
+
+TEST(ReceiveBufferPoolTests, buffers_are_bounded)
+{
+    std::shared_ptr<ReceiveBufferPool> pool = std::make_shared<ReceiveBufferPool>(buffer_size, 2u);
+    EXPECT_EQ(buffer_size, pool->buffer_size());
+
+    octet* first = pool->get_buffer();
+    octet* second = pool->get_buffer();
+    ASSERT_NE(nullptr, first);
+    ASSERT_NE(nullptr, second);
+    EXPECT_NE(first, second);
+    EXPECT_EQ(nullptr, pool->get_buffer());
+
+    pool->release_buffer(second);
+    EXPECT_EQ(second, pool->get_buffer());
+
+    pool->release_buffer(first);
+    pool->release_buffer(second);
+}
+
+TEST(ReceiveBufferPoolTests, adopted_payload_keeps_buffer)
+{
+    std::shared_ptr<ReceiveBufferPool> pool = std::make_shared<ReceiveBufferPool>(buffer_size, 2u);
+
+    octet* buffer = pool->get_buffer();
+    ASSERT_NE(nullptr, buffer);
+    memset(buffer, 0xAB, buffer_size);
+
+    CacheChange_t change;
+    adopt(pool.get(), buffer, 40u, 100u, change);
+    EXPECT_EQ(pool.get(), change.payload_owner());
+    EXPECT_EQ(buffer + 40u, change.serializedPayload.data);
+    EXPECT_EQ(100u, change.serializedPayload.length);
+    EXPECT_EQ(0xAB, change.serializedPayload.data[99]);
+
+    // The buffer is not reused while the change references it
+    octet* next = pool->renew_buffer(buffer);
+    EXPECT_NE(buffer, next);
+    EXPECT_EQ(nullptr, pool->get_buffer());
+
+    // Once the change is released, the buffer is back on the pool
+    EXPECT_TRUE(pool->release_payload(change));
+    EXPECT_EQ(nullptr, change.payload_owner());
+    EXPECT_EQ(nullptr, change.serializedPayload.data);
+    EXPECT_EQ(buffer, pool->get_buffer());
+
+    // A buffer only referenced by its receiver is reused
+    EXPECT_EQ(next, pool->renew_buffer(next));
+
+    pool->release_buffer(buffer);
+    pool->release_buffer(next);
+}
+
+TEST(ReceiveBufferPoolTests, only_own_payloads_are_referenced)
+{
+    std::shared_ptr<ReceiveBufferPool> pool = std::make_shared<ReceiveBufferPool>(buffer_size, 1u);
+
+    CacheChange_t change;
+    EXPECT_FALSE(pool->get_payload(16u, change));
+
+    octet external[16] = {0};
+    SerializedPayload_t data;
+    data.data = external;
+    data.length = sizeof(external);
+    IPayloadPool* owner = nullptr;
+    EXPECT_FALSE(pool->get_payload(data, owner, change));
+    EXPECT_EQ(nullptr, owner);
+    EXPECT_EQ(nullptr, change.payload_owner());
+
+    owner = pool.get();
+    EXPECT_FALSE(pool->get_payload(data, owner, change));
+    data.data = nullptr;
+}
+
+TEST(ReceiveBufferPoolTests, pool_outlives_receiver)
+{
+    std::shared_ptr<ReceiveBufferPool> pool = std::make_shared<ReceiveBufferPool>(buffer_size, 1u);
+    std::weak_ptr<ReceiveBufferPool> weak_pool = pool;
+
+    octet* buffer = pool->get_buffer();
+    ASSERT_NE(nullptr, buffer);
+    buffer[10] = 42;
+
+    CacheChange_t first;
+    CacheChange_t second;
+    adopt(pool.get(), buffer, 8u, 8u, first);
+    adopt(pool.get(), buffer, 8u, 8u, second);
+
+    // The receiver finishes while the changes are still in use
+    IPayloadPool* owner = pool.get();
+    pool->release_buffer(buffer);
+    pool.reset();
+    EXPECT_FALSE(weak_pool.expired());
+    EXPECT_EQ(42, first.serializedPayload.data[2]);
+
+    EXPECT_TRUE(owner->release_payload(first));
+    EXPECT_FALSE(weak_pool.expired());
+    EXPECT_TRUE(owner->release_payload(second));
+    EXPECT_TRUE(weak_pool.expired());
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
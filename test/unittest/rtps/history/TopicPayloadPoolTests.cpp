@@ -16,7 +16,9 @@
 
 #include <rtps/history/TopicPayloadPool.hpp>
 
+#include <cstring>
 #include <tuple>
+#include <vector>
 
 using namespace eprosima::fastrtps::rtps;
 using namespace ::testing;
@@ -488,6 +490,84 @@ TEST(TopicPayloalPoolTests, dynamic_reusable_memory_zero_size)
     do_dynamic_topic_payload_pool_zero_size_test(config);
 }
 
+//! Preallocated payloads can be placed on memory with specific placement requirements
+TEST(TopicPayloalPoolTests, preallocated_with_placement)
+{
+    PoolConfig config{ PREALLOCATED_MEMORY_MODE, 128, 10, 20};
+    config.placement.use_huge_pages = true;
+    config.placement.prefault = true;
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+    ASSERT_TRUE(pool->reserve_history(config, false));
+    EXPECT_EQ(10u, pool->payload_pool_allocated_size());
+
+    std::vector<CacheChange_t*> changes;
+    for (uint32_t i = 0; i < 20u; ++i)
+    {
+        CacheChange_t* ch = new CacheChange_t();
+        ASSERT_TRUE(pool->get_payload(128, *ch));
+        ASSERT_NE(nullptr, ch->serializedPayload.data);
+        EXPECT_EQ(128u, ch->serializedPayload.max_size);
+        memset(ch->serializedPayload.data, 0xAA, ch->serializedPayload.max_size);
+        changes.push_back(ch);
+    }
+
+    CacheChange_t overflow;
+    EXPECT_FALSE(pool->get_payload(128, overflow));
+
+    for (CacheChange_t* ch : changes)
+    {
+        ASSERT_TRUE(pool->release_payload(*ch));
+        delete ch;
+    }
+    EXPECT_TRUE(pool->release_history(config, false));
+}
+
+//! Preallocated payloads with placement can still grow, moving their buffers out of the placed memory
+TEST(TopicPayloalPoolTests, preallocated_with_realloc_with_placement)
+{
+    PoolConfig config{ PREALLOCATED_WITH_REALLOC_MEMORY_MODE, 128, 10, 20};
+    config.placement.use_huge_pages = true;
+    config.placement.prefault = true;
+    std::unique_ptr<ITopicPayloadPool> pool = TopicPayloadPool::get(config);
+    ASSERT_TRUE(pool->reserve_history(config, false));
+    EXPECT_EQ(10u, pool->payload_pool_allocated_size());
+
+    // Preallocated payloads are used first, and the bigger ones are allocated when they run out
+    std::vector<CacheChange_t*> changes;
+    for (uint32_t i = 0; i < 20u; ++i)
+    {
+        uint32_t size = (0 == i % 2) ? 128u : 1024u;
+        CacheChange_t* ch = new CacheChange_t();
+        ASSERT_TRUE(pool->get_payload(size, *ch));
+        ASSERT_NE(nullptr, ch->serializedPayload.data);
+        EXPECT_LE(size, ch->serializedPayload.max_size);
+        memset(ch->serializedPayload.data, 0xAA, ch->serializedPayload.max_size);
+        changes.push_back(ch);
+    }
+
+    for (CacheChange_t* ch : changes)
+    {
+        ASSERT_TRUE(pool->release_payload(*ch));
+    }
+
+    // Recycled payloads grow when needed
+    for (CacheChange_t* ch : changes)
+    {
+        ASSERT_TRUE(pool->get_payload(2048u, *ch));
+        ASSERT_NE(nullptr, ch->serializedPayload.data);
+        EXPECT_LE(2048u, ch->serializedPayload.max_size);
+        memset(ch->serializedPayload.data, 0x55, ch->serializedPayload.max_size);
+    }
+    EXPECT_EQ(20u, pool->payload_pool_allocated_size());
+
+    for (CacheChange_t* ch : changes)
+    {
+        ASSERT_TRUE(pool->release_payload(*ch));
+        delete ch;
+    }
+    EXPECT_TRUE(pool->release_history(config, false));
+}
+
 #ifdef INSTANTIATE_TEST_SUITE_P
 #define GTEST_INSTANTIATE_TEST_MACRO(x, y, z) INSTANTIATE_TEST_SUITE_P(x, y, z)
 #else
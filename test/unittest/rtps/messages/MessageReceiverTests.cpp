@@ -0,0 +1,213 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/common/CDRMessage_t.h>
+#include <fastdds/rtps/common/Locator.h>
+#include <fastdds/rtps/messages/MessageReceiver.h>
+#include <fastdds/rtps/reader/RTPSReader.h>
+
+#include <rtps/participant/RTPSParticipantImpl.h>
+
+using namespace eprosima::fastrtps::rtps;
+using namespace ::testing;
+
+/**
+ * Reader that records whether a message is delivered to it after being removed from the receiver.
+ */
+class RemovableReader : public RTPSReader
+{
+public:
+
+    explicit RemovableReader(
+            uint32_t id)
+    {
+        m_att.endpointKind = READER;
+        m_guid.entityId = EntityId_t(id);
+    }
+
+    bool matched_writer_add(
+            const WriterProxyData&) override
+    {
+        return true;
+    }
+
+    bool matched_writer_remove(
+            const GUID_t&,
+            bool) override
+    {
+        return true;
+    }
+
+    bool matched_writer_is_matched(
+            const GUID_t&) override
+    {
+        return true;
+    }
+
+    bool processHeartbeatMsg(
+            const GUID_t&,
+            uint32_t,
+            const SequenceNumber_t&,
+            const SequenceNumber_t&,
+            bool,
+            bool) override
+    {
+        if (removed)
+        {
+            ++late_deliveries;
+        }
+        // Give the removal time to complete while the message is being processed
+        std::this_thread::yield();
+        if (removed)
+        {
+            ++late_deliveries;
+        }
+        ++deliveries;
+        return true;
+    }
+
+    std::atomic<bool> removed{false};
+    std::atomic<uint32_t> deliveries{0};
+    std::atomic<uint32_t> late_deliveries{0};
+};
+
+/**
+ * Builds a message with a HEARTBEAT directed to every reader of the participant.
+ */
+static void fill_heartbeat(
+        CDRMessage_t& msg)
+{
+    const octet message[] =
+    {
+        // Header: protocol, version, vendor and source GUID prefix
+        'R', 'T', 'P', 'S', 2, 3, 0x01, 0x0F,
+        1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12,
+        // HEARTBEAT, little endian, with readerId unknown and writerId 0x000001C2
+        0x07, 0x01, 28, 0,
+        0, 0, 0, 0,
+        0, 0, 0x01, 0xC2,
+        // firstSN = 1, lastSN = 1, count = 1
+        0, 0, 0, 0, 1, 0, 0, 0,
+        0, 0, 0, 0, 1, 0, 0, 0,
+        1, 0, 0, 0
+    };
+
+    memcpy(msg.buffer, message, sizeof(message));
+    msg.length = static_cast<uint32_t>(sizeof(message));
+    msg.pos = 0;
+}
+
+/**
+ * Several threads process messages on receivers sharing the same endpoints, while others associate and remove
+ * readers. Once removeEndpoint returns, the removed reader must not be used anymore, whatever the table the
+ * messages being processed took.
+ */
+TEST(MessageReceiverTests, remove_endpoint_waits_for_messages_in_flight)
+{
+    constexpr size_t num_receivers = 4;
+    constexpr size_t num_updaters = 2;
+    constexpr uint32_t readers_per_updater = 500;
+
+    NiceMock<RTPSParticipantImpl> participant;
+    GUID_t participant_guid;
+    participant_guid.guidPrefix.value[0] = 0xAA;
+    ON_CALL(participant, getGuid()).WillByDefault(ReturnRef(participant_guid));
+
+    MessageReceiver owner(&participant, 1024);
+    std::vector<std::unique_ptr<MessageReceiver>> receivers;
+    for (size_t i = 0; i < num_receivers; ++i)
+    {
+        receivers.emplace_back(new MessageReceiver(owner, 1024));
+    }
+
+    // A reader that is never removed, so messages always reach some reader
+    RemovableReader permanent(1);
+    owner.associateEndpoint(&permanent);
+
+    std::atomic<bool> running{true};
+    std::vector<std::thread> threads;
+    for (auto& receiver : receivers)
+    {
+        MessageReceiver* rec = receiver.get();
+        threads.emplace_back([rec, &running]()
+                {
+                    CDRMessage_t msg(1024);
+                    Locator_t locator;
+                    while (running)
+                    {
+                        fill_heartbeat(msg);
+                        rec->processCDRMsg(locator, locator, &msg);
+                    }
+                });
+    }
+
+    std::vector<std::unique_ptr<RemovableReader>> removed_readers;
+    std::mutex removed_mutex;
+    std::vector<std::thread> updaters;
+    for (uint32_t u = 0; u < num_updaters; ++u)
+    {
+        updaters.emplace_back([u, &owner, &receivers, &removed_readers, &removed_mutex]()
+                {
+                    for (uint32_t i = 0; i < readers_per_updater; ++i)
+                    {
+                        uint32_t id = 0x100 + u * readers_per_updater + i;
+                        std::unique_ptr<RemovableReader> reader(new RemovableReader(id));
+                        owner.associateEndpoint(reader.get());
+                        std::this_thread::yield();
+                        // Receivers share the endpoints, so removing from any of them is the same
+                        receivers[i % receivers.size()]->removeEndpoint(reader.get());
+                        reader->removed = true;
+
+                        std::lock_guard<std::mutex> guard(removed_mutex);
+                        removed_readers.push_back(std::move(reader));
+                    }
+                });
+    }
+
+    for (auto& updater : updaters)
+    {
+        updater.join();
+    }
+    running = false;
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    owner.removeEndpoint(&permanent);
+
+    uint32_t deliveries = permanent.deliveries;
+    EXPECT_LT(0u, deliveries);
+    for (const auto& reader : removed_readers)
+    {
+        EXPECT_EQ(0u, reader->late_deliveries.load());
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleMock(&argc, argv);
+    return RUN_ALL_TESTS();
+}
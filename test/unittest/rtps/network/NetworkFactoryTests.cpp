@@ -661,6 +661,81 @@ TEST_F(NetworkTests, LocatorShrink)
     }
 }
 
+static std::vector<Locator_t> selected_locators(
+        const LocatorSelector& selector)
+{
+    std::vector<Locator_t> locators;
+    selector.for_each([&locators](const Locator_t& locator)
+            {
+                locators.push_back(locator);
+            });
+    return locators;
+}
+
+TEST_F(NetworkTests, LocatorSelectionCache)
+{
+    NetworkFactory f{pattr};
+    UDPv4TransportDescriptor udpv4;
+    f.RegisterTransport(&udpv4);
+
+    Locator_t multicast;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "239.255.1.1", 7400, multicast);
+    Locator_t unicast1;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "192.168.1.1", 7410, unicast1);
+    Locator_t unicast2;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "192.168.1.2", 7410, unicast2);
+    Locator_t unicast3;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "192.168.1.3", 7410, unicast3);
+
+    std::vector<LocatorSelectorEntry> entries(3, LocatorSelectorEntry(1u, 1u));
+    for (size_t i = 0; i < entries.size(); ++i)
+    {
+        entries[i].remote_guid.entityId = static_cast<uint32_t>(i + 1);
+    }
+    entries[0].unicast.push_back(unicast1);
+    entries[0].multicast.push_back(multicast);
+    entries[1].unicast.push_back(unicast2);
+    entries[1].multicast.push_back(multicast);
+    entries[2].unicast.push_back(unicast3);
+
+    LocatorSelector selector(ResourceLimitedContainerConfig::fixed_size_configuration(4u));
+    selector.add_entry(&entries[0]);
+    selector.add_entry(&entries[1]);
+
+    // Shared multicast locator is preferred
+    selector.reset(true);
+    f.select_locators(selector);
+    EXPECT_EQ(std::vector<Locator_t>({multicast}), selected_locators(selector));
+
+    // Adding an entry discards cached selections
+    selector.add_entry(&entries[2]);
+    selector.reset(true);
+    f.select_locators(selector);
+    std::vector<Locator_t> all_selected = selected_locators(selector);
+    EXPECT_EQ(std::vector<Locator_t>({multicast, unicast3}), all_selected);
+
+    selector.reset(false);
+    selector.enable(entries[0].remote_guid);
+    f.select_locators(selector);
+    EXPECT_EQ(std::vector<Locator_t>({unicast1}), selected_locators(selector));
+
+    // Selection for all the entries is restored
+    selector.reset(true);
+    f.select_locators(selector);
+    EXPECT_EQ(all_selected, selected_locators(selector));
+    EXPECT_EQ(all_selected.size(), selector.selected_size());
+    EXPECT_TRUE(selector.is_selected(unicast3));
+    EXPECT_FALSE(selector.is_selected(unicast1));
+
+    // Changed locators are used once cached selections are discarded
+    entries[2].unicast.clear();
+    entries[2].unicast.push_back(unicast2);
+    selector.clear_cached_selections();
+    selector.reset(true);
+    f.select_locators(selector);
+    EXPECT_EQ(std::vector<Locator_t>({multicast, unicast2}), selected_locators(selector));
+}
+
 int main(
         int argc,
         char** argv)
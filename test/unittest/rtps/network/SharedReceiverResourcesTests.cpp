@@ -0,0 +1,407 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <fastdds/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastdds/rtps/messages/MessageReceiver.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <MockTransport.h>
+#include <rtps/network/NetworkFactory.h>
+#include <rtps/network/ReceiverResource.h>
+#include <rtps/network/SharedReceiverResources.hpp>
+
+using namespace eprosima::fastrtps::rtps;
+
+namespace {
+
+GuidPrefix_t make_prefix(
+        octet value)
+{
+    GuidPrefix_t prefix;
+    memset(prefix.value, value, GuidPrefix_t::size);
+    return prefix;
+}
+
+//! Builds RTPS messages, with little endian submessages
+class MessageBuilder
+{
+public:
+
+    MessageBuilder()
+        : data_({'R', 'T', 'P', 'S', 2, 3, 1, 15})
+    {
+        data_.insert(data_.end(), GuidPrefix_t::size, 0xAA);
+    }
+
+    MessageBuilder& submessage(
+            octet id,
+            uint16_t length)
+    {
+        data_.push_back(id);
+        data_.push_back(BIT(0));
+        data_.push_back(static_cast<octet>(length & 0xFF));
+        data_.push_back(static_cast<octet>(length >> 8));
+        data_.insert(data_.end(), length, 0);
+        return *this;
+    }
+
+    MessageBuilder& info_dst(
+            const GuidPrefix_t& prefix)
+    {
+        submessage(INFO_DST, GuidPrefix_t::size);
+        memcpy(&data_[data_.size() - GuidPrefix_t::size], prefix.value, GuidPrefix_t::size);
+        return *this;
+    }
+
+    const octet* data() const
+    {
+        return data_.data();
+    }
+
+    uint32_t size() const
+    {
+        return static_cast<uint32_t>(data_.size());
+    }
+
+private:
+
+    std::vector<octet> data_;
+};
+
+class ConfiguredMockTransport;
+
+//! Descriptor of mock transports that return their configuration, so the shared resources can create their own
+class ConfiguredMockTransportDescriptor : public MockTransportDescriptor
+{
+public:
+
+    ConfiguredMockTransportDescriptor()
+    {
+        maximumChannels = MockTransport::DefaultMaxChannels;
+        supportedKind = LOCATOR_KIND_UDPv4;
+    }
+
+    TransportInterface* create_transport() const override;
+
+    bool is_equivalent(
+            const TransportDescriptorInterface& t) const override
+    {
+        const ConfiguredMockTransportDescriptor* other = dynamic_cast<const ConfiguredMockTransportDescriptor*>(&t);
+        return nullptr != other && SocketTransportDescriptor::operator ==(*other);
+    }
+};
+
+class ConfiguredMockTransport : public MockTransport
+{
+public:
+
+    explicit ConfiguredMockTransport(
+            const ConfiguredMockTransportDescriptor& descriptor)
+        : MockTransport(descriptor)
+        , configuration_(descriptor)
+    {
+    }
+
+    TransportDescriptorInterface* get_configuration() override
+    {
+        return &configuration_;
+    }
+
+private:
+
+    ConfiguredMockTransportDescriptor configuration_;
+};
+
+TransportInterface* ConfiguredMockTransportDescriptor::create_transport() const
+{
+    return new ConfiguredMockTransport(*this);
+}
+
+//! Counts the messages it is given to process
+class CountingReceiver : public MessageReceiver
+{
+public:
+
+    CountingReceiver()
+        : MessageReceiver(nullptr, 1024u)
+    {
+    }
+
+    void processCDRMsg(
+            const Locator_t&,
+            const Locator_t&,
+            CDRMessage_t* msg,
+            IPayloadPool*) override
+    {
+        // Each receiver must be given the message from its beginning
+        EXPECT_EQ(0u, msg->pos);
+        ++messages;
+    }
+
+    uint32_t messages = 0;
+};
+
+//! Number of mock transports with an input channel open on a locator
+size_t transports_listening(
+        const Locator_t& locator)
+{
+    size_t listening = 0;
+    for (const MockTransport* transport : MockTransport::mockTransportInstances)
+    {
+        if (transport->IsInputChannelOpen(locator))
+        {
+            ++listening;
+        }
+    }
+    return listening;
+}
+
+} // namespace
+
+/**
+ * Participants using the same multicast locator and max message size get a single resource, listening on a single
+ * channel, which gives each message only to the participants it is addressed to.
+ */
+class SharedReceiverResourcesFactoryTests : public ::testing::Test
+{
+protected:
+
+    void SetUp() override
+    {
+        IPLocator::createLocator(LOCATOR_KIND_UDPv4, "239.255.0.1", 7400, multicast_);
+        factory_a_.RegisterTransport(&descriptor_);
+        factory_b_.RegisterTransport(&descriptor_);
+    }
+
+    void deliver(
+            ReceiverResource& resource,
+            const MessageBuilder& message)
+    {
+        Locator_t remote;
+        IPLocator::createLocator(LOCATOR_KIND_UDPv4, "192.168.1.10", 7410, remote);
+        resource.OnDataReceived(message.data(), message.size(), multicast_, remote);
+    }
+
+    ConfiguredMockTransportDescriptor descriptor_;
+    RTPSParticipantAttributes attributes_;
+    NetworkFactory factory_a_{attributes_};
+    NetworkFactory factory_b_{attributes_};
+    Locator_t multicast_;
+    GuidPrefix_t prefix_a_ = make_prefix(1);
+    GuidPrefix_t prefix_b_ = make_prefix(2);
+};
+
+TEST_F(SharedReceiverResourcesFactoryTests, messages_dispatched_by_guid_prefix)
+{
+    std::vector<std::shared_ptr<ReceiverResource>> resources_a;
+    std::vector<std::shared_ptr<ReceiverResource>> resources_b;
+    ASSERT_TRUE(factory_a_.BuildSharedReceiverResources(multicast_, resources_a, 1024u));
+    ASSERT_TRUE(factory_b_.BuildSharedReceiverResources(multicast_, resources_b, 1024u));
+    ASSERT_EQ(1u, resources_a.size());
+    ASSERT_EQ(1u, resources_b.size());
+    ASSERT_EQ(resources_a[0], resources_b[0]);
+    ReceiverResource& resource = *resources_a[0];
+    EXPECT_TRUE(resource.is_shared());
+    EXPECT_EQ(1u, transports_listening(multicast_));
+
+    CountingReceiver receiver_a;
+    CountingReceiver receiver_b;
+    resource.RegisterReceiver(&receiver_a, prefix_a_);
+    resource.RegisterReceiver(&receiver_b, prefix_b_);
+
+    MessageBuilder to_a;
+    to_a.info_dst(prefix_a_).submessage(DATA, 32);
+    deliver(resource, to_a);
+    EXPECT_EQ(1u, receiver_a.messages);
+    EXPECT_EQ(0u, receiver_b.messages);
+
+    MessageBuilder to_b;
+    to_b.submessage(INFO_TS, 8).info_dst(prefix_b_).submessage(ACKNACK, 24);
+    deliver(resource, to_b);
+    EXPECT_EQ(1u, receiver_a.messages);
+    EXPECT_EQ(1u, receiver_b.messages);
+
+    MessageBuilder to_both;
+    to_both.info_dst(prefix_a_).submessage(DATA, 32).info_dst(prefix_b_).submessage(DATA, 32);
+    deliver(resource, to_both);
+    EXPECT_EQ(2u, receiver_a.messages);
+    EXPECT_EQ(2u, receiver_b.messages);
+
+    MessageBuilder to_all;
+    to_all.submessage(DATA, 32);
+    deliver(resource, to_all);
+    EXPECT_EQ(3u, receiver_a.messages);
+    EXPECT_EQ(3u, receiver_b.messages);
+
+    // Messages for participants not sharing the resource are not processed
+    MessageBuilder to_other;
+    to_other.info_dst(make_prefix(3)).submessage(DATA, 32);
+    deliver(resource, to_other);
+    EXPECT_EQ(3u, receiver_a.messages);
+    EXPECT_EQ(3u, receiver_b.messages);
+
+    resource.UnregisterReceiver(&receiver_a);
+    resource.UnregisterReceiver(&receiver_b);
+}
+
+TEST_F(SharedReceiverResourcesFactoryTests, participants_unregister_independently)
+{
+    std::vector<std::shared_ptr<ReceiverResource>> resources_a;
+    std::vector<std::shared_ptr<ReceiverResource>> resources_b;
+    ASSERT_TRUE(factory_a_.BuildSharedReceiverResources(multicast_, resources_a, 1024u));
+    ASSERT_TRUE(factory_b_.BuildSharedReceiverResources(multicast_, resources_b, 1024u));
+    ASSERT_EQ(resources_a.at(0), resources_b.at(0));
+    std::weak_ptr<ReceiverResource> shared = resources_a[0];
+
+    CountingReceiver receiver_a;
+    CountingReceiver receiver_b;
+    resources_a[0]->RegisterReceiver(&receiver_a, prefix_a_);
+    resources_b[0]->RegisterReceiver(&receiver_b, prefix_b_);
+
+    // The first participant leaves, while the other one keeps receiving on the same channel
+    resources_a[0]->UnregisterReceiver(&receiver_a);
+    resources_a.clear();
+    ASSERT_FALSE(shared.expired());
+    EXPECT_EQ(1u, transports_listening(multicast_));
+
+    // With a single participant, messages are not filtered, as its receiver skips those addressed to others
+    MessageBuilder to_all;
+    to_all.submessage(DATA, 32);
+    deliver(*resources_b[0], to_all);
+    MessageBuilder to_a;
+    to_a.info_dst(prefix_a_).submessage(DATA, 32);
+    deliver(*resources_b[0], to_a);
+    EXPECT_EQ(0u, receiver_a.messages);
+    EXPECT_EQ(2u, receiver_b.messages);
+
+    // The first participant joins again, getting the resource still in use
+    ASSERT_TRUE(factory_a_.BuildSharedReceiverResources(multicast_, resources_a, 1024u));
+    EXPECT_EQ(resources_b[0], resources_a.at(0));
+    resources_a.clear();
+
+    // The channel is closed when the last participant leaves
+    resources_b[0]->UnregisterReceiver(&receiver_b);
+    resources_b.clear();
+    EXPECT_TRUE(shared.expired());
+    EXPECT_EQ(0u, transports_listening(multicast_));
+
+    // A new resource is opened afterwards
+    ASSERT_TRUE(factory_b_.BuildSharedReceiverResources(multicast_, resources_b, 1024u));
+    EXPECT_EQ(1u, transports_listening(multicast_));
+    resources_b.clear();
+    EXPECT_EQ(0u, transports_listening(multicast_));
+}
+
+TEST_F(SharedReceiverResourcesFactoryTests, different_max_message_size_not_shared)
+{
+    std::vector<std::shared_ptr<ReceiverResource>> resources_a;
+    std::vector<std::shared_ptr<ReceiverResource>> resources_b;
+    ASSERT_TRUE(factory_a_.BuildSharedReceiverResources(multicast_, resources_a, 1024u));
+    ASSERT_TRUE(factory_b_.BuildSharedReceiverResources(multicast_, resources_b, 2048u));
+    EXPECT_NE(resources_a.at(0), resources_b.at(0));
+    EXPECT_EQ(2u, transports_listening(multicast_));
+}
+
+TEST_F(SharedReceiverResourcesFactoryTests, different_transport_configuration_not_shared)
+{
+    ConfiguredMockTransportDescriptor other_descriptor;
+    other_descriptor.receiveBufferSize = descriptor_.receiveBufferSize + 1024u;
+    NetworkFactory factory_c{attributes_};
+    factory_c.RegisterTransport(&other_descriptor);
+
+    std::vector<std::shared_ptr<ReceiverResource>> resources_a;
+    std::vector<std::shared_ptr<ReceiverResource>> resources_b;
+    std::vector<std::shared_ptr<ReceiverResource>> resources_c;
+    ASSERT_TRUE(factory_a_.BuildSharedReceiverResources(multicast_, resources_a, 1024u));
+    ASSERT_TRUE(factory_c.BuildSharedReceiverResources(multicast_, resources_c, 1024u));
+    ASSERT_TRUE(factory_b_.BuildSharedReceiverResources(multicast_, resources_b, 1024u));
+    EXPECT_NE(resources_a.at(0), resources_c.at(0));
+    EXPECT_EQ(resources_a.at(0), resources_b.at(0));
+    EXPECT_TRUE(resources_c.at(0)->is_shared());
+    EXPECT_EQ(2u, transports_listening(multicast_));
+
+    // The resource of each configuration is kept while a participant is using it
+    resources_a.clear();
+    resources_b.clear();
+    EXPECT_EQ(1u, transports_listening(multicast_));
+    std::vector<std::shared_ptr<ReceiverResource>> resources_c2;
+    ASSERT_TRUE(factory_c.BuildSharedReceiverResources(multicast_, resources_c2, 1024u));
+    EXPECT_EQ(resources_c.at(0), resources_c2.at(0));
+    resources_c.clear();
+    resources_c2.clear();
+    EXPECT_EQ(0u, transports_listening(multicast_));
+}
+
+TEST(SharedReceiverResourcesTests, messages_with_destination)
+{
+    std::vector<GuidPrefix_t> destinations;
+
+    MessageBuilder single;
+    single.submessage(INFO_TS, 8).info_dst(make_prefix(1)).submessage(DATA, 32).submessage(HEARTBEAT, 28);
+    ASSERT_TRUE(SharedReceiverResources::message_destinations(single.data(), single.size(), destinations));
+    ASSERT_EQ(1u, destinations.size());
+    EXPECT_EQ(make_prefix(1), destinations[0]);
+
+    MessageBuilder several;
+    several.info_dst(make_prefix(1)).submessage(ACKNACK, 24).info_dst(make_prefix(2)).submessage(ACKNACK, 24)
+            .info_dst(make_prefix(1)).submessage(DATA, 0);
+    ASSERT_TRUE(SharedReceiverResources::message_destinations(several.data(), several.size(), destinations));
+    ASSERT_EQ(2u, destinations.size());
+    EXPECT_EQ(make_prefix(1), destinations[0]);
+    EXPECT_EQ(make_prefix(2), destinations[1]);
+}
+
+TEST(SharedReceiverResourcesTests, messages_for_all_participants)
+{
+    std::vector<GuidPrefix_t> destinations;
+
+    // Submessages before any INFO_DST
+    MessageBuilder no_destination;
+    no_destination.submessage(INFO_TS, 8).submessage(DATA, 32).info_dst(make_prefix(1)).submessage(DATA, 32);
+    EXPECT_FALSE(SharedReceiverResources::message_destinations(no_destination.data(), no_destination.size(),
+            destinations));
+
+    MessageBuilder unknown_destination;
+    unknown_destination.info_dst(c_GuidPrefix_Unknown).submessage(DATA, 32);
+    EXPECT_FALSE(SharedReceiverResources::message_destinations(unknown_destination.data(), unknown_destination.size(),
+            destinations));
+
+    // Protected messages
+    MessageBuilder secure;
+    secure.submessage(0x33, 16).info_dst(make_prefix(1)).submessage(DATA, 32);
+    EXPECT_FALSE(SharedReceiverResources::message_destinations(secure.data(), secure.size(), destinations));
+
+    // Malformed messages
+    MessageBuilder truncated;
+    truncated.info_dst(make_prefix(1)).submessage(DATA, 32);
+    EXPECT_FALSE(SharedReceiverResources::message_destinations(truncated.data(), truncated.size() - 1, destinations));
+
+    octet not_rtps[24] = {'R', 'T', 'P', 'X'};
+    EXPECT_FALSE(SharedReceiverResources::message_destinations(not_rtps, sizeof(not_rtps), destinations));
+    EXPECT_FALSE(SharedReceiverResources::message_destinations(not_rtps, 4u, destinations));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
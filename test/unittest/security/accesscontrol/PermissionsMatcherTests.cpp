@@ -0,0 +1,110 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <security/accesscontrol/PermissionsMatcher.h>
+
+using namespace eprosima::fastrtps::rtps::security;
+
+TEST(PermissionsMatcherTests, name_matcher_literals_and_patterns)
+{
+    NameMatcher matcher;
+    matcher.add("Square");
+    matcher.add("Circle*");
+    matcher.add("Tri?ngle");
+    matcher.add("");
+
+    EXPECT_TRUE(matcher.matches("Square"));
+    EXPECT_TRUE(matcher.matches("Circle"));
+    EXPECT_TRUE(matcher.matches("CircleBig"));
+    EXPECT_TRUE(matcher.matches("Triangle"));
+    EXPECT_TRUE(matcher.matches(""));
+    EXPECT_FALSE(matcher.matches("Squares"));
+    EXPECT_FALSE(matcher.matches("Triangles"));
+    EXPECT_FALSE(matcher.matches("BigCircle"));
+
+    NameMatcher empty;
+    EXPECT_FALSE(empty.matches(""));
+    EXPECT_FALSE(empty.matches("Square"));
+}
+
+TEST(PermissionsMatcherTests, compiled_rule_joins_criterias)
+{
+    Rule rule;
+    rule.allow = true;
+    rule.domains.ranges.emplace_back(0u, 10u);
+
+    Criteria first;
+    first.topics = {"Square"};
+    first.partitions = {"A"};
+    Criteria second;
+    second.topics = {"Circle*"};
+    second.partitions = {"B*"};
+    rule.publishes = {first, second};
+
+    Criteria relay;
+    relay.topics = {"*"};
+    rule.relays = {relay};
+
+    std::vector<CompiledRule> compiled = compile_rules({rule});
+    ASSERT_EQ(1u, compiled.size());
+    EXPECT_TRUE(compiled[0].allow);
+    EXPECT_EQ(rule.domains.ranges, compiled[0].domains.ranges);
+
+    // Partitions of any criteria apply to the topics of all of them, as when checking the rule criterias
+    EXPECT_TRUE(compiled[0].publishes.topics.matches("Square"));
+    EXPECT_TRUE(compiled[0].publishes.topics.matches("CircleBig"));
+    EXPECT_TRUE(compiled[0].publishes.partitions.matches("A"));
+    EXPECT_TRUE(compiled[0].publishes.partitions.matches("Bxx"));
+    EXPECT_FALSE(compiled[0].publishes.partitions.matches("C"));
+
+    EXPECT_FALSE(compiled[0].subscribes.topics.matches("Square"));
+    EXPECT_TRUE(compiled[0].relays.topics.matches("Square"));
+}
+
+TEST(PermissionsMatcherTests, decision_cache)
+{
+    AccessDecisionCache cache;
+    AccessDecisionCache::Decision decision;
+    std::vector<std::string> partitions = {"A", "B"};
+
+    EXPECT_FALSE(cache.find(AccessDecisionCache::Check::REMOTE_DATAREADER, 0u, "Square", partitions, decision));
+
+    decision.allowed = true;
+    decision.relay_only = true;
+    cache.insert(AccessDecisionCache::Check::REMOTE_DATAREADER, 0u, "Square", partitions, decision);
+
+    AccessDecisionCache::Decision cached;
+    ASSERT_TRUE(cache.find(AccessDecisionCache::Check::REMOTE_DATAREADER, 0u, "Square", partitions, cached));
+    EXPECT_TRUE(cached.allowed);
+    EXPECT_TRUE(cached.relay_only);
+
+    // Decisions are only reused for the same kind of check, domain, topic and partitions
+    EXPECT_FALSE(cache.find(AccessDecisionCache::Check::REMOTE_DATAWRITER, 0u, "Square", partitions, cached));
+    EXPECT_FALSE(cache.find(AccessDecisionCache::Check::REMOTE_DATAREADER, 1u, "Square", partitions, cached));
+    EXPECT_FALSE(cache.find(AccessDecisionCache::Check::REMOTE_DATAREADER, 0u, "Circle", partitions, cached));
+    EXPECT_FALSE(cache.find(AccessDecisionCache::Check::REMOTE_DATAREADER, 0u, "Square", {"A"}, cached));
+
+    cache.clear();
+    EXPECT_FALSE(cache.find(AccessDecisionCache::Check::REMOTE_DATAREADER, 0u, "Square", partitions, cached));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
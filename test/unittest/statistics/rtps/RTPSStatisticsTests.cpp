@@ -23,6 +23,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <fastdds/dds/core/policy/ParameterTypes.hpp>
 #include <fastdds/dds/log/Log.hpp>
 #include <fastdds/dds/publisher/qos/WriterQos.hpp>
 #include <fastdds/dds/subscriber/qos/ReaderQos.hpp>
@@ -234,12 +235,14 @@ protected:
 
 public:
 
-    void create_participant()
+    void create_participant(
+            const fastrtps::rtps::PropertyPolicy& properties = fastrtps::rtps::PropertyPolicy())
     {
         using namespace fastrtps::rtps;
 
         // create the participant
         RTPSParticipantAttributes p_attr;
+        p_attr.properties = properties;
 
         // use leaky transport
         // as filter use a fixture provided functor
@@ -759,6 +762,71 @@ TEST_F(RTPSStatisticsTests, statistics_rpts_listener_callbacks)
     test_execution();
 }
 
+/*
+ * This test checks that the counting events are published by the aggregator thread when the participant is
+ * configured with an aggregation period.
+ */
+TEST_F(RTPSStatisticsTests, statistics_rpts_listener_callbacks_aggregated)
+{
+    using namespace ::testing;
+    using namespace fastrtps;
+    using namespace fastrtps::rtps;
+    using namespace std;
+
+    // Replace the participant by one aggregating the events every 50 ms
+    remove_participant();
+    PropertyPolicy properties;
+    properties.properties().emplace_back(fastdds::dds::parameter_statistics_aggregation_period, "50");
+    create_participant(properties);
+
+    uint16_t length = 255;
+    create_endpoints(length, RELIABLE);
+    participant_->set_enabled_statistics_writers_mask(
+        EventKindBits::DATA_COUNT |
+        EventKindBits::HEARTBEAT_COUNT |
+        EventKindBits::PUBLICATION_THROUGHPUT |
+        EventKindBits::ACKNACK_COUNT |
+        EventKindBits::SUBSCRIPTION_THROUGHPUT);
+
+    auto writer_listener = make_shared<MockListener>();
+    ASSERT_TRUE(writer_->add_statistics_listener(writer_listener));
+    auto reader_listener = make_shared<MockListener>();
+    ASSERT_TRUE(reader_->add_statistics_listener(reader_listener));
+
+    EXPECT_CALL(*writer_listener, on_data_count)
+            .Times(AtLeast(1));
+    EXPECT_CALL(*writer_listener, on_heartbeat_count)
+            .Times(AtLeast(1));
+    EXPECT_CALL(*writer_listener, on_publisher_throughput)
+            .Times(AtLeast(1));
+    EXPECT_CALL(*reader_listener, on_acknack_count)
+            .Times(AtLeast(1));
+    EXPECT_CALL(*reader_listener, on_subscriber_throughput)
+            .Times(AtLeast(1));
+
+    // match writer and reader on a dummy topic
+    match_endpoints(false, "string", "statisticsAggregatedTopic");
+
+    // exchange data
+    write_small_sample(length);
+
+    // wait for reception
+    EXPECT_TRUE(reader_->wait_for_unread_cache(Duration_t(5, 0)));
+
+    // receive the sample
+    CacheChange_t* reader_change = nullptr;
+    ASSERT_TRUE(reader_->nextUntakenCache(&reader_change, nullptr));
+
+    // wait for acknowledgement
+    EXPECT_TRUE(writer_->wait_for_all_acked(Duration_t(5, 0)));
+
+    // let the aggregator publish the last events
+    this_thread::sleep_for(chrono::milliseconds(200));
+
+    EXPECT_TRUE(writer_->remove_statistics_listener(writer_listener));
+    EXPECT_TRUE(reader_->remove_statistics_listener(reader_listener));
+}
+
 /*
  * This test checks RTPSParticipant, RTPSWriter and RTPSReader statistics module related APIs.
  * - participant listeners management with late joiners
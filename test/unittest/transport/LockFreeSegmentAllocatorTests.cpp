@@ -0,0 +1,269 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <set>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <rtps/transport/shared_mem/LockFreeSegmentAllocator.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+/**
+ * Simplified buffer node, only holding the reference counts needed by the allocator.
+ */
+struct TestNode
+{
+    std::atomic<uint32_t> enqueued_count{0};
+    std::atomic<uint32_t> processing_count{0};
+    uint32_t validity_id = 0;
+    uint32_t data_size = 0;
+    uint32_t data_offset = 0;
+
+    bool is_not_referenced() const
+    {
+        return (0 == enqueued_count) && (0 == processing_count);
+    }
+
+    void invalidate_buffer()
+    {
+        ++validity_id;
+        enqueued_count = 0;
+        processing_count = 0;
+    }
+
+    bool invalidate_if_not_processing()
+    {
+        if (0 == processing_count)
+        {
+            invalidate_buffer();
+            return true;
+        }
+        return false;
+    }
+
+};
+
+using Allocator = LockFreeSegmentAllocator<TestNode>;
+
+TEST(LockFreeSegmentAllocatorTests, size_classes)
+{
+    std::vector<TestNode> nodes(4);
+    Allocator allocator(nodes.data(), 4, 0, Allocator::area_size_for(100000));
+
+    EXPECT_EQ(64u, allocator.capacity_for(1));
+    EXPECT_EQ(64u, allocator.capacity_for(64));
+    EXPECT_EQ(80u, allocator.capacity_for(65));
+    EXPECT_EQ(1280u, allocator.capacity_for(1025));
+    EXPECT_GE(allocator.capacity_for(100000), 100000u);
+    EXPECT_LE(allocator.capacity_for(100000), Allocator::area_size_for(100000));
+    EXPECT_EQ(0u, allocator.capacity_for(0xFFFFFFFFu));
+}
+
+TEST(LockFreeSegmentAllocatorTests, allocation_and_recycling)
+{
+    constexpr uint32_t max_allocations = 4;
+    std::vector<TestNode> nodes(max_allocations);
+    Allocator allocator(nodes.data(), max_allocations, 1000, Allocator::area_size_for(256));
+
+    // Nodes are carved in order, and regions do not overlap
+    std::set<uint32_t> offsets;
+    std::vector<TestNode*> allocated;
+    for (uint32_t i = 0; i < max_allocations; ++i)
+    {
+        TestNode* node = allocator.allocate(64);
+        ASSERT_NE(nullptr, node);
+        EXPECT_EQ(64u, node->data_size);
+        EXPECT_GE(node->data_offset, 1000u);
+        EXPECT_TRUE(offsets.insert(node->data_offset).second);
+        node->processing_count = 1;
+        allocator.publish(node);
+        allocated.push_back(node);
+    }
+
+    // All nodes referenced
+    EXPECT_EQ(nullptr, allocator.allocate(64));
+    EXPECT_EQ(1u, allocator.overflows_count());
+
+    // Enqueued, but not processing buffers are recovered on overflow
+    allocated[1]->processing_count = 0;
+    allocated[1]->enqueued_count = 1;
+    TestNode* node = allocator.allocate(32);
+    EXPECT_EQ(allocated[1], node);
+    EXPECT_EQ(1u, node->validity_id);
+    allocator.publish(node);
+
+    // Unreferenced buffers are recycled, oldest first
+    allocated[2]->processing_count = 0;
+    allocated[3]->processing_count = 0;
+    node = allocator.allocate(64);
+    EXPECT_EQ(allocated[2], node);
+    allocator.publish(node);
+
+    // Unpublished nodes can be returned
+    node = allocator.allocate(64);
+    EXPECT_EQ(allocated[3], node);
+    allocator.deallocate(node);
+    EXPECT_EQ(allocated[3], allocator.allocate(64));
+}
+
+TEST(LockFreeSegmentAllocatorTests, bigger_classes_are_reused)
+{
+    constexpr uint32_t max_allocations = 2;
+    std::vector<TestNode> nodes(max_allocations);
+    Allocator allocator(nodes.data(), max_allocations, 0, 600);
+
+    TestNode* big = allocator.allocate(512);
+    ASSERT_NE(nullptr, big);
+    allocator.deallocate(big);
+
+    // Not enough room to carve a new region of 128 bytes
+    TestNode* small = allocator.allocate(100);
+    EXPECT_EQ(big, small);
+    EXPECT_EQ(100u, small->data_size);
+}
+
+TEST(LockFreeSegmentAllocatorTests, freed_small_regions_serve_big_allocations)
+{
+    constexpr uint32_t max_allocations = 32;
+    std::vector<TestNode> nodes(max_allocations);
+    Allocator allocator(nodes.data(), max_allocations, 100, Allocator::area_size_for(1024));
+
+    // Fill the payload area with small messages
+    std::vector<TestNode*> allocated;
+    for (TestNode* node = allocator.allocate(64); nullptr != node; node = allocator.allocate(64))
+    {
+        node->processing_count = 1;
+        allocator.publish(node);
+        allocated.push_back(node);
+    }
+    ASSERT_LT(1u, allocated.size());
+
+    // Free all of them, but one returned before publishing, and allocate a big one
+    for (TestNode* node : allocated)
+    {
+        node->processing_count = 0;
+    }
+    TestNode* small = allocator.allocate(64);
+    ASSERT_NE(nullptr, small);
+    allocator.deallocate(small);
+
+    TestNode* big = allocator.allocate(1024);
+    ASSERT_NE(nullptr, big);
+    EXPECT_EQ(1024u, big->data_size);
+    EXPECT_EQ(100u, big->data_offset);
+    big->processing_count = 1;
+    allocator.publish(big);
+
+    // The area is fully used by the big one, until it is freed
+    EXPECT_EQ(nullptr, allocator.allocate(1024));
+    big->processing_count = 0;
+    EXPECT_NE(nullptr, allocator.allocate(1024));
+}
+
+TEST(LockFreeSegmentAllocatorTests, adjacent_free_regions_are_merged)
+{
+    constexpr uint32_t max_allocations = 8;
+    std::vector<TestNode> nodes(max_allocations);
+    Allocator allocator(nodes.data(), max_allocations, 0, 512);
+
+    std::vector<TestNode*> allocated;
+    for (uint32_t i = 0; i < max_allocations; ++i)
+    {
+        TestNode* node = allocator.allocate(64);
+        ASSERT_NE(nullptr, node);
+        node->processing_count = 1;
+        allocator.publish(node);
+        allocated.push_back(node);
+    }
+
+    // The last region is still in use, so the others cannot be returned to the carved area
+    for (uint32_t i = 0; i < max_allocations - 1; ++i)
+    {
+        allocated[i]->processing_count = 0;
+    }
+
+    TestNode* big = allocator.allocate(384);
+    ASSERT_NE(nullptr, big);
+    EXPECT_EQ(0u, big->data_offset);
+
+    // The merged region is the only free one
+    EXPECT_EQ(nullptr, allocator.allocate(64));
+    allocator.deallocate(big);
+    EXPECT_EQ(big, allocator.allocate(64));
+}
+
+TEST(LockFreeSegmentAllocatorTests, concurrent_allocations)
+{
+    constexpr uint32_t max_allocations = 64;
+    constexpr uint32_t num_threads = 4;
+    constexpr uint32_t num_allocations = 10000;
+
+    std::vector<TestNode> nodes(max_allocations);
+    Allocator allocator(nodes.data(), max_allocations, 0, Allocator::area_size_for(1024) * max_allocations);
+
+    std::vector<std::atomic<uint32_t>> owners(max_allocations);
+    for (auto& owner : owners)
+    {
+        owner = 0;
+    }
+    std::atomic<bool> collision{false};
+
+    auto worker = [&](uint32_t id)
+            {
+                for (uint32_t i = 0; i < num_allocations; ++i)
+                {
+                    TestNode* node = allocator.allocate(1 + (i * 37) % 1024);
+                    if (nullptr == node)
+                    {
+                        continue;
+                    }
+
+                    node->processing_count = 1;
+                    uint32_t index = static_cast<uint32_t>(node - nodes.data());
+                    uint32_t expected = 0;
+                    if (!owners[index].compare_exchange_strong(expected, id))
+                    {
+                        collision = true;
+                    }
+                    allocator.publish(node);
+
+                    owners[index] = 0;
+                    node->processing_count = 0;
+                }
+            };
+
+    std::vector<std::thread> threads;
+    for (uint32_t t = 1; t <= num_threads; ++t)
+    {
+        threads.emplace_back(worker, t);
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    EXPECT_FALSE(collision);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -21,6 +21,7 @@
 #include "../../../src/cpp/rtps/transport/shared_mem/SharedMemManager.hpp"
 #include "../../../src/cpp/rtps/transport/shared_mem/SharedMemGlobal.hpp"
 #include "../../../src/cpp/rtps/transport/shared_mem/MultiProducerConsumerRingBuffer.hpp"
+#include "../../../src/cpp/rtps/transport/shared_mem/SharedMemPayloadPool.hpp"
 
 #include <string>
 #include <fstream>
@@ -1375,6 +1376,174 @@ TEST_F(SHMTransportTests, port_not_ok_listener_recover)
     thread_listener.join();
 }
 
+TEST_F(SHMTransportTests, lock_free_segment_allocation)
+{
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+
+    constexpr uint32_t max_allocations = 4u;
+    auto segment = shared_mem_manager->create_segment(1024u, max_allocations, true);
+    segment->prefault();
+
+    std::vector<std::shared_ptr<SharedMemManager::Buffer>> buffers;
+    for (uint32_t i = 0; i < max_allocations; ++i)
+    {
+        buffers.push_back(segment->alloc_buffer(100u,
+                std::chrono::steady_clock::now() + std::chrono::milliseconds(100)));
+        ASSERT_NE(nullptr, buffers.back());
+        EXPECT_EQ(100u, buffers.back()->size());
+        memset(buffers.back()->data(), static_cast<int>(i), buffers.back()->size());
+    }
+
+    // Buffers do not overlap
+    for (uint32_t i = 0; i < max_allocations; ++i)
+    {
+        EXPECT_EQ(static_cast<uint8_t>(i), *static_cast<uint8_t*>(buffers[i]->data()));
+    }
+
+    // All buffer nodes are being processed
+    EXPECT_THROW(segment->alloc_buffer(100u, std::chrono::steady_clock::now() + std::chrono::milliseconds(100)),
+            std::exception);
+
+    // A released buffer is recycled
+    void* released_data = buffers[1]->data();
+    buffers[1].reset();
+    auto buffer = segment->alloc_buffer(50u, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+    ASSERT_NE(nullptr, buffer);
+    EXPECT_EQ(released_data, buffer->data());
+    EXPECT_EQ(50u, buffer->size());
+
+    // Bigger than the segment
+    EXPECT_THROW(segment->alloc_buffer(2048u, std::chrono::steady_clock::now() + std::chrono::milliseconds(100)),
+            std::exception);
+}
+
+TEST_F(SHMTransportTests, listener_spin_then_block)
+{
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    SharedMemGlobal* shared_mem_global = shared_mem_manager->global_segment();
+
+    shared_mem_global->remove_port(0);
+    auto read_port = shared_mem_manager->open_port(0, 4, 1000, SharedMemGlobal::Port::OpenMode::ReadExclusive);
+    auto write_port = shared_mem_manager->open_port(0, 4, 1000, SharedMemGlobal::Port::OpenMode::Write);
+    auto listener = read_port->create_listener(100000u);
+    auto data_segment = shared_mem_manager->create_segment(4, 4);
+
+    std::atomic<uint32_t> received(0u);
+    std::thread thread_listener([&]
+            {
+                for (uint8_t i = 1; i <= 2; ++i)
+                {
+                    auto buff = listener->pop();
+                    ASSERT_TRUE(buff != nullptr);
+                    EXPECT_EQ(i, *static_cast<uint8_t*>(buff->data()));
+                    listener->stop_processing_buffer();
+                    received.fetch_add(1u);
+                }
+                // Nothing else is pushed, so the listener blocks after spinning until it is closed
+                EXPECT_EQ(nullptr, listener->pop());
+            });
+
+    // Pushed while the listener is spinning
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    auto buffer = data_segment->alloc_buffer(1, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+    *static_cast<uint8_t*>(buffer->data()) = 1;
+    bool is_port_ok = false;
+    ASSERT_TRUE(write_port->try_push(buffer, is_port_ok));
+    buffer.reset();
+
+    while (received.load() != 1u)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    // Pushed once the spin budget has expired and the listener is blocked on the port
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    buffer = data_segment->alloc_buffer(1, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+    *static_cast<uint8_t*>(buffer->data()) = 2;
+    ASSERT_TRUE(write_port->try_push(buffer, is_port_ok));
+    buffer.reset();
+
+    while (received.load() != 2u)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    listener->close();
+    thread_listener.join();
+}
+
+TEST_F(SHMTransportTests, payload_pool_descriptor)
+{
+    PoolConfig config{PREALLOCATED_MEMORY_MODE, 1024u, 2u, 2u};
+    auto pool = SharedMemPayloadPool::create(2048u, config);
+    ASSERT_TRUE(pool);
+
+    CacheChange_t change;
+    ASSERT_TRUE(pool->get_payload(1024u, change));
+    for (uint32_t i = 0; i < 1024u; ++i)
+    {
+        change.serializedPayload.data[i] = static_cast<octet>(i);
+    }
+    change.serializedPayload.length = 1024u;
+
+    SharedMemPayloadDescriptor descriptor;
+    ASSERT_TRUE(SharedMemPayloadPool::get_descriptor(change, descriptor));
+    EXPECT_EQ(1024u, descriptor.length);
+
+    // The descriptor travels as an inline QoS parameter
+    CDRMessage_t msg(128);
+    ASSERT_TRUE(descriptor.add_to_cdr_message(&msg));
+    ASSERT_TRUE(CDRMessage::addUInt16(&msg, eprosima::fastdds::dds::PID_SENTINEL));
+    ASSERT_TRUE(CDRMessage::addUInt16(&msg, 0));
+    SerializedPayload_t inline_qos;
+    inline_qos.data = msg.buffer;
+    inline_qos.length = msg.length;
+    inline_qos.max_size = msg.max_size;
+    inline_qos.encapsulation = BIGEND == msg.msg_endian ? PL_CDR_BE : PL_CDR_LE;
+    SharedMemPayloadDescriptor received;
+    bool descriptor_read = SharedMemPayloadDescriptor::read_from_inline_qos(inline_qos, received);
+    inline_qos.data = nullptr;
+    ASSERT_TRUE(descriptor_read);
+
+    SerializedPayload_t mapped;
+    auto mapped_ref = SharedMemPayloadPool::map_payload(received, mapped);
+    ASSERT_TRUE(mapped_ref != nullptr);
+    ASSERT_EQ(1024u, mapped.length);
+    EXPECT_EQ(0, memcmp(change.serializedPayload.data, mapped.data, 1024u));
+    mapped.data = nullptr;
+    mapped_ref.reset();
+
+    // Once released, the payload is recycled by the next allocation and can no longer be mapped
+    ASSERT_TRUE(pool->release_payload(change));
+    CacheChange_t other;
+    ASSERT_TRUE(pool->get_payload(1024u, other));
+    EXPECT_EQ(nullptr, SharedMemPayloadPool::map_payload(received, mapped));
+    mapped.data = nullptr;
+    ASSERT_TRUE(pool->release_payload(other));
+}
+
+TEST_F(SHMTransportTests, segment_memory_placement)
+{
+    SharedMemTransportDescriptor my_descriptor;
+    my_descriptor.segment_huge_pages(true);
+    my_descriptor.segment_numa_node(0);
+
+    // Placement is best effort, the transport should be usable even when the system does not support it
+    SharedMemTransport transport(my_descriptor);
+    ASSERT_TRUE(transport.init());
+
+    auto shared_mem_manager = SharedMemManager::create(domain_name);
+    auto segment = shared_mem_manager->create_segment(1024u, 4u);
+    eprosima::utilities::memory::MemoryPlacement placement;
+    placement.use_huge_pages = true;
+    segment->apply_placement(placement);
+    segment->prefault();
+
+    auto buffer = segment->alloc_buffer(100u, std::chrono::steady_clock::now() + std::chrono::milliseconds(100));
+    ASSERT_NE(nullptr, buffer);
+    memset(buffer->data(), 0xAA, buffer->size());
+}
+
 TEST_F(SHMTransportTests, buffer_recover)
 {
     auto shared_mem_manager = SharedMemManager::create(domain_name);
@@ -25,6 +25,7 @@
 #include <fastrtps/utils/Semaphore.h>
 #include <fastrtps/utils/IPFinder.h>
 #include <fastrtps/utils/IPLocator.h>
+#include <rtps/transport/TCPSendQueue.hpp>
 #include <rtps/transport/TCPv4Transport.h>
 #include <rtps/transport/tcp/RTCPHeader.h>
 
@@ -1767,6 +1768,64 @@ TEST_F(TCPv4Tests, autofill_port)
     EXPECT_TRUE(transportUnderTest_multiple_autofill.configuration()->listening_ports.size() == 3);
 }
 
+// This test verifies that the asynchronous send queue gathers the frames queued while a write is in progress, and
+// drops the frames that do not fit when configured with the DROP policy.
+TEST_F(TCPv4Tests, send_queue_gathers_and_drops_frames)
+{
+    using TCPSendQueue = eprosima::fastdds::rtps::TCPSendQueue;
+
+    asio::io_context ctx;
+    asio::ip::tcp::endpoint endpoint(asio::ip::address_v4::loopback(), 0);
+    asio::ip::tcp::acceptor acceptor(ctx, endpoint);
+    auto client = std::make_shared<asio::ip::tcp::socket>(ctx);
+    asio::ip::tcp::socket server(ctx);
+    client->connect(acceptor.local_endpoint());
+    acceptor.accept(server);
+
+    auto queue = std::make_shared<TCPSendQueue>(client, 1000u, TCPSendQueue::FullPolicy::DROP,
+                    std::chrono::milliseconds(0));
+
+    octet header[4] = {'R', 'T', 'C', 'P'};
+    std::vector<octet> body(96);
+    asio::error_code ec;
+
+    // The first frame starts a write, which completes when the context runs
+    for (octet i = 0; i < 3; ++i)
+    {
+        header[3] = i;
+        EXPECT_EQ(100u, queue->push(header, sizeof(header), body.data(), body.size(), ec));
+        EXPECT_FALSE(ec);
+    }
+
+    // Does not fit on the queue
+    std::vector<octet> big_body(900);
+    EXPECT_EQ(0u, queue->push(nullptr, 0, big_body.data(), big_body.size(), ec));
+    EXPECT_EQ(asio::error::no_buffer_space, ec);
+
+    ctx.run();
+
+    TCPSendQueue::Statistics stats = queue->statistics();
+    EXPECT_EQ(3u, stats.sent_frames);
+    EXPECT_EQ(2u, stats.write_operations);
+    EXPECT_EQ(1u, stats.dropped_frames);
+    EXPECT_EQ(0u, stats.queued_bytes);
+    EXPECT_EQ(0u, stats.queued_frames);
+    EXPECT_EQ(300u, stats.max_queued_bytes);
+
+    // Frames are received in order
+    std::vector<octet> received(300);
+    asio::read(server, asio::buffer(received));
+    for (size_t i = 0; i < 3; ++i)
+    {
+        EXPECT_EQ(static_cast<octet>(i), received[i * 100u + 3u]);
+    }
+
+    // Nothing is accepted after closing
+    queue->close();
+    EXPECT_EQ(0u, queue->push(header, sizeof(header), body.data(), body.size(), ec));
+    EXPECT_EQ(asio::error::not_connected, ec);
+}
+
 void TCPv4Tests::HELPER_SetDescriptorDefaults()
 {
     descriptor.add_listener_port(g_default_port);
@@ -13,6 +13,8 @@
 // limitations under the License.
 
 #include <memory>
+#include <mutex>
+#include <set>
 #include <thread>
 
 #include <asio.hpp>
@@ -725,6 +727,128 @@ TEST_F(UDPv4Tests, double_binding_fails)
     EXPECT_FALSE(default_transport.IsInputChannelOpen(locator));
 }
 
+#if defined(__linux__)
+// A unicast port opened by a group of sockets is listened by several threads
+TEST_F(UDPv4Tests, unicast_socket_group_receives_on_several_threads)
+{
+    constexpr uint32_t num_sources = 32;
+
+    // Room for all the datagrams, as they are sent in a burst
+    descriptor.receiveBufferSize = ReceiveBufferCapacity;
+    descriptor.unicast_sockets_per_port = 4;
+    UDPv4Transport transportUnderTest(descriptor);
+    ASSERT_TRUE(transportUnderTest.init());
+
+    Locator_t locator;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "127.0.0.1", g_default_port, locator);
+
+    MockReceiverResource receiver(transportUnderTest, locator);
+    ASSERT_TRUE(receiver.is_valid());
+    MockMessageReceiver* msg_recv = dynamic_cast<MockMessageReceiver*>(receiver.CreateMessageReceiver());
+
+    std::mutex threads_mutex;
+    std::set<std::thread::id> threads;
+    Semaphore sem;
+    msg_recv->setCallback([&]()
+            {
+                {
+                    std::lock_guard<std::mutex> guard(threads_mutex);
+                    threads.insert(std::this_thread::get_id());
+                }
+                sem.post();
+            });
+
+    // The kernel chooses the socket of the group from the source of the datagram
+    octet message[5] = { 'H', 'e', 'l', 'l', 'o' };
+    asio::io_service io_service;
+    asio::ip::udp::endpoint destination(asio::ip::address_v4::loopback(), g_default_port);
+    for (uint32_t i = 0; i < num_sources; ++i)
+    {
+        asio::ip::udp::socket source(io_service, asio::ip::udp::endpoint(asio::ip::udp::v4(), 0));
+        source.send_to(asio::buffer(message, sizeof(message)), destination);
+    }
+
+    for (uint32_t i = 0; i < num_sources; ++i)
+    {
+        sem.wait();
+    }
+
+    std::lock_guard<std::mutex> guard(threads_mutex);
+    EXPECT_LT(1u, threads.size());
+}
+
+// The sockets of a group do not share their port with a socket opened without SO_REUSEPORT
+TEST_F(UDPv4Tests, unicast_socket_group_fails_on_used_port)
+{
+    auto group_descriptor = descriptor;
+    group_descriptor.unicast_sockets_per_port = 4;
+
+    Locator_t locator;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "127.0.0.1", g_default_port, locator);
+
+    {
+        UDPv4Transport single_transport(descriptor);
+        UDPv4Transport group_transport(group_descriptor);
+        ASSERT_TRUE(single_transport.init());
+        ASSERT_TRUE(group_transport.init());
+
+        MockReceiverResource single_receiver(single_transport, locator);
+        EXPECT_TRUE(single_receiver.is_valid());
+
+        MockReceiverResource group_receiver(group_transport, locator);
+        EXPECT_FALSE(group_receiver.is_valid());
+        EXPECT_FALSE(group_transport.IsInputChannelOpen(locator));
+    }
+
+    {
+        UDPv4Transport group_transport(group_descriptor);
+        UDPv4Transport single_transport(descriptor);
+        ASSERT_TRUE(group_transport.init());
+        ASSERT_TRUE(single_transport.init());
+
+        MockReceiverResource group_receiver(group_transport, locator);
+        EXPECT_TRUE(group_receiver.is_valid());
+
+        MockReceiverResource single_receiver(single_transport, locator);
+        EXPECT_FALSE(single_receiver.is_valid());
+        EXPECT_FALSE(single_transport.IsInputChannelOpen(locator));
+
+        // The port can be opened again once the group is closed
+        EXPECT_TRUE(group_transport.CloseInputChannel(locator));
+        MockReceiverResource reopened_receiver(single_transport, locator);
+        EXPECT_TRUE(reopened_receiver.is_valid());
+    }
+}
+
+// Only one group of sockets listens on a port, even if both groups could bind it with SO_REUSEPORT
+TEST_F(UDPv4Tests, unicast_socket_group_fails_on_port_of_other_group)
+{
+    auto group_descriptor = descriptor;
+    group_descriptor.unicast_sockets_per_port = 4;
+
+    Locator_t locator;
+    IPLocator::createLocator(LOCATOR_KIND_UDPv4, "127.0.0.1", g_default_port, locator);
+
+    UDPv4Transport first_transport(group_descriptor);
+    UDPv4Transport second_transport(group_descriptor);
+    ASSERT_TRUE(first_transport.init());
+    ASSERT_TRUE(second_transport.init());
+
+    MockReceiverResource first_receiver(first_transport, locator);
+    EXPECT_TRUE(first_receiver.is_valid());
+
+    MockReceiverResource second_receiver(second_transport, locator);
+    EXPECT_FALSE(second_receiver.is_valid());
+    EXPECT_FALSE(second_transport.IsInputChannelOpen(locator));
+
+    // The port can be opened by another group once the first one is closed
+    EXPECT_TRUE(first_transport.CloseInputChannel(locator));
+    MockReceiverResource reopened_receiver(second_transport, locator);
+    EXPECT_TRUE(reopened_receiver.is_valid());
+    EXPECT_TRUE(second_transport.IsInputChannelOpen(locator));
+}
+#endif // if defined(__linux__)
+
 void UDPv4Tests::HELPER_SetDescriptorDefaults()
 {
     descriptor.maxMessageSize = 5;
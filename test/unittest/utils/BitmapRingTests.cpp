@@ -0,0 +1,183 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <random>
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include <utils/collections/BitmapRing.hpp>
+
+using namespace eprosima::utilities::collections;
+
+using TestRing = BitmapRing<128u>;
+
+TEST(BitmapRingTests, set_and_check)
+{
+    TestRing ring;
+    ring.reset(10u);
+
+    EXPECT_EQ(10u, ring.base());
+    EXPECT_FALSE(ring.in_range(9u));
+    EXPECT_TRUE(ring.in_range(10u));
+    EXPECT_TRUE(ring.in_range(10u + TestRing::capacity - 1u));
+    EXPECT_FALSE(ring.in_range(10u + TestRing::capacity));
+
+    EXPECT_TRUE(ring.set(12u));
+    EXPECT_FALSE(ring.set(12u));
+    EXPECT_TRUE(ring.set(100u));
+    EXPECT_TRUE(ring.is_set(12u));
+    EXPECT_TRUE(ring.is_set(100u));
+    EXPECT_FALSE(ring.is_set(11u));
+    // Same bit as 12, but outside the window
+    EXPECT_FALSE(ring.is_set(12u + TestRing::capacity));
+}
+
+TEST(BitmapRingTests, advance_while_set)
+{
+    TestRing ring;
+    ring.reset(30u);
+
+    EXPECT_EQ(30u, ring.advance_while_set());
+
+    // Consecutive positions crossing a word boundary
+    for (uint64_t pos = 30u; pos < 70u; ++pos)
+    {
+        ring.set(pos);
+    }
+    ring.set(71u);
+    EXPECT_EQ(70u, ring.advance_while_set());
+    EXPECT_TRUE(ring.is_set(71u));
+
+    // Positions beyond the previous window reuse the bits cleared
+    EXPECT_TRUE(ring.in_range(70u + TestRing::capacity - 1u));
+    EXPECT_FALSE(ring.is_set(30u + TestRing::capacity));
+    EXPECT_TRUE(ring.set(30u + TestRing::capacity));
+
+    ring.set(70u);
+    EXPECT_EQ(72u, ring.advance_while_set());
+}
+
+TEST(BitmapRingTests, advance_to)
+{
+    TestRing ring;
+    ring.reset(1u);
+
+    ring.set(2u);
+    ring.set(40u);
+    ring.set(41u);
+    ring.set(100u);
+
+    EXPECT_EQ(0u, ring.advance_to(1u));
+    EXPECT_EQ(3u, ring.advance_to(41u + 1u));
+    EXPECT_EQ(42u, ring.base());
+    EXPECT_FALSE(ring.is_set(40u));
+    EXPECT_TRUE(ring.is_set(100u));
+
+    // Jump further than the window size
+    EXPECT_EQ(1u, ring.advance_to(1000u));
+    EXPECT_EQ(1000u, ring.base());
+    EXPECT_EQ(0u, ring.count_set(0u, 2000u));
+}
+
+TEST(BitmapRingTests, find_and_count)
+{
+    TestRing ring;
+    ring.reset(50u);
+
+    EXPECT_EQ(60u, ring.find_next_set(50u, 60u));
+    EXPECT_EQ(0u, ring.count_set(50u, 60u));
+
+    ring.set(55u);
+    ring.set(96u);
+    ring.set(50u + TestRing::capacity - 1u);
+
+    EXPECT_EQ(55u, ring.find_next_set(0u, 1000u));
+    EXPECT_EQ(96u, ring.find_next_set(56u, 1000u));
+    EXPECT_EQ(90u, ring.find_next_set(56u, 90u));
+    EXPECT_EQ(50u + TestRing::capacity - 1u, ring.find_next_set(97u, 1000u));
+    EXPECT_EQ(1000u, ring.find_next_set(50u + TestRing::capacity, 1000u));
+
+    EXPECT_EQ(3u, ring.count_set(0u, 1000u));
+    EXPECT_EQ(1u, ring.count_set(56u, 97u));
+    EXPECT_EQ(0u, ring.count_set(56u, 96u));
+}
+
+/*
+ * Compare against a std::set on a random sequence of operations, with the window wrapping many times.
+ */
+TEST(BitmapRingTests, random_against_set)
+{
+    std::mt19937 gen(7u);
+    std::uniform_int_distribution<uint32_t> op_dist(0u, 9u);
+    std::uniform_int_distribution<uint32_t> offset_dist(0u, TestRing::capacity - 1u);
+
+    TestRing ring;
+    std::set<uint64_t> reference;
+    uint64_t base = 1u;
+    ring.reset(base);
+
+    for (uint32_t i = 0; i < 20000u; ++i)
+    {
+        uint32_t op = op_dist(gen);
+        if (op < 6u)
+        {
+            uint64_t pos = base + offset_dist(gen);
+            ASSERT_EQ(reference.insert(pos).second, ring.set(pos));
+        }
+        else if (op < 8u)
+        {
+            while (reference.count(base) != 0u)
+            {
+                reference.erase(base++);
+            }
+            ASSERT_EQ(base, ring.advance_while_set());
+        }
+        else
+        {
+            uint64_t new_base = base + offset_dist(gen) / 4u;
+            uint64_t n_set = 0u;
+            while (!reference.empty() && *reference.begin() < new_base)
+            {
+                reference.erase(reference.begin());
+                ++n_set;
+            }
+            base = new_base;
+            ASSERT_EQ(n_set, ring.advance_to(new_base));
+        }
+
+        ASSERT_EQ(base, ring.base());
+        uint64_t from = base + offset_dist(gen);
+        uint64_t limit = from + offset_dist(gen);
+        auto it = reference.lower_bound(from);
+        uint64_t expected_next = (it != reference.end() && *it < limit) ? *it : limit;
+        ASSERT_EQ(expected_next, ring.find_next_set(from, limit));
+
+        uint64_t expected_count = 0u;
+        for (; it != reference.end() && *it < limit; ++it)
+        {
+            ++expected_count;
+        }
+        ASSERT_EQ(expected_count, ring.count_set(from, limit));
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
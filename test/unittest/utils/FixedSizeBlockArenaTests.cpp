@@ -0,0 +1,122 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <cstring>
+#include <set>
+
+#include <gtest/gtest.h>
+
+#include <utils/memory/FixedSizeBlockArena.hpp>
+#include <utils/memory/MemoryPlacement.hpp>
+
+using namespace eprosima::utilities::memory;
+
+static bool is_zero_filled(
+        const void* block,
+        size_t size)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(block);
+    for (size_t i = 0; i < size; ++i)
+    {
+        if (0 != bytes[i])
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+TEST(MemoryPlacementTests, default_placement)
+{
+    MemoryPlacement placement;
+    EXPECT_TRUE(placement.is_default());
+
+    placement.prefault = true;
+    EXPECT_FALSE(placement.is_default());
+
+    placement = MemoryPlacement();
+    placement.numa_node = 0;
+    EXPECT_FALSE(placement.is_default());
+}
+
+TEST(MemoryPlacementTests, map_placed_memory)
+{
+    MemoryPlacement placement;
+    placement.use_huge_pages = true;
+    placement.prefault = true;
+
+    // Huge pages may not be available, but the mapping should always succeed
+    size_t size = 3 * page_size() + 1;
+    void* address = map_placed_memory(size, placement);
+    ASSERT_NE(nullptr, address);
+    EXPECT_GE(size, 3 * page_size() + 1);
+    EXPECT_TRUE(is_zero_filled(address, size));
+    memset(address, 0xAA, size);
+    unmap_placed_memory(address, size);
+}
+
+TEST(FixedSizeBlockArenaTests, block_size_is_aligned)
+{
+    FixedSizeBlockArena arena(13, MemoryPlacement());
+    EXPECT_GE(arena.block_size(), 13u);
+    EXPECT_EQ(0u, arena.block_size() % alignof(std::max_align_t));
+}
+
+TEST(FixedSizeBlockArenaTests, allocate_and_reuse)
+{
+    MemoryPlacement placement;
+    placement.prefault = true;
+    FixedSizeBlockArena arena(100, placement);
+    constexpr size_t num_blocks = 50;
+
+    ASSERT_TRUE(arena.reserve(num_blocks));
+
+    // Reserved blocks are contiguous, zero-filled and do not overlap
+    std::set<uint8_t*> blocks;
+    uint8_t* previous = nullptr;
+    for (size_t i = 0; i < num_blocks; ++i)
+    {
+        uint8_t* block = static_cast<uint8_t*>(arena.allocate());
+        ASSERT_NE(nullptr, block);
+        EXPECT_TRUE(is_zero_filled(block, arena.block_size()));
+        if (nullptr != previous)
+        {
+            EXPECT_EQ(previous + arena.block_size(), block);
+        }
+        previous = block;
+        EXPECT_TRUE(blocks.insert(block).second);
+        memset(block, 0xFF, arena.block_size());
+    }
+
+    // Released blocks are reused, and zero-filled again
+    uint8_t* released = *blocks.begin();
+    arena.deallocate(released);
+    uint8_t* block = static_cast<uint8_t*>(arena.allocate());
+    EXPECT_EQ(released, block);
+    EXPECT_TRUE(is_zero_filled(block, arena.block_size()));
+
+    // The arena grows when exhausted
+    block = static_cast<uint8_t*>(arena.allocate());
+    ASSERT_NE(nullptr, block);
+    EXPECT_EQ(blocks.end(), blocks.find(block));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,103 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <utils/threading/ThreadLayout.hpp>
+
+using namespace eprosima::fastdds::rtps;
+
+TEST(ThreadLayoutTests, parse_cpu_list)
+{
+    EXPECT_EQ(std::vector<uint32_t>({0u, 1u, 2u, 3u, 8u, 10u, 11u}), ThreadLayout::parse_cpu_list("0-3,8,10-11"));
+    EXPECT_EQ(std::vector<uint32_t>({5u}), ThreadLayout::parse_cpu_list("5\n"));
+    EXPECT_EQ(std::vector<uint32_t>({62u, 63u}), ThreadLayout::parse_cpu_list("62-70"));
+    EXPECT_TRUE(ThreadLayout::parse_cpu_list("").empty());
+    EXPECT_TRUE(ThreadLayout::parse_cpu_list("x,7-3").empty());
+}
+
+TEST(ThreadLayoutTests, default_policy_keeps_settings)
+{
+    ThreadTopologyPolicy policy;
+    ThreadLayout layout(policy, {0u, 1u, 2u, 3u});
+    EXPECT_TRUE(layout.is_default());
+
+    ThreadSettings settings;
+    EXPECT_EQ(0u, layout.general_thread(settings).affinity);
+    EXPECT_EQ(0u, layout.reception_thread(settings, 0u).affinity);
+}
+
+TEST(ThreadLayoutTests, isolate_receive_cores)
+{
+    ThreadTopologyPolicy policy;
+    policy.isolate_receive_cores = true;
+    ThreadLayout layout(policy, {4u, 5u, 6u, 7u});
+    ASSERT_FALSE(layout.is_default());
+
+    ThreadSettings settings;
+    EXPECT_EQ(0x30u, layout.general_thread(settings).affinity);
+    EXPECT_EQ(0xC0u, layout.reception_thread(settings, 0u).affinity);
+    EXPECT_EQ(0xC0u, layout.reception_thread(settings, 1u).affinity);
+
+    // Explicit affinities are kept
+    settings.affinity = 0x1u;
+    EXPECT_EQ(0x1u, layout.general_thread(settings).affinity);
+    EXPECT_EQ(0x1u, layout.reception_thread(settings, 0u).affinity);
+
+    // A single CPU cannot be split
+    ThreadLayout single(policy, {2u});
+    EXPECT_EQ(0x4u, single.general_thread(ThreadSettings{}).affinity);
+    EXPECT_EQ(0x4u, single.reception_thread(ThreadSettings{}, 0u).affinity);
+}
+
+TEST(ThreadLayoutTests, auto_spread)
+{
+    ThreadTopologyPolicy policy;
+    policy.isolate_receive_cores = true;
+    policy.auto_spread = true;
+    ThreadLayout layout(policy, {0u, 1u, 2u, 3u, 4u, 5u});
+
+    ThreadSettings settings;
+    EXPECT_EQ(0x07u, layout.general_thread(settings).affinity);
+    EXPECT_EQ(0x08u, layout.reception_thread(settings, 0u).affinity);
+    EXPECT_EQ(0x10u, layout.reception_thread(settings, 1u).affinity);
+    EXPECT_EQ(0x20u, layout.reception_thread(settings, 2u).affinity);
+    EXPECT_EQ(0x08u, layout.reception_thread(settings, 3u).affinity);
+
+    // Ports listened by several threads get a CPU for each of them
+    EXPECT_EQ(0x30u, layout.reception_thread(settings, 1u, 2u).affinity);
+    EXPECT_EQ(0x28u, layout.reception_thread(settings, 2u, 2u).affinity);
+    EXPECT_EQ(0x38u, layout.reception_thread(settings, 0u, 5u).affinity);
+}
+
+TEST(ThreadLayoutTests, numa_node_without_cpus)
+{
+    ThreadTopologyPolicy policy;
+    policy.numa_node = 1;
+    ThreadLayout layout(policy, {});
+    EXPECT_TRUE(layout.is_default());
+    EXPECT_EQ(1, layout.numa_node());
+    EXPECT_EQ(0u, layout.general_thread(ThreadSettings{}).affinity);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
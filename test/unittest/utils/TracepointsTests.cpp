@@ -0,0 +1,197 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <utils/tracing/Tracepoints.hpp>
+
+#ifndef FASTDDS_TRACING
+#error "These tests must be built with FASTDDS_TRACING"
+#endif // ifndef FASTDDS_TRACING
+
+using namespace eprosima::fastrtps::rtps;
+
+//! Returns a different writer GUID on each call, as the events of previous tests are kept on the trace
+static GUID_t writer_guid()
+{
+    static uint32_t writer_id = 0x100;
+    GUID_t guid;
+    guid.guidPrefix.value[0] = 0x01;
+    guid.entityId = EntityId_t(++writer_id);
+    return guid;
+}
+
+static std::string read_file(
+        const std::string& file_name)
+{
+    std::ifstream file(file_name);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+static size_t count(
+        const std::string& text,
+        const std::string& pattern)
+{
+    size_t n = 0;
+    for (size_t pos = text.find(pattern); std::string::npos != pos; pos = text.find(pattern, pos + 1))
+    {
+        ++n;
+    }
+    return n;
+}
+
+static std::string dump(
+        const std::string& file_name)
+{
+    EXPECT_TRUE(eprosima::fastdds::tracing::dump_trace(file_name));
+    std::string trace = read_file(file_name);
+    std::remove(file_name.c_str());
+    return trace;
+}
+
+/**
+ * The stages of a sample recorded by several threads are dumped as slices joined by a single flow.
+ */
+TEST(TracepointsTests, dump_joins_sample_stages)
+{
+    const std::string file_name = "TracepointsTests_dump.json";
+    const std::string flow_start = "{\"ph\":\"s\",\"cat\":\"fastdds\",\"name\":\"sample\"";
+    const std::string flow_step = "{\"ph\":\"t\",\"cat\":\"fastdds\",\"name\":\"sample\"";
+    const std::string flow_end = "{\"ph\":\"f\",\"cat\":\"fastdds\",\"name\":\"sample\"";
+    GUID_t guid = writer_guid();
+    SequenceNumber_t sn(0, 42);
+    std::ostringstream sample;
+    sample << "\"writer_guid\":\"" << guid << "\",\"sequence_number\":42}";
+
+    std::string before = dump(file_name);
+
+    FASTDDS_TRACEPOINT_INSTANT("test::first_stage", guid, sn);
+    std::thread other([&guid, &sn]()
+            {
+                FASTDDS_TRACEPOINT_SCOPE(tp, "test::second_stage", GUID_t::unknown(), SequenceNumber_t::unknown());
+                FASTDDS_TRACEPOINT_SAMPLE(tp, guid, sn);
+            });
+    other.join();
+    {
+        FASTDDS_TRACEPOINT_SCOPE(tp, "test::third_stage", guid, sn);
+    }
+
+    std::string trace = dump(file_name);
+
+    EXPECT_EQ(0u, trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"test::first_stage\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"test::second_stage\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"test::third_stage\""));
+    EXPECT_EQ(3u, count(trace, sample.str()));
+    EXPECT_LE(2u, count(trace, "\"name\":\"thread_name\""));
+
+    // A single flow, with start, step and end, is added for the sample
+    EXPECT_EQ(count(before, flow_start) + 1, count(trace, flow_start));
+    EXPECT_EQ(count(before, flow_step) + 1, count(trace, flow_step));
+    EXPECT_EQ(count(before, flow_end) + 1, count(trace, flow_end));
+}
+
+/**
+ * Only the newest events of a thread are kept when it records more than its ring can hold.
+ */
+TEST(TracepointsTests, ring_keeps_newest_events)
+{
+    const std::string file_name = "TracepointsTests_ring.json";
+    const uint32_t recorded = 20000;
+    GUID_t guid = writer_guid();
+    std::ostringstream writer;
+    writer << "\"writer_guid\":\"" << guid << "\"";
+
+    std::thread recorder([&guid, recorded]()
+            {
+                for (uint32_t i = 0; i < recorded; ++i)
+                {
+                    FASTDDS_TRACEPOINT_INSTANT("test::ring", guid, SequenceNumber_t(1, i));
+                }
+            });
+    recorder.join();
+
+    std::string trace = dump(file_name);
+
+    EXPECT_EQ(16384u, count(trace, writer.str()));
+    std::ostringstream newest;
+    newest << writer.str() << ",\"sequence_number\":" << SequenceNumber_t(1, recorded - 1).to64long() << "}";
+    EXPECT_NE(std::string::npos, trace.find(newest.str()));
+    std::ostringstream oldest;
+    oldest << writer.str() << ",\"sequence_number\":" << SequenceNumber_t(1, 0).to64long() << "}";
+    EXPECT_EQ(std::string::npos, trace.find(oldest.str()));
+}
+
+TEST(TracepointsTests, dump_fails_on_wrong_file)
+{
+    FASTDDS_TRACEPOINT_INSTANT("test::wrong_file", writer_guid(), SequenceNumber_t(0, 1));
+    EXPECT_FALSE(eprosima::fastdds::tracing::dump_trace("non_existent_directory/trace.json"));
+}
+
+/**
+ * The trace is written on the file of the environment when the process exits, with other threads still running.
+ */
+TEST(TracepointsTests, dump_on_exit)
+{
+    const std::string file_name = "TracepointsTests_exit.json";
+    std::remove(file_name.c_str());
+
+    EXPECT_EXIT(
+        {
+#ifdef _WIN32
+            _putenv_s("FASTDDS_TRACE_FILE", file_name.c_str());
+#else
+            setenv("FASTDDS_TRACE_FILE", file_name.c_str(), 1);
+#endif // ifdef _WIN32
+            FASTDDS_TRACEPOINT_INSTANT("test::exit", writer_guid(), SequenceNumber_t(0, 7));
+            std::promise<void> recorded;
+            std::thread([&recorded]()
+            {
+                FASTDDS_TRACEPOINT_INSTANT("test::detached", GUID_t::unknown(), SequenceNumber_t::unknown());
+                recorded.set_value();
+                for (;;)
+                {
+                    std::this_thread::sleep_for(std::chrono::seconds(1));
+                }
+            }).detach();
+            recorded.get_future().wait();
+            std::exit(0);
+        }, ::testing::ExitedWithCode(0), "");
+
+    std::string trace = read_file(file_name);
+    std::remove(file_name.c_str());
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"test::exit\""));
+    EXPECT_NE(std::string::npos, trace.find("\"name\":\"test::detached\""));
+    EXPECT_NE(std::string::npos, trace.find("\n]}\n"));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -1693,6 +1693,89 @@ TEST_F(XMLParserTests, ParticipantAllocationAttributesDataLimits)
     EXPECT_EQ(allocation.data_limits.max_partitions, 3ul);
 }
 
+/*
+ * This test checks the positive cases of configuration through XML of the payload pools placement of the
+ * participant's allocation attributes.
+ * 1. Check that the XML return code is correct for the payload pools settings.
+ * 2. Check that use_huge_pages, prefault and numa_node are set correctly.
+ */
+TEST_F(XMLParserTests, ParticipantAllocationAttributesPayloadPools)
+{
+    uint8_t ident = 1;
+    rtps::RTPSParticipantAllocationAttributes allocation;
+    tinyxml2::XMLDocument xml_doc;
+    tinyxml2::XMLElement* titleElement;
+
+    // XML snippet
+    const char* xml =
+            "\
+            <rtpsParticipantAllocationAttributes>\
+                <payload_pools>\
+                    <use_huge_pages>true</use_huge_pages>\
+                    <prefault>true</prefault>\
+                    <numa_node>1</numa_node>\
+                </payload_pools>\
+            </rtpsParticipantAllocationAttributes>\
+            ";
+
+    // Load the xml
+    ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+    titleElement = xml_doc.RootElement();
+    // Check that the XML return code is correct for the payload pools settings.
+    EXPECT_EQ(
+        XMLP_ret::XML_OK,
+        XMLParserTest::getXMLParticipantAllocationAttributes_wrapper(titleElement, allocation, ident));
+    // Check that the placement attributes are set correctly.
+    EXPECT_TRUE(allocation.payload_pools.use_huge_pages);
+    EXPECT_TRUE(allocation.payload_pools.prefault);
+    EXPECT_EQ(allocation.payload_pools.numa_node, 1);
+}
+
+/*
+ * This test checks the configuration through XML of the thread topology policy of the participant.
+ * 1. Check that the XML return code is correct for the thread topology settings.
+ * 2. Check that numa_node, isolate_receive_cores and auto_spread are set correctly.
+ * 3. Check that an invalid element is rejected.
+ */
+TEST_F(XMLParserTests, getXMLThreadTopologyPolicy)
+{
+    uint8_t ident = 1;
+    eprosima::fastdds::rtps::ThreadTopologyPolicy policy;
+    tinyxml2::XMLDocument xml_doc;
+    tinyxml2::XMLElement* titleElement;
+
+    // XML snippet
+    const char* xml =
+            "\
+            <thread_topology>\
+                <numa_node>1</numa_node>\
+                <isolate_receive_cores>true</isolate_receive_cores>\
+                <auto_spread>true</auto_spread>\
+            </thread_topology>\
+            ";
+
+    // Load the xml
+    ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+    titleElement = xml_doc.RootElement();
+    // Check that the XML return code is correct for the thread topology settings.
+    EXPECT_EQ(XMLP_ret::XML_OK, XMLParserTest::getXMLThreadTopologyPolicy_wrapper(titleElement, policy, ident));
+    // Check that the policy is set correctly.
+    EXPECT_EQ(policy.numa_node, 1);
+    EXPECT_TRUE(policy.isolate_receive_cores);
+    EXPECT_TRUE(policy.auto_spread);
+
+    // Invalid element
+    const char* bad_xml =
+            "\
+            <thread_topology>\
+                <bad_element> </bad_element>\
+            </thread_topology>\
+            ";
+    ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(bad_xml));
+    titleElement = xml_doc.RootElement();
+    EXPECT_EQ(XMLP_ret::XML_ERROR, XMLParserTest::getXMLThreadTopologyPolicy_wrapper(titleElement, policy, ident));
+}
+
 /*
  * This test checks the positive cases of configuration through XML of the STATIC EDP.
  * 1. Check that the XML return code is correct for the STATIC EDP settings.
@@ -1729,6 +1812,57 @@ TEST_F(XMLParserTests, getXMLDiscoverySettingsStaticEDP)
     EXPECT_STREQ(settings.static_edp_xml_config(), "file://my_static_edp.xml");
 }
 
+/*
+ * This test checks the configuration through XML of the format of the discovery database backup.
+ * 1. Check that the format is BINARY by default.
+ * 2. Check that each value of <backupFormat> sets the corresponding format.
+ * 3. Check that an invalid value of <backupFormat> is rejected.
+ */
+TEST_F(XMLParserTests, getXMLDiscoverySettingsBackupFormat)
+{
+    uint8_t ident = 1;
+    tinyxml2::XMLDocument xml_doc;
+    tinyxml2::XMLElement* titleElement;
+
+    // Parametrized XML
+    const char* xml_p =
+            "\
+            <discovery_config>\
+                <backupFormat>%s</backupFormat>\
+            </discovery_config>\
+            ";
+    constexpr size_t xml_len {500};
+    char xml[xml_len];
+
+    // Check that the format is BINARY by default.
+    EXPECT_EQ(rtps::DiscoveryBackupFormat::BINARY, rtps::DiscoverySettings().backup_format);
+
+    // Check that each value of <backupFormat> sets the corresponding format.
+    std::vector<std::pair<std::string, rtps::DiscoveryBackupFormat>> formats =
+    {
+        {"JSON", rtps::DiscoveryBackupFormat::JSON},
+        {"BINARY", rtps::DiscoveryBackupFormat::BINARY}
+    };
+    for (const auto& format : formats)
+    {
+        rtps::DiscoverySettings settings;
+        settings.backup_format = rtps::DiscoveryBackupFormat::JSON == format.second ?
+                rtps::DiscoveryBackupFormat::BINARY : rtps::DiscoveryBackupFormat::JSON;
+        snprintf(xml, xml_len, xml_p, format.first.c_str());
+        ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+        titleElement = xml_doc.RootElement();
+        EXPECT_EQ(XMLP_ret::XML_OK, XMLParserTest::getXMLDiscoverySettings_wrapper(titleElement, settings, ident));
+        EXPECT_EQ(format.second, settings.backup_format);
+    }
+
+    // Check that an invalid value of <backupFormat> is rejected.
+    rtps::DiscoverySettings settings;
+    snprintf(xml, xml_len, xml_p, "XML");
+    ASSERT_EQ(tinyxml2::XMLError::XML_SUCCESS, xml_doc.Parse(xml));
+    titleElement = xml_doc.RootElement();
+    EXPECT_EQ(XMLP_ret::XML_ERROR, XMLParserTest::getXMLDiscoverySettings_wrapper(titleElement, settings, ident));
+}
+
 /*
  * This test checks the positive case of configuration via XML of the livelines automatic kind.
  * 1. Check that the XML return code is correct for the liveliness kind setting.
@@ -2970,6 +3104,7 @@ TEST_F(XMLParserTests, getXMLPublishModeQos_NegativeClauses)
  *      <max_properties>
  *      <max_user_data>
  *      <max_partitions>
+ *      <payload_pools>
  * 2. Check invalid element
  */
 TEST_F(XMLParserTests, getXMLParticipantAllocationAttributes_NegativeClauses)
@@ -3007,7 +3142,8 @@ TEST_F(XMLParserTests, getXMLParticipantAllocationAttributes_NegativeClauses)
         "send_buffers",
         "max_properties",
         "max_user_data",
-        "max_partitions"
+        "max_partitions",
+        "payload_pools"
     };
 
     for (std::string tag : field_vec)
@@ -3041,6 +3177,7 @@ TEST_F(XMLParserTests, getXMLParticipantAllocationAttributes_NegativeClauses)
  *      <clientAnnouncementPeriod>
  *      <discoveryServersList>
  *      <static_edp_xml_config>
+ *      <backupFormat>
  * 2. Check invalid <EDP> element
  * 3. Check invalid <SimpleEDP <PUBWRITER_SUBREADER>> element
  * 4. Check invalid <SimpleEDP <PUBREADER_SUBWRITER>> element
@@ -3083,7 +3220,8 @@ TEST_F(XMLParserTests, getXMLDiscoverySettings_NegativeClauses)
         "simpleEDP",
         "clientAnnouncementPeriod",
         "discoveryServersList",
-        "static_edp_xml_config"
+        "static_edp_xml_config",
+        "backupFormat"
     };
 
     for (std::string tag : field_vec)
@@ -885,7 +885,9 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <sendBufferSize>8192</sendBufferSize>\
                     <receiveBufferSize>8192</receiveBufferSize>\
                     <TTL>250</TTL>\
+                    <receive_buffer_pool_size>16</receive_buffer_pool_size>\
                     <non_blocking_send>false</non_blocking_send>\
+                    <unicast_sockets_per_port>4</unicast_sockets_per_port>\
                     <maxMessageSize>16384</maxMessageSize>\
                     <maxInitialPeersRange>100</maxInitialPeersRange>\
                     <interfaceWhiteList>\
@@ -935,7 +937,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     </reception_threads>\
                 </transport_descriptor>\
                 ";
-        constexpr size_t xml_len {3000};
+        constexpr size_t xml_len {3500};
         char xml[xml_len];
 
         // UDPv4
@@ -949,7 +951,9 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv4Desc->sendBufferSize, 8192u);
         EXPECT_EQ(pUDPv4Desc->receiveBufferSize, 8192u);
         EXPECT_EQ(pUDPv4Desc->TTL, 250u);
+        EXPECT_EQ(pUDPv4Desc->receive_buffer_pool_size, 16u);
         EXPECT_EQ(pUDPv4Desc->non_blocking_send, false);
+        EXPECT_EQ(pUDPv4Desc->unicast_sockets_per_port, 4u);
         EXPECT_EQ(pUDPv4Desc->max_message_size(), 16384u);
         EXPECT_EQ(pUDPv4Desc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pUDPv4Desc->interfaceWhiteList[0], "192.168.1.41");
@@ -974,7 +978,9 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pUDPv6Desc->sendBufferSize, 8192u);
         EXPECT_EQ(pUDPv6Desc->receiveBufferSize, 8192u);
         EXPECT_EQ(pUDPv6Desc->TTL, 250u);
+        EXPECT_EQ(pUDPv6Desc->receive_buffer_pool_size, 16u);
         EXPECT_EQ(pUDPv6Desc->non_blocking_send, false);
+        EXPECT_EQ(pUDPv6Desc->unicast_sockets_per_port, 4u);
         EXPECT_EQ(pUDPv6Desc->max_message_size(), 16384u);
         EXPECT_EQ(pUDPv6Desc->max_initial_peers_range(), 100u);
         EXPECT_EQ(pUDPv6Desc->interfaceWhiteList[0], "192.168.1.41");
@@ -1020,6 +1026,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     <calculate_crc>false</calculate_crc>\
                     <check_crc>false</check_crc>\
                     <enable_tcp_nodelay>false</enable_tcp_nodelay>\
+                    <async_send>true</async_send>\
+                    <send_queue_max_bytes>1048576</send_queue_max_bytes>\
+                    <send_queue_full_policy>BLOCK</send_queue_full_policy>\
+                    <send_queue_block_timeout_ms>50</send_queue_block_timeout_ms>\
                     <tls><!-- TLS Section --></tls>\
                     <keep_alive_thread>\
                         <scheduling_policy>12</scheduling_policy>\
@@ -1055,7 +1065,7 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                     </reception_threads>\
                 </transport_descriptor>\
                 ";
-        constexpr size_t xml_len {3500};
+        constexpr size_t xml_len {4000};
         char xml[xml_len];
 
         // TCPv4
@@ -1085,6 +1095,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv4Desc->logical_port_increment, 2u);
         EXPECT_EQ(pTCPv4Desc->listening_ports[0], 5100u);
         EXPECT_EQ(pTCPv4Desc->listening_ports[1], 5200u);
+        EXPECT_TRUE(pTCPv4Desc->async_send);
+        EXPECT_EQ(pTCPv4Desc->send_queue_max_bytes, 1048576u);
+        EXPECT_EQ(pTCPv4Desc->send_queue_full_policy, rtps::TCPTransportDescriptor::SendQueueFullPolicy::BLOCK);
+        EXPECT_EQ(pTCPv4Desc->send_queue_block_timeout_ms, 50u);
         EXPECT_EQ(pTCPv4Desc->keep_alive_thread, modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->accept_thread, modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->default_reception_threads(), modified_thread_settings);
@@ -1115,6 +1129,10 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pTCPv6Desc->logical_port_increment, 2u);
         EXPECT_EQ(pTCPv6Desc->listening_ports[0], 5100u);
         EXPECT_EQ(pTCPv6Desc->listening_ports[1], 5200u);
+        EXPECT_TRUE(pTCPv6Desc->async_send);
+        EXPECT_EQ(pTCPv6Desc->send_queue_max_bytes, 1048576u);
+        EXPECT_EQ(pTCPv6Desc->send_queue_full_policy, rtps::TCPTransportDescriptor::SendQueueFullPolicy::BLOCK);
+        EXPECT_EQ(pTCPv6Desc->send_queue_block_timeout_ms, 50u);
         EXPECT_EQ(pTCPv4Desc->keep_alive_thread, modified_thread_settings);
         EXPECT_EQ(pTCPv4Desc->accept_thread, modified_thread_settings);
         EXPECT_EQ(pTCPv6Desc->default_reception_threads(), modified_thread_settings);
@@ -1165,6 +1183,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
                         <affinity>12</affinity>\
                         <stack_size>12</stack_size>\
                     </dump_thread>\
+                    <lock_free_segment_allocation>true</lock_free_segment_allocation>\
+                    <listener_spin_budget_us>50</listener_spin_budget_us>\
                 </transport_descriptor>\
                 ";
 
@@ -1184,6 +1204,8 @@ TEST_F(XMLParserTests, parseXMLTransportData)
         EXPECT_EQ(pSHMDesc->get_thread_config_for_port(12345), modified_thread_settings);
         EXPECT_EQ(pSHMDesc->get_thread_config_for_port(12346), modified_thread_settings);
         EXPECT_EQ(pSHMDesc->dump_thread(), modified_thread_settings);
+        EXPECT_TRUE(pSHMDesc->lock_free_segment_allocation());
+        EXPECT_EQ(pSHMDesc->listener_spin_budget_us(), 50u);
 
         xmlparser::XMLProfileManager::DeleteInstance();
     }
@@ -1212,7 +1234,9 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "sendBufferSize",
         "receiveBufferSize",
         "TTL",
+        "receive_buffer_pool_size",
         "non_blocking_send",
+        "unicast_sockets_per_port",
         "interfaceWhiteList",
         "output_port",
         "default_reception_threads",
@@ -1236,6 +1260,10 @@ TEST_F(XMLParserTests, parseXMLTransportData_NegativeClauses)
         "calculate_crc",
         "check_crc",
         "enable_tcp_nodelay",
+        "async_send",
+        "send_queue_max_bytes",
+        "send_queue_full_policy",
+        "send_queue_block_timeout_ms",
         "tls",
         "keep_alive_thread",
         "accept_thread",
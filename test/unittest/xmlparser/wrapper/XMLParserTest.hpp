@@ -393,6 +393,14 @@ public:
         return getXMLParticipantAllocationAttributes(elem, allocation, ident);
     }
 
+    static XMLP_ret getXMLThreadTopologyPolicy_wrapper(
+            tinyxml2::XMLElement* elem,
+            eprosima::fastdds::rtps::ThreadTopologyPolicy& policy,
+            uint8_t ident)
+    {
+        return getXMLThreadTopologyPolicy(elem, policy, ident);
+    }
+
     static XMLP_ret getXMLSendBuffersAllocationAttributes_wrapper(
             tinyxml2::XMLElement* elem,
             SendBuffersAllocationAttributes& allocation,
@@ -0,0 +1,264 @@
+// Copyright 2023 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file thread_layout.cpp
+ *
+ * Creates a participant with a given thread topology policy and prints the CPUs each of its threads may run on.
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <dirent.h>
+
+#include <optionparser.hpp>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
+
+namespace option = eprosima::option;
+
+using namespace eprosima::fastdds::dds;
+
+enum  optionIndex
+{
+    UNKNOWN,
+    HELP,
+    DOMAIN_ID,
+    XML_FILE,
+    NUMA_NODE,
+    ISOLATE_RECEIVE_CORES,
+    AUTO_SPREAD
+};
+
+struct Arg : public option::Arg
+{
+    static option::ArgStatus required(
+            const option::Option& option,
+            bool msg)
+    {
+        if (nullptr != option.arg)
+        {
+            return option::ARG_OK;
+        }
+
+        if (msg)
+        {
+            std::cout << "Option '" << option << "' requires an argument" << std::endl;
+        }
+        return option::ARG_ILLEGAL;
+    }
+
+    static option::ArgStatus number(
+            const option::Option& option,
+            bool msg)
+    {
+        if (nullptr != option.arg)
+        {
+            char* end = nullptr;
+            std::strtol(option.arg, &end, 10);
+            if (end != option.arg && '\0' == *end)
+            {
+                return option::ARG_OK;
+            }
+        }
+
+        if (msg)
+        {
+            std::cout << "Option '" << option << "' requires a numeric argument" << std::endl;
+        }
+        return option::ARG_ILLEGAL;
+    }
+
+};
+
+const option::Descriptor usage[] = {
+
+    { UNKNOWN,               0, "",  "",                      Arg::None,
+      "\neProsima thread layout tool\n"
+      "\nCreates a participant and prints the CPUs each thread of the process may run on.\n"
+      "\nUsage: fast-thread-layout [optional parameters] \nGeneral options:" },
+
+    { HELP,                  0, "h", "help",                  Arg::None,
+      "  -h  \t--help                  Produce help message.\n" },
+
+    { DOMAIN_ID,             0, "d", "domain",                Arg::number,
+      "  -d  \t--domain                Domain of the participant. Defaults to 0.\n" },
+
+    { XML_FILE,              0, "x", "xml-file",              Arg::required,
+      "  -x  \t--xml-file              Gets the participant configuration from XML file.\n"
+      "\t                        A profile can be selected with profile_name@file.\n" },
+
+    { NUMA_NODE,             0, "n", "numa-node",             Arg::number,
+      "  -n  \t--numa-node             Run the threads on the CPUs of a NUMA node.\n" },
+
+    { ISOLATE_RECEIVE_CORES, 0, "r", "isolate-receive-cores", Arg::None,
+      "  -r  \t--isolate-receive-cores Run reception threads on their own CPUs.\n" },
+
+    { AUTO_SPREAD,           0, "s", "auto-spread",           Arg::None,
+      "  -s  \t--auto-spread           Pin each reception thread to a different CPU.\n" },
+
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+//! Reads the value of a field of a status file of /proc
+static std::string status_field(
+        const std::string& status_file,
+        const std::string& field)
+{
+    std::ifstream status(status_file);
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (0 == line.compare(0, field.size(), field) && ':' == line[field.size()])
+        {
+            size_t start = line.find_first_not_of(" \t", field.size() + 1);
+            return std::string::npos == start ? std::string() : line.substr(start);
+        }
+    }
+    return std::string();
+}
+
+//! Prints the name and allowed CPUs of every thread of the process
+static void print_threads()
+{
+    std::vector<std::pair<std::string, std::string>> threads;
+
+    DIR* tasks = opendir("/proc/self/task");
+    if (nullptr == tasks)
+    {
+        std::cout << "Cannot read the threads of the process. Only Linux is supported." << std::endl;
+        return;
+    }
+
+    for (dirent* entry = readdir(tasks); nullptr != entry; entry = readdir(tasks))
+    {
+        if ('.' == entry->d_name[0])
+        {
+            continue;
+        }
+
+        std::string task = std::string("/proc/self/task/") + entry->d_name;
+        std::string name;
+        std::ifstream comm(task + "/comm");
+        std::getline(comm, name);
+        threads.emplace_back(name, status_field(task + "/status", "Cpus_allowed_list"));
+    }
+    closedir(tasks);
+
+    std::sort(threads.begin(), threads.end());
+    std::cout << std::left << std::setw(20) << "Thread" << "CPUs" << std::endl;
+    for (const auto& thread : threads)
+    {
+        std::cout << std::left << std::setw(20) << thread.first << thread.second << std::endl;
+    }
+}
+
+int main(
+        int argc,
+        char* argv[])
+{
+    // Skip program name argv[0] if present
+    argc -= (argc > 0);
+    argv += (argc > 0);
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    if (parse.error() || 0 < parse.nonOptionsCount())
+    {
+        option::printUsage(std::cout, usage);
+        return 1;
+    }
+
+    if (options[HELP])
+    {
+        option::printUsage(std::cout, usage);
+        return 0;
+    }
+
+    DomainParticipantFactory* factory = DomainParticipantFactory::get_instance();
+    DomainParticipantQos qos = PARTICIPANT_QOS_DEFAULT;
+    DomainId_t domain_id = 0;
+
+    if (nullptr != options[XML_FILE])
+    {
+        std::string xml_file = options[XML_FILE].arg;
+        std::string profile;
+        size_t delimiter_pos = xml_file.find('@');
+        if (std::string::npos != delimiter_pos)
+        {
+            profile = xml_file.substr(0, delimiter_pos);
+            xml_file = xml_file.substr(delimiter_pos + 1);
+        }
+
+        if (ReturnCode_t::RETCODE_OK != factory->load_XML_profiles_file(xml_file))
+        {
+            std::cout << "Cannot open XML file " << xml_file << std::endl;
+            return 1;
+        }
+
+        if (profile.empty())
+        {
+            factory->get_default_participant_qos(qos);
+        }
+        else if (ReturnCode_t::RETCODE_OK != factory->get_participant_qos_from_profile(profile, qos))
+        {
+            std::cout << "Cannot find participant profile " << profile << std::endl;
+            return 1;
+        }
+    }
+
+    if (nullptr != options[DOMAIN_ID])
+    {
+        domain_id = static_cast<DomainId_t>(std::strtol(options[DOMAIN_ID].arg, nullptr, 10));
+    }
+    if (nullptr != options[NUMA_NODE])
+    {
+        qos.thread_topology().numa_node = static_cast<int32_t>(std::strtol(options[NUMA_NODE].arg, nullptr, 10));
+    }
+    if (nullptr != options[ISOLATE_RECEIVE_CORES])
+    {
+        qos.thread_topology().isolate_receive_cores = true;
+    }
+    if (nullptr != options[AUTO_SPREAD])
+    {
+        qos.thread_topology().auto_spread = true;
+    }
+
+    DomainParticipant* participant = factory->create_participant(domain_id, qos);
+    if (nullptr == participant)
+    {
+        std::cout << "Cannot create the participant" << std::endl;
+        return 1;
+    }
+
+    // Let the threads of the participant start and apply their settings
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+    print_threads();
+
+    factory->delete_participant(participant);
+    return 0;
+}